@@ -75,6 +75,10 @@ void Config::load(json &config)
     if (config.contains("runKeccakScriptGenerator") && config["runKeccakScriptGenerator"].is_boolean())
         runKeccakScriptGenerator = config["runKeccakScriptGenerator"];
 
+    runRomImageGenerator = false;
+    if (config.contains("runRomImageGenerator") && config["runRomImageGenerator"].is_boolean())
+        runRomImageGenerator = config["runRomImageGenerator"];
+
     runKeccakTest = false;
     if (config.contains("runKeccakTest") && config["runKeccakTest"].is_boolean())
         runKeccakTest = config["runKeccakTest"];
@@ -99,6 +103,58 @@ void Config::load(json &config)
     if (config.contains("runBlakeTest") && config["runBlakeTest"].is_boolean())
         runBlakeTest = config["runBlakeTest"];
 
+    runZkinTest = false;
+    if (config.contains("runZkinTest") && config["runZkinTest"].is_boolean())
+        runZkinTest = config["runZkinTest"];
+
+    runPoseidonLanesTest = false;
+    if (config.contains("runPoseidonLanesTest") && config["runPoseidonLanesTest"].is_boolean())
+        runPoseidonLanesTest = config["runPoseidonLanesTest"];
+
+    runSmtBatchTest = false;
+    if (config.contains("runSmtBatchTest") && config["runSmtBatchTest"].is_boolean())
+        runSmtBatchTest = config["runSmtBatchTest"];
+
+    runPoseidonOptTest = false;
+    if (config.contains("runPoseidonOptTest") && config["runPoseidonOptTest"].is_boolean())
+        runPoseidonOptTest = config["runPoseidonOptTest"];
+
+    runFRIFoldTest = false;
+    if (config.contains("runFRIFoldTest") && config["runFRIFoldTest"].is_boolean())
+        runFRIFoldTest = config["runFRIFoldTest"];
+
+    runFRIProofTest = false;
+    if (config.contains("runFRIProofTest") && config["runFRIProofTest"].is_boolean())
+        runFRIProofTest = config["runFRIProofTest"];
+
+    runH1H2Test = false;
+    if (config.contains("runH1H2Test") && config["runH1H2Test"].is_boolean())
+        runH1H2Test = config["runH1H2Test"];
+
+    runCalculateZTest = false;
+    if (config.contains("runCalculateZTest") && config["runCalculateZTest"].is_boolean())
+        runCalculateZTest = config["runCalculateZTest"];
+
+    runLDEMerkleTest = false;
+    if (config.contains("runLDEMerkleTest") && config["runLDEMerkleTest"].is_boolean())
+        runLDEMerkleTest = config["runLDEMerkleTest"];
+
+    runChelpersJitTest = false;
+    if (config.contains("runChelpersJitTest") && config["runChelpersJitTest"].is_boolean())
+        runChelpersJitTest = config["runChelpersJitTest"];
+
+    runRomProgramTest = false;
+    if (config.contains("runRomProgramTest") && config["runRomProgramTest"].is_boolean())
+        runRomProgramTest = config["runRomProgramTest"];
+
+    runRomImageTest = false;
+    if (config.contains("runRomImageTest") && config["runRomImageTest"].is_boolean())
+        runRomImageTest = config["runRomImageTest"];
+
+    runLazyMainExecutorTest = false;
+    if (config.contains("runLazyMainExecutorTest") && config["runLazyMainExecutorTest"].is_boolean())
+        runLazyMainExecutorTest = config["runLazyMainExecutorTest"];
+
     useMainExecGenerated = false;
     if (config.contains("useMainExecGenerated") && config["useMainExecGenerated"].is_boolean())
         useMainExecGenerated = config["useMainExecGenerated"];
@@ -107,6 +163,10 @@ void Config::load(json &config)
     if (config.contains("executeInParallel") && config["executeInParallel"].is_boolean())
         executeInParallel = config["executeInParallel"];
 
+    mainExecutorIdleTimeout = 0;
+    if (config.contains("mainExecutorIdleTimeout") && config["mainExecutorIdleTimeout"].is_number())
+        mainExecutorIdleTimeout = config["mainExecutorIdleTimeout"];
+
     saveDbReadsToFile = false;
     if (config.contains("saveDbReadsToFile") && config["saveDbReadsToFile"].is_boolean())
         saveDbReadsToFile = config["saveDbReadsToFile"];
@@ -147,6 +207,18 @@ void Config::load(json &config)
     if (config.contains("loadDBToMemCacheInParallel") && config["loadDBToMemCacheInParallel"].is_boolean())
         loadDBToMemCacheInParallel = config["loadDBToMemCacheInParallel"];
 
+    loadDBToMemCacheBatchSize = 1000;
+    if (config.contains("loadDBToMemCacheBatchSize") && config["loadDBToMemCacheBatchSize"].is_number())
+        loadDBToMemCacheBatchSize = config["loadDBToMemCacheBatchSize"];
+
+    loadDBToMemCacheThreads = 8;
+    if (config.contains("loadDBToMemCacheThreads") && config["loadDBToMemCacheThreads"].is_number())
+        loadDBToMemCacheThreads = config["loadDBToMemCacheThreads"];
+
+    loadDBToMemCacheCheckpointFile = "";
+    if (config.contains("loadDBToMemCacheCheckpointFile") && config["loadDBToMemCacheCheckpointFile"].is_string())
+        loadDBToMemCacheCheckpointFile = config["loadDBToMemCacheCheckpointFile"];
+
     dbMTCacheSize = 4*1024;
     if (config.contains("dbMTCacheSize") && config["dbMTCacheSize"].is_number())
         dbMTCacheSize = config["dbMTCacheSize"];
@@ -175,6 +247,10 @@ void Config::load(json &config)
     if (config.contains("dontLoadRomOffsets") && config["dontLoadRomOffsets"].is_boolean())
         dontLoadRomOffsets = config["dontLoadRomOffsets"];
 
+    loadRomImages = true;
+    if (config.contains("loadRomImages") && config["loadRomImages"].is_boolean())
+        loadRomImages = config["loadRomImages"];
+
     executorServerPort = 50071;
     if (config.contains("executorServerPort") && config["executorServerPort"].is_number())
         executorServerPort = config["executorServerPort"];
@@ -318,6 +394,22 @@ void Config::load(json &config)
     if (config.contains("mapConstantsTreeFile") && config["mapConstantsTreeFile"].is_boolean())
         mapConstantsTreeFile = config["mapConstantsTreeFile"];
 
+    pipelineLdeAndMerkle = false;
+    if (config.contains("pipelineLdeAndMerkle") && config["pipelineLdeAndMerkle"].is_boolean())
+        pipelineLdeAndMerkle = config["pipelineLdeAndMerkle"];
+
+    chelpersJit = false;
+    if (config.contains("chelpersJit") && config["chelpersJit"].is_boolean())
+        chelpersJit = config["chelpersJit"];
+
+    chelpersAvx512 = true;
+    if (config.contains("chelpersAvx512") && config["chelpersAvx512"].is_boolean())
+        chelpersAvx512 = config["chelpersAvx512"];
+
+    stepsTileL2Size = 0;
+    if (config.contains("stepsTileL2Size") && config["stepsTileL2Size"].is_number())
+        stepsTileL2Size = config["stepsTileL2Size"];
+
     if (config.contains("finalVerkey") && config["finalVerkey"].is_string())
         finalVerkey = config["finalVerkey"];
 
@@ -429,6 +521,10 @@ void Config::load(json &config)
     if (config.contains("maxProverThreads") && config["maxProverThreads"].is_number())
         maxProverThreads = config["maxProverThreads"];
 
+    maxProverMemory = 0;
+    if (config.contains("maxProverMemory") && config["maxProverMemory"].is_number())
+        maxProverMemory = config["maxProverMemory"];
+
     maxStateDBThreads = 16;
     if (config.contains("maxStateDBThreads") && config["maxStateDBThreads"].is_number())
         maxStateDBThreads = config["maxStateDBThreads"];
@@ -476,6 +572,8 @@ void Config::print(void)
 
     if (runKeccakScriptGenerator)
         cout << "    runKeccakScriptGenerator=true" << endl;
+    if (runRomImageGenerator)
+        cout << "    runRomImageGenerator=true" << endl;
     if (runKeccakTest)
         cout << "    runKeccakTest=true" << endl;
     if (runStorageSMTest)
@@ -488,9 +586,37 @@ void Config::print(void)
         cout << "    runSHA256Test=true" << endl;
     if (runBlakeTest)
         cout << "    runBlakeTest=true" << endl;
+    if (runZkinTest)
+        cout << "    runZkinTest=true" << endl;
+    if (runPoseidonLanesTest)
+        cout << "    runPoseidonLanesTest=true" << endl;
+    if (runSmtBatchTest)
+        cout << "    runSmtBatchTest=true" << endl;
+    if (runPoseidonOptTest)
+        cout << "    runPoseidonOptTest=true" << endl;
+    if (runFRIFoldTest)
+        cout << "    runFRIFoldTest=true" << endl;
+    if (runFRIProofTest)
+        cout << "    runFRIProofTest=true" << endl;
+    if (runH1H2Test)
+        cout << "    runH1H2Test=true" << endl;
+    if (runCalculateZTest)
+        cout << "    runCalculateZTest=true" << endl;
+    if (runLDEMerkleTest)
+        cout << "    runLDEMerkleTest=true" << endl;
+    if (runChelpersJitTest)
+        cout << "    runChelpersJitTest=true" << endl;
+    if (runRomProgramTest)
+        cout << "    runRomProgramTest=true" << endl;
+    if (runRomImageTest)
+        cout << "    runRomImageTest=true" << endl;
+    if (runLazyMainExecutorTest)
+        cout << "    runLazyMainExecutorTest=true" << endl;
 
     if (executeInParallel)
         cout << "    executeInParallel=true" << endl;
+    if (mainExecutorIdleTimeout > 0)
+        cout << "    mainExecutorIdleTimeout=" << mainExecutorIdleTimeout << endl;
     if (useMainExecGenerated)
         cout << "    useMainExecGenerated=true" << endl;
 
@@ -528,6 +654,8 @@ void Config::print(void)
         cout << "    logExecutorServerTxs=true" << endl;
     if (dontLoadRomOffsets)
         cout << "    dontLoadRomOffsets=true" << endl;
+    if (loadRomImages)
+        cout << "    loadRomImages=true" << endl;
 
     cout << "    executorServerPort=" << to_string(executorServerPort) << endl;
     cout << "    executorClientPort=" << to_string(executorClientPort) << endl;
@@ -555,6 +683,16 @@ void Config::print(void)
     cout << "    c12aConstantsTree=" << c12aConstantsTree << endl;
     if (mapConstantsTreeFile)
         cout << "    mapConstantsTreeFile=true" << endl;
+    if (pipelineLdeAndMerkle)
+        cout << "    pipelineLdeAndMerkle=true" << endl;
+    if (chelpersJit)
+    {
+        cout << "    chelpersJit=true" << endl;
+    }
+    if (!chelpersAvx512)
+        cout << "    chelpersAvx512=false" << endl;
+    if (stepsTileL2Size > 0)
+        cout << "    stepsTileL2Size=" << stepsTileL2Size << endl;
     cout << "    finalVerkey=" << finalVerkey << endl;
     cout << "    zkevmVerifier=" << zkevmVerifier << endl;
     cout << "    recursive1Verifier=" << recursive1Verifier << endl;
@@ -582,7 +720,11 @@ void Config::print(void)
     cout << "    requestsPersistence=" << requestsPersistence << endl;
     cout << "    maxExecutorThreads=" << maxExecutorThreads << endl;
     cout << "    maxProverThreads=" << maxProverThreads << endl;
+    cout << "    maxProverMemory=" << maxProverMemory << endl;
     cout << "    maxStateDBThreads=" << maxStateDBThreads << endl;
+    cout << "    loadDBToMemCacheBatchSize=" << loadDBToMemCacheBatchSize << endl;
+    cout << "    loadDBToMemCacheThreads=" << loadDBToMemCacheThreads << endl;
+    cout << "    loadDBToMemCacheCheckpointFile=" << loadDBToMemCacheCheckpointFile << endl;
     cout << "    dbMTCacheSize=" << dbMTCacheSize << endl;
     cout << "    dbProgramCacheSize=" << dbProgramCacheSize << endl;
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 #define CONFIG_HPP
 
 #include <string>
+#include <vector>
 #include <iostream>
 #include <nlohmann/json.hpp>
 #include "definitions.hpp"
@@ -31,14 +32,29 @@ public:
     bool runFileExecute;                    // Executor (all SMs)
 
     bool runKeccakScriptGenerator;
+    bool runRomImageGenerator;              // Generates the binary images of the ROMs and of the Keccak-F script
     bool runKeccakTest;
     bool runStorageSMTest;
     bool runBinarySMTest;
     bool runMemAlignSMTest;
     bool runSHA256Test;
     bool runBlakeTest;
+    bool runZkinTest;
+    bool runPoseidonLanesTest;
+    bool runSmtBatchTest;
+    bool runPoseidonOptTest;
+    bool runFRIFoldTest;
+    bool runFRIProofTest;
+    bool runH1H2Test;
+    bool runCalculateZTest;
+    bool runLDEMerkleTest;
+    bool runChelpersJitTest;
+    bool runRomProgramTest;
+    bool runRomImageTest;
+    bool runLazyMainExecutorTest;
     
     bool executeInParallel;
+    uint64_t mainExecutorIdleTimeout; // Seconds after which the idle main executor of a fork other than the requested one is destroyed; 0 means never
     bool useMainExecGenerated;
 
     bool saveRequestToFile; // Saves the grpc service request, in text format
@@ -50,8 +66,11 @@ public:
     bool saveResponseToFile; // Saves the grpc service response, in text format
     bool saveFilesInSubfolders; // Saves output files in folders per hour, e.g. output/2023/01/10/18
 
-    bool loadDBToMemCache;
+    bool loadDBToMemCache; // Loads the DB into the MT cache at start-up; resumes after a restart if loadDBToMemCacheCheckpointFile is set
     bool loadDBToMemCacheInParallel;
+    uint64_t loadDBToMemCacheBatchSize; // Number of nodes read per database query while loading the DB to the cache
+    uint64_t loadDBToMemCacheThreads; // Number of database queries in flight while loading the DB to the cache
+    string loadDBToMemCacheCheckpointFile; // If not empty, the load into the MT cache saves its progress in this file and <file>.nodes, so that a restarted process on the same state root continues it
     int64_t dbMTCacheSize; // Size in MBytes for the cache to store MT records
     int64_t dbProgramCacheSize; // Size in MBytes for the cache to store Program (SC) records
     bool opcodeTracer;
@@ -59,6 +78,7 @@ public:
     bool logExecutorServerResponses;
     bool logExecutorServerTxs;
     bool dontLoadRomOffsets;
+    bool loadRomImages; // Loads the ROMs and the Keccak-F script from their binary images, if present and valid, instead of parsing their JSON files
 
     uint16_t executorServerPort;
     bool executorROMLineTraces;
@@ -95,6 +115,10 @@ public:
     string recursive2ConstantsTree;
     string recursivefConstantsTree;
     bool mapConstantsTreeFile;
+    bool pipelineLdeAndMerkle; // Hashes the Merkle tree leaves of every stage while computing its low degree extension
+    bool chelpersJit; // Runs the zkevm chelpers steps with the straight-line kernels generated at build time, instead of interpreting their ops
+    bool chelpersAvx512; // Runs the zkevm chelpers parsers and kernels widened to AVX-512 on the CPUs that support it, loaded from their library next to the executable
+    uint64_t stepsTileL2Size; // L2 cache bytes per core used to compute steps 4 and 5 in tiles of rows, copied into a scratch buffer per thread; 0 disables the tiles. Only applies to the chelpers parsers, not to the chelpers JIT kernels
     string finalVerkey;
     string zkevmVerifier;
     string recursive1Verifier;
@@ -129,6 +153,7 @@ public:
     uint64_t requestsPersistence;
     uint64_t maxExecutorThreads;
     uint64_t maxProverThreads;
+    uint64_t maxProverMemory; // Memory budget in MBytes for prover requests computed concurrently; 0 means no limit
     uint64_t maxStateDBThreads;
     string proverName;
     void load(json &config);
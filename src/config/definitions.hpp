@@ -43,6 +43,7 @@
 //#define LOG_STORAGE_EXECUTOR_ROM_LINE
 //#define LOG_MEMORY_EXECUTOR
 //#define LOG_BINARY_EXECUTOR
+//#define LOG_ARITH_EXECUTOR
 //#define LOG_HASHK
 //#define LOG_DB_READ
 //#define LOG_DB_WRITE
@@ -57,7 +58,6 @@
 //#define PROVER_INJECT_ZKIN_JSON
 
 /* State DB*/
-//#define STATEDB_LOCK // If defined, the StateDB class will use a lock in all its methods, i.e. they will be serialized
 //#define DATABASE_COMMIT // If defined, the Database class can be configured to autocommit, or explicitly commit(); used for testing only
 #define DATABASE_USE_CACHE // If defined, the Database class uses a cache
 
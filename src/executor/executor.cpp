@@ -15,14 +15,18 @@
 // Reduced version: only 1 evaluation is allocated, and some asserts are disabled
 void Executor::process_batch (ProverRequest &proverRequest)
 {
+    evictIdleMainExecutors(proverRequest.input.publicInputsExtended.publicInputs.forkID);
+
     // Execute the Main State Machine
     switch (proverRequest.input.publicInputsExtended.publicInputs.forkID)
     {
         case 0: // fork_0
         {
+            LazyMainExecutor<fork_0::MainExecutor>::Guard guard(mainExecutor_fork_0);
+            fork_0::MainExecutor &mainExecutor = guard.mainExecutor;
             if (config.useMainExecGenerated)
             {
-                fork_0::main_exec_generated_fast(mainExecutor_fork_0, proverRequest);
+                fork_0::main_exec_generated_fast(mainExecutor, proverRequest);
             }
             else
             {
@@ -38,7 +42,7 @@ void Executor::process_batch (ProverRequest &proverRequest)
                 // This instance will store all data required to execute the rest of State Machines
                 fork_0::MainExecRequired required;
 
-                mainExecutor_fork_0.execute(proverRequest, commitPols.Main, required);
+                mainExecutor.execute(proverRequest, commitPols.Main, required);
 
                 // Free committed polynomials address space
                 free(pAddress);
@@ -47,9 +51,11 @@ void Executor::process_batch (ProverRequest &proverRequest)
         }
         case 1: // fork_1
         {
+            LazyMainExecutor<fork_1::MainExecutor>::Guard guard(mainExecutor_fork_1);
+            fork_1::MainExecutor &mainExecutor = guard.mainExecutor;
             if (config.useMainExecGenerated)
             {
-                fork_1::main_exec_generated_fast(mainExecutor_fork_1, proverRequest);
+                fork_1::main_exec_generated_fast(mainExecutor, proverRequest);
             }
             else
             {
@@ -65,7 +71,7 @@ void Executor::process_batch (ProverRequest &proverRequest)
                 // This instance will store all data required to execute the rest of State Machines
                 fork_1::MainExecRequired required;
 
-                mainExecutor_fork_1.execute(proverRequest, commitPols.Main, required);
+                mainExecutor.execute(proverRequest, commitPols.Main, required);
 
                 // Free committed polynomials address space
                 free(pAddress);
@@ -74,9 +80,11 @@ void Executor::process_batch (ProverRequest &proverRequest)
         }
         case 2: // fork_2
         {
+            LazyMainExecutor<fork_2::MainExecutor>::Guard guard(mainExecutor_fork_2);
+            fork_2::MainExecutor &mainExecutor = guard.mainExecutor;
             if (config.useMainExecGenerated)
             {
-                fork_2::main_exec_generated_fast(mainExecutor_fork_2, proverRequest);
+                fork_2::main_exec_generated_fast(mainExecutor, proverRequest);
             }
             else
             {
@@ -92,7 +100,7 @@ void Executor::process_batch (ProverRequest &proverRequest)
                 // This instance will store all data required to execute the rest of State Machines
                 fork_2::MainExecRequired required;
 
-                mainExecutor_fork_2.execute(proverRequest, commitPols.Main, required);
+                mainExecutor.execute(proverRequest, commitPols.Main, required);
 
                 // Free committed polynomials address space
                 free(pAddress);
@@ -101,9 +109,11 @@ void Executor::process_batch (ProverRequest &proverRequest)
         }
         case 3: // fork_3
         {
+            LazyMainExecutor<fork_3::MainExecutor>::Guard guard(mainExecutor_fork_3);
+            fork_3::MainExecutor &mainExecutor = guard.mainExecutor;
             if (config.useMainExecGenerated)
             {
-                fork_3::main_exec_generated_fast(mainExecutor_fork_3, proverRequest);
+                fork_3::main_exec_generated_fast(mainExecutor, proverRequest);
             }
             else
             {
@@ -119,7 +129,7 @@ void Executor::process_batch (ProverRequest &proverRequest)
                 // This instance will store all data required to execute the rest of State Machines
                 fork_3::MainExecRequired required;
 
-                mainExecutor_fork_3.execute(proverRequest, commitPols.Main, required);
+                mainExecutor.execute(proverRequest, commitPols.Main, required);
 
                 // Free committed polynomials address space
                 free(pAddress);
@@ -128,9 +138,11 @@ void Executor::process_batch (ProverRequest &proverRequest)
         }
         case 4: // fork_4
         {
+            LazyMainExecutor<fork_4::MainExecutor>::Guard guard(mainExecutor_fork_4);
+            fork_4::MainExecutor &mainExecutor = guard.mainExecutor;
             if (config.useMainExecGenerated)
             {
-                fork_4::main_exec_generated_fast(mainExecutor_fork_4, proverRequest);
+                fork_4::main_exec_generated_fast(mainExecutor, proverRequest);
             }
             else
             {
@@ -146,7 +158,7 @@ void Executor::process_batch (ProverRequest &proverRequest)
                 // This instance will store all data required to execute the rest of State Machines
                 fork_4::MainExecRequired required;
 
-                mainExecutor_fork_4.execute(proverRequest, commitPols.Main, required);
+                mainExecutor.execute(proverRequest, commitPols.Main, required);
 
                 // Free committed polynomials address space
                 free(pAddress);
@@ -162,6 +174,18 @@ void Executor::process_batch (ProverRequest &proverRequest)
     }
 }
 
+void Executor::evictIdleMainExecutors (uint64_t forkID)
+{
+    if (config.mainExecutorIdleTimeout == 0)
+    {
+        return;
+    }
+    if (forkID != 0) mainExecutor_fork_0.evictIfIdle(config.mainExecutorIdleTimeout);
+    if (forkID != 1) mainExecutor_fork_1.evictIfIdle(config.mainExecutorIdleTimeout);
+    if (forkID != 2) mainExecutor_fork_2.evictIfIdle(config.mainExecutorIdleTimeout);
+    if (forkID != 3) mainExecutor_fork_3.evictIfIdle(config.mainExecutorIdleTimeout);
+}
+
 class ExecutorContext
 {
 public:
@@ -276,6 +300,8 @@ void* KeccakThread (void* arg)
 // Full version: all polynomials are evaluated, in all evaluations
 void Executor::execute (ProverRequest &proverRequest, PROVER_FORK_NAMESPACE::CommitPols & commitPols)
 {
+    evictIdleMainExecutors(PROVER_FORK_ID);
+
     if (!config.executeInParallel)
     {
         // This instance will store all data required to execute the rest of State Machines
@@ -285,13 +311,14 @@ void Executor::execute (ProverRequest &proverRequest, PROVER_FORK_NAMESPACE::Com
         TimerStart(MAIN_EXECUTOR_EXECUTE);
         if (proverRequest.input.publicInputsExtended.publicInputs.forkID == PROVER_FORK_ID)
         {
+            LazyMainExecutor<PROVER_FORK_NAMESPACE::MainExecutor>::Guard guard(mainExecutor_fork_4);
             if (config.useMainExecGenerated)
             {
-                PROVER_FORK_NAMESPACE::main_exec_generated(mainExecutor_fork_4, proverRequest, commitPols.Main, required);
+                PROVER_FORK_NAMESPACE::main_exec_generated(guard.mainExecutor, proverRequest, commitPols.Main, required);
             }
             else
             {
-                mainExecutor_fork_4.execute(proverRequest, commitPols.Main, required);
+                guard.mainExecutor.execute(proverRequest, commitPols.Main, required);
             }
             
             // Save input to <timestamp>.input.json after execution including dbReadLog
@@ -307,6 +334,7 @@ void Executor::execute (ProverRequest &proverRequest, PROVER_FORK_NAMESPACE::Com
             cerr << "Error: Executor::execute() got invalid fork ID=" << proverRequest.input.publicInputsExtended.publicInputs.forkID << endl;
             proverRequest.result = ZKR_SM_MAIN_INVALID_FORK_ID;
         }
+        required.close();
         TimerStopAndLog(MAIN_EXECUTOR_EXECUTE);
 
         if (proverRequest.result != ZKR_SUCCESS)
@@ -378,16 +406,31 @@ void Executor::execute (ProverRequest &proverRequest, PROVER_FORK_NAMESPACE::Com
         executorContext.pCommitPols = &commitPols;
         executorContext.pRequired = &required;
 
+        // Execute the Arith, Binary and Mem Align State Machines, in parallel, consuming their actions
+        // while the Main State Machine is still generating them
+        pthread_t arithThread;
+        pthread_create(&arithThread, NULL, ArithThread, &executorContext);
+        pthread_t binaryThread;
+        pthread_create(&binaryThread, NULL, BinaryThread, &executorContext);
+        pthread_t memAlignThread;
+        pthread_create(&memAlignThread, NULL, MemAlignThread, &executorContext);
+
         // Execute the Main State Machine
         TimerStart(MAIN_EXECUTOR_EXECUTE);
-        if (config.useMainExecGenerated)
-        {
-            PROVER_FORK_NAMESPACE::main_exec_generated(mainExecutor_fork_4, proverRequest, commitPols.Main, required);
-        }
-        else
         {
-            mainExecutor_fork_4.execute(proverRequest, commitPols.Main, required);
+            LazyMainExecutor<PROVER_FORK_NAMESPACE::MainExecutor>::Guard guard(mainExecutor_fork_4);
+            if (config.useMainExecGenerated)
+            {
+                PROVER_FORK_NAMESPACE::main_exec_generated(guard.mainExecutor, proverRequest, commitPols.Main, required);
+            }
+            else
+            {
+                guard.mainExecutor.execute(proverRequest, commitPols.Main, required);
+            }
         }
+
+        // Let the streaming State Machines know that no more actions will be generated
+        required.close();
             
         // Save input to <timestamp>.input.json after execution including dbReadLog
         if (config.saveDbReadsToFile)
@@ -402,24 +445,15 @@ void Executor::execute (ProverRequest &proverRequest, PROVER_FORK_NAMESPACE::Com
         if (proverRequest.result != ZKR_SUCCESS)
         {
             cerr << "Error: Executor::execute() got from main execution proverRequest.result=" << proverRequest.result << "=" << zkresult2string(proverRequest.result) << endl;
+            pthread_join(arithThread, NULL);
+            pthread_join(binaryThread, NULL);
+            pthread_join(memAlignThread, NULL);
             return;
         }
 
         // Execute the Padding PG, Storage and Poseidon G State Machines
         pthread_t poseidonThread;
         pthread_create(&poseidonThread, NULL, PoseidonThread, &executorContext);
-
-        // Execute the Arith State Machine, in parallel
-        pthread_t arithThread;
-        pthread_create(&arithThread, NULL, ArithThread, &executorContext);
-
-        // Execute the Binary State Machine, in parallel
-        pthread_t binaryThread;
-        pthread_create(&binaryThread, NULL, BinaryThread, &executorContext);
-
-        // Execute the Mem Align State Machine, in parallel
-        pthread_t memAlignThread;
-        pthread_create(&memAlignThread, NULL, MemAlignThread, &executorContext);
         
         // Execute the Memory State Machine, in parallel
         pthread_t memoryThread;
@@ -20,6 +20,7 @@
 #include "sm/poseidon_g/poseidon_g_executor.hpp"
 #include "sm/mem_align/mem_align_executor.hpp"
 #include "prover_request.hpp"
+#include "executor/lazy_main_executor.hpp"
 
 class Executor
 {
@@ -27,11 +28,11 @@ public:
     Goldilocks &fr;
     const Config &config;
     
-    fork_0::MainExecutor mainExecutor_fork_0;
-    fork_1::MainExecutor mainExecutor_fork_1;
-    fork_2::MainExecutor mainExecutor_fork_2;
-    fork_3::MainExecutor mainExecutor_fork_3;
-    fork_4::MainExecutor mainExecutor_fork_4;
+    LazyMainExecutor<fork_0::MainExecutor> mainExecutor_fork_0;
+    LazyMainExecutor<fork_1::MainExecutor> mainExecutor_fork_1;
+    LazyMainExecutor<fork_2::MainExecutor> mainExecutor_fork_2;
+    LazyMainExecutor<fork_3::MainExecutor> mainExecutor_fork_3;
+    LazyMainExecutor<fork_4::MainExecutor> mainExecutor_fork_4;
     StorageExecutor storageExecutor;
     MemoryExecutor memoryExecutor;
     BinaryExecutor binaryExecutor;
@@ -47,11 +48,11 @@ public:
     Executor(Goldilocks &fr, const Config &config, PoseidonGoldilocks &poseidon) :
         fr(fr),
         config(config),
-        mainExecutor_fork_0(fr, poseidon, config),
-        mainExecutor_fork_1(fr, poseidon, config),
-        mainExecutor_fork_2(fr, poseidon, config),
-        mainExecutor_fork_3(fr, poseidon, config),
-        mainExecutor_fork_4(fr, poseidon, config),
+        mainExecutor_fork_0(fr, poseidon, config, "fork_0"),
+        mainExecutor_fork_1(fr, poseidon, config, "fork_1"),
+        mainExecutor_fork_2(fr, poseidon, config, "fork_2"),
+        mainExecutor_fork_3(fr, poseidon, config, "fork_3"),
+        mainExecutor_fork_4(fr, poseidon, config, "fork_4"),
         storageExecutor(fr, poseidon, config),
         memoryExecutor(fr, config),
         binaryExecutor(fr, config),
@@ -63,13 +64,21 @@ public:
         paddingPGExecutor(fr, poseidon),
         poseidonGExecutor(fr, poseidon),
         memAlignExecutor(fr, config)
-        {};
+    {
+        // The main executor of the prover fork ID is created at start-up and never evicted, so that an
+        // invalid ROM path fails here rather than on the first request
+        mainExecutor_fork_4.create();
+    };
 
     // Full version: all polynomials are evaluated, in all evaluations
     void execute (ProverRequest &proverRequest, PROVER_FORK_NAMESPACE::CommitPols & commitPols);
 
     // Reduced version: only 2 evaluations are allocated, and assert is disabled
     void process_batch (ProverRequest &proverRequest);
+
+    // Destroys the main executors of the forks other than forkID and PROVER_FORK_ID that have been idle
+    // for config.mainExecutorIdleTimeout seconds, if not zero
+    void evictIdleMainExecutors (uint64_t forkID);
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,112 @@
+#ifndef LAZY_MAIN_EXECUTOR_HPP
+#define LAZY_MAIN_EXECUTOR_HPP
+
+#include <string>
+#include <iostream>
+#include <pthread.h>
+#include <time.h>
+#include "config.hpp"
+#include "goldilocks_base_field.hpp"
+#include "poseidon_goldilocks.hpp"
+#include "zkassert.hpp"
+
+using namespace std;
+
+/* Main executor of a fork, created on first use, since most deployments only receive requests of the
+   latest fork ID, and destroyed by evictIfIdle() once it has not been used for a while.
+   Every use of the main executor must hold a Guard, so that it is never destroyed while in use; all
+   threads share the same instance, and therefore the same ROM */
+template <class MainExecutorType>
+class LazyMainExecutor
+{
+    Goldilocks &fr;
+    PoseidonGoldilocks &poseidon;
+    const Config &config;
+    const string name;
+    pthread_mutex_t mutex; // Mutex to protect pMainExecutor, users and lastUse
+    MainExecutorType * pMainExecutor;
+    uint64_t users; // Number of acquire() calls not released yet
+    time_t lastUse; // Time of the last release()
+
+    // Only used by Guard
+    MainExecutorType & acquire (void)
+    {
+        pthread_mutex_lock(&mutex);
+
+        // Created while holding the lock, so that concurrent requests of the same fork wait for one instance
+        if (pMainExecutor == NULL)
+        {
+            cout << "LazyMainExecutor::acquire() creating the main executor of " << name << endl;
+            pMainExecutor = new MainExecutorType(fr, poseidon, config);
+        }
+        users++;
+        MainExecutorType &mainExecutor = *pMainExecutor;
+
+        pthread_mutex_unlock(&mutex);
+        return mainExecutor;
+    };
+
+    void release (void)
+    {
+        pthread_mutex_lock(&mutex);
+        zkassert(users > 0);
+        users--;
+        lastUse = time(NULL);
+        pthread_mutex_unlock(&mutex);
+    };
+
+public:
+    LazyMainExecutor (Goldilocks &fr, PoseidonGoldilocks &poseidon, const Config &config, const string &name) :
+        fr(fr),
+        poseidon(poseidon),
+        config(config),
+        name(name),
+        pMainExecutor(NULL),
+        users(0),
+        lastUse(0)
+    {
+        pthread_mutex_init(&mutex, NULL);
+    };
+
+    ~LazyMainExecutor ()
+    {
+        if (pMainExecutor != NULL)
+        {
+            delete pMainExecutor;
+        }
+        pthread_mutex_destroy(&mutex);
+    };
+
+    /* Creates the main executor now, e.g. at start-up, so that an invalid ROM fails before the first request */
+    void create (void)
+    {
+        Guard guard(*this);
+    };
+
+    /* Acquires the main executor, creating it if needed, and releases it when the guard goes out of scope */
+    class Guard
+    {
+        LazyMainExecutor &lazyMainExecutor;
+    public:
+        MainExecutorType &mainExecutor;
+        Guard (LazyMainExecutor &lazyMainExecutor) : lazyMainExecutor(lazyMainExecutor), mainExecutor(lazyMainExecutor.acquire()) {};
+        ~Guard () { lazyMainExecutor.release(); };
+        Guard (const Guard &) = delete;
+        Guard & operator= (const Guard &) = delete;
+    };
+
+    /* Destroys the main executor if it is not in use and has not been used for idleSeconds */
+    void evictIfIdle (uint64_t idleSeconds)
+    {
+        pthread_mutex_lock(&mutex);
+        if ((pMainExecutor != NULL) && (users == 0) && ((uint64_t)(time(NULL) - lastUse) >= idleSeconds))
+        {
+            cout << "LazyMainExecutor::evictIfIdle() destroying the main executor of " << name << ", idle for " << (time(NULL) - lastUse) << " s" << endl;
+            delete pMainExecutor;
+            pMainExecutor = NULL;
+        }
+        pthread_mutex_unlock(&mutex);
+    };
+};
+
+#endif
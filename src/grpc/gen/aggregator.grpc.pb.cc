@@ -1,80 +0,0 @@
-// Generated by the gRPC C++ plugin.
-// If you make any local change, they will be lost.
-// source: aggregator.proto
-
-#include "aggregator.pb.h"
-#include "aggregator.grpc.pb.h"
-
-#include <functional>
-#include <grpcpp/impl/codegen/async_stream.h>
-#include <grpcpp/impl/codegen/async_unary_call.h>
-#include <grpcpp/impl/codegen/channel_interface.h>
-#include <grpcpp/impl/codegen/client_unary_call.h>
-#include <grpcpp/impl/codegen/client_callback.h>
-#include <grpcpp/impl/codegen/message_allocator.h>
-#include <grpcpp/impl/codegen/method_handler.h>
-#include <grpcpp/impl/codegen/rpc_service_method.h>
-#include <grpcpp/impl/codegen/server_callback.h>
-#include <grpcpp/impl/codegen/server_callback_handlers.h>
-#include <grpcpp/impl/codegen/server_context.h>
-#include <grpcpp/impl/codegen/service_type.h>
-#include <grpcpp/impl/codegen/sync_stream.h>
-namespace aggregator {
-namespace v1 {
-
-static const char* AggregatorService_method_names[] = {
-  "/aggregator.v1.AggregatorService/Channel",
-};
-
-std::unique_ptr< AggregatorService::Stub> AggregatorService::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
-  (void)options;
-  std::unique_ptr< AggregatorService::Stub> stub(new AggregatorService::Stub(channel));
-  return stub;
-}
-
-AggregatorService::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel)
-  : channel_(channel), rpcmethod_Channel_(AggregatorService_method_names[0], ::grpc::internal::RpcMethod::BIDI_STREAMING, channel)
-  {}
-
-::grpc::ClientReaderWriter< ::aggregator::v1::ProverMessage, ::aggregator::v1::AggregatorMessage>* AggregatorService::Stub::ChannelRaw(::grpc::ClientContext* context) {
-  return ::grpc_impl::internal::ClientReaderWriterFactory< ::aggregator::v1::ProverMessage, ::aggregator::v1::AggregatorMessage>::Create(channel_.get(), rpcmethod_Channel_, context);
-}
-
-void AggregatorService::Stub::experimental_async::Channel(::grpc::ClientContext* context, ::grpc::experimental::ClientBidiReactor< ::aggregator::v1::ProverMessage,::aggregator::v1::AggregatorMessage>* reactor) {
-  ::grpc_impl::internal::ClientCallbackReaderWriterFactory< ::aggregator::v1::ProverMessage,::aggregator::v1::AggregatorMessage>::Create(stub_->channel_.get(), stub_->rpcmethod_Channel_, context, reactor);
-}
-
-::grpc::ClientAsyncReaderWriter< ::aggregator::v1::ProverMessage, ::aggregator::v1::AggregatorMessage>* AggregatorService::Stub::AsyncChannelRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
-  return ::grpc_impl::internal::ClientAsyncReaderWriterFactory< ::aggregator::v1::ProverMessage, ::aggregator::v1::AggregatorMessage>::Create(channel_.get(), cq, rpcmethod_Channel_, context, true, tag);
-}
-
-::grpc::ClientAsyncReaderWriter< ::aggregator::v1::ProverMessage, ::aggregator::v1::AggregatorMessage>* AggregatorService::Stub::PrepareAsyncChannelRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
-  return ::grpc_impl::internal::ClientAsyncReaderWriterFactory< ::aggregator::v1::ProverMessage, ::aggregator::v1::AggregatorMessage>::Create(channel_.get(), cq, rpcmethod_Channel_, context, false, nullptr);
-}
-
-AggregatorService::Service::Service() {
-  AddMethod(new ::grpc::internal::RpcServiceMethod(
-      AggregatorService_method_names[0],
-      ::grpc::internal::RpcMethod::BIDI_STREAMING,
-      new ::grpc::internal::BidiStreamingHandler< AggregatorService::Service, ::aggregator::v1::ProverMessage, ::aggregator::v1::AggregatorMessage>(
-          [](AggregatorService::Service* service,
-             ::grpc_impl::ServerContext* ctx,
-             ::grpc_impl::ServerReaderWriter<::aggregator::v1::AggregatorMessage,
-             ::aggregator::v1::ProverMessage>* stream) {
-               return service->Channel(ctx, stream);
-             }, this)));
-}
-
-AggregatorService::Service::~Service() {
-}
-
-::grpc::Status AggregatorService::Service::Channel(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::aggregator::v1::AggregatorMessage, ::aggregator::v1::ProverMessage>* stream) {
-  (void) context;
-  (void) stream;
-  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-}
-
-
-}  // namespace aggregator
-}  // namespace v1
-
@@ -10,6 +10,7 @@
 #include "config.hpp"
 #include "version.hpp"
 #include "proof2zkin.hpp"
+#include "proof2zkinStark.hpp"
 #include "calcwit.hpp"
 #include "circom.hpp"
 #include "main.hpp"
@@ -21,6 +22,7 @@
 #include "service/aggregator/aggregator_client_mock.hpp"
 #include "sm/keccak_f/keccak.hpp"
 #include "sm/keccak_f/keccak_executor_test.hpp"
+#include "rom_image/rom_image_generator.hpp"
 #include "sm/storage/storage_executor.hpp"
 #include "sm/storage/storage_test.hpp"
 #include "sm/binary/binary_test.hpp"
@@ -31,6 +33,19 @@
 #include "service/statedb/statedb.hpp"
 #include "sha256_test.hpp"
 #include "blake_test.hpp"
+#include "starkpil/zkin_test.hpp"
+#include "starkpil/poseidon_lanes_test.hpp"
+#include "service/statedb/smt_batch_test.hpp"
+#include "starkpil/poseidon_opt_test.hpp"
+#include "starkpil/fri_fold_test.hpp"
+#include "starkpil/fri_proof_test.hpp"
+#include "starkpil/h1h2_test.hpp"
+#include "starkpil/calculate_z_test.hpp"
+#include "starkpil/lde_merkle_test.hpp"
+#include "starkpil/chelpers_jit_test.hpp"
+#include "main_sm/rom_program_test.hpp"
+#include "main_sm/rom_image_test.hpp"
+#include "executor/lazy_main_executor_test.hpp"
 #include "goldilocks_precomputed.hpp"
 
 using namespace std;
@@ -94,6 +109,35 @@ void runFileGenBatchProof(Goldilocks fr, Prover &prover, Config &config)
     prover.genBatchProof(&proverRequest);
 }
 
+// Loads an aggregated proof input, either a zkin or a batch or aggregated proof saved in binary format,
+// which is mapped and converted to a zkin without going through JSON
+void file2aggregatedProofInput(const Config &config, const string &fileName, Zkin &zkin)
+{
+    if (!FRIProof::isBinaryFile(fileName))
+    {
+        file2zkin(fileName, zkin);
+        return;
+    }
+    FRIProof *pProof = file2proof(fileName);
+    if (pProof == NULL)
+    {
+        cerr << "Error: file2aggregatedProofInput() failed loading binary proof file " << fileName << endl;
+        exitProcess();
+    }
+
+    // A batch proof is a recursive1 proof, and an aggregated proof a recursive2 one
+    StarkInfo starkInfoRecursive1(config, config.recursive1StarkInfo);
+    StarkInfo starkInfoRecursive2(config, config.recursive2StarkInfo);
+    if (!checkProofShape(*pProof, starkInfoRecursive1.starkStruct.steps.size()) && !checkProofShape(*pProof, starkInfoRecursive2.starkStruct.steps.size()))
+    {
+        cerr << "Error: file2aggregatedProofInput() found a proof that is not a recursive1 or recursive2 proof in file " << fileName << endl;
+        exitProcess();
+    }
+    proof2zkinStark(*pProof, zkin);
+    zkin.add("publics", {pProof->publics.size()}, pProof->publics.data());
+    delete pProof;
+}
+
 void runFileGenAggregatedProof(Goldilocks fr, Prover &prover, Config &config)
 {
     // Load and parse input JSON file
@@ -102,11 +146,11 @@ void runFileGenAggregatedProof(Goldilocks fr, Prover &prover, Config &config)
     ProverRequest proverRequest(fr, config, prt_genAggregatedProof);
     if (config.inputFile.size() > 0)
     {
-        file2json(config.inputFile, proverRequest.aggregatedProofInput1);
+        file2aggregatedProofInput(config, config.inputFile, proverRequest.aggregatedProofInput1);
     }
     if (config.inputFile2.size() > 0)
     {
-        file2json(config.inputFile2, proverRequest.aggregatedProofInput2);
+        file2aggregatedProofInput(config, config.inputFile2, proverRequest.aggregatedProofInput2);
     }
     TimerStopAndLog(INPUT_LOAD);
 
@@ -122,7 +166,7 @@ void runFileGenFinalProof(Goldilocks fr, Prover &prover, Config &config)
     ProverRequest proverRequest(fr, config, prt_genFinalProof);
     if (config.inputFile.size() > 0)
     {
-        file2json(config.inputFile, proverRequest.finalProofInput);
+        file2zkin(config.inputFile, proverRequest.finalProofInput);
     }
     TimerStopAndLog(INPUT_LOAD);
 
@@ -488,6 +532,12 @@ int main(int argc, char **argv)
         KeccakGenerateScript(config);
     }
 
+    // Generate the binary images of the ROMs and of the Keccak SM script
+    if (config.runRomImageGenerator)
+    {
+        RomImageGenerate(fr, config);
+    }
+
     /* TESTS */
 
     // Test Keccak SM
@@ -528,6 +578,84 @@ int main(int argc, char **argv)
         Blake2b256_Test(fr, config);
     }
 
+    // Test zkin serialization
+    if (config.runZkinTest)
+    {
+        ZkinTest(fr);
+    }
+
+    // Test Poseidon lanes
+    if (config.runPoseidonLanesTest)
+    {
+        PoseidonLanesTest(fr);
+    }
+
+    // Test SMT batches
+    if (config.runSmtBatchTest)
+    {
+        SmtBatchTest(fr, config);
+    }
+
+    // Test Poseidon BN128
+    if (config.runPoseidonOptTest)
+    {
+        PoseidonOptTest(fr);
+    }
+
+    // Test FRI folding
+    if (config.runFRIFoldTest)
+    {
+        FRIFoldTest(fr);
+    }
+
+    // Test FRI binary proof files
+    if (config.runFRIProofTest)
+    {
+        FRIProofTest(fr, config);
+    }
+
+    // Test plookup h1 and h2
+    if (config.runH1H2Test)
+    {
+        H1H2Test(fr);
+    }
+
+    // Test the grand product polynomial
+    if (config.runCalculateZTest)
+    {
+        CalculateZTest(fr);
+    }
+
+    // Test LDE and merkelization
+    if (config.runLDEMerkleTest)
+    {
+        LDEMerkleTest(fr);
+    }
+
+    // Test the chelpers JIT kernels
+    if (config.runChelpersJitTest)
+    {
+        ChelpersJitTest(fr, config);
+    }
+
+    // Test the ROM programs against the ROM command trees
+    if (config.runRomProgramTest)
+    {
+        RomProgramTest();
+    }
+
+    // Test the ROM images against the ROM JSON files
+    if (config.runRomImageTest)
+    {
+        RomImageTest(fr, config);
+    }
+
+    // Test the creation and eviction of the lazy main executors
+    if (config.runLazyMainExecutorTest)
+    {
+        LazyMainExecutorTest(fr, poseidon, config);
+    }
+
     // If there is nothing else to run, exit normally
     if (!config.runExecutorServer && !config.runExecutorClient && !config.runExecutorClientMultithread &&
         !config.runStateDBServer && !config.runStateDBTest &&
@@ -561,6 +689,8 @@ int main(int argc, char **argv)
     Database::dbMTCache.setName("MTCache");
     Database::dbProgramCache.setName("ProgramCache");
     Database::dbMTCache.setMaxSize(config.dbMTCacheSize*1024*1024);
+    // In local mode the MT cache is the only storage of the database, so it must not evict records
+    Database::dbMTCache.setEviction(config.databaseURL != "local");
     Database::dbProgramCache.setMaxSize(config.dbProgramCacheSize*1024*1024);
 
     if (config.databaseURL != "local") // remote DB
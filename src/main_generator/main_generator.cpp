@@ -377,7 +377,7 @@ string generate(const json &rom, const string &functionName, const string &fileN
         code += "    MemoryAccess memoryAccess;\n";
 
     code += "    std::ofstream outfile;\n";
-    code += "    std::unordered_map<uint64_t, Fea>::iterator memIterator;\n";
+    code += "    Fea * pMemValue;\n";
     code += "\n";
 
     code += "    uint64_t zkPC = 0; // Zero-knowledge program counter\n";
@@ -895,16 +895,16 @@ string generate(const json &rom, const string &functionName, const string &fileN
                      (!rom["program"][zkPC].contains("mWR") || (rom["program"][zkPC]["mWR"]==0)) )
                 {
                     code += "    // Memory read free in: get fi=mem[addr], if it exists\n";
-                    code += "    memIterator = ctx.mem.find(addr);\n";
-                    code += "    if (memIterator != ctx.mem.end()) {\n";
-                    code += "        fi0 = memIterator->second.fe0;\n";
-                    code += "        fi1 = memIterator->second.fe1;\n";
-                    code += "        fi2 = memIterator->second.fe2;\n";
-                    code += "        fi3 = memIterator->second.fe3;\n";
-                    code += "        fi4 = memIterator->second.fe4;\n";
-                    code += "        fi5 = memIterator->second.fe5;\n";
-                    code += "        fi6 = memIterator->second.fe6;\n";
-                    code += "        fi7 = memIterator->second.fe7;\n";
+                    code += "    pMemValue = ctx.mem.find(addr);\n";
+                    code += "    if (pMemValue != NULL) {\n";
+                    code += "        fi0 = pMemValue->fe0;\n";
+                    code += "        fi1 = pMemValue->fe1;\n";
+                    code += "        fi2 = pMemValue->fe2;\n";
+                    code += "        fi3 = pMemValue->fe3;\n";
+                    code += "        fi4 = pMemValue->fe4;\n";
+                    code += "        fi5 = pMemValue->fe5;\n";
+                    code += "        fi6 = pMemValue->fe6;\n";
+                    code += "        fi7 = pMemValue->fe7;\n";
                     code += "    } else {\n";
                     code += "        fi0 = fr.zero();\n";
                     code += "        fi1 = fr.zero();\n";
@@ -1718,23 +1718,15 @@ string generate(const json &rom, const string &functionName, const string &fileN
                 if (!bFastMode)
                     code += "    pols.mWR[i] = fr.one();\n\n";
 
-                code += "    memIterator = ctx.mem.find(addr);\n";
-                code += "    if (memIterator == ctx.mem.end())\n";
-                code += "    {\n";
-                code += "        ctx.mem[addr].fe0 = op0;\n";
-                code += "        memIterator = ctx.mem.find(addr);\n";
-                code += "    }\n";
-                code += "    else\n";
-                code += "    {\n";
-                code += "        memIterator->second.fe0 = op0;\n";
-                code += "    }\n";
-                code += "    memIterator->second.fe1 = op1;\n";
-                code += "    memIterator->second.fe2 = op2;\n";
-                code += "    memIterator->second.fe3 = op3;\n";
-                code += "    memIterator->second.fe4 = op4;\n";
-                code += "    memIterator->second.fe5 = op5;\n";
-                code += "    memIterator->second.fe6 = op6;\n";
-                code += "    memIterator->second.fe7 = op7;\n\n";
+                code += "    pMemValue = &ctx.mem[addr];\n";
+                code += "    pMemValue->fe0 = op0;\n";
+                code += "    pMemValue->fe1 = op1;\n";
+                code += "    pMemValue->fe2 = op2;\n";
+                code += "    pMemValue->fe3 = op3;\n";
+                code += "    pMemValue->fe4 = op4;\n";
+                code += "    pMemValue->fe5 = op5;\n";
+                code += "    pMemValue->fe6 = op6;\n";
+                code += "    pMemValue->fe7 = op7;\n\n";
 
                 if (!bFastMode)
                 {
@@ -1770,17 +1762,17 @@ string generate(const json &rom, const string &functionName, const string &fileN
                     code += "    required.Memory.push_back(memoryAccess);\n\n";
                 }
 
-                code += "    memIterator = ctx.mem.find(addr);\n";
-                code += "    if (memIterator != ctx.mem.end()) \n";
+                code += "    pMemValue = ctx.mem.find(addr);\n";
+                code += "    if (pMemValue != NULL) \n";
                 code += "    {\n";
-                code += "        if ( (!fr.equal(memIterator->second.fe0, op0)) ||\n";
-                code += "             (!fr.equal(memIterator->second.fe1, op1)) ||\n";
-                code += "             (!fr.equal(memIterator->second.fe2, op2)) ||\n";
-                code += "             (!fr.equal(memIterator->second.fe3, op3)) ||\n";
-                code += "             (!fr.equal(memIterator->second.fe4, op4)) ||\n";
-                code += "             (!fr.equal(memIterator->second.fe5, op5)) ||\n";
-                code += "             (!fr.equal(memIterator->second.fe6, op6)) ||\n";
-                code += "             (!fr.equal(memIterator->second.fe7, op7)) )\n";
+                code += "        if ( (!fr.equal(pMemValue->fe0, op0)) ||\n";
+                code += "             (!fr.equal(pMemValue->fe1, op1)) ||\n";
+                code += "             (!fr.equal(pMemValue->fe2, op2)) ||\n";
+                code += "             (!fr.equal(pMemValue->fe3, op3)) ||\n";
+                code += "             (!fr.equal(pMemValue->fe4, op4)) ||\n";
+                code += "             (!fr.equal(pMemValue->fe5, op5)) ||\n";
+                code += "             (!fr.equal(pMemValue->fe6, op6)) ||\n";
+                code += "             (!fr.equal(pMemValue->fe7, op7)) )\n";
                 code += "        {\n";
                 code += "            cerr << \"Error: Memory Read does not match\" << \" step=\" << i << \" zkPC=\" << " + to_string(zkPC) + " << \" line=\" << rom.line[" + to_string(zkPC) + "].toString(fr) << \" uuid=\" << proverRequest.uuid << endl;\n";
                 code += "            proverRequest.result = ZKR_SM_MAIN_MEMORY;\n";
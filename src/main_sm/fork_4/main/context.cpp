@@ -1,8 +1,79 @@
+#include <algorithm>
 #include "main_sm/fork_4/main/context.hpp"
+#include "zkassert.hpp"
 
 namespace fork_4
 {
 
+Memory::~Memory()
+{
+    for (uint64_t context = 0; context < contexts.size(); context++)
+    {
+        if (contexts[context] == NULL)
+        {
+            continue;
+        }
+        for (uint64_t page = 0; page < MEMORY_CTX_PAGES; page++)
+        {
+            delete contexts[context][page];
+        }
+        delete[] contexts[context];
+    }
+}
+
+MemoryPage * Memory::allocatePage (uint64_t address)
+{
+    uint64_t context = address >> MEMORY_CTX_BITS;
+    zkassert(context < MEMORY_MAX_CONTEXTS);
+    if (context >= contexts.size())
+    {
+        contexts.resize(context + 1, NULL);
+    }
+    if (contexts[context] == NULL)
+    {
+        contexts[context] = new MemoryPage *[MEMORY_CTX_PAGES](); // All NULL
+    }
+    MemoryPage * &pPage = contexts[context][(address >> MEMORY_PAGE_BITS) & (MEMORY_CTX_PAGES - 1)];
+    if (pPage == NULL)
+    {
+        pPage = new MemoryPage(); // Zero-initialized
+    }
+    return pPage;
+}
+
+void Memory::getAddresses (vector<uint64_t> &addresses)
+{
+    addresses.clear();
+    for (uint64_t context = 0; context < contexts.size(); context++)
+    {
+        if (contexts[context] == NULL)
+        {
+            continue;
+        }
+        for (uint64_t page = 0; page < MEMORY_CTX_PAGES; page++)
+        {
+            MemoryPage * pPage = contexts[context][page];
+            if (pPage == NULL)
+            {
+                continue;
+            }
+            for (uint64_t i = 0; i < MEMORY_PAGE_SIZE; i++)
+            {
+                if ((pPage->written >> i) & 1)
+                {
+                    addresses.push_back((context << MEMORY_CTX_BITS) + (page << MEMORY_PAGE_BITS) + i);
+                }
+            }
+        }
+    }
+    uint64_t lowSize = addresses.size();
+    for (unordered_map<uint64_t, Fea>::iterator it = highContexts.begin(); it != highContexts.end(); it++)
+    {
+        addresses.push_back(it->first);
+    }
+    sort(addresses.begin() + lowSize, addresses.end());
+}
+
 void Context::printRegs()
 {
     cout << "Registers:" << endl;
@@ -71,9 +142,13 @@ void Context::printVars()
 {
     cout << "Variables:" << endl;
     uint64_t i = 0;
-    for (unordered_map<string, mpz_class>::iterator it = vars.begin(); it != vars.end(); it++)
+    for (uint64_t slot = 0; slot < vars.size(); slot++)
     {
-        cout << "i: " << i << " varName: " << it->first << " fe: " << it->second.get_str(16) << endl;
+        if (!vars[slot].bDeclared)
+        {
+            continue;
+        }
+        cout << "i: " << i << " varName: " << rom.varNames[slot] << " fe: " << vars[slot].value.get_str(16) << endl;
         i++;
     }
 }
@@ -93,14 +168,14 @@ string Context::printFea(Fea &fea)
 void Context::printMem()
 {
     cout << "Memory:" << endl;
-    uint64_t i = 0;
-    for (unordered_map<uint64_t, Fea>::iterator it = mem.begin(); it != mem.end(); it++)
+    vector<uint64_t> addresses;
+    mem.getAddresses(addresses);
+    for (uint64_t i = 0; i < addresses.size(); i++)
     {
-        mpz_class addr(it->first);
+        mpz_class addr(addresses[i]);
         cout << "i: " << i << " address:" << addr.get_str(16) << " ";
-        cout << printFea(it->second);
+        cout << printFea(mem[addresses[i]]);
         cout << endl;
-        i++;
     }
 }
 
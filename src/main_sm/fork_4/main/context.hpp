@@ -89,6 +89,99 @@ public:
     Goldilocks::Element fe7;
 };
 
+// Memory addresses are CTX*MEMORY_CTX_SIZE + offset, where offset < MEMORY_CTX_SIZE
+#define MEMORY_CTX_BITS 18
+#define MEMORY_CTX_SIZE (1 << MEMORY_CTX_BITS) // 0x40000 words per context
+#define MEMORY_PAGE_BITS 6
+#define MEMORY_PAGE_SIZE (1 << MEMORY_PAGE_BITS) // 64 words of 64 bytes, i.e. 4 KB pages
+#define MEMORY_CTX_PAGES (1 << (MEMORY_CTX_BITS - MEMORY_PAGE_BITS)) // 4096 pages per context
+#define MEMORY_MAX_CONTEXTS (1 << 20) // Contexts with a page table; the higher ones are kept in a map
+
+class MemoryPage
+{
+public:
+    uint64_t written; // Bit i is set if fea[i] has been written
+    Fea fea[MEMORY_PAGE_SIZE];
+};
+
+// Main SM memory, directly indexed by address: every context has a table of 4 KB pages, and both the
+// table and its pages are allocated when first written.  It keeps the semantics of the map it replaces:
+// find() returns NULL for an address never written, and operator[] marks it as written, set to zero
+class Memory
+{
+private:
+    vector<MemoryPage **> contexts; // Page table of every context, or NULL
+    unordered_map<uint64_t, Fea> highContexts; // Addresses of contexts >= MEMORY_MAX_CONTEXTS
+
+    MemoryPage * allocatePage (uint64_t address);
+
+public:
+    Memory() {};
+    Memory(const Memory &) = delete;
+    Memory & operator= (const Memory &) = delete;
+    ~Memory();
+
+    // Returns the value at this address, or NULL if it has never been written
+    inline Fea * find (uint64_t address)
+    {
+        uint64_t context = address >> MEMORY_CTX_BITS;
+        if (context >= contexts.size())
+        {
+            if (context < MEMORY_MAX_CONTEXTS)
+            {
+                return NULL;
+            }
+            unordered_map<uint64_t, Fea>::iterator it = highContexts.find(address);
+            return (it == highContexts.end()) ? NULL : &it->second;
+        }
+        MemoryPage ** pPages = contexts[context];
+        if (pPages == NULL)
+        {
+            return NULL;
+        }
+        MemoryPage * pPage = pPages[(address >> MEMORY_PAGE_BITS) & (MEMORY_CTX_PAGES - 1)];
+        if (pPage == NULL)
+        {
+            return NULL;
+        }
+        uint64_t i = address & (MEMORY_PAGE_SIZE - 1);
+        return ((pPage->written >> i) & 1) ? &pPage->fea[i] : NULL;
+    }
+
+    // Returns the value at this address, marking it as written, and set to zero if it was not
+    inline Fea & operator[] (uint64_t address)
+    {
+        uint64_t context = address >> MEMORY_CTX_BITS;
+        if (context >= MEMORY_MAX_CONTEXTS)
+        {
+            return highContexts[address];
+        }
+        MemoryPage * pPage = NULL;
+        if ((context < contexts.size()) && (contexts[context] != NULL))
+        {
+            pPage = contexts[context][(address >> MEMORY_PAGE_BITS) & (MEMORY_CTX_PAGES - 1)];
+        }
+        if (pPage == NULL)
+        {
+            pPage = allocatePage(address);
+        }
+        uint64_t i = address & (MEMORY_PAGE_SIZE - 1);
+        pPage->written |= (uint64_t)1 << i; // Words are zero until written
+        return pPage->fea[i];
+    }
+
+    // Returns the written addresses, in increasing order
+    void getAddresses (vector<uint64_t> &addresses);
+};
+
+class RomVariable
+{
+public:
+    bool bDeclared;
+    mpz_class value;
+    RomVariable() : bDeclared(false) {};
+};
+
 class OutLog
 {
 public:
@@ -136,7 +229,8 @@ public:
         lastSWrite(fr),
         proverRequest(proverRequest),
         pStateDB(pStateDB),
-        lastStep(0)
+        lastStep(0),
+        vars(rom.varNames.size())
         {}; // Constructor, setting references
 
     // Evaluations data
@@ -154,11 +248,11 @@ public:
     // HashP database, used in hashP, hashPLen and hashPDigest
     unordered_map< uint64_t, HashValue > hashP;
 
-    // Variables database, used in evalCommand() declareVar/setVar/getVar
-    unordered_map< string, mpz_class > vars;
+    // Variables database, used in evalCommand() declareVar/setVar/getVar, indexed by RomCommand::varSlot
+    vector<RomVariable> vars;
     
-    // Memory map, using absolute address as key, and field element array as value
-    unordered_map< uint64_t, Fea > mem; // TODO: Use array<Goldilocks::Element,8> instead of Fea, or declare Fea8, Fea4 at a higher level
+    // Memory, using absolute address as index, and field element array as value
+    Memory mem; // TODO: Use array<Goldilocks::Element,8> instead of Fea, or declare Fea8, Fea4 at a higher level
 
     // Repository of eval_storeLog() calls
     unordered_map< uint32_t, OutLog> outLogs;
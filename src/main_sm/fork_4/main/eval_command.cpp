@@ -4,6 +4,7 @@
 #include "main_sm/fork_4/main/eval_command.hpp"
 #include "main_sm/fork_4/main/opcode_address.hpp"
 #include "scalar.hpp"
+#include "u256.hpp"
 #include "utils.hpp"
 #include "zkassert.hpp"
 
@@ -14,8 +15,125 @@ namespace fork_4
 #define CHECK_EVAL_COMMAND_PARAMETERS
 #endif
 
+/*****************************/
+/* 256-bit integer fast path */
+/*****************************/
+
+// Same as fea2scalar(), but returns false instead of failing if an element has more than 32 bits
+inline bool fea2u256 (Goldilocks &fr, const Goldilocks::Element &fe0, const Goldilocks::Element &fe1, const Goldilocks::Element &fe2, const Goldilocks::Element &fe3, const Goldilocks::Element &fe4, const Goldilocks::Element &fe5, const Goldilocks::Element &fe6, const Goldilocks::Element &fe7, U256 &r)
+{
+    uint64_t fe[8] = { fr.toU64(fe0), fr.toU64(fe1), fr.toU64(fe2), fr.toU64(fe3), fr.toU64(fe4), fr.toU64(fe5), fr.toU64(fe6), fr.toU64(fe7) };
+    for (uint64_t i = 0; i < 4; i++)
+    {
+        if ((fe[2*i] >= 0x100000000) || (fe[2*i + 1] >= 0x100000000))
+        {
+            return false;
+        }
+        r.limbs[i] = (fe[2*i + 1] << 32) | fe[2*i];
+    }
+    return true;
+}
+
+bool evalU256Reg (Context &ctx, tReg reg, U256 &r)
+{
+    Goldilocks &fr = ctx.fr;
+    MainCommitPols &pols = ctx.pols;
+    uint64_t step = *ctx.pStep;
+    switch (reg)
+    {
+        case reg_A:                   return fea2u256(fr, pols.A0[step], pols.A1[step], pols.A2[step], pols.A3[step], pols.A4[step], pols.A5[step], pols.A6[step], pols.A7[step], r);
+        case reg_B:                   return fea2u256(fr, pols.B0[step], pols.B1[step], pols.B2[step], pols.B3[step], pols.B4[step], pols.B5[step], pols.B6[step], pols.B7[step], r);
+        case reg_C:                   return fea2u256(fr, pols.C0[step], pols.C1[step], pols.C2[step], pols.C3[step], pols.C4[step], pols.C5[step], pols.C6[step], pols.C7[step], r);
+        case reg_D:                   return fea2u256(fr, pols.D0[step], pols.D1[step], pols.D2[step], pols.D3[step], pols.D4[step], pols.D5[step], pols.D6[step], pols.D7[step], r);
+        case reg_E:                   return fea2u256(fr, pols.E0[step], pols.E1[step], pols.E2[step], pols.E3[step], pols.E4[step], pols.E5[step], pols.E6[step], pols.E7[step], r);
+        case reg_SR:                  return fea2u256(fr, pols.SR0[step], pols.SR1[step], pols.SR2[step], pols.SR3[step], pols.SR4[step], pols.SR5[step], pols.SR6[step], pols.SR7[step], r);
+        case reg_CTX:                 u256Set(r, (uint32_t)fr.toU64(pols.CTX[step])); return true;
+        case reg_SP:                  u256Set(r, (uint16_t)fr.toU64(pols.SP[step])); return true;
+        case reg_PC:                  u256Set(r, (uint32_t)fr.toU64(pols.PC[step])); return true;
+        case reg_GAS:                 u256Set(r, fr.toU64(pols.GAS[step])); return true;
+        case reg_zkPC:                u256Set(r, (uint32_t)fr.toU64(pols.zkPC[step])); return true;
+        case reg_RR:                  u256Set(r, fr.toU64(pols.RR[step])); return true;
+        case reg_CNT_ARITH:           u256Set(r, fr.toU64(pols.cntArith[step])); return true;
+        case reg_CNT_BINARY:          u256Set(r, fr.toU64(pols.cntBinary[step])); return true;
+        case reg_CNT_KECCAK_F:        u256Set(r, fr.toU64(pols.cntKeccakF[step])); return true;
+        case reg_CNT_MEM_ALIGN:       u256Set(r, fr.toU64(pols.cntMemAlign[step])); return true;
+        case reg_CNT_PADDING_PG:      u256Set(r, fr.toU64(pols.cntPaddingPG[step])); return true;
+        case reg_CNT_POSEIDON_G:      u256Set(r, fr.toU64(pols.cntPoseidonG[step])); return true;
+        case reg_STEP:                u256Set(r, step); return true;
+        case reg_HASHPOS:             u256Set(r, fr.toU64(pols.HASHPOS[step])); return true;
+        default:                      return false;
+    }
+}
+
+// Provides the context leaves and variables to runRomProgram()
+class RomProgramHost
+{
+public:
+    Context &ctx;
+    RomProgramHost(Context &ctx) : ctx(ctx) {};
+
+    bool getVar (uint64_t slot, S256 &r)
+    {
+        RomVariable &variable = ctx.vars[slot];
+        return variable.bDeclared && scalar2s256(variable.value, r);
+    }
+
+    bool getReg (uint64_t reg, S256 &r)
+    {
+        r.negative = false;
+        return evalU256Reg(ctx, (tReg)reg, r.abs);
+    }
+
+    bool getMemValue (uint64_t offset, S256 &r)
+    {
+        Fea &fea = ctx.mem[offset];
+        r.negative = false;
+        return fea2u256(ctx.fr, fea.fe0, fea.fe1, fea.fe2, fea.fe3, fea.fe4, fea.fe5, fea.fe6, fea.fe7, r.abs);
+    }
+
+    // Returns false, with no side effects, in the error cases of eval_setVar() and eval_declareVar(),
+    // so that they report them
+    bool setVar (uint64_t slot, bool bDeclare, const S256 &value)
+    {
+        RomVariable &variable = ctx.vars[slot];
+        if (bDeclare)
+        {
+#ifdef CHECK_EVAL_COMMAND_PARAMETERS
+            if ( (ctx.rom.varNames[slot] == "") || ((ctx.rom.varNames[slot][0] != '_') && variable.bDeclared) )
+            {
+                return false;
+            }
+#endif
+            variable.bDeclared = true;
+        }
+        else if (!variable.bDeclared)
+        {
+            return false;
+        }
+        s2562scalar(value, variable.value);
+#ifdef LOG_VARIABLES
+        cout << "Set variable: " << ctx.rom.varNames[slot] << " scalar: " << variable.value.get_str(16) << endl;
+#endif
+        return true;
+    }
+};
+
 void evalCommand (Context &ctx, const RomCommand &cmd, CommandResult &cr)
 {
+    // The commands compiled by Rom::load() are first run on 256-bit integers, without mpz_class
+    // temporaries, and the result is only converted to the reused scalar of the command result
+    if (cmd.pProgram != NULL)
+    {
+        RomProgramHost host(ctx);
+        S256 result;
+        if (runRomProgram(*cmd.pProgram, host, result))
+        {
+            cr.type = crt_scalar;
+            s2562scalar(result, cr.scalar);
+            return;
+        }
+    }
+
     if (cmd.op == op_functionCall)
     {
         switch (cmd.function)
@@ -55,6 +173,7 @@ void evalCommand (Context &ctx, const RomCommand &cmd, CommandResult &cr)
                 exitProcess();
         }
     }
+
     switch (cmd.op)
     {
         case op_number:         return eval_number(ctx, cmd, cr);
@@ -113,7 +232,7 @@ void eval_declareVar (Context &ctx, const RomCommand &cmd, CommandResult &cr)
     }
 
     // Check that this variable does not exists
-    if ( (cmd.varName[0] != '_') && (ctx.vars.find(cmd.varName) != ctx.vars.end()) )
+    if ( (cmd.varName[0] != '_') && ctx.vars[cmd.varSlot].bDeclared )
     {
         cerr << "Error: eval_declareVar() Variable already declared: " << cmd.varName << " step=" << *ctx.pStep << " zkPC=" << *ctx.pZKPC << " line=" << ctx.rom.line[*ctx.pZKPC].toString(ctx.fr) << " uuid=" << ctx.proverRequest.uuid << endl;
         exitProcess();
@@ -121,7 +240,8 @@ void eval_declareVar (Context &ctx, const RomCommand &cmd, CommandResult &cr)
 #endif
 
     // Create the new variable with a zero value
-    ctx.vars[cmd.varName] = 0;
+    ctx.vars[cmd.varSlot].bDeclared = true;
+    ctx.vars[cmd.varSlot].value = 0;
 
 #ifdef LOG_VARIABLES
     cout << "Declare variable: " << cmd.varName << endl;
@@ -145,20 +265,20 @@ void eval_getVar (Context &ctx, const RomCommand &cmd, CommandResult &cr)
 #endif
 
     // Check that this variable exists
-    std::unordered_map<std::string, mpz_class>::iterator it = ctx.vars.find(cmd.varName);
-    if (it == ctx.vars.end())
+    RomVariable &variable = ctx.vars[cmd.varSlot];
+    if (!variable.bDeclared)
     {
         cerr << "Error: eval_getVar() Undefined variable: " << cmd. varName << " step=" << *ctx.pStep << " zkPC=" << *ctx.pZKPC << " line=" << ctx.rom.line[*ctx.pZKPC].toString(ctx.fr) << " uuid=" << ctx.proverRequest.uuid << endl;
         exitProcess();
     }
 
 #ifdef LOG_VARIABLES
-    cout << "Get variable: " << cmd.varName << " scalar: " << ctx.vars[cmd.varName].get_str(16) << endl;
+    cout << "Get variable: " << cmd.varName << " scalar: " << variable.value.get_str(16) << endl;
 #endif
 
     // Return the current value of this variable
     cr.type = crt_scalar;
-    cr.scalar = it->second;
+    cr.scalar = variable.value;
 }
 
 // Forward declaration, used by eval_setVar
@@ -175,41 +295,36 @@ void eval_setVar (Context &ctx, const RomCommand &cmd, CommandResult &cr)
     }
 #endif
 
-    // Get varName from the first element in values
+    // Get the variable slot from the first element in values
     eval_left(ctx,*cmd.values[0], cr);
 #ifdef CHECK_EVAL_COMMAND_PARAMETERS
-    if (cr.type != crt_string)
+    if (cr.type != crt_u64)
     {
         cerr << "Error: eval_setVar() unexpected command result type: " << cr.type << " step=" << *ctx.pStep << " zkPC=" << *ctx.pZKPC << " line=" << ctx.rom.line[*ctx.pZKPC].toString(ctx.fr) << " uuid=" << ctx.proverRequest.uuid << endl;
         exitProcess();
     }
 #endif
-    string varName = cr.str;
+    RomVariable &variable = ctx.vars[cr.u64];
 
     // Check that this variable exists
-    std::unordered_map<std::string, mpz_class>::iterator it = ctx.vars.find(varName);
-    if (it == ctx.vars.end())
+    if (!variable.bDeclared)
     {
-        cerr << "Error: eval_setVar() Undefined variable: " << varName << " step=" << *ctx.pStep << " zkPC=" << *ctx.pZKPC << " line=" << ctx.rom.line[*ctx.pZKPC].toString(ctx.fr) << " uuid=" << ctx.proverRequest.uuid << endl;
+        cerr << "Error: eval_setVar() Undefined variable: " << cmd.values[0]->varName << " step=" << *ctx.pStep << " zkPC=" << *ctx.pZKPC << " line=" << ctx.rom.line[*ctx.pZKPC].toString(ctx.fr) << " uuid=" << ctx.proverRequest.uuid << endl;
         exitProcess();
     }
 
     // Call evalCommand() to build the field element value for this variable
     evalCommand(ctx, *cmd.values[1], cr);
 
-    // Get the field element value from the command result
-    mpz_class auxScalar;
-    cr2scalar(ctx, cr, auxScalar);
-
     // Store the value as the new variable value
-    it->second = auxScalar;
+    cr2scalar(ctx, cr, variable.value);
 
     // Return the current value of the variable
     cr.type = crt_scalar;
-    cr.scalar = auxScalar;
+    cr.scalar = variable.value;
 
 #ifdef LOG_VARIABLES
-    cout << "Set variable: " << varName << " scalar: " << ctx.vars[varName].get_str(16) << endl;
+    cout << "Set variable: " << cmd.values[0]->varName << " scalar: " << variable.value.get_str(16) << endl;
 #endif
 }
 
@@ -220,14 +335,14 @@ void eval_left (Context &ctx, const RomCommand &cmd, CommandResult &cr)
         case op_declareVar:
         {
             eval_declareVar(ctx, cmd, cr);
-            cr.type = crt_string;
-            cr.str = cmd.varName;
+            cr.type = crt_u64;
+            cr.u64 = cmd.varSlot;
             return;
         }
         case op_getVar:
         {
-            cr.type = crt_string;
-            cr.str = cmd.varName;
+            cr.type = crt_u64;
+            cr.u64 = cmd.varSlot;
             return;
         }
         default:
@@ -78,10 +78,10 @@ inline void getFromMemory(Context &ctx, mpz_class &offset, mpz_class &length, st
     if (init != double(initCeil))
     {
         mpz_class memScalarStart = 0;
-        std::unordered_map<uint64_t, Fea>::iterator it = ctx.mem.find(initFloor);
-        if (it != ctx.mem.end())
+        Fea * pMemValue = ctx.mem.find(initFloor);
+        if (pMemValue != NULL)
         {
-            fea2scalar(ctx.fr, memScalarStart, it->second.fe0, it->second.fe1, it->second.fe2, it->second.fe3, it->second.fe4, it->second.fe5, it->second.fe6, it->second.fe7);
+            fea2scalar(ctx.fr, memScalarStart, pMemValue->fe0, pMemValue->fe1, pMemValue->fe2, pMemValue->fe3, pMemValue->fe4, pMemValue->fe5, pMemValue->fe6, pMemValue->fe7);
         }
         string hexStringStart = PrependZeros(memScalarStart.get_str(16), 64);
         uint64_t bytesToSkip = (init - double(initFloor)) * 32;
@@ -91,10 +91,10 @@ inline void getFromMemory(Context &ctx, mpz_class &offset, mpz_class &length, st
     for (uint64_t i = initCeil; i < endFloor; i++)
     {
         mpz_class memScalar = 0;
-        if (ctx.mem.find(i) != ctx.mem.end())
+        Fea * pMemValue = ctx.mem.find(i);
+        if (pMemValue != NULL)
         {
-            Fea memValue = ctx.mem[i];
-            fea2scalar(ctx.fr, memScalar, memValue.fe0, memValue.fe1, memValue.fe2, memValue.fe3, memValue.fe4, memValue.fe5, memValue.fe6, memValue.fe7);
+            fea2scalar(ctx.fr, memScalar, pMemValue->fe0, pMemValue->fe1, pMemValue->fe2, pMemValue->fe3, pMemValue->fe4, pMemValue->fe5, pMemValue->fe6, pMemValue->fe7);
         }
         result += PrependZeros(memScalar.get_str(16), 64);
     }
@@ -102,10 +102,10 @@ inline void getFromMemory(Context &ctx, mpz_class &offset, mpz_class &length, st
     if (end != double(endFloor))
     {
         mpz_class memScalarEnd = 0;
-        std::unordered_map<uint64_t, Fea>::iterator it = ctx.mem.find(endFloor);
-        if (it != ctx.mem.end())
+        Fea * pMemValue = ctx.mem.find(endFloor);
+        if (pMemValue != NULL)
         {
-            fea2scalar(ctx.fr, memScalarEnd, it->second.fe0, it->second.fe1, it->second.fe2, it->second.fe3, it->second.fe4, it->second.fe5, it->second.fe6, it->second.fe7);
+            fea2scalar(ctx.fr, memScalarEnd, pMemValue->fe0, pMemValue->fe1, pMemValue->fe2, pMemValue->fe3, pMemValue->fe4, pMemValue->fe5, pMemValue->fe6, pMemValue->fe7);
         }
         string hexStringEnd = PrependZeros(memScalarEnd.get_str(16), 64);
         uint64_t bytesToRetrieve = (end - double(endFloor)) * 32;
@@ -121,16 +121,15 @@ inline void getVarFromCtx(Context &ctx, bool global, uint64_t varOffset, mpz_cla
 
     uint64_t offsetCtx = global ? 0 : (pContext != NULL) ? *pContext*0x40000 : ctx.fr.toU64(ctx.pols.CTX[*ctx.pStep])*0x40000;
     uint64_t addressMem = offsetCtx + varOffset;
-    unordered_map<uint64_t, Fea>::iterator memIterator;
-    memIterator = ctx.mem.find(addressMem);
-    if (memIterator == ctx.mem.end())
+    Fea * pMemValue = ctx.mem.find(addressMem);
+    if (pMemValue == NULL)
     {
         //cout << "FullTracer::getVarFromCtx() could not find in ctx.mem address with offset=" << varOffset << endl;
         result = 0;
     }
     else
     {
-        Fea value = memIterator->second;
+        Fea &value = *pMemValue;
         fea2scalar(ctx.fr, result, value.fe0, value.fe1, value.fe2, value.fe3, value.fe4, value.fe5, value.fe6, value.fe7);
     }
 }
@@ -144,16 +143,16 @@ inline void getCalldataFromStack(Context &ctx, uint64_t offset, uint64_t length,
     mpz_class auxScalar;
     result = "0x";
     
-    unordered_map<uint64_t, Fea>::iterator memIterator;
+    Fea * pMemValue;
     uint64_t consumedLength = 0;
     for (uint64_t i = firstAddr; i < lastAddr; i++)
     {
-        memIterator = ctx.mem.find(i);
-        if (memIterator == ctx.mem.end())
+        pMemValue = ctx.mem.find(i);
+        if (pMemValue == NULL)
         {
             break;
         }
-        Fea memVal = memIterator->second;
+        Fea &memVal = *pMemValue;
         fea2scalar(ctx.fr, auxScalar, memVal.fe0, memVal.fe1, memVal.fe2, memVal.fe3, memVal.fe4, memVal.fe5, memVal.fe6, memVal.fe7);
         result += PrependZeros(auxScalar.get_str(16), 64);
         if (length > 0)
@@ -942,24 +941,23 @@ void FullTracer::onOpcode(Context &ctx, const RomCommand &cmd)
 
         uint64_t lengthMemOffset = ctx.rom.memLengthOffset;
         uint64_t lenMemValueFinal = 0;
-        unordered_map< uint64_t, Fea >::iterator it;
-        it = ctx.mem.find(offsetCtx + lengthMemOffset);
-        if (it != ctx.mem.end())
+        Fea * pMemValue = ctx.mem.find(offsetCtx + lengthMemOffset);
+        if (pMemValue != NULL)
         {
-            Fea lenMemValue = it->second;
+            Fea &lenMemValue = *pMemValue;
             fea2scalar(ctx.fr, auxScalar, lenMemValue.fe0, lenMemValue.fe1, lenMemValue.fe2, lenMemValue.fe3, lenMemValue.fe4, lenMemValue.fe5, lenMemValue.fe6, lenMemValue.fe7);
             lenMemValueFinal = ceil(double(auxScalar.get_ui()) / 32);
         }
 
         for (uint64_t i = 0; i < lenMemValueFinal; i++)
         {
-            it = ctx.mem.find(addrMem + i);
-            if (it == ctx.mem.end())
+            pMemValue = ctx.mem.find(addrMem + i);
+            if (pMemValue == NULL)
             {
                 finalMemory += "0000000000000000000000000000000000000000000000000000000000000000";
                 continue;
             }
-            Fea memValue = it->second;
+            Fea &memValue = *pMemValue;
             fea2scalar(ctx.fr, auxScalar, memValue.fe0, memValue.fe1, memValue.fe2, memValue.fe3, memValue.fe4, memValue.fe5, memValue.fe6, memValue.fe7);
             finalMemory += PrependZeros(auxScalar.get_str(16), 64);
         }
@@ -986,13 +984,13 @@ void FullTracer::onOpcode(Context &ctx, const RomCommand &cmd)
         uint64_t addr = offsetCtx + 0x10000;
 
         uint16_t sp = fr.toU64(ctx.pols.SP[*ctx.pStep]);
-        unordered_map<uint64_t, Fea>::iterator it;
+        Fea * pMemValue;
         for (uint16_t i = 0; i < sp; i++)
         {
-            it = ctx.mem.find(addr + i);
-            if (it == ctx.mem.end())
+            pMemValue = ctx.mem.find(addr + i);
+            if (pMemValue == NULL)
                 continue;
-            Fea stack = it->second;
+            Fea &stack = *pMemValue;
             mpz_class stackScalar;
             fea2scalar(ctx.fr, stackScalar, stack.fe0, stack.fe1, stack.fe2, stack.fe3, stack.fe4, stack.fe5, stack.fe6, stack.fe7);
             finalStack.push_back(stackScalar);
@@ -12,26 +12,37 @@
 #include "sm/memory/memory_executor.hpp"
 #include "sm/padding_pg/padding_pg_executor.hpp"
 #include "sm/mem_align/mem_align_executor.hpp"
+#include "action_log.hpp"
 
 using namespace std;
 
 namespace fork_4
 {
 
+// Binary, Arith and MemAlign actions are appended to logs that their executors can consume while the
+// main executor is still running; the rest are only consumed after the main execution
 class MainExecRequired
 {
 public:
     vector<SmtAction> Storage;
     vector<MemoryAccess> Memory;
-    vector<BinaryAction> Binary;
-    vector<ArithAction> Arith;
+    ActionLog<BinaryAction> Binary;
+    ActionLog<ArithAction> Arith;
     vector<PaddingKKExecutorInput> PaddingKK;
     vector<PaddingKKBitExecutorInput> PaddingKKBit;
     vector<Bits2FieldExecutorInput> Bits2Field;
     vector<vector<Goldilocks::Element>> KeccakF;
     vector<PaddingPGExecutorInput> PaddingPG;
     vector<array<Goldilocks::Element, 17>> PoseidonG; // The 17th fe is the permutation
-    vector<MemAlignAction> MemAlign;
+    ActionLog<MemAlignAction> MemAlign;
+
+    // Called when the main execution is done, successfully or not, so that the log consumers can finish
+    void close (void)
+    {
+        Binary.close();
+        Arith.close();
+        MemAlign.close();
+    }
 };
 
 } // namespace
@@ -23,6 +23,7 @@
 #include "input.hpp"
 #include "scalar.hpp"
 #include "utils.hpp"
+#include "rom_image.hpp"
 #include "statedb_factory.hpp"
 #include "goldilocks_base_field.hpp"
 #include "ffiasm/fec.hpp"
@@ -74,12 +75,14 @@ MainExecutor::MainExecutor (Goldilocks &fr, PoseidonGoldilocks &poseidon, const
         exitProcess();
     }
 
-    // Load file contents into a json instance
-    json romJson;
-    file2json("src/main_sm/fork_4/scripts/rom.json", romJson);
-
-    // Load ROM data from JSON data
-    rom.load(fr, romJson);
+    // Load ROM data from the ROM image, if valid, or else from the JSON file contents
+    string romFileName = "src/main_sm/fork_4/scripts/rom.json";
+    if (!config.loadRomImages || !rom.loadImage(fr, romImageFileName(romFileName), romFileName))
+    {
+        json romJson;
+        file2json(romFileName, romJson);
+        rom.load(fr, romJson);
+    }
 
     finalizeExecutionLabel = rom.getLabel(string("finalizeExecution"));
     checkAndSaveFromLabel  = rom.getLabel(string("checkAndSaveFrom"));
@@ -87,14 +90,8 @@ MainExecutor::MainExecutor (Goldilocks &fr, PoseidonGoldilocks &poseidon, const
     // Initialize the Ethereum opcode list: opcode=array position, operation=position content
     ethOpcodeInit();
 
-    // Use the rom labels object to map every opcode to a ROM address
-    if (!romJson.contains("labels") ||
-        !romJson["labels"].is_object() )
-    {
-        cerr << "Error: ROM file does not contain a labels object at root level" << endl;
-        exitProcess();
-    }
-    opcodeAddressInit(romJson["labels"]);
+    // Use the rom labels to map every opcode to a ROM address
+    opcodeAddressInit(rom.labels);
 
     TimerStopAndLog(ROM_LOAD);
 };
@@ -161,6 +158,12 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
         pStateDB->flush();
     }
 
+    // Read the balance and nonce of the accounts known in advance with a single batch request; the
+    // storage reads done against the old state root reuse these results instead of calling get(), and
+    // if the prefetch fails they just call get()
+    vector<SmtGetResult> prefetched;
+    prefetchState(ctx, pStateDB, prefetched);
+
     // opN are local, uncommitted polynomials
     Goldilocks::Element op0, op1, op2, op3, op4, op5, op6, op7;
 
@@ -719,20 +722,19 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
                 // Memory read free in: get fi=mem[addr], if it exists
                 if ( (rom.line[zkPC].mOp==1) && (rom.line[zkPC].mWR==0) )
                 {
-                    std::unordered_map<uint64_t, Fea>::iterator memIterator;
-                    memIterator = ctx.mem.find(addr);
-                    if (memIterator != ctx.mem.end()) {
+                    Fea * pMemValue = ctx.mem.find(addr);
+                    if (pMemValue != NULL) {
 #ifdef LOG_MEMORY
-                        cout << "Memory read mRD: addr:" << addr << " " << printFea(ctx, ctx.mem[addr]) << endl;
+                        cout << "Memory read mRD: addr:" << addr << " " << printFea(ctx, *pMemValue) << endl;
 #endif
-                        fi0 = memIterator->second.fe0;
-                        fi1 = memIterator->second.fe1;
-                        fi2 = memIterator->second.fe2;
-                        fi3 = memIterator->second.fe3;
-                        fi4 = memIterator->second.fe4;
-                        fi5 = memIterator->second.fe5;
-                        fi6 = memIterator->second.fe6;
-                        fi7 = memIterator->second.fe7;
+                        fi0 = pMemValue->fe0;
+                        fi1 = pMemValue->fe1;
+                        fi2 = pMemValue->fe2;
+                        fi3 = pMemValue->fe3;
+                        fi4 = pMemValue->fe4;
+                        fi5 = pMemValue->fe5;
+                        fi6 = pMemValue->fe6;
+                        fi7 = pMemValue->fe7;
 
                     } else {
                         fi0 = fr.zero();
@@ -819,7 +821,11 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
 #endif
                     SmtGetResult smtGetResult;
                     mpz_class value;
-                    zkresult zkResult = pStateDB->get(oldRoot, key, value, &smtGetResult, proverRequest.dbReadLog);
+                    zkresult zkResult = ZKR_SUCCESS;
+                    if (!getPrefetched(prefetched, oldRoot, key, smtGetResult))
+                    {
+                        zkResult = pStateDB->get(oldRoot, key, value, &smtGetResult, proverRequest.dbReadLog);
+                    }
                     if (zkResult != ZKR_SUCCESS)
                     {
                         cerr << "Error: MainExecutor::Execute() failed calling pStateDB->get() result=" << zkresult2string(zkResult) << " step=" << step << " zkPC=" << zkPC << " line=" << rom.line[zkPC].toString(fr) << " uuid=" << proverRequest.uuid << endl;
@@ -1437,14 +1443,15 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
             {
                 pols.mWR[i] = fr.one();
 
-                ctx.mem[addr].fe0 = op0;
-                ctx.mem[addr].fe1 = op1;
-                ctx.mem[addr].fe2 = op2;
-                ctx.mem[addr].fe3 = op3;
-                ctx.mem[addr].fe4 = op4;
-                ctx.mem[addr].fe5 = op5;
-                ctx.mem[addr].fe6 = op6;
-                ctx.mem[addr].fe7 = op7;
+                Fea &memValue = ctx.mem[addr];
+                memValue.fe0 = op0;
+                memValue.fe1 = op1;
+                memValue.fe2 = op2;
+                memValue.fe3 = op3;
+                memValue.fe4 = op4;
+                memValue.fe5 = op5;
+                memValue.fe6 = op6;
+                memValue.fe7 = op7;
 
                 if (!bProcessBatch)
                 {
@@ -1486,16 +1493,17 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
                     required.Memory.push_back(memoryAccess);
                 }
 
-                if (ctx.mem.find(addr) != ctx.mem.end())
+                Fea * pMemValue = ctx.mem.find(addr);
+                if (pMemValue != NULL)
                 {
-                    if ( (!fr.equal(ctx.mem[addr].fe0, op0)) ||
-                         (!fr.equal(ctx.mem[addr].fe1, op1)) ||
-                         (!fr.equal(ctx.mem[addr].fe2, op2)) ||
-                         (!fr.equal(ctx.mem[addr].fe3, op3)) ||
-                         (!fr.equal(ctx.mem[addr].fe4, op4)) ||
-                         (!fr.equal(ctx.mem[addr].fe5, op5)) ||
-                         (!fr.equal(ctx.mem[addr].fe6, op6)) ||
-                         (!fr.equal(ctx.mem[addr].fe7, op7)) )
+                    if ( (!fr.equal(pMemValue->fe0, op0)) ||
+                         (!fr.equal(pMemValue->fe1, op1)) ||
+                         (!fr.equal(pMemValue->fe2, op2)) ||
+                         (!fr.equal(pMemValue->fe3, op3)) ||
+                         (!fr.equal(pMemValue->fe4, op4)) ||
+                         (!fr.equal(pMemValue->fe5, op5)) ||
+                         (!fr.equal(pMemValue->fe6, op6)) ||
+                         (!fr.equal(pMemValue->fe7, op7)) )
                     {
                         cerr << "Error: Memory Read does not match" << " step=" << step << " zkPC=" << zkPC << " line=" << rom.line[zkPC].toString(fr) << " uuid=" << proverRequest.uuid << endl;
                         proverRequest.result = ZKR_SM_MAIN_MEMORY;
@@ -1633,7 +1641,11 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
 #endif
             SmtGetResult smtGetResult;
             mpz_class value;
-            zkresult zkResult = pStateDB->get(oldRoot, key, value, &smtGetResult, proverRequest.dbReadLog);
+            zkresult zkResult = ZKR_SUCCESS;
+            if (!getPrefetched(prefetched, oldRoot, key, smtGetResult))
+            {
+                zkResult = pStateDB->get(oldRoot, key, value, &smtGetResult, proverRequest.dbReadLog);
+            }
             if (zkResult != ZKR_SUCCESS)
             {
                 cerr << "Error: MainExecutor::Execute() failed calling pStateDB->get() result=" << zkresult2string(zkResult) << " step=" << step << " zkPC=" << zkPC << " line=" << rom.line[zkPC].toString(fr) << " uuid=" << proverRequest.uuid << endl;
@@ -3872,6 +3884,80 @@ void MainExecutor::initState(Context &ctx)
     ctx.pols.CTX[0] = fr.fromU64(ctx.proverRequest.input.publicInputsExtended.publicInputs.forkID);
 }
 
+// Get the balance and nonce of the sequencer and, in unsigned transactions, of the sender, from the
+// old state root, calculating their keys as the storage free inputs do; on failure, e.g. with a StateDB
+// server without GetBatch, nothing is prefetched
+void MainExecutor::prefetchState(Context &ctx, StateDBInterface *pStateDB, vector<SmtGetResult> &prefetched)
+{
+    vector<mpz_class> addresses;
+    addresses.push_back(ctx.proverRequest.input.publicInputsExtended.publicInputs.sequencerAddr);
+    if ((ctx.proverRequest.input.from != "") && (ctx.proverRequest.input.from != "0x"))
+    {
+        mpz_class from(Remove0xIfPresent(ctx.proverRequest.input.from), 16);
+        if (from != addresses[0])
+        {
+            addresses.push_back(from);
+        }
+    }
+
+    // Balance and nonce keys have storage position 0, so Kin0 is all zeros
+    Goldilocks::Element Kin0[12];
+    for (uint64_t j=0; j<12; j++) Kin0[j] = fr.zero();
+    Goldilocks::Element Kin0Hash[4];
+    poseidon.hash(Kin0Hash, Kin0);
+
+    const uint64_t keyTypes[2] = { 0, 1 }; // SMT_KEY_BALANCE and SMT_KEY_NONCE ROM constants
+    vector<SmtKeyValue> keyValues;
+    for (uint64_t a=0; a<addresses.size(); a++)
+    {
+        Goldilocks::Element addressFea[8];
+        scalar2fea(fr, addresses[a], addressFea);
+        for (uint64_t t=0; t<2; t++)
+        {
+            Goldilocks::Element Kin1[12];
+            for (uint64_t j=0; j<5; j++) Kin1[j] = addressFea[j];
+            Kin1[5] = fr.zero();
+            Kin1[6] = fr.fromU64(keyTypes[t]);
+            Kin1[7] = fr.zero();
+            Kin1[8] = Kin0Hash[0];
+            Kin1[9] = Kin0Hash[1];
+            Kin1[10] = Kin0Hash[2];
+            Kin1[11] = Kin0Hash[3];
+
+            SmtKeyValue keyValue;
+            poseidon.hash(keyValue.key, Kin1);
+            keyValues.push_back(keyValue);
+        }
+    }
+
+    Goldilocks::Element oldRoot[4];
+    scalar2fea(fr, ctx.proverRequest.input.publicInputsExtended.publicInputs.oldStateRoot, oldRoot);
+
+    vector<mpz_class> values;
+    zkresult zkr = pStateDB->getBatch(oldRoot, keyValues, values, &prefetched, ctx.proverRequest.dbReadLog);
+    if (zkr != ZKR_SUCCESS)
+    {
+        cout << "MainExecutor::prefetchState() failed calling pStateDB->getBatch() result=" << zkresult2string(zkr) << " uuid=" << ctx.proverRequest.uuid << ", so every key will be read with get()" << endl;
+        prefetched.clear();
+    }
+}
+
+// Find a prefetched result with the same root and key
+bool MainExecutor::getPrefetched(const vector<SmtGetResult> &prefetched, const Goldilocks::Element (&root)[4], const Goldilocks::Element (&key)[4], SmtGetResult &result)
+{
+    for (uint64_t p=0; p<prefetched.size(); p++)
+    {
+        const SmtGetResult &r = prefetched[p];
+        if ( fr.equal(r.root[0], root[0]) && fr.equal(r.root[1], root[1]) && fr.equal(r.root[2], root[2]) && fr.equal(r.root[3], root[3]) &&
+             fr.equal(r.key[0], key[0]) && fr.equal(r.key[1], key[1]) && fr.equal(r.key[2], key[2]) && fr.equal(r.key[3], key[3]) )
+        {
+            result = r;
+            return true;
+        }
+    }
+    return false;
+}
+
 // Check that last evaluation (which is in fact the first one) is zero
 void MainExecutor::checkFinalState(Context &ctx)
 {
@@ -66,6 +66,10 @@ public:
     void initState(Context &ctx);
     void checkFinalState(Context &ctx);
     void assertOutputs(Context &ctx);
+
+    // State prefetch, i.e. storage reads known before the execution starts
+    void prefetchState(Context &ctx, StateDBInterface *pStateDB, vector<SmtGetResult> &prefetched);
+    bool getPrefetched(const vector<SmtGetResult> &prefetched, const Goldilocks::Element (&root)[4], const Goldilocks::Element (&key)[4], SmtGetResult &result);
     
 public:
     void flushInParallel(StateDBInterface * pStateDB);
@@ -1,26 +1,29 @@
+#include <iostream>
+#include <cstring>
 #include "main_sm/fork_4/main/opcode_address.hpp"
 #include "main_sm/fork_4/main/eth_opcodes.hpp"
+#include "exit_process.hpp"
 
 namespace fork_4
 {
 
 uint64_t opcodeAddress[256];
 
-void opcodeAddressInit (json &labels)
+void opcodeAddressInit (const unordered_map<string, uint64_t> &labels)
 {
     memset(&opcodeAddress, 0, sizeof(opcodeAddress));
 
+    unordered_map<string, uint64_t>::const_iterator invalid = labels.find("opINVALID");
+    if (invalid == labels.end())
+    {
+        cerr << "Error: opcodeAddressInit() could not find label opINVALID" << endl;
+        exitProcess();
+    }
+
     for (uint64_t i=0; i<256; i++)
     {
-        if (labels.contains(ethOpcode[i]) &&
-            labels[ethOpcode[i]].is_number() )
-        {
-            opcodeAddress[i] = labels[ethOpcode[i]];
-        }
-        else
-        {
-            opcodeAddress[i] = labels["opINVALID"];
-        }
+        unordered_map<string, uint64_t>::const_iterator it = labels.find(ethOpcode[i]);
+        opcodeAddress[i] = (it != labels.end()) ? it->second : invalid->second;
     }
 }
 
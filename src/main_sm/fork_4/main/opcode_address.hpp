@@ -2,17 +2,16 @@
 #define OPCODE_ADDRESS_HPP_fork_4
 
 #include <string>
-#include <nlohmann/json.hpp>
+#include <unordered_map>
 
 using namespace std;
-using json = nlohmann::json;
 
 namespace fork_4
 {
 
 extern uint64_t opcodeAddress[256];
 
-void opcodeAddressInit (json &labels);
+void opcodeAddressInit (const unordered_map<string, uint64_t> &labels);
 
 } // namespace
 
@@ -3,6 +3,7 @@
 #include "main_sm/fork_4/main/rom_command.hpp"
 #include "scalar.hpp"
 #include "utils.hpp"
+#include "zkassert.hpp"
 
 namespace fork_4
 {
@@ -26,6 +27,20 @@ void Rom::load(Goldilocks &fr, json &romJson)
     loadLabels(fr, romJson["labels"]);
 
     // Get labels offsets
+    loadOffsets();
+
+    // Load ROM constants
+    MAX_CNT_STEPS_LIMIT      = getConstant(romJson, "MAX_CNT_STEPS_LIMIT");
+    MAX_CNT_ARITH_LIMIT      = getConstant(romJson, "MAX_CNT_ARITH_LIMIT");
+    MAX_CNT_BINARY_LIMIT     = getConstant(romJson, "MAX_CNT_BINARY_LIMIT");
+    MAX_CNT_MEM_ALIGN_LIMIT  = getConstant(romJson, "MAX_CNT_MEM_ALIGN_LIMIT");
+    MAX_CNT_KECCAK_F_LIMIT   = getConstant(romJson, "MAX_CNT_KECCAK_F_LIMIT");
+    MAX_CNT_PADDING_PG_LIMIT = getConstant(romJson, "MAX_CNT_PADDING_PG_LIMIT");
+    MAX_CNT_POSEIDON_G_LIMIT = getConstant(romJson, "MAX_CNT_POSEIDON_G_LIMIT");
+}
+
+void Rom::loadOffsets(void)
+{
     if (config.dontLoadRomOffsets == false)
     {
         memLengthOffset        = getMemoryOffset("memLength");
@@ -58,15 +73,6 @@ void Rom::load(Goldilocks &fr, json &romJson)
         gasCTXOffset           = getMemoryOffset("gasCTX");
         lastCtxUsedOffset      = getMemoryOffset("lastCtxUsed");
     }
-
-    // Load ROM constants
-    MAX_CNT_STEPS_LIMIT      = getConstant(romJson, "MAX_CNT_STEPS_LIMIT");
-    MAX_CNT_ARITH_LIMIT      = getConstant(romJson, "MAX_CNT_ARITH_LIMIT");
-    MAX_CNT_BINARY_LIMIT     = getConstant(romJson, "MAX_CNT_BINARY_LIMIT");
-    MAX_CNT_MEM_ALIGN_LIMIT  = getConstant(romJson, "MAX_CNT_MEM_ALIGN_LIMIT");
-    MAX_CNT_KECCAK_F_LIMIT   = getConstant(romJson, "MAX_CNT_KECCAK_F_LIMIT");
-    MAX_CNT_PADDING_PG_LIMIT = getConstant(romJson, "MAX_CNT_PADDING_PG_LIMIT");
-    MAX_CNT_POSEIDON_G_LIMIT = getConstant(romJson, "MAX_CNT_POSEIDON_G_LIMIT");
 }
 
 void Rom::loadProgram(Goldilocks &fr, json &romJson)
@@ -117,6 +123,11 @@ void Rom::loadProgram(Goldilocks &fr, json &romJson)
         parseRomCommandArray(line[i].cmdBefore, l["cmdBefore"]);
         parseRomCommandArray(line[i].cmdAfter, l["cmdAfter"]);
         parseRomCommand(line[i].freeInTag, l["freeInTag"]);
+
+        // Resolve the variables into slots, and compile the commands
+        compileRomCommandArray(line[i].cmdBefore, varSlots, varNames);
+        compileRomCommandArray(line[i].cmdAfter, varSlots, varNames);
+        compileRomCommand(line[i].freeInTag, varSlots, varNames);
         
         if (l["CONST"].is_string())
         {
@@ -333,6 +344,190 @@ uint64_t Rom::getConstant(json &romJson, const string &constantName)
     return atoi(auxString.c_str());
 }
 
+// RomLine fields saved in the ROM image, besides the ones saved explicitly by saveImage()
+static Goldilocks::Element RomLine::* const romImageElements[] = {
+    &RomLine::inA, &RomLine::inB, &RomLine::inC, &RomLine::inD, &RomLine::inE, &RomLine::inSR, &RomLine::inCTX,
+    &RomLine::inSP, &RomLine::inPC, &RomLine::inGAS, &RomLine::inSTEP, &RomLine::inFREE, &RomLine::inRR,
+    &RomLine::inHASHPOS, &RomLine::inCntArith, &RomLine::inCntBinary, &RomLine::inCntMemAlign,
+    &RomLine::inCntKeccakF, &RomLine::inCntPoseidonG, &RomLine::inCntPaddingPG, &RomLine::inROTL_C, &RomLine::inRCX };
+static uint8_t RomLine::* const romImageFlags[] = {
+    &RomLine::mOp, &RomLine::mWR, &RomLine::hashK, &RomLine::hashK1, &RomLine::hashKLen, &RomLine::hashKDigest,
+    &RomLine::hashP, &RomLine::hashP1, &RomLine::hashPLen, &RomLine::hashPDigest, &RomLine::JMP, &RomLine::JMPC,
+    &RomLine::JMPN, &RomLine::JMPZ, &RomLine::call, &RomLine::return_, &RomLine::useJmpAddr, &RomLine::useElseAddr,
+    &RomLine::useCTX, &RomLine::isStack, &RomLine::isMem, &RomLine::ind, &RomLine::indRR, &RomLine::assert,
+    &RomLine::setA, &RomLine::setB, &RomLine::setC, &RomLine::setD, &RomLine::setE, &RomLine::setSR, &RomLine::setCTX,
+    &RomLine::setSP, &RomLine::setPC, &RomLine::setGAS, &RomLine::setRR, &RomLine::setHASHPOS, &RomLine::setRCX,
+    &RomLine::sRD, &RomLine::sWR, &RomLine::arithEq0, &RomLine::arithEq1, &RomLine::arithEq2, &RomLine::bin,
+    &RomLine::binOpcode, &RomLine::memAlignRD, &RomLine::memAlignWR, &RomLine::memAlignWR8, &RomLine::repeat };
+
+void Rom::saveImage(Goldilocks &fr, const string &fileName, const string &jsonFileName)
+{
+    zkassert(line != NULL);
+
+    RomImageWriter writer;
+
+    // Program
+    writer.writeU64(size);
+    for (uint64_t i=0; i<size; i++)
+    {
+        RomLine &l = line[i];
+        writer.writeString(l.fileName);
+        writer.writeU64(l.line);
+        writer.writeString(l.lineStr);
+        saveRomCommandArray(writer, l.cmdBefore);
+        saveRomCommandArray(writer, l.cmdAfter);
+        saveRomCommand(writer, l.freeInTag);
+        writer.writeU8(l.bConstPresent);
+        writer.writeU64(l.bConstPresent ? fr.toU64(l.CONST) : 0);
+        writer.writeU8(l.bConstLPresent);
+        writer.writeString(l.bConstLPresent ? l.CONSTL.get_str(16) : "0");
+        writer.writeU8(l.bJmpAddrPresent);
+        writer.writeU64(l.bJmpAddrPresent ? fr.toU64(l.jmpAddr) : 0);
+        writer.writeU8(l.bElseAddrPresent);
+        writer.writeU64(l.bElseAddrPresent ? fr.toU64(l.elseAddr) : 0);
+        writer.writeU8(l.bOffsetPresent);
+        writer.writeU32(l.bOffsetPresent ? l.offset : 0);
+        writer.writeString(l.offsetLabel);
+        writer.writeU32(l.incStack);
+        for (Goldilocks::Element RomLine::* element : romImageElements)
+        {
+            writer.writeU64(fr.toU64(l.*element));
+        }
+        for (uint8_t RomLine::* flag : romImageFlags)
+        {
+            writer.writeU8(l.*flag);
+        }
+    }
+
+    // Labels
+    writer.writeU64(labels.size());
+    for (unordered_map<string, uint64_t>::const_iterator it = labels.begin(); it != labels.end(); it++)
+    {
+        writer.writeString(it->first);
+        writer.writeU64(it->second);
+    }
+
+    // Constants
+    writer.writeU64(MAX_CNT_STEPS_LIMIT);
+    writer.writeU64(MAX_CNT_ARITH_LIMIT);
+    writer.writeU64(MAX_CNT_BINARY_LIMIT);
+    writer.writeU64(MAX_CNT_MEM_ALIGN_LIMIT);
+    writer.writeU64(MAX_CNT_KECCAK_F_LIMIT);
+    writer.writeU64(MAX_CNT_PADDING_PG_LIMIT);
+    writer.writeU64(MAX_CNT_POSEIDON_G_LIMIT);
+
+    RomImage::write(fileName, rit_mainRom, writer.data, jsonFileName);
+    cout << "Rom::saveImage() generated " << fileName << " with " << size << " lines" << endl;
+}
+
+bool Rom::loadImage(Goldilocks &fr, const string &fileName, const string &jsonFileName)
+{
+    // Check that rom is null
+    if (line != NULL)
+    {
+        cerr << "Error: Rom::loadImage() called with line!=NULL" << endl;
+        exitProcess();
+    }
+
+    RomImage image;
+    if (!image.map(fileName, rit_mainRom, jsonFileName))
+    {
+        return false;
+    }
+    RomImageReader reader(image);
+
+    // Program; every line takes more than 64 bytes, which bounds the allocation of a corrupted size
+    uint64_t imageSize = reader.readU64();
+    if (imageSize > image.payloadSize / 64)
+    {
+        cerr << "Error: Rom::loadImage() found invalid size=" << imageSize << " in " << fileName << endl;
+        return false;
+    }
+    size = imageSize;
+    line = new RomLine[size];
+    for (uint64_t i=0; (i<size) && !reader.bError; i++)
+    {
+        RomLine &l = line[i];
+        reader.readString(l.fileName);
+        l.line = reader.readU64();
+        reader.readString(l.lineStr);
+        if ( !loadRomCommandArray(reader, l.cmdBefore) ||
+             !loadRomCommandArray(reader, l.cmdAfter) ||
+             !loadRomCommand(reader, l.freeInTag) )
+        {
+            reader.bError = true;
+            break;
+        }
+
+        // Resolve the variables into slots, and compile the commands
+        compileRomCommandArray(l.cmdBefore, varSlots, varNames);
+        compileRomCommandArray(l.cmdAfter, varSlots, varNames);
+        compileRomCommand(l.freeInTag, varSlots, varNames);
+
+        l.bConstPresent = reader.readU8();
+        l.CONST = fr.fromU64(reader.readU64());
+        l.bConstLPresent = reader.readU8();
+        string constL;
+        reader.readString(constL);
+        if (l.CONSTL.set_str(constL, 16) != 0)
+        {
+            reader.bError = true;
+        }
+        l.bJmpAddrPresent = reader.readU8();
+        l.jmpAddr = fr.fromU64(reader.readU64());
+        l.bElseAddrPresent = reader.readU8();
+        l.elseAddr = fr.fromU64(reader.readU64());
+        l.bOffsetPresent = reader.readU8();
+        l.offset = reader.readU32();
+        reader.readString(l.offsetLabel);
+        l.incStack = reader.readU32();
+        for (Goldilocks::Element RomLine::* element : romImageElements)
+        {
+            l.*element = fr.fromU64(reader.readU64());
+        }
+        for (uint8_t RomLine::* flag : romImageFlags)
+        {
+            l.*flag = reader.readU8();
+        }
+
+        if (l.bOffsetPresent && (l.offsetLabel.size() > 0))
+        {
+            memoryMap[l.offsetLabel] = l.offset;
+        }
+    }
+
+    // Labels
+    uint64_t nLabels = reader.readU64();
+    for (uint64_t i=0; (i<nLabels) && !reader.bError; i++)
+    {
+        string label;
+        reader.readString(label);
+        labels[label] = reader.readU64();
+    }
+
+    // Constants
+    MAX_CNT_STEPS_LIMIT      = reader.readU64();
+    MAX_CNT_ARITH_LIMIT      = reader.readU64();
+    MAX_CNT_BINARY_LIMIT     = reader.readU64();
+    MAX_CNT_MEM_ALIGN_LIMIT  = reader.readU64();
+    MAX_CNT_KECCAK_F_LIMIT   = reader.readU64();
+    MAX_CNT_PADDING_PG_LIMIT = reader.readU64();
+    MAX_CNT_POSEIDON_G_LIMIT = reader.readU64();
+
+    if (reader.bError || !reader.isEnd())
+    {
+        cerr << "Error: Rom::loadImage() failed parsing " << fileName << endl;
+        unload();
+        return false;
+    }
+    cout << "ROM size: " << size << " lines, loaded from " << fileName << endl;
+
+    // Get labels offsets
+    loadOffsets();
+
+    return true;
+}
+
 void Rom::unload(void)
 {
     for (uint64_t i=0; i<size; i++)
@@ -343,6 +538,11 @@ void Rom::unload(void)
     }
     delete[] line;
     line = NULL;
+    size = 0;
+    memoryMap.clear();
+    labels.clear();
+    varSlots.clear();
+    varNames.clear();
 }
 
 } // namespace
\ No newline at end of file
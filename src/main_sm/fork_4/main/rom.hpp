@@ -22,6 +22,8 @@ public:
     RomLine *line; // ROM program lines, parsed and stored in memory
     unordered_map<string, uint64_t> memoryMap; // Map of memory variables offsets
     unordered_map<string, uint64_t> labels; // ROM lines labels, i.e. names of the ROM lines
+    unordered_map<string, uint64_t> varSlots; // ROM variables slots in ctx.vars, by variable name
+    vector<string> varNames; // ROM variables names, by slot
 
     /* Offsets of memory variables */
     uint64_t memLengthOffset;
@@ -112,7 +114,14 @@ public:
     /* Parses the ROM JSON data and stores them in memory, in ctx.rom[i] */
     void load(Goldilocks &fr, json &romJson);
 
-    /* Frees any memory allocated in load() */
+    /* Loads the ROM from a binary image of the ROM JSON file, generated by saveImage(); returns false if
+       the image is missing or invalid, so that the caller can load the ROM JSON file instead */
+    bool loadImage(Goldilocks &fr, const string &fileName, const string &jsonFileName);
+
+    /* Saves the loaded ROM as a binary image of the ROM JSON file */
+    void saveImage(Goldilocks &fr, const string &fileName, const string &jsonFileName);
+
+    /* Frees any memory allocated in load() or loadImage() */
     void unload(void);
     
     uint64_t getLabel(const string &label) const;
@@ -122,6 +131,7 @@ public:
 private:
     void loadProgram(Goldilocks &fr, json &romJson);
     void loadLabels(Goldilocks &fr, json &romJson);
+    void loadOffsets(void);
 };
 
 } // namespace
@@ -307,6 +307,13 @@ void freeRomCommand (RomCommand &cmd)
     // Fee the ROM command arrays content
     freeRomCommandArray(cmd.values);
     freeRomCommandArray(cmd.params);
+
+    // Free the compiled program
+    if (cmd.pProgram != NULL)
+    {
+        delete cmd.pProgram;
+        cmd.pProgram = NULL;
+    }
 }
 
 void freeRomCommandArray (vector<RomCommand *> &array)
@@ -321,4 +328,73 @@ void freeRomCommandArray (vector<RomCommand *> &array)
     array.clear();
 }
 
+void saveRomCommand (RomImageWriter &writer, const RomCommand &cmd)
+{
+    writer.writeU8(cmd.isPresent);
+    if (!cmd.isPresent)
+    {
+        return;
+    }
+    writer.writeU8(cmd.op);
+    writer.writeString(cmd.varName);
+    writer.writeU8(cmd.reg);
+    writer.writeU8(cmd.function);
+    writer.writeString(cmd.num.get_str(16));
+    writer.writeU64(cmd.offset);
+    saveRomCommandArray(writer, cmd.values);
+    saveRomCommandArray(writer, cmd.params);
+}
+
+void saveRomCommandArray (RomImageWriter &writer, const vector<RomCommand *> &array)
+{
+    writer.writeU64(array.size());
+    for (uint64_t i=0; i<array.size(); i++)
+    {
+        saveRomCommand(writer, *array[i]);
+    }
+}
+
+bool loadRomCommand (RomImageReader &reader, RomCommand &cmd)
+{
+    cmd.isPresent = reader.readU8();
+    if (!cmd.isPresent)
+    {
+        return !reader.bError;
+    }
+    uint8_t op = reader.readU8();
+    reader.readString(cmd.varName);
+    uint8_t reg = reader.readU8();
+    uint8_t function = reader.readU8();
+    string num;
+    reader.readString(num);
+    cmd.offset = reader.readU64();
+    if ( reader.bError ||
+         (op > op_getMemValue) ||
+         (reg > reg_HASHPOS) ||
+         (function > f_onUpdateStorage) ||
+         (cmd.num.set_str(num, 16) != 0) )
+    {
+        return false;
+    }
+    cmd.op = (tOp)op;
+    cmd.reg = (tReg)reg;
+    cmd.function = (tFunction)function;
+    return loadRomCommandArray(reader, cmd.values) && loadRomCommandArray(reader, cmd.params);
+}
+
+bool loadRomCommandArray (RomImageReader &reader, vector<RomCommand *> &array)
+{
+    uint64_t size = reader.readU64();
+    for (uint64_t i=0; (i<size) && !reader.bError; i++)
+    {
+        RomCommand *pRomCommand = new RomCommand();
+        array.push_back(pRomCommand);
+        if (!loadRomCommand(reader, *pRomCommand))
+        {
+            return false;
+        }
+    }
+    return !reader.bError;
+}
+
 } // namespace
\ No newline at end of file
@@ -5,6 +5,8 @@
 #include <vector>
 #include <nlohmann/json.hpp>
 #include <gmpxx.h>
+#include "main_sm/fork_4/main/rom_program.hpp"
+#include "rom_image.hpp"
 
 using namespace std;
 using json = nlohmann::json;
@@ -120,7 +122,9 @@ public:
     vector<RomCommand *> values;
     vector<RomCommand *> params;
     uint64_t offset;
-    RomCommand() : isPresent(false), op(op_empty), reg(reg_empty), function(f_empty), num(0), offset(0) {};
+    uint64_t varSlot; // index of varName in ctx.vars, resolved by Rom::load()
+    RomProgram *pProgram; // compiled form of this command, or NULL if it must be evaluated as a tree
+    RomCommand() : isPresent(false), op(op_empty), reg(reg_empty), function(f_empty), num(0), offset(0), varSlot(0), pProgram(NULL) {};
     string toString(void) const;
 };
 
@@ -138,6 +142,13 @@ void parseRomCommand      (RomCommand &cmd, json tag);
 void freeRomCommandArray  (vector<RomCommand *> &array);
 void freeRomCommand       (RomCommand &cmd);
 
+// Functions to save/load a ROM command, or an array of them, to/from a ROM image; the variable slots and
+// the compiled programs are not saved, since compileRomCommand() recalculates them
+void saveRomCommandArray (RomImageWriter &writer, const vector<RomCommand *> &array);
+void saveRomCommand      (RomImageWriter &writer, const RomCommand &cmd);
+bool loadRomCommandArray (RomImageReader &reader, vector<RomCommand *> &array);
+bool loadRomCommand      (RomImageReader &reader, RomCommand &cmd);
+
 } // namespace
 
 #endif
\ No newline at end of file
@@ -0,0 +1,400 @@
+#include "main_sm/fork_4/main/rom_program.hpp"
+#include "main_sm/fork_4/main/rom_command.hpp"
+
+namespace fork_4
+{
+
+// Returns true if evalCommand() returns cmd as a crt_scalar, which the functions read from their params
+bool isScalarCommand (const RomCommand &cmd)
+{
+    switch (cmd.op)
+    {
+        case op_number:
+        case op_getVar:
+        case op_getMemValue:
+            return true;
+        case op_getReg:
+            return (cmd.reg >= reg_A) && (cmd.reg <= reg_SR);
+        case op_functionCall:
+            switch (cmd.function)
+            {
+                case f_bitwise_and:
+                case f_bitwise_or:
+                case f_bitwise_xor:
+                case f_bitwise_not:
+                case f_comp_lt:
+                case f_comp_gt:
+                case f_comp_eq:
+                    return true;
+                case f_loadScalar:
+                    return (cmd.params.size() == 1) && isScalarCommand(*cmd.params[0]);
+                default:
+                    return false;
+            }
+        default:
+            return (cmd.op >= op_add) && (cmd.op <= op_if);
+    }
+}
+
+// Appends the instructions that leave the value of cmd in register dst, using the registers above it as
+// temporaries; returns false if cmd has side effects, a number that does not fit in 256 bits, or needs
+// too many registers
+bool compileExpression (const RomCommand &cmd, uint64_t dst, RomProgram &program)
+{
+    if (dst >= ROM_PROGRAM_MAX_REGISTERS)
+    {
+        return false;
+    }
+    if (dst + 1 > program.nRegisters)
+    {
+        program.nRegisters = dst + 1;
+    }
+
+    RomInstruction instruction;
+    instruction.dst = dst;
+    instruction.a = dst;
+    instruction.b = dst + 1;
+    instruction.param = 0;
+    s256Set(instruction.num, 0);
+
+    switch (cmd.op)
+    {
+        case op_number:
+            if (!scalar2s256(cmd.num, instruction.num))
+            {
+                return false;
+            }
+            instruction.opcode = rpo_number;
+            program.instructions.push_back(instruction);
+            return true;
+        case op_getVar:
+            instruction.opcode = rpo_getVar;
+            instruction.param = cmd.varSlot;
+            program.instructions.push_back(instruction);
+            return true;
+        case op_getReg:
+            instruction.opcode = rpo_getReg;
+            instruction.param = cmd.reg;
+            program.instructions.push_back(instruction);
+            return true;
+        case op_getMemValue:
+            instruction.opcode = rpo_getMemValue;
+            instruction.param = cmd.offset;
+            program.instructions.push_back(instruction);
+            return true;
+        case op_neg:
+        case op_not:
+        case op_bitnot:
+            if ((cmd.values.size() != 1) || !compileExpression(*cmd.values[0], dst, program))
+            {
+                return false;
+            }
+            instruction.opcode = (cmd.op == op_neg) ? rpo_neg : (cmd.op == op_not) ? rpo_not : rpo_bitnot;
+            program.instructions.push_back(instruction);
+            return true;
+        case op_add:
+        case op_sub:
+        case op_mul:
+        case op_div:
+        case op_mod:
+        case op_or:
+        case op_and:
+        case op_gt:
+        case op_ge:
+        case op_lt:
+        case op_le:
+        case op_eq:
+        case op_ne:
+        case op_bitand:
+        case op_bitor:
+        case op_bitxor:
+        case op_shl:
+        case op_shr:
+        {
+            if ( (cmd.values.size() != 2) ||
+                 !compileExpression(*cmd.values[0], dst, program) ||
+                 !compileExpression(*cmd.values[1], dst + 1, program) )
+            {
+                return false;
+            }
+            switch (cmd.op)
+            {
+                case op_add:    instruction.opcode = rpo_add; break;
+                case op_sub:    instruction.opcode = rpo_sub; break;
+                case op_mul:    instruction.opcode = rpo_mul; break;
+                case op_div:    instruction.opcode = rpo_div; break;
+                case op_mod:    instruction.opcode = rpo_mod; break;
+                case op_or:     instruction.opcode = rpo_or; break;
+                case op_and:    instruction.opcode = rpo_and; break;
+                case op_gt:     instruction.opcode = rpo_gt; break;
+                case op_ge:     instruction.opcode = rpo_ge; break;
+                case op_lt:     instruction.opcode = rpo_lt; break;
+                case op_le:     instruction.opcode = rpo_le; break;
+                case op_eq:     instruction.opcode = rpo_eq; break;
+                case op_ne:     instruction.opcode = rpo_ne; break;
+                case op_bitand: instruction.opcode = rpo_bitand; break;
+                case op_bitor:  instruction.opcode = rpo_bitor; break;
+                case op_bitxor: instruction.opcode = rpo_bitxor; break;
+                case op_shl:    instruction.opcode = rpo_shl; break;
+                default:        instruction.opcode = rpo_shr; break;
+            }
+            program.instructions.push_back(instruction);
+            return true;
+        }
+        case op_if:
+        {
+            // r[dst] = a; if (r[dst]==0) goto else; r[dst] = b; goto end; else: r[dst] = c; end:
+            if ((cmd.values.size() != 3) || !compileExpression(*cmd.values[0], dst, program))
+            {
+                return false;
+            }
+            uint64_t jmpz = program.instructions.size();
+            instruction.opcode = rpo_jmpz;
+            program.instructions.push_back(instruction);
+            if (!compileExpression(*cmd.values[1], dst, program))
+            {
+                return false;
+            }
+            uint64_t jmp = program.instructions.size();
+            instruction.opcode = rpo_jmp;
+            program.instructions.push_back(instruction);
+            program.instructions[jmpz].param = program.instructions.size();
+            if (!compileExpression(*cmd.values[2], dst, program))
+            {
+                return false;
+            }
+            program.instructions[jmp].param = program.instructions.size();
+            return true;
+        }
+        case op_functionCall:
+        {
+            // The functions read their params as crt_scalar, whatever type evalCommand() returns
+            for (uint64_t i = 0; i < cmd.params.size(); i++)
+            {
+                if (!isScalarCommand(*cmd.params[i]))
+                {
+                    return false;
+                }
+            }
+            switch (cmd.function)
+            {
+                case f_loadScalar:
+                    return (cmd.params.size() == 1) && compileExpression(*cmd.params[0], dst, program);
+                case f_bitwise_not:
+                    if ((cmd.params.size() != 1) || !compileExpression(*cmd.params[0], dst, program))
+                    {
+                        return false;
+                    }
+                    instruction.opcode = rpo_bitnot256;
+                    program.instructions.push_back(instruction);
+                    return true;
+                case f_bitwise_and:
+                case f_bitwise_or:
+                case f_bitwise_xor:
+                case f_comp_lt:
+                case f_comp_gt:
+                case f_comp_eq:
+                    if ( (cmd.params.size() != 2) ||
+                         !compileExpression(*cmd.params[0], dst, program) ||
+                         !compileExpression(*cmd.params[1], dst + 1, program) )
+                    {
+                        return false;
+                    }
+                    switch (cmd.function)
+                    {
+                        case f_bitwise_and: instruction.opcode = rpo_bitand; break;
+                        case f_bitwise_or:  instruction.opcode = rpo_bitor; break;
+                        case f_bitwise_xor: instruction.opcode = rpo_bitxor; break;
+                        case f_comp_lt:     instruction.opcode = rpo_lt; break;
+                        case f_comp_gt:     instruction.opcode = rpo_gt; break;
+                        default:            instruction.opcode = rpo_eq; break;
+                    }
+                    program.instructions.push_back(instruction);
+                    return true;
+                default:
+                    // Functions with side effects, or that return field elements or strings
+                    return false;
+            }
+        }
+        default:
+            // Variable declarations and assignments, which are only compiled as a whole command
+            return false;
+    }
+}
+
+// Compiles a variable declaration or assignment, whose side effect is the last instruction
+bool compileAssignment (const RomCommand &cmd, RomProgram &program)
+{
+    RomInstruction instruction;
+    instruction.dst = 0;
+    instruction.a = 0;
+    instruction.b = 1;
+    s256Set(instruction.num, 0);
+
+    if (cmd.op == op_declareVar)
+    {
+        // Declares the variable with a zero value
+        instruction.opcode = rpo_number;
+        instruction.param = 0;
+        program.instructions.push_back(instruction);
+        program.nRegisters = 1;
+        instruction.opcode = rpo_declareVar;
+        instruction.param = cmd.varSlot;
+        program.instructions.push_back(instruction);
+        return true;
+    }
+
+    // setVar: values[0] is the variable, possibly declared in place, and values[1] its new value
+    if ( (cmd.values.size() != 2) ||
+         ((cmd.values[0]->op != op_declareVar) && (cmd.values[0]->op != op_getVar)) ||
+         !compileExpression(*cmd.values[1], 0, program) )
+    {
+        return false;
+    }
+    instruction.opcode = (cmd.values[0]->op == op_declareVar) ? rpo_declareVar : rpo_setVar;
+    instruction.param = cmd.values[0]->varSlot;
+
+    // A tree declares the variable before evaluating the value, which then reads it as zero, while the
+    // program declares it at the end, so such values are left to the tree
+    if (instruction.opcode == rpo_declareVar)
+    {
+        for (uint64_t i = 0; i < program.instructions.size(); i++)
+        {
+            if ((program.instructions[i].opcode == rpo_getVar) && (program.instructions[i].param == instruction.param))
+            {
+                return false;
+            }
+        }
+    }
+    program.instructions.push_back(instruction);
+    return true;
+}
+
+void compileRomCommand (RomCommand &cmd, unordered_map<string, uint64_t> &varSlots, vector<string> &varNames)
+{
+    if (!cmd.isPresent)
+    {
+        return;
+    }
+
+    compileRomCommandArray(cmd.values, varSlots, varNames);
+    compileRomCommandArray(cmd.params, varSlots, varNames);
+
+    // Resolve the variable name into its slot in ctx.vars
+    if ((cmd.op == op_declareVar) || (cmd.op == op_getVar))
+    {
+        unordered_map<string, uint64_t>::iterator it = varSlots.find(cmd.varName);
+        if (it == varSlots.end())
+        {
+            cmd.varSlot = varNames.size();
+            varSlots[cmd.varName] = cmd.varSlot;
+            varNames.push_back(cmd.varName);
+        }
+        else
+        {
+            cmd.varSlot = it->second;
+        }
+    }
+
+    // The leaves are not compiled, since evalCommand() returns them with their own types
+    if ( ((cmd.op >= op_add) && (cmd.op <= op_if)) ||
+         (cmd.op == op_functionCall) ||
+         (cmd.op == op_setVar) ||
+         (cmd.op == op_declareVar) )
+    {
+        RomProgram *pProgram = new RomProgram();
+        bool bCompiled = ((cmd.op == op_setVar) || (cmd.op == op_declareVar)) ?
+                         compileAssignment(cmd, *pProgram) :
+                         compileExpression(cmd, 0, *pProgram);
+        if (bCompiled)
+        {
+            cmd.pProgram = pProgram;
+        }
+        else
+        {
+            delete pProgram;
+        }
+    }
+}
+
+void compileRomCommandArray (vector<RomCommand *> &array, unordered_map<string, uint64_t> &varSlots, vector<string> &varNames)
+{
+    for (uint64_t i = 0; i < array.size(); i++)
+    {
+        compileRomCommand(*array[i], varSlots, varNames);
+    }
+}
+
+bool evalRomOperation (tRomProgramOpcode opcode, const S256 &a, const S256 &b, S256 &r)
+{
+    switch (opcode)
+    {
+        case rpo_add: return s256Add(a, b, r);
+        case rpo_sub: return s256Sub(a, b, r);
+        case rpo_neg: s256Neg(a, r); return true;
+        case rpo_mul: return s256Mul(a, b, r);
+        case rpo_div:
+        {
+            S256 remainder;
+            return s256DivMod(a, b, r, remainder);
+        }
+        case rpo_mod:
+        {
+            S256 quotient;
+            return s256DivMod(a, b, quotient, r);
+        }
+        case rpo_or:  s256Set(r, (!s256IsZero(a) || !s256IsZero(b)) ? 1 : 0); return true;
+        case rpo_and: s256Set(r, (!s256IsZero(a) && !s256IsZero(b)) ? 1 : 0); return true;
+        case rpo_gt:  s256Set(r, (s256Compare(a, b) > 0) ? 1 : 0); return true;
+        case rpo_ge:  s256Set(r, (s256Compare(a, b) >= 0) ? 1 : 0); return true;
+        case rpo_lt:  s256Set(r, (s256Compare(a, b) < 0) ? 1 : 0); return true;
+        case rpo_le:  s256Set(r, (s256Compare(a, b) <= 0) ? 1 : 0); return true;
+        case rpo_eq:  s256Set(r, (s256Compare(a, b) == 0) ? 1 : 0); return true;
+        case rpo_ne:  s256Set(r, (s256Compare(a, b) != 0) ? 1 : 0); return true;
+        case rpo_not: s256Set(r, s256IsZero(a) ? 1 : 0); return true;
+        case rpo_bitnot: return s256BitNot(a, r);
+        default:
+            break;
+    }
+
+    // The bitwise operations and shifts of negative values use two's complement of unlimited width;
+    // rpo_bitnot256 has no operand b
+    if (a.negative || ((opcode != rpo_bitnot256) && b.negative))
+    {
+        return false;
+    }
+    switch (opcode)
+    {
+        case rpo_bitand: u256And(a.abs, b.abs, r.abs); break;
+        case rpo_bitor:  u256Or(a.abs, b.abs, r.abs); break;
+        case rpo_bitxor: u256Xor(a.abs, b.abs, r.abs); break;
+        case rpo_bitnot256:
+        {
+            U256 mask256 = {{0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF}};
+            u256Xor(a.abs, mask256, r.abs);
+            break;
+        }
+        case rpo_shl:
+        case rpo_shr:
+            // The shift is b.get_ui(), so it must fit in 64 bits
+            if ((b.abs.limbs[1] | b.abs.limbs[2] | b.abs.limbs[3]) != 0)
+            {
+                return false;
+            }
+            if (opcode == rpo_shr)
+            {
+                u256Shr(a.abs, b.abs.limbs[0], r.abs);
+            }
+            else if (!u256Shl(a.abs, b.abs.limbs[0], r.abs))
+            {
+                return false;
+            }
+            break;
+        default:
+            return false;
+    }
+    r.negative = false;
+    return true;
+}
+
+} // namespace
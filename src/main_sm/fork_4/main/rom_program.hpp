@@ -0,0 +1,158 @@
+#ifndef ROM_PROGRAM_HPP_fork_4
+#define ROM_PROGRAM_HPP_fork_4
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include "u256.hpp"
+
+using namespace std;
+
+namespace fork_4
+{
+
+class RomCommand;
+
+// Maximum number of registers of a ROM program; deeper expressions are not compiled
+#define ROM_PROGRAM_MAX_REGISTERS 32
+
+// Opcodes of the ROM program instructions: the ROM command operations, the functions without side
+// effects, variable assignments and jumps
+typedef enum : uint8_t
+{
+    rpo_number = 0,     // r[dst] = num
+    rpo_getVar,         // r[dst] = ctx.vars[param]
+    rpo_getReg,         // r[dst] = register param
+    rpo_getMemValue,    // r[dst] = ctx.mem[param]
+    rpo_add,            // r[dst] = r[a] + r[b], and so on up to rpo_bitnot256
+    rpo_sub,
+    rpo_neg,
+    rpo_mul,
+    rpo_div,
+    rpo_mod,
+    rpo_or,
+    rpo_and,
+    rpo_gt,
+    rpo_ge,
+    rpo_lt,
+    rpo_le,
+    rpo_eq,
+    rpo_ne,
+    rpo_not,
+    rpo_bitand,
+    rpo_bitor,
+    rpo_bitxor,
+    rpo_bitnot,         // r[dst] = ~r[a], i.e. -r[a] - 1
+    rpo_shl,
+    rpo_shr,
+    rpo_bitnot256,      // r[dst] = r[a] ^ (2^256 - 1), as the bitwise_not function
+    rpo_jmpz,           // if r[a] == 0, go to instruction param
+    rpo_jmp,            // go to instruction param
+    rpo_setVar,         // ctx.vars[param] = r[a]; only the last instruction of a program
+    rpo_declareVar      // declare ctx.vars[param], then as rpo_setVar
+} tRomProgramOpcode;
+
+class RomInstruction
+{
+public:
+    tRomProgramOpcode opcode;
+    uint8_t dst;
+    uint8_t a;
+    uint8_t b;
+    uint64_t param; // Variable slot, register, memory offset or instruction, depending on the opcode
+    S256 num; // Used by rpo_number
+};
+
+// Flat, register-based form of a ROM command, which leaves its result in register 0.  Only its last
+// instruction can have side effects, so a program that fails half way can be evaluated again as a tree
+class RomProgram
+{
+public:
+    vector<RomInstruction> instructions;
+    uint64_t nRegisters;
+    RomProgram() : nRegisters(0) {};
+};
+
+// Assigns a slot to every variable used by the command and its values and params, adding new variables
+// to varSlots and varNames, and compiles into a RomProgram every expression, assignment and function
+// without side effects whose numbers fit in 256 bits
+void compileRomCommand      (RomCommand &cmd, unordered_map<string, uint64_t> &varSlots, vector<string> &varNames);
+void compileRomCommandArray (vector<RomCommand *> &array, unordered_map<string, uint64_t> &varSlots, vector<string> &varNames);
+
+// Computes r = a <op> b for the opcodes from rpo_add to rpo_bitnot256, as the eval_*() functions do on
+// mpz_class; returns false if the result does not fit in 256 bits, or if mpz_class must compute it, e.g.
+// for the bitwise operations and shifts of negative values or a division by zero
+bool evalRomOperation (tRomProgramOpcode opcode, const S256 &a, const S256 &b, S256 &r);
+
+/* Runs a ROM program.  The host provides the values of the leaves and stores the variables:
+     bool getVar (uint64_t slot, S256 &r);
+     bool getReg (uint64_t reg, S256 &r);
+     bool getMemValue (uint64_t offset, S256 &r);
+     bool setVar (uint64_t slot, bool bDeclare, const S256 &value);
+   Returns false as soon as any of them, or any operation, returns false */
+template <class Host>
+bool runRomProgram (const RomProgram &program, Host &host, S256 &result)
+{
+    S256 r[ROM_PROGRAM_MAX_REGISTERS + 1]; // Operand b of the last register is never read
+    const RomInstruction *pInstructions = program.instructions.data();
+    uint64_t nInstructions = program.instructions.size();
+    uint64_t pc = 0;
+    while (pc < nInstructions)
+    {
+        const RomInstruction &instruction = pInstructions[pc];
+        pc++;
+        S256 &dst = r[instruction.dst];
+        switch (instruction.opcode)
+        {
+            case rpo_number:
+                dst = instruction.num;
+                break;
+            case rpo_getVar:
+                if (!host.getVar(instruction.param, dst))
+                {
+                    return false;
+                }
+                break;
+            case rpo_getReg:
+                if (!host.getReg(instruction.param, dst))
+                {
+                    return false;
+                }
+                break;
+            case rpo_getMemValue:
+                if (!host.getMemValue(instruction.param, dst))
+                {
+                    return false;
+                }
+                break;
+            case rpo_jmpz:
+                if (s256IsZero(r[instruction.a]))
+                {
+                    pc = instruction.param;
+                }
+                break;
+            case rpo_jmp:
+                pc = instruction.param;
+                break;
+            case rpo_setVar:
+            case rpo_declareVar:
+                if (!host.setVar(instruction.param, instruction.opcode == rpo_declareVar, r[instruction.a]))
+                {
+                    return false;
+                }
+                dst = r[instruction.a];
+                break;
+            default:
+                if (!evalRomOperation(instruction.opcode, r[instruction.a], r[instruction.b], dst))
+                {
+                    return false;
+                }
+        }
+    }
+    result = r[0];
+    return true;
+}
+
+} // namespace
+
+#endif
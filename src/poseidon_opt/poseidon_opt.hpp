@@ -8,25 +8,217 @@
 #include <cassert>
 using namespace std;
 
+// Number of independent states hashed together by the multi-lane hash; interleaving them keeps the
+// field multiplier busy while every single state waits for its previous operation
+#define POSEIDON_OPT_LANES 4
+
+// Constants of the permutation of width t, built from Constants_opt the first time they are used.
+// The matrices are transposed, so that every output element reads a contiguous row
+template <unsigned int t>
+class PoseidonOptConstants
+{
+public:
+  const RawFr::Element *C;
+  const RawFr::Element *S;
+  RawFr::Element M[t][t];
+  RawFr::Element P[t][t];
+
+  static const PoseidonOptConstants &get(void)
+  {
+    static const PoseidonOptConstants constants;
+    return constants;
+  }
+
+private:
+  PoseidonOptConstants()
+  {
+    C = Constants_opt::C[t - 2].data();
+    S = Constants_opt::S[t - 2].data();
+    for (unsigned int i = 0; i < t; i++)
+    {
+      for (unsigned int j = 0; j < t; j++)
+      {
+        M[i][j] = Constants_opt::M[t - 2][j][i];
+        P[i][j] = Constants_opt::P[t - 2][j][i];
+      }
+    }
+  }
+};
+
 class Poseidon_opt
 {
   typedef RawFr::Element FrElement;
 
   const static int N_ROUNDS_F = 8;
-  const unsigned int N_ROUNDS_P[16] = {56, 57, 56, 60, 60, 63, 64, 63, 60, 66, 60, 65, 70, 60, 64, 68};
+  constexpr static unsigned int N_ROUNDS_P[16] = {56, 57, 56, 60, 60, 63, 64, 63, 60, 66, 60, 65, 70, 60, 64, 68};
 
 private:
   RawFr field;
-  void ark(vector<FrElement> *state, const vector<FrElement> *c, const int ssize, int it);
-  void sbox(vector<FrElement> *state, const vector<FrElement> *c, const int ssize, int it);
-  void mix(vector<FrElement> *new_state, vector<FrElement> state, const vector<vector<FrElement>> *m, const int ssize);
   void exp5(FrElement &r);
-  void stateExp5(vector<FrElement> *state, const int ssize);
+
+  template <unsigned int t, unsigned int lanes>
+  void sbox(FrElement (&state)[lanes][t], const FrElement *c);
+  template <unsigned int t, unsigned int lanes>
+  void mix(FrElement (&state)[lanes][t], const FrElement (&m)[t][t]);
 
 public:
   void hash(vector<FrElement> &state);
   void hash(vector<FrElement> &state, FrElement *result);
   void gmimc(vector<FrElement>, FrElement *result);
+
+  // Hashes lanes independent states of width t (2 to 17), without allocating any memory
+  template <unsigned int t, unsigned int lanes = 1>
+  void hash(FrElement (&state)[lanes][t]);
+
+  // Same as above for a width only known at runtime; the states are stored one after the other,
+  // i.e. state[l*t+i] is element i of lane l
+  template <unsigned int lanes = 1>
+  void hash(FrElement *state, const unsigned int t);
 };
 
-#endif // POSEIDON_OPT
\ No newline at end of file
+inline void Poseidon_opt::exp5(FrElement &r)
+{
+	FrElement aux = r;
+	field.square(r, r);
+	field.square(r, r);
+	field.mul(r, r, aux);
+}
+
+template <unsigned int t, unsigned int lanes>
+void Poseidon_opt::sbox(FrElement (&state)[lanes][t], const FrElement *c)
+{
+	for (unsigned int i = 0; i < t; i++)
+	{
+		for (unsigned int l = 0; l < lanes; l++)
+		{
+			exp5(state[l][i]);
+			field.add(state[l][i], state[l][i], c[i]);
+		}
+	}
+}
+
+template <unsigned int t, unsigned int lanes>
+void Poseidon_opt::mix(FrElement (&state)[lanes][t], const FrElement (&m)[t][t])
+{
+	FrElement newState[lanes][t];
+	FrElement aux;
+	for (unsigned int i = 0; i < t; i++)
+	{
+		for (unsigned int l = 0; l < lanes; l++)
+		{
+			field.mul(newState[l][i], m[i][0], state[l][0]);
+		}
+		for (unsigned int j = 1; j < t; j++)
+		{
+			for (unsigned int l = 0; l < lanes; l++)
+			{
+				field.mul(aux, m[i][j], state[l][j]);
+				field.add(newState[l][i], newState[l][i], aux);
+			}
+		}
+	}
+	for (unsigned int l = 0; l < lanes; l++)
+	{
+		for (unsigned int i = 0; i < t; i++)
+		{
+			state[l][i] = newState[l][i];
+		}
+	}
+}
+
+template <unsigned int t, unsigned int lanes>
+void Poseidon_opt::hash(FrElement (&state)[lanes][t])
+{
+	static_assert((t >= 2) && (t <= 17), "Poseidon_opt::hash() supports widths from 2 to 17");
+	const PoseidonOptConstants<t> &constants = PoseidonOptConstants<t>::get();
+	const unsigned int nRoundsP = N_ROUNDS_P[t - 2];
+	const FrElement *c = constants.C;
+	const FrElement *s = constants.S;
+	FrElement aux;
+
+	for (unsigned int i = 0; i < t; i++)
+	{
+		for (unsigned int l = 0; l < lanes; l++)
+		{
+			field.add(state[l][i], state[l][i], c[i]);
+		}
+	}
+	for (int r = 0; r < N_ROUNDS_F / 2 - 1; r++)
+	{
+		sbox(state, &c[(r + 1) * t]);
+		mix(state, constants.M);
+	}
+	sbox(state, &c[(N_ROUNDS_F / 2 - 1 + 1) * t]);
+	mix(state, constants.P);
+	for (unsigned int r = 0; r < nRoundsP; r++)
+	{
+		const FrElement *sr = &s[(t * 2 - 1) * r];
+		FrElement s0[lanes];
+		for (unsigned int l = 0; l < lanes; l++)
+		{
+			exp5(state[l][0]);
+			field.add(state[l][0], state[l][0], c[(N_ROUNDS_F / 2 + 1) * t + r]);
+			field.mul(s0[l], sr[0], state[l][0]);
+		}
+		for (unsigned int j = 1; j < t; j++)
+		{
+			for (unsigned int l = 0; l < lanes; l++)
+			{
+				field.mul(aux, sr[j], state[l][j]);
+				field.add(s0[l], s0[l], aux);
+				field.mul(aux, state[l][0], sr[t + j - 1]);
+				field.add(state[l][j], state[l][j], aux);
+			}
+		}
+		for (unsigned int l = 0; l < lanes; l++)
+		{
+			state[l][0] = s0[l];
+		}
+	}
+	for (int r = 0; r < N_ROUNDS_F / 2 - 1; r++)
+	{
+		sbox(state, &c[(N_ROUNDS_F / 2 + 1) * t + nRoundsP + r * t]);
+		mix(state, constants.M);
+	}
+	for (unsigned int i = 0; i < t; i++)
+	{
+		for (unsigned int l = 0; l < lanes; l++)
+		{
+			exp5(state[l][i]);
+		}
+	}
+	mix(state, constants.M);
+}
+
+template <unsigned int lanes>
+void Poseidon_opt::hash(FrElement *state, const unsigned int t)
+{
+	switch (t)
+	{
+#define POSEIDON_OPT_HASH_CASE(T) \
+	case T:                       \
+		hash<T, lanes>(*(FrElement(*)[lanes][T])state); \
+		break;
+	POSEIDON_OPT_HASH_CASE(2)
+	POSEIDON_OPT_HASH_CASE(3)
+	POSEIDON_OPT_HASH_CASE(4)
+	POSEIDON_OPT_HASH_CASE(5)
+	POSEIDON_OPT_HASH_CASE(6)
+	POSEIDON_OPT_HASH_CASE(7)
+	POSEIDON_OPT_HASH_CASE(8)
+	POSEIDON_OPT_HASH_CASE(9)
+	POSEIDON_OPT_HASH_CASE(10)
+	POSEIDON_OPT_HASH_CASE(11)
+	POSEIDON_OPT_HASH_CASE(12)
+	POSEIDON_OPT_HASH_CASE(13)
+	POSEIDON_OPT_HASH_CASE(14)
+	POSEIDON_OPT_HASH_CASE(15)
+	POSEIDON_OPT_HASH_CASE(16)
+	POSEIDON_OPT_HASH_CASE(17)
+#undef POSEIDON_OPT_HASH_CASE
+	default:
+		assert(false);
+	}
+}
+
+#endif // POSEIDON_OPT
@@ -1,6 +1,9 @@
 #include <fstream>
 #include <iomanip>
 #include <unistd.h>
+#include <dlfcn.h>
+#include <limits.h>
+#include <string.h>
 #include "prover.hpp"
 #include "utils.hpp"
 #include "scalar.hpp"
@@ -30,14 +33,18 @@
 #include "recursive1Steps.hpp"
 #include "recursive2Steps.hpp"
 
-#define NROWS_STEPS_ 4 // if AVX is used this must be 4
-
 Prover::Prover(Goldilocks &fr,
                PoseidonGoldilocks &poseidon,
                const Config &config) : fr(fr),
                                        poseidon(poseidon),
                                        executor(fr, config, poseidon),
-                                       pCurrentRequest(NULL),
+                                       pZkevmSteps(NULL),
+                                       pZkevmStepsAvx512Lib(NULL),
+                                       pChelpersJit(NULL),
+                                       polsSize(0),
+                                       polsSizeRecursive2(0),
+                                       reservedMemory(0),
+                                       maxMemory(0),
                                        config(config),
                                        lastComputedRequestEndTime(0)
 {
@@ -80,17 +87,15 @@ Prover::Prover(Goldilocks &fr,
 
             lastComputedRequestEndTime = 0;
 
-            sem_init(&pendingRequestSem, 0, 0);
             pthread_mutex_init(&mutex, NULL);
-            pCurrentRequest = NULL;
-            pthread_create(&proverPthread, NULL, proverThread, this);
+            pthread_cond_init(&pendingRequestCond, NULL);
             pthread_create(&cleanerPthread, NULL, cleanerThread, this);
 
             StarkInfo _starkInfo(config, config.zkevmStarkInfo);
 
             // Allocate an area of memory, mapped to file, to store all the committed polynomials,
             // and create them using the allocated address
-            uint64_t polsSize = _starkInfo.mapTotalN * sizeof(Goldilocks::Element) + _starkInfo.mapSectionsN.section[eSection::cm3_2ns] * (1 << _starkInfo.starkStruct.nBitsExt) * sizeof(Goldilocks::Element);
+            polsSize = _starkInfo.mapTotalN * sizeof(Goldilocks::Element) + _starkInfo.mapSectionsN.section[eSection::cm3_2ns] * (1 << _starkInfo.starkStruct.nBitsExt) * sizeof(Goldilocks::Element);
 
             zkassert(_starkInfo.mapSectionsN.section[eSection::cm1_2ns] * sizeof(Goldilocks::Element) <= polsSize - _starkInfo.mapSectionsN.section[eSection::cm2_2ns] * sizeof(Goldilocks::Element));
 
@@ -119,12 +124,86 @@ Prover::Prover(Goldilocks &fr,
             StarkInfo _starkInfoRecursiveF(config, config.recursivefStarkInfo);
             pAddressStarksRecursiveF = (void *)malloc(_starkInfoRecursiveF.mapTotalN * sizeof(Goldilocks::Element));
 
-            starkZkevm = new Starks(config, {config.zkevmConstPols, config.mapConstPolsFile, config.zkevmConstantsTree, config.zkevmStarkInfo}, pAddress);
-            starkZkevm->nrowsStepBatch = NROWS_STEPS_;
-            starksC12a = new Starks(config, {config.c12aConstPols, config.mapConstPolsFile, config.c12aConstantsTree, config.c12aStarkInfo}, pAddress);
-            starksRecursive1 = new Starks(config, {config.recursive1ConstPols, config.mapConstPolsFile, config.recursive1ConstantsTree, config.recursive1StarkInfo}, pAddress);
-            starksRecursive2 = new Starks(config, {config.recursive2ConstPols, config.mapConstPolsFile, config.recursive2ConstantsTree, config.recursive2StarkInfo}, pAddress);
+            // The aggregated lane gets its own committed polynomials buffer only if it fits in the memory budget
+            // together with the batch lane; otherwise, aggregated proofs are computed in the batch lane
+            StarkInfo _starkInfoRecursive2(config, config.recursive2StarkInfo);
+            polsSizeRecursive2 = _starkInfoRecursive2.mapTotalN * sizeof(Goldilocks::Element) + _starkInfoRecursive2.mapSectionsN.section[eSection::cm3_2ns] * (1 << _starkInfoRecursive2.starkStruct.nBitsExt) * sizeof(Goldilocks::Element);
+            maxMemory = config.maxProverMemory * 1024 * 1024;
+            MemoryInfo memoryInfo;
+            getMemoryInfo(memoryInfo);
+            uint64_t availableMemory = memoryInfo.available * 1024; // getMemoryInfo() returns kB
+            uint64_t concurrentMemory = polsSizeRecursive2 + getStarkTransientMemory(_starkInfo) + getStarkTransientMemory(_starkInfoRecursive2);
+            StarkInfo _starkInfoC12a(config, config.c12aStarkInfo);
+            StarkInfo _starkInfoRecursive1(config, config.recursive1StarkInfo);
+            treesMemory = getStarkTreesMemory(_starkInfo) + getStarkTreesMemory(_starkInfoC12a) + getStarkTreesMemory(_starkInfoRecursive1) + getStarkTreesMemory(_starkInfoRecursive2); // Allocated below, by the Starks constructors
+            if ((concurrentMemory + treesMemory <= availableMemory) && ((maxMemory == 0) || (polsSize + treesMemory + concurrentMemory <= maxMemory)))
+            {
+                pAddressStarksRecursive2 = malloc(polsSizeRecursive2);
+            }
+            if (pAddressStarksRecursive2 == NULL)
+            {
+                pAddressStarksRecursive2 = pAddress;
+                cout << "Prover::Prover() aggregated proofs will be computed in the batch lane" << endl;
+            }
+            else
+            {
+                cout << "Prover::Prover() successfully allocated " << polsSizeRecursive2 << " bytes for the aggregated lane" << endl;
+            }
+
+            starkZkevm = new Starks(config, {config.zkevmConstPols, config.mapConstPolsFile, config.zkevmConstantsTree, config.zkevmStarkInfo}, pAddress, polsSize);
+            if (config.chelpersAvx512)
+            {
+                pZkevmSteps = newZkevmStepsAvx512();
+            }
+            if (pZkevmSteps != NULL)
+            {
+                starkZkevm->nrowsStepBatch = ZKEVM_STEPS_AVX512_NROWS_BATCH;
+                cout << "Prover::Prover() computing the zkevm steps with the AVX-512 chelpers parsers and kernels" << endl;
+            }
+            else
+            {
+                pZkevmSteps = new ZkevmSteps();
+                starkZkevm->nrowsStepBatch = ZKEVM_STEPS_AVX2_NROWS_BATCH;
+            }
+            if (config.chelpersJit)
+            {
+                map<string, ChelpersJitFunction> kernels;
+                pZkevmSteps->getJitKernels(kernels);
+                pChelpersJit = new ChelpersJit(kernels, starkZkevm->nrowsStepBatch);
+                starkZkevm->pChelpersJit = pChelpersJit;
+            }
+            if ((config.stepsTileL2Size > 0) && (pChelpersJit != NULL))
+            {
+                cout << "Prover::Prover() stepsTileL2Size does not apply to the zkevm steps run by the chelpers JIT kernels, only to their parsers" << endl;
+            }
+            starksC12a = new Starks(config, {config.c12aConstPols, config.mapConstPolsFile, config.c12aConstantsTree, config.c12aStarkInfo}, pAddress, polsSize);
+            starksRecursive1 = new Starks(config, {config.recursive1ConstPols, config.mapConstPolsFile, config.recursive1ConstantsTree, config.recursive1StarkInfo}, pAddress, polsSize);
+            starksRecursive2 = new Starks(config, {config.recursive2ConstPols, config.mapConstPolsFile, config.recursive2ConstantsTree, config.recursive2StarkInfo}, pAddressStarksRecursive2, (pAddressStarksRecursive2 != pAddress) ? polsSizeRecursive2 : polsSize);
             starksRecursiveF = new StarkRecursiveF(config, pAddressStarksRecursiveF);
+
+            // Start one thread per lane, once all the STARKs are ready; the OpenMP threads are handed
+            // out to the lanes as their requests start, see getRequestThreads()
+            reservedMemory = 0;
+            nThreads = omp_get_max_threads();
+            for (uint64_t i = 0; i < PROVER_LANES; i++)
+            {
+                lanes[i].pProver = this;
+                lanes[i].lane = (tProverLane)i;
+                lanes[i].pCurrentRequest = NULL;
+                lanes[i].reservedMemory = 0;
+                lanes[i].nThreads = 0;
+            }
+            lanes[pl_batch].bEnabled = true;
+            lanes[pl_aggregated].bEnabled = (pAddressStarksRecursive2 != pAddress);
+            lanes[pl_final].bEnabled = (Zkey::GROTH16_PROTOCOL_ID == protocolId);
+            for (uint64_t i = 0; i < PROVER_LANES; i++)
+            {
+                // The requests of a disabled lane are computed in the batch lane, so it needs no thread
+                if (lanes[i].bEnabled)
+                {
+                    pthread_create(&lanes[i].pthread, NULL, proverThread, &lanes[i]);
+                }
+            }
         }
     }
     catch (std::exception &e)
@@ -155,8 +234,6 @@ Prover::~Prover()
 
         mpz_clear(altBbn128r);
 
-        uint64_t polsSize = starkZkevm->starkInfo.mapTotalN * sizeof(Goldilocks::Element) + starkZkevm->starkInfo.mapSectionsN.section[eSection::cm1_n] * (1 << starkZkevm->starkInfo.starkStruct.nBits) * FIELD_EXTENSION * sizeof(Goldilocks::Element);
-
         // Unmap committed polynomials address
         if (config.zkevmCmPols.size() > 0)
         {
@@ -166,6 +243,10 @@ Prover::~Prover()
         {
             free(pAddress);
         }
+        if (pAddressStarksRecursive2 != pAddress)
+        {
+            free(pAddressStarksRecursive2);
+        }
         free(pAddressStarksRecursiveF);
 
         delete prover;
@@ -174,76 +255,369 @@ Prover::~Prover()
         delete starksC12a;
         delete starksRecursive1;
         delete starksRecursive2;
+        delete pChelpersJit;
+        delete pZkevmSteps;
+        if (pZkevmStepsAvx512Lib != NULL)
+        {
+            dlclose(pZkevmStepsAvx512Lib);
+        }
     }
 }
 
-void *proverThread(void *arg)
+ZkevmSteps *Prover::newZkevmStepsAvx512(void)
 {
-    Prover *pProver = (Prover *)arg;
-    cout << "proverThread() started" << endl;
+    if (!__builtin_cpu_supports("avx512f"))
+    {
+        return NULL;
+    }
 
-    zkassert(pProver->config.generateProof());
+    // The library is installed next to the executable
+    char exePath[PATH_MAX];
+    ssize_t exePathSize = readlink("/proc/self/exe", exePath, sizeof(exePath) - 1);
+    if (exePathSize < 0)
+    {
+        cerr << "Error: Prover::newZkevmStepsAvx512() failed calling readlink() errno=" << errno << "=" << strerror(errno) << endl;
+        return NULL;
+    }
+    exePath[exePathSize] = 0;
+    string libPath = exePath;
+    libPath = libPath.substr(0, libPath.find_last_of('/') + 1) + ZKEVM_STEPS_AVX512_LIB;
 
-    while (true)
+    pZkevmStepsAvx512Lib = dlopen(libPath.c_str(), RTLD_NOW | RTLD_LOCAL);
+    if (pZkevmStepsAvx512Lib == NULL)
     {
-        pProver->lock();
+        cout << "Prover::newZkevmStepsAvx512() could not load " << libPath << ", using the AVX2 chelpers parsers and kernels: " << dlerror() << endl;
+        return NULL;
+    }
+    ZkevmStepsAvx512New pNew = (ZkevmStepsAvx512New)dlsym(pZkevmStepsAvx512Lib, ZKEVM_STEPS_AVX512_NEW);
+    if (pNew == NULL)
+    {
+        cerr << "Error: Prover::newZkevmStepsAvx512() could not find " << ZKEVM_STEPS_AVX512_NEW << " in " << libPath << ": " << dlerror() << endl;
+        dlclose(pZkevmStepsAvx512Lib);
+        pZkevmStepsAvx512Lib = NULL;
+        return NULL;
+    }
+    return pNew();
+}
+
+uint64_t Prover::getStarkTransientMemory(const StarkInfo &starkInfo)
+{
+    // genProof() allocates evals, xDivXSubXi and xDivXSubWXi on top of the committed polynomials buffer
+    uint64_t N = 1 << starkInfo.starkStruct.nBits;
+    uint64_t NExtended = 1 << starkInfo.starkStruct.nBitsExt;
+    uint64_t memory = (N + 2 * NExtended) * FIELD_EXTENSION * sizeof(Goldilocks::Element);
+
+    // FRIProve::prove() allocates, for every step but the last one, the transposed polynomial, and a
+    // merkle tree with its own copy of it as source plus its nodes
+    for (uint64_t si = 0; si + 1 < starkInfo.starkStruct.steps.size(); si++)
+    {
+        uint64_t pol2N = 1 << starkInfo.starkStruct.steps[si].nBits;
+        uint64_t nGroups = 1 << starkInfo.starkStruct.steps[si + 1].nBits;
+        memory += 2 * pol2N * FIELD_EXTENSION * sizeof(Goldilocks::Element);
+        memory += (2 * nGroups - 1) * HASH_SIZE * sizeof(Goldilocks::Element);
+    }
+    return memory;
+}
+
+uint64_t Prover::getStarkTreesMemory(const StarkInfo &starkInfo)
+{
+    // The Starks constructor allocates the nodes of the merkle trees of the 4 committed stages; the
+    // constant polynomials tree is mapped from file
+    uint64_t NExtended = 1 << starkInfo.starkStruct.nBitsExt;
+    return 4 * (2 * NExtended - 1) * HASH_SIZE * sizeof(Goldilocks::Element);
+}
+
+uint64_t Prover::getLanesMemory(void)
+{
+    // When the aggregated lane shares the batch lane buffer, polsSizeRecursive2 is not allocated
+    return polsSize + treesMemory + ((pAddressStarksRecursive2 != pAddress) ? polsSizeRecursive2 : 0);
+}
+
+tProverLane Prover::getRequestLane(const ProverRequest *pProverRequest)
+{
+    return getRequestLane(pProverRequest->type);
+}
+
+tProverLane Prover::getRequestLane(tProverRequestType type)
+{
+    switch (type)
+    {
+    case prt_genAggregatedProof:
+        return (pAddressStarksRecursive2 != pAddress) ? pl_aggregated : pl_batch;
+    case prt_genFinalProof:
+        // The fflonk prover uses pAddress as working memory, so it cannot run concurrently with the batch lane
+        return (Zkey::GROTH16_PROTOCOL_ID == protocolId) ? pl_final : pl_batch;
+    default:
+        return pl_batch;
+    }
+}
+
+uint64_t Prover::getRequestPriority(const ProverRequest *pProverRequest, time_t now)
+{
+    // Shorter requests first, so that they are not blocked behind a long batch proof sharing their lane
+    uint64_t priority;
+    switch (pProverRequest->type)
+    {
+    case prt_genFinalProof:
+        priority = 3;
+        break;
+    case prt_genAggregatedProof:
+        priority = 2;
+        break;
+    default:
+        priority = 1;
+        break;
+    }
+
+    // Aging: a request gains one level every PROVER_PRIORITY_AGING seconds in the queue, so that a
+    // steady flow of higher priority requests cannot starve it
+    if (now > pProverRequest->submitTime)
+    {
+        priority += (now - pProverRequest->submitTime) / PROVER_PRIORITY_AGING;
+    }
+    return priority;
+}
+
+uint64_t Prover::getRequestMemory(const ProverRequest *pProverRequest)
+{
+    return getRequestMemory(pProverRequest->type);
+}
+
+uint64_t Prover::getRequestMemory(tProverRequestType type)
+{
+    switch (type)
+    {
+    case prt_genBatchProof:
+        return std::max(std::max(getStarkTransientMemory(starkZkevm->starkInfo), getStarkTransientMemory(starksC12a->starkInfo)), getStarkTransientMemory(starksRecursive1->starkInfo));
+    case prt_genAggregatedProof:
+        return getStarkTransientMemory(starksRecursive2->starkInfo);
+    case prt_genFinalProof:
+        return getStarkTransientMemory(starksRecursiveF->starkInfo);
+    default:
+        return 0;
+    }
+}
 
-        // Wait for the pending request queue semaphore to be released, if there are no more pending requests
-        if (pProver->pendingRequests.size() == 0)
+ProverRequest *Prover::popCancelledRequest(void)
+{
+    // A request cancelled while pending is never admitted, and leaves the queue as completed
+    for (uint64_t i = 0; i < pendingRequests.size(); i++)
+    {
+        if (pendingRequests[i]->bCancelling)
         {
-            pProver->unlock();
-            sem_wait(&pProver->pendingRequestSem);
+            ProverRequest *pProverRequest = pendingRequests[i];
+            pendingRequests.erase(pendingRequests.begin() + i);
+            pProverRequest->result = ZKR_CANCELLED;
+            pProverRequest->startTime = time(NULL);
+            pProverRequest->endTime = pProverRequest->startTime;
+            completedRequests.push_back(pProverRequest);
+            return pProverRequest;
         }
+    }
+    return NULL;
+}
 
-        // Check that the pending requests queue is not empty
-        if (pProver->pendingRequests.size() == 0)
+ProverRequest *Prover::popNextRequest(ProverLaneContext &laneContext)
+{
+    // Select the pending request of this lane with the highest priority; oldest first in case of a tie
+    time_t now = time(NULL);
+    int64_t selected = -1;
+    uint64_t selectedPriority = 0;
+    for (uint64_t i = 0; i < pendingRequests.size(); i++)
+    {
+        if ((getRequestLane(pendingRequests[i]) != laneContext.lane) || pendingRequests[i]->bCancelling)
         {
-            pProver->unlock();
-            cout << "proverThread() found pending requests queue empty, so ignoring" << endl;
             continue;
         }
+        uint64_t priority = getRequestPriority(pendingRequests[i], now);
+        if ((selected < 0) || (priority > selectedPriority))
+        {
+            selected = i;
+            selectedPriority = priority;
+        }
+    }
+    if (selected < 0)
+    {
+        return NULL;
+    }
 
-        // Extract the first pending request (first in, first out)
-        pProver->pCurrentRequest = pProver->pendingRequests[0];
-        pProver->pCurrentRequest->startTime = time(NULL);
-        pProver->pendingRequests.erase(pProver->pendingRequests.begin());
+    // Admission control: the request must fit in the memory budget, unless no other request is being
+    // processed, in which case it is admitted anyway to avoid starving it
+    ProverRequest *pProverRequest = pendingRequests[selected];
+    uint64_t requestMemory = getRequestMemory(pProverRequest);
+    if ((maxMemory != 0) && (reservedMemory != 0) && (getLanesMemory() + reservedMemory + requestMemory > maxMemory))
+    {
+        return NULL;
+    }
 
-        cout << "proverThread() starting to process request with UUID: " << pProver->pCurrentRequest->uuid << endl;
+    // The request only leaves the pending queue once it has been admitted, and atomically with
+    // becoming the lane current request, so it is always visible in one of them
+    pendingRequests.erase(pendingRequests.begin() + selected);
+    laneContext.pCurrentRequest = pProverRequest;
+    laneContext.reservedMemory = requestMemory;
+    reservedMemory += requestMemory;
+    pProverRequest->startTime = time(NULL);
+    return pProverRequest;
+}
 
-        pProver->unlock();
+ProverRequest *Prover::getCurrentRequest(void)
+{
+    ProverRequest *pCurrentRequest = NULL;
+    for (uint64_t i = 0; i < PROVER_LANES; i++)
+    {
+        if ((lanes[i].pCurrentRequest != NULL) && ((pCurrentRequest == NULL) || (lanes[i].pCurrentRequest->startTime < pCurrentRequest->startTime)))
+        {
+            pCurrentRequest = lanes[i].pCurrentRequest;
+        }
+    }
+    return pCurrentRequest;
+}
 
-        // Process the request
-        switch (pProver->pCurrentRequest->type)
+uint64_t Prover::getRequestThreads(tProverLane lane)
+{
+    // A request gets the threads that the other lanes are not using when it starts, i.e. all of them
+    // if no other lane is busy; if they are all in use, it gets an even share of them instead of
+    // waiting, oversubscribing the cores until one of the other lanes is done
+    uint64_t usedThreads = 0;
+    uint64_t busyLanes = 0;
+    for (uint64_t i = 0; i < PROVER_LANES; i++)
+    {
+        if ((i != (uint64_t)lane) && (lanes[i].pCurrentRequest != NULL))
         {
-        case prt_genBatchProof:
-            pProver->genBatchProof(pProver->pCurrentRequest);
-            break;
-        case prt_genAggregatedProof:
-            pProver->genAggregatedProof(pProver->pCurrentRequest);
-            break;
-        case prt_genFinalProof:
-            pProver->genFinalProof(pProver->pCurrentRequest);
-            break;
-        case prt_execute:
-            pProver->execute(pProver->pCurrentRequest);
-            break;
-        default:
-            cerr << "Error: proverThread() got an invalid prover request type=" << pProver->pCurrentRequest->type << endl;
-            exitProcess();
+            usedThreads += lanes[i].nThreads;
+            busyLanes++;
+        }
+    }
+    uint64_t freeThreads = (usedThreads < nThreads) ? nThreads - usedThreads : 0;
+    return std::max(std::max(freeThreads, nThreads / (busyLanes + 1)), (uint64_t)1);
+}
+
+bool Prover::isComputing(void)
+{
+    // The aggregator sends a genBatchProof to an idle prover, so the prover is idle only if it can
+    // start one right away; the aggregated and final lanes report their availability separately,
+    // see isLaneFree()
+    return !isLaneFree(pl_batch);
+}
+
+bool Prover::isLaneFree(tProverLane lane)
+{
+    if (!lanes[lane].bEnabled || (lanes[lane].pCurrentRequest != NULL))
+    {
+        return false;
+    }
+    for (uint64_t i = 0; i < pendingRequests.size(); i++)
+    {
+        if (!pendingRequests[i]->bCancelling && (getRequestLane(pendingRequests[i]) == lane))
+        {
+            return false;
+        }
+    }
+
+    // Same admission control as popNextRequest(), for the largest request type of the lane
+    tProverRequestType type = (lane == pl_aggregated) ? prt_genAggregatedProof : ((lane == pl_final) ? prt_genFinalProof : prt_genBatchProof);
+    return (maxMemory == 0) || (reservedMemory == 0) || (getLanesMemory() + reservedMemory + getRequestMemory(type) <= maxMemory);
+}
+
+void Prover::cancelRequest(ProverRequest *pProverRequest)
+{
+    pProverRequest->bCancelling = true;
+
+    // Wake up the lane threads, so that a pending request is dropped from the queue right away
+    pthread_cond_broadcast(&pendingRequestCond);
+}
+
+bool Prover::checkCancelled(ProverRequest *pProverRequest)
+{
+    // Requests in progress are cancelled between stages, releasing their lane
+    lock();
+    bool bCancelling = pProverRequest->bCancelling;
+    unlock();
+    if (bCancelling)
+    {
+        cout << "Prover::checkCancelled() cancelling request with UUID: " << pProverRequest->uuid << endl;
+        pProverRequest->result = ZKR_CANCELLED;
+    }
+    return bCancelling;
+}
+
+void Prover::processRequest(ProverRequest *pProverRequest)
+{
+    switch (pProverRequest->type)
+    {
+    case prt_genBatchProof:
+        genBatchProof(pProverRequest);
+        break;
+    case prt_genAggregatedProof:
+        genAggregatedProof(pProverRequest);
+        break;
+    case prt_genFinalProof:
+        genFinalProof(pProverRequest);
+        break;
+    case prt_execute:
+        execute(pProverRequest);
+        break;
+    default:
+        cerr << "Error: Prover::processRequest() got an invalid prover request type=" << pProverRequest->type << endl;
+        exitProcess();
+    }
+}
+
+void *proverThread(void *arg)
+{
+    ProverLaneContext *pLaneContext = (ProverLaneContext *)arg;
+    Prover *pProver = pLaneContext->pProver;
+    cout << "proverThread() started lane=" << pLaneContext->lane << endl;
+
+    zkassert(pProver->config.generateProof());
+
+    while (true)
+    {
+        pProver->lock();
+
+        // Wait until a request of this lane is pending and fits in the memory budget, completing
+        // the requests cancelled while pending
+        ProverRequest *pProverRequest;
+        while ((pProverRequest = pProver->popNextRequest(*pLaneContext)) == NULL)
+        {
+            ProverRequest *pCancelledRequest = pProver->popCancelledRequest();
+            if (pCancelledRequest != NULL)
+            {
+                cout << "proverThread() lane=" << pLaneContext->lane << " dropped cancelled request with UUID: " << pCancelledRequest->uuid << endl;
+                pCancelledRequest->notifyCompleted();
+                continue;
+            }
+            pthread_cond_wait(&pProver->pendingRequestCond, &pProver->mutex);
         }
 
-        // Move to completed requests
+        // The OpenMP parallel regions of this request only use the threads left by the other lanes
+        pLaneContext->nThreads = pProver->getRequestThreads(pLaneContext->lane);
+        omp_set_num_threads(pLaneContext->nThreads);
+
+        cout << "proverThread() lane=" << pLaneContext->lane << " threads=" << pLaneContext->nThreads << " starting to process request with UUID: " << pProverRequest->uuid << endl;
+
+        pProver->unlock();
+
+        // Process the request
+        pProver->processRequest(pProverRequest);
+
+        // Move to completed requests, and release the reserved memory
         pProver->lock();
-        ProverRequest *pProverRequest = pProver->pCurrentRequest;
         pProverRequest->endTime = time(NULL);
         pProver->lastComputedRequestId = pProverRequest->uuid;
         pProver->lastComputedRequestEndTime = pProverRequest->endTime;
 
-        pProver->completedRequests.push_back(pProver->pCurrentRequest);
-        pProver->pCurrentRequest = NULL;
+        pProver->completedRequests.push_back(pProverRequest);
+        pLaneContext->pCurrentRequest = NULL;
+        pLaneContext->nThreads = 0;
+        pProver->reservedMemory -= pLaneContext->reservedMemory;
+        pLaneContext->reservedMemory = 0;
+
+        // Wake up the lanes waiting for memory to be released
+        pthread_cond_broadcast(&pProver->pendingRequestCond);
         pProver->unlock();
 
-        cout << "proverThread() done processing request with UUID: " << pProverRequest->uuid << endl;
+        cout << "proverThread() lane=" << pLaneContext->lane << " done processing request with UUID: " << pProverRequest->uuid << endl;
 
         // Release the prove request semaphore to notify any blocked waiting call
         pProverRequest->notifyCompleted();
@@ -305,11 +679,12 @@ string Prover::submitRequest(ProverRequest *pProverRequest) // returns UUID for
     // Get the prover request UUID
     string uuid = pProverRequest->uuid;
 
-    // Add the request to the pending requests queue, and release the semaphore to notify the prover thread
+    // Add the request to the pending requests queue, and wake up the lane threads
     lock();
     requestsMap[uuid] = pProverRequest;
+    pProverRequest->submitTime = time(NULL);
     pendingRequests.push_back(pProverRequest);
-    sem_post(&pendingRequestSem);
+    pthread_cond_broadcast(&pendingRequestCond);
     unlock();
 
     cout << "Prover::submitRequest() returns UUID: " << uuid << endl;
@@ -430,13 +805,12 @@ void Prover::genBatchProof(ProverRequest *pProverRequest)
         unmapFile(pointerCmPols, cmPols.size());
     }
 
-    if (pProverRequest->result == ZKR_SUCCESS)
+    if ((pProverRequest->result == ZKR_SUCCESS) && !checkCancelled(pProverRequest))
     {
         /*************************************/
         /*  Generate publics input           */
         /*************************************/
         TimerStart(SAVE_PUBLICS_JSON_BATCH_PROOF);
-        json publicStarkJson;
 
         uint64_t lastN = cmPols.pilDegree() - 1;
 
@@ -510,11 +884,6 @@ void Prover::genBatchProof(ProverRequest *pProverRequest)
         publics[46] = Goldilocks::fromU64(recursive2Verkey["constRoot"][2]);
         publics[47] = Goldilocks::fromU64(recursive2Verkey["constRoot"][3]);
 
-        for (uint64_t i = 0; i < starkZkevm->starkInfo.nPublics; i++)
-        {
-            publicStarkJson[i] = Goldilocks::toString(publics[i]);
-        }
-
         TimerStopAndLog(SAVE_PUBLICS_JSON_BATCH_PROOF);
 
         /*************************************/
@@ -523,22 +892,26 @@ void Prover::genBatchProof(ProverRequest *pProverRequest)
 
         TimerStart(STARK_PROOF_BATCH_PROOF);
 
-        ZkevmSteps zkevmSteps;
         uint64_t polBits = starkZkevm->starkInfo.starkStruct.steps[starkZkevm->starkInfo.starkStruct.steps.size() - 1].nBits;
         FRIProof fproof((1 << polBits), FIELD_EXTENSION, starkZkevm->starkInfo.starkStruct.steps.size(), starkZkevm->starkInfo.evMap.size(), starkZkevm->starkInfo.nPublics);
-        starkZkevm->genProof(fproof, &publics[0], &zkevmSteps);
+        starkZkevm->genProof(fproof, &publics[0], pZkevmSteps);
 
         TimerStopAndLog(STARK_PROOF_BATCH_PROOF);
 
-        TimerStart(STARK_JSON_GENERATION_BATCH_PROOF);
+        TimerStart(STARK_ZKIN_GENERATION_BATCH_PROOF);
 
-        nlohmann::ordered_json jProof = fproof.proofs.proof2json();
-        nlohmann::json zkin = proof2zkinStark(jProof);
-        // Generate publics
-        jProof["publics"] = publicStarkJson;
-        zkin["publics"] = publicStarkJson;
+        // The zkin is handed to the next recursion stage in binary form, with no JSON round trip
+        Zkin zkin;
+        proof2zkinStark(fproof, zkin);
+        zkin.add("publics", {starkZkevm->starkInfo.nPublics}, publics);
 
-        TimerStopAndLog(STARK_JSON_GENERATION_BATCH_PROOF);
+        TimerStopAndLog(STARK_ZKIN_GENERATION_BATCH_PROOF);
+
+        if (checkCancelled(pProverRequest))
+        {
+            TimerStopAndLog(PROVER_BATCH_PROOF);
+            return;
+        }
 
         CommitPolsStarks cmPols12a(pAddress, (1 << starksC12a->starkInfo.starkStruct.nBits));
 
@@ -557,21 +930,25 @@ void Prover::genBatchProof(ProverRequest *pProverRequest)
         starksC12a->genProof(fproofC12a, publics, &c12aSteps);
 
         TimerStopAndLog(STARK_C12_A_PROOF_BATCH_PROOF);
-        TimerStart(STARK_JSON_GENERATION_BATCH_PROOF_C12A);
+        TimerStart(STARK_ZKIN_GENERATION_BATCH_PROOF_C12A);
 
-        // Save the proof & zkinproof
-        nlohmann::ordered_json jProofc12a = fproofC12a.proofs.proof2json();
-        nlohmann::json zkinC12a = proof2zkinStark(jProofc12a);
+        Zkin zkinC12a;
+        proof2zkinStark(fproofC12a, zkinC12a);
+        zkinC12a.add("publics", {starkZkevm->starkInfo.nPublics}, publics);
 
         // Add the recursive2 verification key
-        json rootC;
-        rootC[0] = to_string(recursive2Verkey["constRoot"][0]);
-        rootC[1] = to_string(recursive2Verkey["constRoot"][1]);
-        rootC[2] = to_string(recursive2Verkey["constRoot"][2]);
-        rootC[3] = to_string(recursive2Verkey["constRoot"][3]);
-        zkinC12a["publics"] = publicStarkJson;
-        zkinC12a["rootC"] = rootC;
-        TimerStopAndLog(STARK_JSON_GENERATION_BATCH_PROOF_C12A);
+        Goldilocks::Element *rootC = zkinC12a.add("rootC", {4});
+        for (uint64_t i = 0; i < 4; i++)
+        {
+            rootC[i] = Goldilocks::fromU64(recursive2Verkey["constRoot"][i]);
+        }
+        TimerStopAndLog(STARK_ZKIN_GENERATION_BATCH_PROOF_C12A);
+
+        if (checkCancelled(pProverRequest))
+        {
+            TimerStopAndLog(PROVER_BATCH_PROOF);
+            return;
+        }
 
         CommitPolsStarks cmPolsRecursive1(pAddress, (1 << starksRecursive1->starkInfo.starkStruct.nBits));
         CircomRecursive1::getCommitedPols(&cmPolsRecursive1, config.recursive1Verifier, config.recursive1Exec, zkinC12a, (1 << starksRecursive1->starkInfo.starkStruct.nBits));
@@ -590,25 +967,34 @@ void Prover::genBatchProof(ProverRequest *pProverRequest)
         // Save the proof & zkinproof
         TimerStart(SAVE_PROOF);
 
-        nlohmann::ordered_json jProofRecursive1 = fproofRecursive1.proofs.proof2json();
-        nlohmann::ordered_json zkinRecursive1 = proof2zkinStark(jProofRecursive1);
-        zkinRecursive1["publics"] = publicStarkJson;
-
-        pProverRequest->batchProofOutput = zkinRecursive1;
+        proof2zkinStark(fproofRecursive1, pProverRequest->batchProofOutput);
+        pProverRequest->batchProofOutput.add("publics", {starkZkevm->starkInfo.nPublics}, publics);
 
         // save publics to file
+        json publicStarkJson;
+        for (uint64_t i = 0; i < starkZkevm->starkInfo.nPublics; i++)
+        {
+            publicStarkJson[i] = Goldilocks::toString(publics[i]);
+        }
         json2file(publicStarkJson, pProverRequest->publicsOutputFile());
 
         // Save output to file
         if (config.saveOutputToFile)
         {
-            json2file(pProverRequest->batchProofOutput, pProverRequest->filePrefix + "batch_proof.output.json");
+            ordered_json jBatchProofOutput;
+            pProverRequest->batchProofOutput.toJson(jBatchProofOutput);
+            json2file(jBatchProofOutput, pProverRequest->filePrefix + "batch_proof.output.json");
         }
-        // Save proof to file
+        // Save proof to file; this is the only place where the proof is converted to JSON
         if (config.saveProofToFile)
         {
+            nlohmann::ordered_json jProofRecursive1 = fproofRecursive1.proofs.proof2json();
             jProofRecursive1["publics"] = publicStarkJson;
             json2file(jProofRecursive1, pProverRequest->filePrefix + "batch_proof.proof.json");
+
+            // Binary copy, that can be mapped back as an input of genAggregatedProof
+            fproofRecursive1.publics.assign(publics, publics + starkZkevm->starkInfo.nPublics);
+            proof2file(fproofRecursive1, pProverRequest->filePrefix + "batch_proof.proof.bin");
         }
         TimerStopAndLog(SAVE_PROOF);
     }
@@ -631,11 +1017,11 @@ void Prover::genAggregatedProof(ProverRequest *pProverRequest)
     // Save input to file
     if (config.saveInputToFile)
     {
-        json2file(pProverRequest->aggregatedProofInput1, pProverRequest->filePrefix + "aggregated_proof.input_1.json");
-        json2file(pProverRequest->aggregatedProofInput2, pProverRequest->filePrefix + "aggregated_proof.input_2.json");
+        zkin2file(pProverRequest->aggregatedProofInput1, pProverRequest->filePrefix + "aggregated_proof.input_1.zkin");
+        zkin2file(pProverRequest->aggregatedProofInput2, pProverRequest->filePrefix + "aggregated_proof.input_2.zkin");
     }
 
-    // Input is pProverRequest->aggregatedProofInput1 and pProverRequest->aggregatedProofInput2 (of type json)
+    // Input is pProverRequest->aggregatedProofInput1 and pProverRequest->aggregatedProofInput2 (of type Zkin)
 
     ordered_json verKey;
     file2json(config.recursive2Verkey, verKey);
@@ -643,29 +1029,47 @@ void Prover::genAggregatedProof(ProverRequest *pProverRequest)
     // ----------------------------------------------
     // CHECKS
     // ----------------------------------------------
-    // Check chainID
+    const Goldilocks::Element *publics1 = pProverRequest->aggregatedProofInput1.get("publics");
+    const Goldilocks::Element *publics2 = pProverRequest->aggregatedProofInput2.get("publics");
+    if ((publics1 == NULL) || (publics2 == NULL))
+    {
+        std::cerr << "Error: Inputs have no publics" << std::endl;
+        pProverRequest->result = ZKR_AGGREGATED_PROOF_INVALID_INPUT;
+        return;
+    }
+    // The checks below read up to publics[43], and joinzkin() the first ZKIN_AGGREGATED_NPUBLICS
+    uint64_t minPublics = std::max<uint64_t>(starkZkevm->starkInfo.nPublics, ZKIN_AGGREGATED_NPUBLICS);
+    uint64_t nPublics1 = pProverRequest->aggregatedProofInput1.find("publics")->size;
+    uint64_t nPublics2 = pProverRequest->aggregatedProofInput2.find("publics")->size;
+    if ((nPublics1 < minPublics) || (nPublics2 < minPublics))
+    {
+        std::cerr << "Error: Inputs have " << nPublics1 << " and " << nPublics2 << " publics instead of at least " << minPublics << std::endl;
+        pProverRequest->result = ZKR_AGGREGATED_PROOF_INVALID_INPUT;
+        return;
+    }
 
-    if (pProverRequest->aggregatedProofInput1["publics"][17] != pProverRequest->aggregatedProofInput2["publics"][17])
+    // Check chainID
+    if (!Goldilocks::equal(publics1[17], publics2[17]))
     {
         std::cerr << "Error: Inputs has different chainId" << std::endl;
-        std::cerr << pProverRequest->aggregatedProofInput1["publics"][17] << "!=" << pProverRequest->aggregatedProofInput2["publics"][17] << std::endl;
+        std::cerr << Goldilocks::toString(publics1[17]) << "!=" << Goldilocks::toString(publics2[17]) << std::endl;
         pProverRequest->result = ZKR_AGGREGATED_PROOF_INVALID_INPUT;
         return;
     }
-    if (pProverRequest->aggregatedProofInput1["publics"][18] != pProverRequest->aggregatedProofInput2["publics"][18])
+    if (!Goldilocks::equal(publics1[18], publics2[18]))
     {
         std::cerr << "Error: Inputs has different forkId" << std::endl;
-        std::cerr << pProverRequest->aggregatedProofInput1["publics"][18] << "!=" << pProverRequest->aggregatedProofInput2["publics"][18] << std::endl;
+        std::cerr << Goldilocks::toString(publics1[18]) << "!=" << Goldilocks::toString(publics2[18]) << std::endl;
         pProverRequest->result = ZKR_AGGREGATED_PROOF_INVALID_INPUT;
         return;
     }
     // Check midStateRoot
     for (int i = 0; i < 8; i++)
     {
-        if (pProverRequest->aggregatedProofInput1["publics"][19 + i] != pProverRequest->aggregatedProofInput2["publics"][0 + i])
+        if (!Goldilocks::equal(publics1[19 + i], publics2[0 + i]))
         {
             std::cerr << "Error: The newStateRoot and the oldStateRoot are not consistent" << std::endl;
-            std::cerr << pProverRequest->aggregatedProofInput1["publics"][19 + i] << "!=" << pProverRequest->aggregatedProofInput2["publics"][0 + i] << std::endl;
+            std::cerr << Goldilocks::toString(publics1[19 + i]) << "!=" << Goldilocks::toString(publics2[0 + i]) << std::endl;
             pProverRequest->result = ZKR_AGGREGATED_PROOF_INVALID_INPUT;
             return;
         }
@@ -673,40 +1077,40 @@ void Prover::genAggregatedProof(ProverRequest *pProverRequest)
     // Check midAccInputHash0
     for (int i = 0; i < 8; i++)
     {
-        if (pProverRequest->aggregatedProofInput1["publics"][27 + i] != pProverRequest->aggregatedProofInput2["publics"][8 + i])
+        if (!Goldilocks::equal(publics1[27 + i], publics2[8 + i]))
         {
             std::cerr << "Error: newAccInputHash and oldAccInputHash are not consistent" << std::endl;
-            std::cerr << pProverRequest->aggregatedProofInput1["publics"][27 + i] << "!=" << pProverRequest->aggregatedProofInput2["publics"][8 + i] << std::endl;
+            std::cerr << Goldilocks::toString(publics1[27 + i]) << "!=" << Goldilocks::toString(publics2[8 + i]) << std::endl;
             pProverRequest->result = ZKR_AGGREGATED_PROOF_INVALID_INPUT;
             return;
         }
     }
     // Check batchNum
-    if (pProverRequest->aggregatedProofInput1["publics"][43] != pProverRequest->aggregatedProofInput2["publics"][16])
+    if (!Goldilocks::equal(publics1[43], publics2[16]))
     {
         std::cerr << "Error: newBatchNum and oldBatchNum are not consistent" << std::endl;
-        std::cerr << pProverRequest->aggregatedProofInput1["publics"][43] << "!=" << pProverRequest->aggregatedProofInput2["publics"][16] << std::endl;
+        std::cerr << Goldilocks::toString(publics1[43]) << "!=" << Goldilocks::toString(publics2[16]) << std::endl;
         pProverRequest->result = ZKR_AGGREGATED_PROOF_INVALID_INPUT;
         return;
     }
 
-    json zkinInputRecursive2 = joinzkin(pProverRequest->aggregatedProofInput1, pProverRequest->aggregatedProofInput2, verKey);
-    json recursive2Verkey;
-    file2json(config.recursive2Verkey, recursive2Verkey);
+    Zkin zkinInputRecursive2;
+    joinzkin(pProverRequest->aggregatedProofInput1, pProverRequest->aggregatedProofInput2, verKey, zkinInputRecursive2);
+    const Goldilocks::Element *publicsInput = zkinInputRecursive2.get("publics");
 
     Goldilocks::Element publics[starksRecursive2->starkInfo.nPublics];
 
     for (uint64_t i = 0; i < starkZkevm->starkInfo.nPublics; i++)
     {
-        publics[i] = Goldilocks::fromString(zkinInputRecursive2["publics"][i]);
+        publics[i] = publicsInput[i];
     }
 
-    for (uint64_t i = 0; i < recursive2Verkey["constRoot"].size(); i++)
+    for (uint64_t i = 0; i < verKey["constRoot"].size(); i++)
     {
-        publics[starkZkevm->starkInfo.nPublics + i] = Goldilocks::fromU64(recursive2Verkey["constRoot"][i]);
+        publics[starkZkevm->starkInfo.nPublics + i] = Goldilocks::fromU64(verKey["constRoot"][i]);
     }
 
-    CommitPolsStarks cmPolsRecursive2(pAddress, (1 << starksRecursive2->starkInfo.starkStruct.nBits));
+    CommitPolsStarks cmPolsRecursive2(pAddressStarksRecursive2, (1 << starksRecursive2->starkInfo.starkStruct.nBits));
     CircomRecursive2::getCommitedPols(&cmPolsRecursive2, config.recursive2Verifier, config.recursive2Exec, zkinInputRecursive2, (1 << starksRecursive2->starkInfo.starkStruct.nBits));
 
     //-------------------------------------------
@@ -720,40 +1124,40 @@ void Prover::genAggregatedProof(ProverRequest *pProverRequest)
     starksRecursive2->genProof(fproofRecursive2, publics, &recursive2Steps);
     TimerStopAndLog(STARK_RECURSIVE_2_PROOF_BATCH_PROOF);
 
-    // Save the proof & zkinproof
-    nlohmann::ordered_json jProofRecursive2 = fproofRecursive2.proofs.proof2json();
-    nlohmann::ordered_json zkinRecursive2 = proof2zkinStark(jProofRecursive2);
-    zkinRecursive2["publics"] = zkinInputRecursive2["publics"];
+    // Output is pProverRequest->aggregatedProofOutput (of type Zkin)
+    proof2zkinStark(fproofRecursive2, pProverRequest->aggregatedProofOutput);
+    pProverRequest->aggregatedProofOutput.add("publics", {starkZkevm->starkInfo.nPublics}, publicsInput);
 
-    // Output is pProverRequest->aggregatedProofOutput (of type json)
-    pProverRequest->aggregatedProofOutput = zkinRecursive2;
+    json publicsJson = json::array();
+    for (uint64_t i = 0; i < starkZkevm->starkInfo.nPublics; i++)
+    {
+        publicsJson[i] = Goldilocks::toString(publicsInput[i]);
+    }
 
     // Save output to file
     if (config.saveOutputToFile)
     {
-        json2file(pProverRequest->aggregatedProofOutput, pProverRequest->filePrefix + "aggregated_proof.output.json");
+        ordered_json jAggregatedProofOutput;
+        pProverRequest->aggregatedProofOutput.toJson(jAggregatedProofOutput);
+        json2file(jAggregatedProofOutput, pProverRequest->filePrefix + "aggregated_proof.output.json");
     }
     // Save proof to file
     if (config.saveProofToFile)
     {
-        jProofRecursive2["publics"] = zkinInputRecursive2["publics"];
+        nlohmann::ordered_json jProofRecursive2 = fproofRecursive2.proofs.proof2json();
+        jProofRecursive2["publics"] = publicsJson;
         json2file(jProofRecursive2, pProverRequest->filePrefix + "aggregated_proof.proof.json");
-    }
-
-    // Add the recursive2 verification key
-    json publicsJson = json::array();
-
-    file2json(config.recursive2Verkey, recursive2Verkey);
 
-    for (uint64_t i = 0; i < starkZkevm->starkInfo.nPublics; i++)
-    {
-        publicsJson[i] = zkinInputRecursive2["publics"][i];
+        // Binary copy, that can be mapped back as an input of another genAggregatedProof
+        fproofRecursive2.publics.assign(publicsInput, publicsInput + starkZkevm->starkInfo.nPublics);
+        proof2file(fproofRecursive2, pProverRequest->filePrefix + "aggregated_proof.proof.bin");
     }
+
     // Add the recursive2 verification key
-    publicsJson[44] = to_string(recursive2Verkey["constRoot"][0]);
-    publicsJson[45] = to_string(recursive2Verkey["constRoot"][1]);
-    publicsJson[46] = to_string(recursive2Verkey["constRoot"][2]);
-    publicsJson[47] = to_string(recursive2Verkey["constRoot"][3]);
+    publicsJson[44] = to_string(verKey["constRoot"][0]);
+    publicsJson[45] = to_string(verKey["constRoot"][1]);
+    publicsJson[46] = to_string(verKey["constRoot"][2]);
+    publicsJson[47] = to_string(verKey["constRoot"][3]);
 
     json2file(publicsJson, pProverRequest->publicsOutputFile());
 
@@ -776,20 +1180,34 @@ void Prover::genFinalProof(ProverRequest *pProverRequest)
     // Save input to file
     if (config.saveInputToFile)
     {
-        json2file(pProverRequest->finalProofInput, pProverRequest->filePrefix + "final_proof.input.json");
+        zkin2file(pProverRequest->finalProofInput, pProverRequest->filePrefix + "final_proof.input.zkin");
     }
 
-    // Input is pProverRequest->finalProofInput (of type json)
+    // Input is pProverRequest->finalProofInput (of type Zkin)
     std::string strAddress = mpz_get_str(0, 16, pProverRequest->input.publicInputsExtended.publicInputs.aggregatorAddress.get_mpz_t());
     std::string strAddress10 = mpz_get_str(0, 10, pProverRequest->input.publicInputsExtended.publicInputs.aggregatorAddress.get_mpz_t());
 
-    json zkinFinal = pProverRequest->finalProofInput;
+    Zkin &zkinFinal = pProverRequest->finalProofInput;
+    const Goldilocks::Element *publicsFinal = zkinFinal.get("publics");
+    if (publicsFinal == NULL)
+    {
+        cerr << "Error: Prover::genFinalProof() got an input without publics" << endl;
+        pProverRequest->result = ZKR_AGGREGATED_PROOF_INVALID_INPUT;
+        return;
+    }
+    const Zkin::Signal *pPublicsSignal = zkinFinal.find("publics");
+    if (pPublicsSignal->size < starksRecursiveF->starkInfo.nPublics)
+    {
+        cerr << "Error: Prover::genFinalProof() got an input with " << pPublicsSignal->size << " publics instead of at least " << starksRecursiveF->starkInfo.nPublics << endl;
+        pProverRequest->result = ZKR_AGGREGATED_PROOF_INVALID_INPUT;
+        return;
+    }
 
     Goldilocks::Element publics[starksRecursiveF->starkInfo.nPublics];
 
     for (uint64_t i = 0; i < starksRecursiveF->starkInfo.nPublics; i++)
     {
-        publics[i] = Goldilocks::fromString(zkinFinal["publics"][i]);
+        publics[i] = publicsFinal[i];
     }
 
     CommitPolsStarks cmPolsRecursive2(pAddressStarksRecursiveF, (1 << starksRecursiveF->starkInfo.starkStruct.nBits));
@@ -804,10 +1222,14 @@ void Prover::genFinalProof(ProverRequest *pProverRequest)
     FRIProofC12 fproofRecursiveF((1 << polBitsRecursiveF), FIELD_EXTENSION, starksRecursiveF->starkInfo.starkStruct.steps.size(), starksRecursiveF->starkInfo.evMap.size(), starksRecursiveF->starkInfo.nPublics);
     starksRecursiveF->genProof(fproofRecursiveF, publics);
 
-    // Save the proof & zkinproof
+    // Save the proof & zkinproof; the recursiveF proof roots are BN128 field elements, which a Zkin
+    // cannot hold, so the final circuit input still goes through JSON
     nlohmann::ordered_json jProofRecursiveF = fproofRecursiveF.proofs.proof2json();
     json zkinRecursiveF = proof2zkinStark(jProofRecursiveF);
-    zkinRecursiveF["publics"] = zkinFinal["publics"];
+    for (uint64_t i = 0; i < pPublicsSignal->size; i++)
+    {
+        zkinRecursiveF["publics"][i] = Goldilocks::toString(publicsFinal[i]);
+    }
     zkinRecursiveF["aggregatorAddr"] = strAddress10;
 
     //  ----------------------------------------------
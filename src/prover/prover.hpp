@@ -23,6 +23,33 @@
 #include "starks.hpp"
 #include "constant_pols_starks.hpp"
 #include "fflonk_prover.hpp"
+
+// Prover lanes: every lane owns the working memory of the STARKs it computes, so that
+// requests assigned to different lanes can be processed concurrently
+typedef enum
+{
+    pl_batch = 0,      // genBatchProof, execute: zkevm, c12a and recursive1 STARKs over pAddress
+    pl_aggregated = 1, // genAggregatedProof: recursive2 STARK over pAddressStarksRecursive2
+    pl_final = 2,      // genFinalProof: recursiveF STARK over pAddressStarksRecursiveF, and the SNARK
+    PROVER_LANES = 3
+} tProverLane;
+
+class Prover;
+class ZkevmSteps;
+
+struct ProverLaneContext
+{
+    Prover *pProver;
+    tProverLane lane;
+    pthread_t pthread;              // Only created if bEnabled
+    bool bEnabled;                  // False if the requests of this lane are computed in the batch lane
+    uint64_t nThreads;              // Number of OpenMP threads used by the current request, or 0
+    ProverRequest *pCurrentRequest; // Request currently being processed by this lane, or NULL
+    uint64_t reservedMemory;        // Memory reserved by the current request, in bytes
+};
+
+#define PROVER_PRIORITY_AGING 60 // Seconds a pending request waits to gain one priority level
+
 class Prover
 {
     Goldilocks &fr;
@@ -36,6 +63,10 @@ class Prover
     Starks *starksRecursive1;
     Starks *starksRecursive2;
 
+    ZkevmSteps *pZkevmSteps;
+    void *pZkevmStepsAvx512Lib; // Handle of ZKEVM_STEPS_AVX512_LIB, if pZkevmSteps was created by it
+    ChelpersJit *pChelpersJit;
+
     Fflonk::FflonkProver<AltBn128::Engine> *prover;
     std::unique_ptr<Groth16::Prover<AltBn128::Engine>> groth16Prover;
     std::unique_ptr<BinFileUtils::BinFile> zkey;
@@ -45,20 +76,33 @@ class Prover
 public:
     unordered_map<string, ProverRequest *> requestsMap; // Map uuid -> ProveRequest pointer
 
-    vector<ProverRequest *> pendingRequests;   // Queue of pending requests
-    ProverRequest *pCurrentRequest;            // Request currently being processed by the prover thread in server mode
+    vector<ProverRequest *> pendingRequests;   // Queue of pending requests, in order of arrival
+    ProverLaneContext lanes[PROVER_LANES];     // Lanes processing requests in server mode
     vector<ProverRequest *> completedRequests; // Map uuid -> ProveRequest pointer
 
 private:
-    pthread_t proverPthread;  // Prover thread
     pthread_t cleanerPthread; // Garbage collector
-    pthread_mutex_t mutex;    // Mutex to protect the requests queues
+    pthread_mutex_t mutex;    // Mutex to protect the requests queues and the lanes
+    pthread_cond_t pendingRequestCond; // Condition to wakeup lane threads when a request is submitted or memory is released
     void *pAddress = NULL;
+    void *pAddressStarksRecursive2 = NULL; // Only allocated if the aggregated lane fits in memory, otherwise equal to pAddress
     void *pAddressStarksRecursiveF = NULL;
+    uint64_t polsSize;
+    uint64_t polsSizeRecursive2;
+    uint64_t treesMemory;    // Memory of the merkle trees allocated by the Starks constructors, in bytes
+    uint64_t reservedMemory; // Sum of the memory reserved by the requests being processed, in bytes
+    uint64_t maxMemory;      // Memory budget for requests processed concurrently, in bytes; 0 means no limit
+    uint64_t nThreads;       // OpenMP threads shared by the lanes
     int protocolId;
+
+    uint64_t getStarkTransientMemory(const StarkInfo &starkInfo);
+    uint64_t getStarkTreesMemory(const StarkInfo &starkInfo);
+    uint64_t getLanesMemory(void); // Memory allocated once for all the lanes, in bytes
+    ZkevmSteps *newZkevmStepsAvx512(void); // returns NULL if the CPU does not support AVX-512 or ZKEVM_STEPS_AVX512_LIB cannot be loaded
+
+    friend void *proverThread(void *arg);
 public:
     const Config &config;
-    sem_t pendingRequestSem; // Semaphore to wakeup prover thread when a new request is available
     string lastComputedRequestId;
     uint64_t lastComputedRequestEndTime;
 
@@ -79,6 +123,24 @@ public:
 
     void lock(void) { pthread_mutex_lock(&mutex); };
     void unlock(void) { pthread_mutex_unlock(&mutex); };
+
+    // Scheduling; must be called with the prover locked
+    tProverLane getRequestLane(const ProverRequest *pProverRequest);
+    tProverLane getRequestLane(tProverRequestType type);
+    uint64_t getRequestPriority(const ProverRequest *pProverRequest, time_t now);
+    uint64_t getRequestMemory(const ProverRequest *pProverRequest);
+    uint64_t getRequestMemory(tProverRequestType type);
+    ProverRequest *popNextRequest(ProverLaneContext &laneContext); // returns NULL if no request of this lane can be admitted
+    uint64_t getRequestThreads(tProverLane lane); // returns the number of threads for a request starting in this lane
+    ProverRequest *popCancelledRequest(void); // returns NULL if no pending request has been cancelled
+    ProverRequest *getCurrentRequest(void); // returns the oldest request being processed, or NULL
+    bool isComputing(void); // returns true if the prover cannot start a genBatchProof right away
+    bool isLaneFree(tProverLane lane); // returns true if the lane is enabled, idle, has nothing queued and its requests fit in the memory budget
+    void cancelRequest(ProverRequest *pProverRequest);
+
+    bool checkCancelled(ProverRequest *pProverRequest); // called without the prover locked
+
+    void processRequest(ProverRequest *pProverRequest);
 };
 
 void *proverThread(void *arg);
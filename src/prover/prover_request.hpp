@@ -8,6 +8,7 @@
 #include "full_tracer_interface.hpp"
 #include "database_map.hpp"
 #include "prover_request_type.hpp"
+#include "zkin.hpp"
 
 using json = nlohmann::json;
 using ordered_json = nlohmann::ordered_json;
@@ -24,6 +25,7 @@ public:
     /* IDs */
     string uuid;
     string timestamp; // Timestamp, when requested, used as a prefix in the output files
+    time_t submitTime; // Time when the request was submitted to the prover queue
     time_t startTime; // Time when the request started being processed
     time_t endTime; // Time when the request ended
 
@@ -37,15 +39,15 @@ public:
     Input input;
 
     /* genBatchProof output */
-    nlohmann::ordered_json batchProofOutput;
+    Zkin batchProofOutput;
 
     /* genAggregatedProof input and output */
-    nlohmann::ordered_json aggregatedProofInput1;
-    nlohmann::ordered_json aggregatedProofInput2;
-    nlohmann::ordered_json aggregatedProofOutput;
+    Zkin aggregatedProofInput1;
+    Zkin aggregatedProofInput2;
+    Zkin aggregatedProofOutput;
 
     /* genFinalProof input */
-    nlohmann::ordered_json finalProofInput;
+    Zkin finalProofInput;
 
     /* genProof and genFinalProof output */
     Proof proof;
@@ -37,14 +37,15 @@ bool AggregatorClient::GetStatus (::aggregator::v1::GetStatusResponse &getStatus
     getStatusResponse.set_last_computed_request_id(prover.lastComputedRequestId);
     getStatusResponse.set_last_computed_end_time(prover.lastComputedRequestEndTime);
 
-    // If computing, set the current request data
-    if ((prover.pCurrentRequest != NULL) || (prover.pendingRequests.size() > 0))
+    // If the prover cannot start a batch proof right away, set the current request data
+    ProverRequest *pCurrentRequest = prover.getCurrentRequest();
+    if (prover.isComputing())
     {
         getStatusResponse.set_status(aggregator::v1::GetStatusResponse_Status_STATUS_COMPUTING);
-        if (prover.pCurrentRequest != NULL)
+        if (pCurrentRequest != NULL)
         {
-            getStatusResponse.set_current_computing_request_id(prover.pCurrentRequest->uuid);
-            getStatusResponse.set_current_computing_start_time(prover.pCurrentRequest->startTime);
+            getStatusResponse.set_current_computing_request_id(pCurrentRequest->uuid);
+            getStatusResponse.set_current_computing_start_time(pCurrentRequest->startTime);
         }
         else
         {
@@ -59,6 +60,12 @@ bool AggregatorClient::GetStatus (::aggregator::v1::GetStatusResponse &getStatus
         getStatusResponse.set_current_computing_start_time(0);
     }
 
+    // Set which request types would start right away; aggregated and final proofs can run in their own
+    // lanes while the prover is computing a batch proof
+    getStatusResponse.set_gen_batch_proof_free(prover.isLaneFree(pl_batch));
+    getStatusResponse.set_gen_aggregated_proof_free(prover.isLaneFree(prover.getRequestLane(prt_genAggregatedProof)));
+    getStatusResponse.set_gen_final_proof_free(prover.isLaneFree(prover.getRequestLane(prt_genFinalProof)));
+
     // Set the versions
     getStatusResponse.set_version_proto("v0_0_1");
     getStatusResponse.set_version_server("0.0.1");
@@ -272,9 +279,19 @@ bool AggregatorClient::GenAggregatedProof (const aggregator::v1::GenAggregatedPr
     cout << "AggregatorClient::GenAggregatedProof() created a new prover request: " << to_string((uint64_t)pProverRequest) << endl;
 #endif
 
-    // Set the 2 inputs
-    pProverRequest->aggregatedProofInput1 = json::parse(genAggregatedProofRequest.recursive_proof_1());
-    pProverRequest->aggregatedProofInput2 = json::parse(genAggregatedProofRequest.recursive_proof_2());
+    // Set the 2 inputs, parsing them into field elements only once
+    try
+    {
+        pProverRequest->aggregatedProofInput1.fromString(genAggregatedProofRequest.recursive_proof_1());
+        pProverRequest->aggregatedProofInput2.fromString(genAggregatedProofRequest.recursive_proof_2());
+    }
+    catch (std::exception &e)
+    {
+        cerr << "Error: AggregatorClient::GenAggregatedProof() failed parsing the recursive proofs: " << e.what() << endl;
+        genAggregatedProofResponse.set_result(aggregator::v1::Result::RESULT_ERROR);
+        delete pProverRequest;
+        return false;
+    }
 
     // Submit the prover request
     string uuid = prover.submitRequest(pProverRequest);
@@ -305,7 +322,17 @@ bool AggregatorClient::GenFinalProof (const aggregator::v1::GenFinalProofRequest
 #endif
 
     // Set the input
-    pProverRequest->finalProofInput = json::parse(genFinalProofRequest.recursive_proof());
+    try
+    {
+        pProverRequest->finalProofInput.fromString(genFinalProofRequest.recursive_proof());
+    }
+    catch (std::exception &e)
+    {
+        cerr << "Error: AggregatorClient::GenFinalProof() failed parsing the recursive proof: " << e.what() << endl;
+        genFinalProofResponse.set_result(aggregator::v1::Result::RESULT_ERROR);
+        delete pProverRequest;
+        return false;
+    }
 
     // Set the aggregator address
     string auxString = Remove0xIfPresent(genFinalProofRequest.aggregator_addr());
@@ -357,8 +384,8 @@ bool AggregatorClient::Cancel (const aggregator::v1::CancelRequest &cancelReques
         return false;
     }
 
-    // Mark the request as cancelling
-    it->second->bCancelling = true;
+    // Mark the request as cancelling; it is dropped if still pending, or stopped at its next stage
+    prover.cancelRequest(it->second);
 
     // Unlock the prover
     prover.unlock();
@@ -454,13 +481,17 @@ bool AggregatorClient::GetProof (const aggregator::v1::GetProofRequest &getProof
                 }
                 case prt_genBatchProof:
                 {
-                    string recursiveProof = pProverRequest->batchProofOutput.dump();
+                    ordered_json jRecursiveProof;
+                    pProverRequest->batchProofOutput.toJson(jRecursiveProof);
+                    string recursiveProof = jRecursiveProof.dump();
                     getProofResponse.set_recursive_proof(recursiveProof);
                     break;
                 }
                 case prt_genAggregatedProof:
                 {
-                    string recursiveProof = pProverRequest->aggregatedProofOutput.dump();
+                    ordered_json jRecursiveProof;
+                    pProverRequest->aggregatedProofOutput.toJson(jRecursiveProof);
+                    string recursiveProof = jRecursiveProof.dump();
                     getProofResponse.set_recursive_proof(recursiveProof);
                     break;
                 }
@@ -23,13 +23,10 @@ StateDB::~StateDB()
 zkresult StateDB::set(const Goldilocks::Element (&oldRoot)[4], const Goldilocks::Element (&key)[4], const mpz_class &value, const bool persistent, Goldilocks::Element (&newRoot)[4], SmtSetResult *result, DatabaseMap *dbReadLog)
 {
 #ifdef LOG_TIME_STATISTICS_STATEDB
+    struct timeval t;
     gettimeofday(&t, NULL);
 #endif
 
-#ifdef STATEDB_LOCK
-    lock_guard<recursive_mutex> guard(mlock);
-#endif
-
     SmtSetResult *r;
     if (result == NULL) r = new SmtSetResult;
     else r = result;
@@ -49,13 +46,10 @@ zkresult StateDB::set(const Goldilocks::Element (&oldRoot)[4], const Goldilocks:
 zkresult StateDB::get(const Goldilocks::Element (&root)[4], const Goldilocks::Element (&key)[4], mpz_class &value, SmtGetResult *result, DatabaseMap *dbReadLog)
 {
 #ifdef LOG_TIME_STATISTICS_STATEDB
+    struct timeval t;
     gettimeofday(&t, NULL);
 #endif
 
-#ifdef STATEDB_LOCK
-    lock_guard<recursive_mutex> guard(mlock);
-#endif
-
     SmtGetResult *r;
     if (result == NULL) r = new SmtGetResult;
     else r = result;
@@ -73,14 +67,58 @@ zkresult StateDB::get(const Goldilocks::Element (&root)[4], const Goldilocks::El
     return zkr;
 }
 
-zkresult StateDB::setProgram(const Goldilocks::Element (&key)[4], const vector<uint8_t> &data, const bool persistent)
+zkresult StateDB::setBatch(const Goldilocks::Element (&oldRoot)[4], const vector<SmtKeyValue> &keyValues, const bool persistent, Goldilocks::Element (&newRoot)[4], vector<SmtSetResult> *results, DatabaseMap *dbReadLog)
+{
+#ifdef LOG_TIME_STATISTICS_STATEDB
+    struct timeval t;
+    gettimeofday(&t, NULL);
+#endif
+
+    vector<SmtSetResult> *r;
+    if (results == NULL) r = new vector<SmtSetResult>;
+    else r = results;
+
+    zkresult zkr = smt.setBatch(db, oldRoot, keyValues, persistent, newRoot, *r, dbReadLog);
+
+    if (results == NULL) delete r;
+
+#ifdef LOG_TIME_STATISTICS_STATEDB
+    tms.add("setBatch", TimeDiff(t));
+#endif
+
+    return zkr;
+}
+
+zkresult StateDB::getBatch(const Goldilocks::Element (&root)[4], const vector<SmtKeyValue> &keyValues, vector<mpz_class> &values, vector<SmtGetResult> *results, DatabaseMap *dbReadLog)
 {
 #ifdef LOG_TIME_STATISTICS_STATEDB
+    struct timeval t;
     gettimeofday(&t, NULL);
 #endif
 
-#ifdef STATEDB_LOCK
-    lock_guard<recursive_mutex> guard(mlock);
+    vector<SmtGetResult> *r;
+    if (results == NULL) r = new vector<SmtGetResult>;
+    else r = results;
+
+    zkresult zkr = smt.getBatch(db, root, keyValues, *r, dbReadLog);
+
+    values.resize(r->size());
+    for (uint64_t i = 0; i < r->size(); i++) values[i] = (*r)[i].value;
+
+    if (results == NULL) delete r;
+
+#ifdef LOG_TIME_STATISTICS_STATEDB
+    tms.add("getBatch", TimeDiff(t));
+#endif
+
+    return zkr;
+}
+
+zkresult StateDB::setProgram(const Goldilocks::Element (&key)[4], const vector<uint8_t> &data, const bool persistent)
+{
+#ifdef LOG_TIME_STATISTICS_STATEDB
+    struct timeval t;
+    gettimeofday(&t, NULL);
 #endif
 
     zkresult zkr = db.setProgram(fea2string(fr, key), data, persistent);
@@ -95,13 +133,10 @@ zkresult StateDB::setProgram(const Goldilocks::Element (&key)[4], const vector<u
 zkresult StateDB::getProgram(const Goldilocks::Element (&key)[4], vector<uint8_t> &data, DatabaseMap *dbReadLog)
 {
 #ifdef LOG_TIME_STATISTICS_STATEDB
+    struct timeval t;
     gettimeofday(&t, NULL);
 #endif
 
-#ifdef STATEDB_LOCK
-    lock_guard<recursive_mutex> guard(mlock);
-#endif
-
     data.clear();
     zkresult zkr = db.getProgram(fea2string(fr, key), data, dbReadLog);
 
@@ -115,13 +150,10 @@ zkresult StateDB::getProgram(const Goldilocks::Element (&key)[4], vector<uint8_t
 void StateDB::loadDB(const DatabaseMap::MTMap &input, const bool persistent)
 {
 #ifdef LOG_TIME_STATISTICS_STATEDB
+    struct timeval t;
     gettimeofday(&t, NULL);
 #endif
 
-#ifdef STATEDB_LOCK
-    lock_guard<recursive_mutex> guard(mlock);
-#endif
-
     DatabaseMap::MTMap::const_iterator it;
     for (it = input.begin(); it != input.end(); it++)
     {
@@ -137,13 +169,10 @@ void StateDB::loadDB(const DatabaseMap::MTMap &input, const bool persistent)
 void StateDB::loadProgramDB(const DatabaseMap::ProgramMap &input, const bool persistent)
 {
 #ifdef LOG_TIME_STATISTICS_STATEDB
+    struct timeval t;
     gettimeofday(&t, NULL);
 #endif
 
-#ifdef STATEDB_LOCK
-    lock_guard<recursive_mutex> guard(mlock);
-#endif
-
     DatabaseMap::ProgramMap::const_iterator it;
     for (it = input.begin(); it != input.end(); it++)
     {
@@ -158,13 +187,10 @@ void StateDB::loadProgramDB(const DatabaseMap::ProgramMap &input, const bool per
 zkresult StateDB::flush()
 {
 #ifdef LOG_TIME_STATISTICS_STATEDB
+    struct timeval t;
     gettimeofday(&t, NULL);
 #endif
 
-#ifdef STATEDB_LOCK
-    lock_guard<recursive_mutex> guard(mlock);
-#endif
-
     zkresult result;
     result = db.flush();
 
@@ -180,13 +206,10 @@ zkresult StateDB::flush()
 void StateDB::setAutoCommit(const bool autoCommit)
 {
 #ifdef LOG_TIME_STATISTICS_STATEDB
+    struct timeval t;
     gettimeofday(&t, NULL);
 #endif
 
-#ifdef STATEDB_LOCK
-    lock_guard<recursive_mutex> guard(mlock);
-#endif
-
 #ifdef DATABASE_COMMIT
     db.setAutoCommit(autoCommit);
 #endif
@@ -199,13 +222,10 @@ void StateDB::setAutoCommit(const bool autoCommit)
 void StateDB::commit()
 {
 #ifdef LOG_TIME_STATISTICS_STATEDB
+    struct timeval t;
     gettimeofday(&t, NULL);
 #endif
 
-#ifdef STATEDB_LOCK
-    lock_guard<recursive_mutex> guard(mlock);
-#endif
-
 #ifdef DATABASE_COMMIT
     db.commit();
 #endif
@@ -218,13 +238,10 @@ void StateDB::commit()
 void StateDB::hashSave(const Goldilocks::Element (&a)[8], const Goldilocks::Element (&c)[4], const bool persistent, Goldilocks::Element (&hash)[4])
 {
 #ifdef LOG_TIME_STATISTICS_STATEDB
+    struct timeval t;
     gettimeofday(&t, NULL);
 #endif
 
-#ifdef STATEDB_LOCK
-    lock_guard<recursive_mutex> guard(mlock);
-#endif
-
     smt.hashSave(db, a, c, persistent, hash);
 
 #ifdef LOG_TIME_STATISTICS_STATEDB
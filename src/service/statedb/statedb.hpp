@@ -9,6 +9,11 @@
 #include "zkresult.hpp"
 #include "utils/time_metric.hpp"
 
+// StateDB methods can be called concurrently from any number of threads, without a global lock.
+// Tree nodes are content-addressed, i.e. their key is the hash of their value, so a node is never
+// modified once written, and get() calls never conflict with each other or with set() calls, which
+// only add new nodes.  Concurrent accesses are synchronized by the Database: the MT cache is lock-free
+// for readers, and writers only serialize on the multi-write queues and on the connections pool
 class StateDB : public StateDBInterface
 {
 private:
@@ -19,13 +24,8 @@ public:
 private:
     Smt smt;
 
-#ifdef STATEDB_LOCK
-    recursive_mutex mlock;
-#endif
-
 #ifdef LOG_TIME_STATISTICS_STATEDB
     TimeMetricStorage tms;
-    struct timeval t;
 #endif
 
 public:
@@ -33,6 +33,8 @@ public:
     ~StateDB();
     zkresult set(const Goldilocks::Element (&oldRoot)[4], const Goldilocks::Element (&key)[4], const mpz_class &value, const bool persistent, Goldilocks::Element (&newRoot)[4], SmtSetResult *result, DatabaseMap *dbReadLog);
     zkresult get(const Goldilocks::Element (&root)[4], const Goldilocks::Element (&key)[4], mpz_class &value, SmtGetResult *result, DatabaseMap *dbReadLog);
+    zkresult setBatch(const Goldilocks::Element (&oldRoot)[4], const vector<SmtKeyValue> &keyValues, const bool persistent, Goldilocks::Element (&newRoot)[4], vector<SmtSetResult> *results, DatabaseMap *dbReadLog);
+    zkresult getBatch(const Goldilocks::Element (&root)[4], const vector<SmtKeyValue> &keyValues, vector<mpz_class> &values, vector<SmtGetResult> *results, DatabaseMap *dbReadLog);
     zkresult setProgram(const Goldilocks::Element (&key)[4], const vector<uint8_t> &data, const bool persistent);
     zkresult getProgram(const Goldilocks::Element (&key)[4], vector<uint8_t> &data, DatabaseMap *dbReadLog);
     void loadDB(const DatabaseMap::MTMap &inputDB, const bool persistent);
@@ -15,6 +15,8 @@ public:
     virtual ~StateDBInterface(){};
     virtual zkresult set(const Goldilocks::Element (&oldRoot)[4], const Goldilocks::Element (&key)[4], const mpz_class &value, const bool persistent, Goldilocks::Element (&newRoot)[4], SmtSetResult *result, DatabaseMap *dbReadLog) = 0;
     virtual zkresult get(const Goldilocks::Element (&root)[4], const Goldilocks::Element (&key)[4], mpz_class &value, SmtGetResult *result, DatabaseMap *dbReadLog) = 0;
+    virtual zkresult setBatch(const Goldilocks::Element (&oldRoot)[4], const vector<SmtKeyValue> &keyValues, const bool persistent, Goldilocks::Element (&newRoot)[4], vector<SmtSetResult> *results, DatabaseMap *dbReadLog) = 0;
+    virtual zkresult getBatch(const Goldilocks::Element (&root)[4], const vector<SmtKeyValue> &keyValues, vector<mpz_class> &values, vector<SmtGetResult> *results, DatabaseMap *dbReadLog) = 0;
     virtual zkresult setProgram(const Goldilocks::Element (&key)[4], const vector<uint8_t> &data, const bool persistent) = 0;
     virtual zkresult getProgram(const Goldilocks::Element (&key)[4], vector<uint8_t> &data, DatabaseMap *dbReadLog) = 0;
     virtual void loadDB(const DatabaseMap::MTMap &input, const bool persistent) = 0;
@@ -164,6 +164,156 @@ zkresult StateDBRemote::get (const Goldilocks::Element (&root)[4], const Goldilo
     return static_cast<zkresult>(response.result().code());
 }
 
+zkresult StateDBRemote::setBatch (const Goldilocks::Element (&oldRoot)[4], const vector<SmtKeyValue> &keyValues, const bool persistent, Goldilocks::Element (&newRoot)[4], vector<SmtSetResult> *results, DatabaseMap *dbReadLog)
+{
+#ifdef LOG_TIME_STATISTICS_STATEDB_REMOTE
+    gettimeofday(&t, NULL);
+#endif
+
+    ::grpc::ClientContext context;
+    ::statedb::v1::SetBatchRequest request;
+    ::statedb::v1::SetBatchResponse response;
+
+    ::statedb::v1::Fea* reqOldRoot = new ::statedb::v1::Fea();
+    fea2grpc(fr, oldRoot, reqOldRoot);
+    request.set_allocated_old_root(reqOldRoot);
+
+    for (uint64_t i=0; i<keyValues.size(); i++)
+    {
+        fea2grpc(fr, keyValues[i].key, request.add_keys());
+        request.add_values(keyValues[i].value.get_str(16));
+    }
+    request.set_persistent(persistent);
+    request.set_details(results != NULL);
+    request.set_get_db_read_log((dbReadLog != NULL));
+
+    grpc::Status s = stub->SetBatch(&context, request, &response);
+    if (s.error_code() != grpc::StatusCode::OK) {
+        cerr << "Error: StateDBRemote::setBatch() GRPC error(" << s.error_code() << "): " << s.error_message() << endl;
+        return ZKR_STATEDB_GRPC_ERROR;
+    }
+
+    grpc2fea(fr, response.new_root(), newRoot);
+
+    if (results != NULL) {
+        results->resize(response.results_size());
+        for (int i=0; i<response.results_size(); i++)
+        {
+            const ::statedb::v1::SetResponse &res = response.results(i);
+            SmtSetResult &result = (*results)[i];
+            grpc2fea(fr, res.old_root(), result.oldRoot);
+            grpc2fea(fr, res.key(), result.key);
+            grpc2fea(fr, res.new_root(), result.newRoot);
+
+            google::protobuf::Map<google::protobuf::uint64, statedb::v1::SiblingList>::const_iterator it;
+            result.siblings.clear();
+            for (it=res.siblings().begin(); it!=res.siblings().end(); it++)
+            {
+                vector<Goldilocks::Element> list;
+                for (int j=0; j<it->second.sibling_size(); j++) {
+                    list.push_back(fr.fromU64(it->second.sibling(j)));
+                }
+                result.siblings[it->first]=list;
+            }
+
+            grpc2fea(fr, res.ins_key(), result.insKey);
+            result.insValue.set_str(res.ins_value(),16);
+            result.isOld0 = res.is_old0();
+            result.oldValue.set_str(res.old_value(),16);
+            result.newValue.set_str(res.new_value(),16);
+            result.mode = res.mode();
+            result.proofHashCounter = res.proof_hash_counter();
+        }
+    }
+
+    if (dbReadLog != NULL) {
+        DatabaseMap::MTMap mtMap;
+        grpc2mtMap(fr, *response.mutable_db_read_log(), mtMap);
+        dbReadLog->add(mtMap);
+    }
+
+#ifdef LOG_TIME_STATISTICS_STATEDB_REMOTE
+    tms.add("setBatch", TimeDiff(t));
+#endif
+
+    return static_cast<zkresult>(response.result().code());
+}
+
+zkresult StateDBRemote::getBatch (const Goldilocks::Element (&root)[4], const vector<SmtKeyValue> &keyValues, vector<mpz_class> &values, vector<SmtGetResult> *results, DatabaseMap *dbReadLog)
+{
+#ifdef LOG_TIME_STATISTICS_STATEDB_REMOTE
+    gettimeofday(&t, NULL);
+#endif
+
+    ::grpc::ClientContext context;
+    ::statedb::v1::GetBatchRequest request;
+    ::statedb::v1::GetBatchResponse response;
+
+    ::statedb::v1::Fea* reqRoot = new ::statedb::v1::Fea();
+    fea2grpc(fr, root, reqRoot);
+    request.set_allocated_root(reqRoot);
+
+    for (uint64_t i=0; i<keyValues.size(); i++)
+    {
+        fea2grpc(fr, keyValues[i].key, request.add_keys());
+    }
+    request.set_details(results != NULL);
+    request.set_get_db_read_log((dbReadLog != NULL));
+
+    grpc::Status s = stub->GetBatch(&context, request, &response);
+    if (s.error_code() != grpc::StatusCode::OK) {
+        cerr << "Error: StateDBRemote::getBatch() GRPC error(" << s.error_code() << "): " << s.error_message() << endl;
+        return ZKR_STATEDB_GRPC_ERROR;
+    }
+
+    values.resize(response.values_size());
+    for (int i=0; i<response.values_size(); i++)
+    {
+        values[i].set_str(response.values(i),16);
+    }
+
+    if (results != NULL) {
+        results->resize(response.results_size());
+        for (int i=0; i<response.results_size(); i++)
+        {
+            const ::statedb::v1::GetResponse &res = response.results(i);
+            SmtGetResult &result = (*results)[i];
+            grpc2fea(fr, res.root(), result.root);
+            grpc2fea(fr, res.key(), result.key);
+            result.value.set_str(res.value(),16);
+
+            google::protobuf::Map<google::protobuf::uint64, statedb::v1::SiblingList>::const_iterator it;
+            result.siblings.clear();
+            for (it=res.siblings().begin(); it!=res.siblings().end(); it++)
+            {
+                vector<Goldilocks::Element> list;
+                for (int j=0; j<it->second.sibling_size(); j++)
+                {
+                    list.push_back(fr.fromU64(it->second.sibling(j)));
+                }
+                result.siblings[it->first]=list;
+            }
+
+            grpc2fea(fr, res.ins_key(), result.insKey);
+            result.insValue.set_str(res.ins_value(),16);
+            result.isOld0 = res.is_old0();
+            result.proofHashCounter = res.proof_hash_counter();
+        }
+    }
+
+    if (dbReadLog != NULL) {
+        DatabaseMap::MTMap mtMap;
+        grpc2mtMap(fr, *response.mutable_db_read_log(), mtMap);
+        dbReadLog->add(mtMap);
+    }
+
+#ifdef LOG_TIME_STATISTICS_STATEDB_REMOTE
+    tms.add("getBatch", TimeDiff(t));
+#endif
+
+    return static_cast<zkresult>(response.result().code());
+}
+
 zkresult StateDBRemote::setProgram (const Goldilocks::Element (&key)[4], const vector<uint8_t> &data, const bool persistent)
 {
 #ifdef LOG_TIME_STATISTICS_STATEDB_REMOTE
@@ -30,6 +30,8 @@ public:
     ~StateDBRemote();
     zkresult set(const Goldilocks::Element (&oldRoot)[4], const Goldilocks::Element (&key)[4], const mpz_class &value, const bool persistent, Goldilocks::Element (&newRoot)[4], SmtSetResult *result, DatabaseMap *dbReadLog);
     zkresult get(const Goldilocks::Element (&root)[4], const Goldilocks::Element (&key)[4], mpz_class &value, SmtGetResult *result, DatabaseMap *dbReadLog);
+    zkresult setBatch(const Goldilocks::Element (&oldRoot)[4], const vector<SmtKeyValue> &keyValues, const bool persistent, Goldilocks::Element (&newRoot)[4], vector<SmtSetResult> *results, DatabaseMap *dbReadLog);
+    zkresult getBatch(const Goldilocks::Element (&root)[4], const vector<SmtKeyValue> &keyValues, vector<mpz_class> &values, vector<SmtGetResult> *results, DatabaseMap *dbReadLog);
     zkresult setProgram(const Goldilocks::Element (&key)[4], const vector<uint8_t> &data, const bool persistent);
     zkresult getProgram(const Goldilocks::Element (&key)[4], vector<uint8_t> &data, DatabaseMap *dbReadLog);
     void loadDB(const DatabaseMap::MTMap &input, const bool persistent);
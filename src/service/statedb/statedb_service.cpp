@@ -172,6 +172,191 @@ using grpc::Status;
     return Status::OK;
 }
 
+::grpc::Status StateDBServiceImpl::SetBatch(::grpc::ServerContext* context, const ::statedb::v1::SetBatchRequest* request, ::statedb::v1::SetBatchResponse* response)
+{
+    Goldilocks::Element newRoot[4];
+    try
+    {
+        Goldilocks::Element oldRoot[4];
+        grpc2fea (fr, request->old_root(), oldRoot);
+
+        if (request->keys_size() != request->values_size())
+        {
+            cerr << "Error: StateDBServiceImpl::SetBatch() got keys_size=" << request->keys_size() << " != values_size=" << request->values_size() << endl;
+            return Status::CANCELLED;
+        }
+
+        vector<SmtKeyValue> keyValues(request->keys_size());
+        for (int i=0; i<request->keys_size(); i++)
+        {
+            grpc2fea (fr, request->keys(i), keyValues[i].key);
+            keyValues[i].value.set_str(request->values(i), 16);
+        }
+        bool persistent = request->persistent();
+#ifdef LOG_STATEDB_SERVICE
+    cout << "StateDBServiceImpl::SetBatch() called.";
+    cout << " oldRoot=" << fea2string(fr, oldRoot[0], oldRoot[1], oldRoot[2], oldRoot[3]);
+    cout << " keys=" << keyValues.size();
+    cout << " persistent=" << persistent << endl;
+#endif
+        DatabaseMap *dbReadLog = NULL;
+        if (request->get_db_read_log())
+            dbReadLog = new DatabaseMap();
+
+        vector<SmtSetResult> results;
+        zkresult zkr = pStateDB->setBatch(oldRoot, keyValues, persistent, newRoot, request->details() ? &results : NULL, dbReadLog);
+
+        if (request->get_db_read_log())
+        {
+            mtMap2grpc(fr, dbReadLog->getMTDB(), response->mutable_db_read_log());
+            delete dbReadLog;
+        }
+
+        ::statedb::v1::Fea* resNewRoot = new ::statedb::v1::Fea();
+        fea2grpc (fr, newRoot, resNewRoot);
+        response->set_allocated_new_root(resNewRoot);
+
+        for (uint64_t i=0; i<results.size(); i++)
+        {
+            SmtSetResult &r = results[i];
+            ::statedb::v1::SetResponse* res = response->add_results();
+
+            ::statedb::v1::Fea* resOldRoot = new ::statedb::v1::Fea();
+            fea2grpc (fr, r.oldRoot, resOldRoot);
+            res->set_allocated_old_root(resOldRoot);
+
+            ::statedb::v1::Fea* resRootNew = new ::statedb::v1::Fea();
+            fea2grpc (fr, r.newRoot, resRootNew);
+            res->set_allocated_new_root(resRootNew);
+
+            ::statedb::v1::Fea* resKey = new ::statedb::v1::Fea();
+            fea2grpc (fr, r.key, resKey);
+            res->set_allocated_key(resKey);
+
+            std::map<uint64_t, std::vector<Goldilocks::Element>>::iterator it;
+            for (it=r.siblings.begin(); it!=r.siblings.end(); it++)
+            {
+                ::statedb::v1::SiblingList list;
+                for (uint64_t j=0; j<it->second.size(); j++)
+                {
+                    list.add_sibling(fr.toU64(it->second[j]));
+                }
+                (*res->mutable_siblings())[it->first] = list;
+            }
+
+            ::statedb::v1::Fea* resInsKey = new ::statedb::v1::Fea();
+            fea2grpc (fr, r.insKey, resInsKey);
+            res->set_allocated_ins_key(resInsKey);
+
+            res->set_ins_value(r.insValue.get_str(16));
+            res->set_is_old0(r.isOld0);
+            res->set_old_value(r.oldValue.get_str(16));
+            res->set_new_value(r.newValue.get_str(16));
+            res->set_mode(r.mode);
+            res->set_proof_hash_counter(r.proofHashCounter);
+        }
+
+        ::statedb::v1::ResultCode* rc = new ::statedb::v1::ResultCode();
+        rc->set_code(static_cast<::statedb::v1::ResultCode_Code>(zkr));
+        response->set_allocated_result(rc);
+    }
+    catch (const std::exception &e)
+    {
+        cerr << "Error: StateDBServiceImpl::SetBatch() exception: " << e.what() << endl;
+        return Status::CANCELLED;
+    }
+#ifdef LOG_STATEDB_SERVICE
+    cout << "StateDBServiceImpl::SetBatch() completed. newRoot= " << fea2string(fr, newRoot[0], newRoot[1], newRoot[2], newRoot[3]) << endl;
+#endif
+    return Status::OK;
+}
+
+::grpc::Status StateDBServiceImpl::GetBatch(::grpc::ServerContext* context, const ::statedb::v1::GetBatchRequest* request, ::statedb::v1::GetBatchResponse* response)
+{
+    try
+    {
+        Goldilocks::Element root[4];
+        grpc2fea (fr, request->root(), root);
+
+        vector<SmtKeyValue> keyValues(request->keys_size());
+        for (int i=0; i<request->keys_size(); i++)
+        {
+            grpc2fea (fr, request->keys(i), keyValues[i].key);
+        }
+#ifdef LOG_STATEDB_SERVICE
+    cout << "StateDBServiceImpl::GetBatch() called.";
+    cout << " root=" << fea2string(fr, root[0], root[1], root[2], root[3]);
+    cout << " keys=" << keyValues.size() << endl;
+#endif
+
+        DatabaseMap *dbReadLog = NULL;
+        if (request->get_db_read_log())
+            dbReadLog = new DatabaseMap();
+
+        vector<mpz_class> values;
+        vector<SmtGetResult> results;
+        zkresult zkr = pStateDB->getBatch(root, keyValues, values, request->details() ? &results : NULL, dbReadLog);
+
+        if (request->get_db_read_log())
+        {
+            mtMap2grpc(fr, dbReadLog->getMTDB(), response->mutable_db_read_log());
+            delete dbReadLog;
+        }
+
+        for (uint64_t i=0; i<values.size(); i++)
+        {
+            response->add_values(PrependZeros(values[i].get_str(16), 64));
+        }
+
+        for (uint64_t i=0; i<results.size(); i++)
+        {
+            SmtGetResult &r = results[i];
+            ::statedb::v1::GetResponse* res = response->add_results();
+
+            ::statedb::v1::Fea* resRoot = new ::statedb::v1::Fea();
+            fea2grpc (fr, r.root, resRoot);
+            res->set_allocated_root(resRoot);
+
+            ::statedb::v1::Fea* resKey = new ::statedb::v1::Fea();
+            fea2grpc (fr, r.key, resKey);
+            res->set_allocated_key(resKey);
+
+            std::map<uint64_t, std::vector<Goldilocks::Element>>::iterator it;
+            for (it=r.siblings.begin(); it!=r.siblings.end(); it++)
+            {
+                ::statedb::v1::SiblingList list;
+                for (uint64_t j=0; j<it->second.size(); j++)
+                {
+                    list.add_sibling(fr.toU64(it->second[j]));
+                }
+                (*res->mutable_siblings())[it->first] = list;
+            }
+
+            ::statedb::v1::Fea* resInsKey = new ::statedb::v1::Fea();
+            fea2grpc (fr, r.insKey, resInsKey);
+            res->set_allocated_ins_key(resInsKey);
+
+            res->set_ins_value(r.insValue.get_str(16));
+            res->set_is_old0(r.isOld0);
+            res->set_value(PrependZeros(r.value.get_str(16), 64));
+            res->set_proof_hash_counter(r.proofHashCounter);
+        }
+
+        ::statedb::v1::ResultCode* rc = new ::statedb::v1::ResultCode();
+        rc->set_code(static_cast<::statedb::v1::ResultCode_Code>(zkr));
+        response->set_allocated_result(rc);
+    }
+    catch (const std::exception &e)
+    {
+        cerr << "Error: StateDBServiceImpl::GetBatch() exception: " << e.what() << endl;
+        return Status::CANCELLED;
+    }
+#ifdef LOG_STATEDB_SERVICE
+    cout << "StateDBServiceImpl::GetBatch() completed. values=" << response->values_size() << endl;
+#endif
+    return Status::OK;
+}
+
 ::grpc::Status StateDBServiceImpl::SetProgram(::grpc::ServerContext* context, const ::statedb::v1::SetProgramRequest* request, ::statedb::v1::SetProgramResponse* response)
 {
     try
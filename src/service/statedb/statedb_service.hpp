@@ -20,6 +20,8 @@ public:
     };
     ::grpc::Status Set (::grpc::ServerContext* context, const ::statedb::v1::SetRequest* request, ::statedb::v1::SetResponse* response) override;
     ::grpc::Status Get (::grpc::ServerContext* context, const ::statedb::v1::GetRequest* request, ::statedb::v1::GetResponse* response) override;
+    ::grpc::Status SetBatch (::grpc::ServerContext* context, const ::statedb::v1::SetBatchRequest* request, ::statedb::v1::SetBatchResponse* response) override;
+    ::grpc::Status GetBatch (::grpc::ServerContext* context, const ::statedb::v1::GetBatchRequest* request, ::statedb::v1::GetBatchResponse* response) override;
     ::grpc::Status SetProgram (::grpc::ServerContext* context, const ::statedb::v1::SetProgramRequest* request, ::statedb::v1::SetProgramResponse* response) override;
     ::grpc::Status GetProgram (::grpc::ServerContext* context, const ::statedb::v1::GetProgramRequest* request, ::statedb::v1::GetProgramResponse* response) override;
     ::grpc::Status LoadDB(::grpc::ServerContext* context, const ::statedb::v1::LoadDBRequest* request, ::google::protobuf::Empty* response);
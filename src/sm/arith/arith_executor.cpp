@@ -13,19 +13,31 @@ Goldilocks::Element eq2 (Goldilocks &fr, ArithCommitPols &p, uint64_t step, uint
 Goldilocks::Element eq3 (Goldilocks &fr, ArithCommitPols &p, uint64_t step, uint64_t _o);
 Goldilocks::Element eq4 (Goldilocks &fr, ArithCommitPols &p, uint64_t step, uint64_t _o);
 
-void ArithExecutor::execute (vector<ArithAction> &action, ArithCommitPols &pols)
+void ArithExecutor::execute (ActionLog<ArithAction> &action, ArithCommitPols &pols)
 {
-    // Check that we have enough room in polynomials  TODO: Do this check in JS
-    if (action.size()*32 > N)
-    {
-        cerr << "Error: ArithExecutor::execute() Too many Arith entries=" << action.size() << " > N/32=" << N/32 << endl;
-        exitProcess();
-    }
+    RawFec::Element s;
+    RawFec::Element aux1, aux2;
+    mpz_class q0, q1, q2;
 
-    // Split actions into bytes
-    vector<ArithActionBytes> input;
-    for (uint64_t i=0; i<action.size(); i++)
+    // Process all the inputs, as they are generated by the main executor
+//#pragma omp parallel for // TODO: Disabled since OMP decreases performance, probably due to cache invalidations
+    for (uint64_t i = 0; action.wait(i); i++)
     {
+#ifdef LOG_ARITH_EXECUTOR
+        if (i%10000 == 0)
+        {
+            cout << "Computing arith pols " << i << "/" << action.size() << endl;
+        }
+#endif
+
+        // Check that we have enough room in polynomials  TODO: Do this check in JS
+        if ((i + 1)*32 > N)
+        {
+            cerr << "Error: ArithExecutor::execute() Too many Arith entries=" << i + 1 << " > N/32=" << N/32 << endl;
+            exitProcess();
+        }
+
+        // Split action into bytes
         uint64_t dataSize;
         ArithActionBytes actionBytes;
 
@@ -66,23 +78,6 @@ void ArithExecutor::execute (vector<ArithAction> &action, ArithCommitPols &pols)
         memset(actionBytes._q1, 0, sizeof(actionBytes._q1));
         memset(actionBytes._q2, 0, sizeof(actionBytes._q2));
 
-        input.push_back(actionBytes);
-    }
-
-    RawFec::Element s;
-    RawFec::Element aux1, aux2;
-    mpz_class q0, q1, q2;
-
-    // Process all the inputs
-//#pragma omp parallel for // TODO: Disabled since OMP decreases performance, probably due to cache invalidations
-    for (uint64_t i = 0; i < input.size(); i++)
-    {
-#ifdef LOG_BINARY_EXECUTOR
-        if (i%10000 == 0)
-        {
-            cout << "Computing binary pols " << i << "/" << input.size() << endl;
-        }
-#endif
         // TODO: if not have x1, need to componse it
 
         RawFec::Element x1;
@@ -91,14 +86,14 @@ void ArithExecutor::execute (vector<ArithAction> &action, ArithCommitPols &pols)
         RawFec::Element y2;
         RawFec::Element x3;
         RawFec::Element y3;
-        scalar2fec(fec, x1, input[i].x1);
-        scalar2fec(fec, y1, input[i].y1);
-        scalar2fec(fec, x2, input[i].x2);
-        scalar2fec(fec, y2, input[i].y2);
-        scalar2fec(fec, x3, input[i].x3);
-        scalar2fec(fec, y3, input[i].y3);
+        scalar2fec(fec, x1, actionBytes.x1);
+        scalar2fec(fec, y1, actionBytes.y1);
+        scalar2fec(fec, x2, actionBytes.x2);
+        scalar2fec(fec, y2, actionBytes.y2);
+        scalar2fec(fec, x3, actionBytes.x3);
+        scalar2fec(fec, y3, actionBytes.y3);
 
-        if (input[i].selEq1 == 1)
+        if (actionBytes.selEq1 == 1)
         {
             // s=(y2-y1)/(x2-x1)
             fec.sub(aux1, y2, y1);
@@ -111,7 +106,7 @@ void ArithExecutor::execute (vector<ArithAction> &action, ArithCommitPols &pols)
 
             // Check
             mpz_class pq0;
-            pq0 = sScalar*input[i].x2 - sScalar*input[i].x1 - input[i].y2 + input[i].y1;
+            pq0 = sScalar*actionBytes.x2 - sScalar*actionBytes.x1 - actionBytes.y2 + actionBytes.y1;
             q0 = -(pq0/pFec);
             if ((pq0 + pFec*q0) != 0)
             {
@@ -120,7 +115,7 @@ void ArithExecutor::execute (vector<ArithAction> &action, ArithCommitPols &pols)
             } 
             q0 += ScalarTwoTo258;
         }
-        else if (input[i].selEq2 == 1)
+        else if (actionBytes.selEq2 == 1)
         {
             // s = 3*x1*x1/(y1+y1
             fec.mul(aux1, x1, x1);
@@ -135,7 +130,7 @@ void ArithExecutor::execute (vector<ArithAction> &action, ArithCommitPols &pols)
 
             // Check
             mpz_class pq0;
-            pq0 = sScalar*2*input[i].y1 - 3*input[i].x1*input[i].x1;
+            pq0 = sScalar*2*actionBytes.y1 - 3*actionBytes.x1*actionBytes.x1;
             q0 = -(pq0/pFec);
             if ((pq0 + pFec*q0) != 0)
             {
@@ -150,7 +145,7 @@ void ArithExecutor::execute (vector<ArithAction> &action, ArithCommitPols &pols)
             q0 = 0;
         }
 
-        if (input[i].selEq3 == 1)
+        if (actionBytes.selEq3 == 1)
         {
             // Get s as a scalar
             mpz_class sScalar;
@@ -158,7 +153,7 @@ void ArithExecutor::execute (vector<ArithAction> &action, ArithCommitPols &pols)
 
             // Check q1
             mpz_class pq1;
-            pq1 = sScalar*sScalar - input[i].x1 - input[i].x2 - input[i].x3;
+            pq1 = sScalar*sScalar - actionBytes.x1 - actionBytes.x2 - actionBytes.x3;
             q1 = -(pq1/pFec);
             if ((pq1 + pFec*q1) != 0)
             {
@@ -169,7 +164,7 @@ void ArithExecutor::execute (vector<ArithAction> &action, ArithCommitPols &pols)
 
             // Check q2
             mpz_class pq2;
-            pq2 = sScalar*input[i].x1 - sScalar*input[i].x3 - input[i].y1 - input[i].y3;
+            pq2 = sScalar*actionBytes.x1 - sScalar*actionBytes.x3 - actionBytes.y1 - actionBytes.y3;
             q2 = -(pq2/pFec);
             if ((pq2 + pFec*q2) != 0)
             {
@@ -188,41 +183,35 @@ void ArithExecutor::execute (vector<ArithAction> &action, ArithCommitPols &pols)
         mpz_class sScalar;
         fec2scalar(fec, s, sScalar);
 
-        uint64_t dataSize;
         dataSize = 16;
-        scalar2ba16(input[i]._s, dataSize, sScalar);
+        scalar2ba16(actionBytes._s, dataSize, sScalar);
         dataSize = 16;
-        scalar2ba16(input[i]._q0, dataSize, q0);
+        scalar2ba16(actionBytes._q0, dataSize, q0);
         dataSize = 16;
-        scalar2ba16(input[i]._q1, dataSize, q1);
+        scalar2ba16(actionBytes._q1, dataSize, q1);
         dataSize = 16;
-        scalar2ba16(input[i]._q2, dataSize, q2);
-    }
-    
-    // Process all the inputs
-//#pragma omp parallel for // TODO: Disabled since OMP decreases performance, probably due to cache invalidations
-    for (uint64_t i = 0; i < input.size(); i++)
-    {
+        scalar2ba16(actionBytes._q2, dataSize, q2);
+
         uint64_t offset = i*32;
         for (uint64_t step=0; step<32; step++)
         {
             for (uint64_t j=0; j<16; j++)
             {
-                pols.x1[j][offset + step] = fr.fromU64(input[i]._x1[j]);
-                pols.y1[j][offset + step] = fr.fromU64(input[i]._y1[j]);
-                pols.x2[j][offset + step] = fr.fromU64(input[i]._x2[j]);
-                pols.y2[j][offset + step] = fr.fromU64(input[i]._y2[j]);
-                pols.x3[j][offset + step] = fr.fromU64(input[i]._x3[j]);
-                pols.y3[j][offset + step] = fr.fromU64(input[i]._y3[j]);
-                pols.s[j][offset + step]  = fr.fromU64(input[i]._s[j]);
-                pols.q0[j][offset + step] = fr.fromU64(input[i]._q0[j]);
-                pols.q1[j][offset + step] = fr.fromU64(input[i]._q1[j]);
-                pols.q2[j][offset + step] = fr.fromU64(input[i]._q2[j]);
+                pols.x1[j][offset + step] = fr.fromU64(actionBytes._x1[j]);
+                pols.y1[j][offset + step] = fr.fromU64(actionBytes._y1[j]);
+                pols.x2[j][offset + step] = fr.fromU64(actionBytes._x2[j]);
+                pols.y2[j][offset + step] = fr.fromU64(actionBytes._y2[j]);
+                pols.x3[j][offset + step] = fr.fromU64(actionBytes._x3[j]);
+                pols.y3[j][offset + step] = fr.fromU64(actionBytes._y3[j]);
+                pols.s[j][offset + step]  = fr.fromU64(actionBytes._s[j]);
+                pols.q0[j][offset + step] = fr.fromU64(actionBytes._q0[j]);
+                pols.q1[j][offset + step] = fr.fromU64(actionBytes._q1[j]);
+                pols.q2[j][offset + step] = fr.fromU64(actionBytes._q2[j]);
             }
-            pols.selEq[0][offset + step] = fr.fromU64(input[i].selEq0);
-            pols.selEq[1][offset + step] = fr.fromU64(input[i].selEq1);
-            pols.selEq[2][offset + step] = fr.fromU64(input[i].selEq2);
-            pols.selEq[3][offset + step] = fr.fromU64(input[i].selEq3);
+            pols.selEq[0][offset + step] = fr.fromU64(actionBytes.selEq0);
+            pols.selEq[1][offset + step] = fr.fromU64(actionBytes.selEq1);
+            pols.selEq[2][offset + step] = fr.fromU64(actionBytes.selEq2);
+            pols.selEq[3][offset + step] = fr.fromU64(actionBytes.selEq3);
         }
 
         mpz_class carry[3] = {0, 0, 0};
@@ -264,4 +253,15 @@ void ArithExecutor::execute (vector<ArithAction> &action, ArithCommitPols &pols)
     }
     
     cout << "ArithExecutor successfully processed " << action.size() << " arith actions (" << (double(action.size())*32*100)/N << "%)" << endl;
+}
+
+void ArithExecutor::execute (vector<ArithAction> &action, ArithCommitPols &pols)
+{
+    ActionLog<ArithAction> actionLog;
+    for (uint64_t i=0; i<action.size(); i++)
+    {
+        actionLog.push_back(action[i]);
+    }
+    actionLog.close();
+    execute(actionLog, pols);
 }
\ No newline at end of file
@@ -9,6 +9,7 @@
 #include "ffiasm/fec.hpp"
 #include "scalar.hpp"
 #include "exit_process.hpp"
+#include "action_log.hpp"
 
 USING_PROVER_FORK_NAMESPACE;
 
@@ -34,6 +35,9 @@ public:
     ~ArithExecutor ()
     {
     }
+    // Consumes the actions as they are appended to the log, until it is closed
+    void execute (ActionLog<ArithAction> &action, PROVER_FORK_NAMESPACE::ArithCommitPols &pols);
+
     void execute (vector<ArithAction> &action, PROVER_FORK_NAMESPACE::ArithCommitPols &pols);
 };
 
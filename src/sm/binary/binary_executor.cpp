@@ -78,28 +78,8 @@ void BinaryExecutor::buildReset (void)
     TimerStopAndLog(BINARY_BUILD_RESET);
 }
 
-void BinaryExecutor::execute (vector<BinaryAction> &action, BinaryCommitPols &pols)
+void BinaryExecutor::execute (ActionLog<BinaryAction> &action, BinaryCommitPols &pols)
 {
-    // Check that we have enough room in polynomials  TODO: Do this check in JS
-    if (action.size()*LATCH_SIZE > N)
-    {
-        cerr << "Error: BinaryExecutor::execute() Too many Binary entries=" << action.size() << " > N/LATCH_SIZE=" << N/LATCH_SIZE << endl;
-        exitProcess();
-    }
-
-    // Split actions into bytes
-    vector<BinaryActionBytes> input;
-    for (uint64_t i=0; i<action.size(); i++)
-    {
-        BinaryActionBytes actionBytes;
-        scalar2bytes(action[i].a, actionBytes.a_bytes);
-        scalar2bytes(action[i].b, actionBytes.b_bytes);
-        scalar2bytes(action[i].c, actionBytes.c_bytes);
-        actionBytes.opcode = action[i].opcode;
-        actionBytes.type = action[i].type;
-        input.push_back(actionBytes);
-    }
-
     // Local array of N uint32
     uint32_t * c0Temp = (uint32_t *)calloc(N*sizeof(uint32_t),1);
     if (c0Temp == NULL)
@@ -108,22 +88,38 @@ void BinaryExecutor::execute (vector<BinaryAction> &action, BinaryCommitPols &po
         exitProcess();
     }
 
-    // Process all the inputs
+    // Process all the inputs, as they are generated by the main executor
 //#pragma omp parallel for // TODO: Disabled since OMP decreases performance, probably due to cache invalidations
-    for (uint64_t i = 0; i < input.size(); i++)
+    uint64_t i;
+    for (i = 0; action.wait(i); i++)
     {
 #ifdef LOG_BINARY_EXECUTOR
         if (i%10000 == 0)
         {
-            cout << "Computing binary pols " << i << "/" << input.size() << endl;
+            cout << "Computing binary pols " << i << "/" << action.size() << endl;
         }
 #endif
 
+        // Check that we have enough room in polynomials  TODO: Do this check in JS
+        if ((i + 1)*LATCH_SIZE > N)
+        {
+            cerr << "Error: BinaryExecutor::execute() Too many Binary entries=" << i + 1 << " > N/LATCH_SIZE=" << N/LATCH_SIZE << endl;
+            exitProcess();
+        }
+
+        // Split action into bytes
+        BinaryActionBytes actionBytes;
+        scalar2bytes(action[i].a, actionBytes.a_bytes);
+        scalar2bytes(action[i].b, actionBytes.b_bytes);
+        scalar2bytes(action[i].c, actionBytes.c_bytes);
+        actionBytes.opcode = action[i].opcode;
+        actionBytes.type = action[i].type;
+
         for (uint64_t j = 0; j < STEPS; j++)
         {
             bool last = (j == (STEPS - 1)) ? true : false;
             uint64_t index = i*STEPS + j;
-            pols.opcode[index] = fr.fromU64(input[i].opcode);
+            pols.opcode[index] = fr.fromU64(actionBytes.opcode);
 
             Goldilocks::Element cIn = fr.zero();
             Goldilocks::Element cOut = fr.zero();
@@ -134,9 +130,9 @@ void BinaryExecutor::execute (vector<BinaryAction> &action, BinaryCommitPols &po
             {
                 cIn = (k == 0) ? pols.cIn[index] : cOut;
 
-                uint64_t byteA = input[i].a_bytes[j*2 + k];
-                uint64_t byteB = input[i].b_bytes[j*2 + k];
-                uint64_t byteC = input[i].c_bytes[j*2 + k];
+                uint64_t byteA = actionBytes.a_bytes[j*2 + k];
+                uint64_t byteB = actionBytes.b_bytes[j*2 + k];
+                uint64_t byteC = actionBytes.c_bytes[j*2 + k];
                 bool resetByte = reset && (k == 0);
                 bool lastByte = last && (k == 1);
                 pols.freeInA[k][index] = fr.fromU64(byteA);
@@ -145,7 +141,7 @@ void BinaryExecutor::execute (vector<BinaryAction> &action, BinaryCommitPols &po
 
                 // carry management
 
-                switch (input[i].opcode)
+                switch (actionBytes.opcode)
                 {
                     // ADD   (OPCODE = 0)
                     case 0:
@@ -172,7 +168,7 @@ void BinaryExecutor::execute (vector<BinaryAction> &action, BinaryCommitPols &po
                     {
                         if (resetByte)
                         {
-                            pols.freeInC[0][index] = fr.fromU64(input[i].c_bytes[STEPS-1]); // Only change the freeInC when reset or Last
+                            pols.freeInC[0][index] = fr.fromU64(actionBytes.c_bytes[STEPS-1]); // Only change the freeInC when reset or Last
                         }
                         
                         if (byteA < byteB)
@@ -191,7 +187,7 @@ void BinaryExecutor::execute (vector<BinaryAction> &action, BinaryCommitPols &po
                         if (lastByte)
                         {
                             useCarry = true;
-                            pols.freeInC[1][index] = fr.fromU64(input[i].c_bytes[0]);
+                            pols.freeInC[1][index] = fr.fromU64(actionBytes.c_bytes[0]);
                         }
                         break;
                     }
@@ -201,7 +197,7 @@ void BinaryExecutor::execute (vector<BinaryAction> &action, BinaryCommitPols &po
                         useCarry = last;
                         if (resetByte)
                         {
-                            pols.freeInC[0][index] = fr.fromU64(input[i].c_bytes[STEPS-1]);  // Only change the freeInC when reset or Last
+                            pols.freeInC[0][index] = fr.fromU64(actionBytes.c_bytes[STEPS-1]);  // Only change the freeInC when reset or Last
                         }
                         if (lastByte)
                         {
@@ -233,7 +229,7 @@ void BinaryExecutor::execute (vector<BinaryAction> &action, BinaryCommitPols &po
                                     cOut = fr.zero();
                                 }
                             }
-                            pols.freeInC[k][index] = fr.fromU64(input[i].c_bytes[0]); // Only change the freeInC when reset or Last
+                            pols.freeInC[k][index] = fr.fromU64(actionBytes.c_bytes[0]); // Only change the freeInC when reset or Last
                         }
                         else
                         {
@@ -259,7 +255,7 @@ void BinaryExecutor::execute (vector<BinaryAction> &action, BinaryCommitPols &po
                         {
                             // cIn = 1n
                             // pols.cIn[index] = 1n;
-                            pols.freeInC[k][index] = fr.fromU64(input[i].c_bytes[STEPS-1]);
+                            pols.freeInC[k][index] = fr.fromU64(actionBytes.c_bytes[STEPS-1]);
                         }
 
                         if ( (byteA == byteB) && fr.isZero(cIn) )
@@ -275,7 +271,7 @@ void BinaryExecutor::execute (vector<BinaryAction> &action, BinaryCommitPols &po
                         {
                             useCarry = true;
                             cOut = fr.isZero(cOut)? fr.one() : fr.zero();
-                            pols.freeInC[k][index] = fr.fromU64(input[i].c_bytes[0]); // Only change the freeInC when reset or Last
+                            pols.freeInC[k][index] = fr.fromU64(actionBytes.c_bytes[0]); // Only change the freeInC when reset or Last
                         }
                         
                         break;
@@ -351,17 +347,17 @@ void BinaryExecutor::execute (vector<BinaryAction> &action, BinaryCommitPols &po
             }
         }
 
-        if (input[i].type == 1)
+        if (actionBytes.type == 1)
         {
             pols.resultBinOp[((i+1) * STEPS)%N] = fr.one();
         }
-        if (input[i].type == 2)
+        if (actionBytes.type == 2)
         {
             pols.resultValidRange [((i+1) * STEPS)%N] = fr.one();
         }
     }
 
-    for (uint64_t index = input.size()*STEPS; index < N; index++)
+    for (uint64_t index = i*STEPS; index < N; index++)
     {
         uint64_t nextIndex = (index + 1) % N;
         bool reset = (index % STEPS) == 0 ? true : false;
@@ -384,6 +380,17 @@ void BinaryExecutor::execute (vector<BinaryAction> &action, BinaryCommitPols &po
     cout << "BinaryExecutor successfully processed " << action.size() << " binary actions (" << (double(action.size())*LATCH_SIZE*100)/N << "%)" << endl;
 }
 
+void BinaryExecutor::execute (vector<BinaryAction> &action, BinaryCommitPols &pols)
+{
+    ActionLog<BinaryAction> actionLog;
+    for (uint64_t i=0; i<action.size(); i++)
+    {
+        actionLog.push_back(action[i]);
+    }
+    actionLog.close();
+    execute(actionLog, pols);
+}
+
 // To be used only for testing, since it allocates a lot of memory
 void BinaryExecutor::execute (vector<BinaryAction> &action)
 {
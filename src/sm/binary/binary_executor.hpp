@@ -6,6 +6,7 @@
 #include "goldilocks_base_field.hpp"
 #include "binary_action.hpp"
 #include "utils.hpp"
+#include "action_log.hpp"
 #include "sm/pols_generated/commit_pols.hpp"
 
 USING_PROVER_FORK_NAMESPACE;
@@ -22,6 +23,9 @@ private:
 public:
     BinaryExecutor (Goldilocks &fr, const Config &config);
     
+    // Consumes the actions as they are appended to the log, until it is closed
+    void execute (ActionLog<BinaryAction> &action, PROVER_FORK_NAMESPACE::BinaryCommitPols &pols);
+
     void execute (vector<BinaryAction> &action, PROVER_FORK_NAMESPACE::BinaryCommitPols &pols);
 
     void execute (vector<BinaryAction> &action); // Only for testing purposes
@@ -2,8 +2,9 @@
 #include "utils.hpp"
 #include "exit_process.hpp"
 #include "zkassert.hpp"
+#include "zkmax.hpp"
 
-void KeccakFExecutor::loadScript (json j)
+void KeccakFExecutor::loadScript (json &j)
 {
     if ( !j.contains("program") ||
          !j["program"].is_array())
@@ -11,6 +12,7 @@ void KeccakFExecutor::loadScript (json j)
         cerr << "Error: KeccakFExecutor::loadEvals() found JSON object does not contain not a program array" << endl;
         exitProcess();
     }
+    program.clear();
     for (uint64_t i=0; i<j["program"].size(); i++)
     {
         if ( !j["program"][i].is_object() )
@@ -114,12 +116,105 @@ void KeccakFExecutor::loadScript (json j)
             exitProcess();
         }
         
+        if ((instruction.refa > Keccak_SlotSize) || (instruction.refb > Keccak_SlotSize) || (instruction.refr > Keccak_SlotSize))
+        {
+            cerr << "Error: KeccakFExecutor::loadEvals() found reference out of slot in evaluation: " << i << endl;
+            exitProcess();
+        }
+
         program.push_back(instruction);
     }
 
     zkassert(j["maxRef"] == Keccak_SlotSize);
 
+    loadRefPins();
+    bLoaded = true;
+}
+
+/* Image payload: number of instructions n, maxRef, op[n] padded to a multiple of 4 bytes, a[n], b[n] and r[n] */
+
+bool KeccakFExecutor::loadImage (const string &fileName)
+{
+    RomImage image;
+    if (!image.map(fileName, rit_keccakProgram, config.keccakScriptFile))
+    {
+        return false;
+    }
+    uint64_t header[2];
+    if (image.payloadSize < sizeof(header))
+    {
+        cerr << "Error: KeccakFExecutor::loadImage() found invalid payload size=" << image.payloadSize << " in " << fileName << endl;
+        return false;
+    }
+    memcpy(header, image.pPayload, sizeof(header));
+    uint64_t n = header[0];
+    uint64_t opSize = (n + 3) & ~uint64_t(3);
+    if ((header[1] != Keccak_SlotSize) || (n > image.payloadSize) || (image.payloadSize != sizeof(header) + opSize + 3*n*sizeof(uint32_t)))
+    {
+        cerr << "Error: KeccakFExecutor::loadImage() found invalid header in " << fileName << endl;
+        return false;
+    }
+    const uint8_t * pOp = image.pPayload + sizeof(header);
+    const uint8_t * pA = pOp + opSize;
+    const uint8_t * pB = pA + n*sizeof(uint32_t);
+    const uint8_t * pR = pB + n*sizeof(uint32_t);
+
+    program.op.assign(pOp, pOp + n);
+    program.a.resize(n);
+    program.b.resize(n);
+    program.r.resize(n);
+    memcpy(program.a.data(), pA, n*sizeof(uint32_t));
+    memcpy(program.b.data(), pB, n*sizeof(uint32_t));
+    memcpy(program.r.data(), pR, n*sizeof(uint32_t));
+
+    // Same checks as loadScript(), since execute() indexes the gates with these values
+    for (uint64_t i=0; i<n; i++)
+    {
+        if ( ((program.op[i] != gop_xor) && (program.op[i] != gop_andp)) ||
+             (program.a[i] >= 3*KeccakProgram::pinStride) ||
+             (program.b[i] >= 3*KeccakProgram::pinStride) ||
+             (program.r[i] > Keccak_SlotSize) )
+        {
+            cerr << "Error: KeccakFExecutor::loadImage() found invalid instruction: " << i << " in " << fileName << endl;
+            program.clear();
+            return false;
+        }
+    }
+
+    loadRefPins();
     bLoaded = true;
+    return true;
+}
+
+void KeccakFExecutor::saveImage (const string &fileName)
+{
+    zkassert(bLoaded);
+
+    uint64_t n = program.size();
+    uint64_t header[2] = { n, Keccak_SlotSize };
+    string payload;
+    payload.append((const char *)header, sizeof(header));
+    payload.append((const char *)program.op.data(), n);
+    payload.append(((n + 3) & ~uint64_t(3)) - n, 0);
+    payload.append((const char *)program.a.data(), n*sizeof(uint32_t));
+    payload.append((const char *)program.b.data(), n*sizeof(uint32_t));
+    payload.append((const char *)program.r.data(), n*sizeof(uint32_t));
+    RomImage::write(fileName, rit_keccakProgram, payload, config.keccakScriptFile);
+    cout << "KeccakFExecutor::saveImage() generated " << fileName << " with " << n << " instructions" << endl;
+}
+
+void KeccakFExecutor::loadRefPins (void)
+{
+    // Record which pins are written, so that execute() only copies those to the polynomials
+    refPins.assign(KeccakProgram::pinStride, 0);
+    for (uint64_t i=0; i<1600; i++)
+    {
+        refPins[SinRef0 + i*44] |= 1<<pin_a;
+    }
+    for (uint64_t i=0; i<program.size(); i++)
+    {
+        refPins[program.refr(i)] |= (1<<pin_a) | (1<<pin_b) | (1<<pin_r);
+    }
 }
 
 void KeccakFExecutor::execute (KeccakState &S)
@@ -128,21 +223,21 @@ void KeccakFExecutor::execute (KeccakState &S)
 
     for (uint64_t i=0; i<program.size(); i++)
     {
-        if (program[i].op == gop_xor)
+        if (program.op[i] == gop_xor)
         {
-            S.gate[program[i].refr].pin[pin_r].bit = 
-            S.gate[program[i].refa].pin[program[i].pina].bit ^
-            S.gate[program[i].refb].pin[program[i].pinb].bit;
+            S.gate[program.refr(i)].pin[pin_r].bit = 
+            S.gate[program.refa(i)].pin[program.pina(i)].bit ^
+            S.gate[program.refb(i)].pin[program.pinb(i)].bit;
         }
-        else if (program[i].op == gop_andp)
+        else if (program.op[i] == gop_andp)
         {
-            S.gate[program[i].refr].pin[pin_r].bit =
-            ( 1 - S.gate[program[i].refa].pin[program[i].pina].bit ) &
-            S.gate[program[i].refb].pin[program[i].pinb].bit;
+            S.gate[program.refr(i)].pin[pin_r].bit =
+            ( 1 - S.gate[program.refa(i)].pin[program.pina(i)].bit ) &
+            S.gate[program.refb(i)].pin[program.pinb(i)].bit;
         }
         else
         {
-            cerr << "Error: KeccakFExecutor::execute() found invalid op: " << program[i].op << " in evaluation: " << i << endl;
+            cerr << "Error: KeccakFExecutor::execute() found invalid op: " << uint64_t(program.op[i]) << " in evaluation: " << i << endl;
             exitProcess();
         }
     }
@@ -177,26 +272,21 @@ void KeccakFExecutor::execute (uint8_t * bit)
     {
         for (uint64_t i=0; i<program.size(); i++)
         {
-            uint64_t absRefa = relRef2AbsRef(program[i].refa, slot);
-            uint64_t absRefb = relRef2AbsRef(program[i].refb, slot);
-            uint64_t absRefr = relRef2AbsRef(program[i].refr, slot);
-
-            /*if (program[i].refr==(3200*44+1) || program[i].refr==((3200*44)+2) || program[i].refr==1 || program[i].refr==Keccak_SlotSize )
-            {
-                cout << "slot=" << slot << " i=" << i << "/" << program.size() << " refa=" << program[i].refa << " absRefa=" << absRefa << " refb=" << program[i].refb << " absRefb=" << absRefb << " refr=" << program[i].refr << " absRefr=" << absRefr << endl;
-            }*/
+            uint64_t absRefa = relRef2AbsRef(program.refa(i), slot);
+            uint64_t absRefb = relRef2AbsRef(program.refb(i), slot);
+            uint64_t absRefr = relRef2AbsRef(program.refr(i), slot);
 
-            if (program[i].op == gop_xor)
+            if (program.op[i] == gop_xor)
             {
-                gate[absRefr].pin[pin_r].bit = gate[absRefa].pin[program[i].pina].bit ^ gate[absRefb].pin[program[i].pinb].bit;
+                gate[absRefr].pin[pin_r].bit = gate[absRefa].pin[program.pina(i)].bit ^ gate[absRefb].pin[program.pinb(i)].bit;
             }
-            else if (program[i].op == gop_andp)
+            else if (program.op[i] == gop_andp)
             {
-                gate[absRefr].pin[pin_r].bit = ( 1 - gate[absRefa].pin[program[i].pina].bit ) & gate[absRefb].pin[program[i].pinb].bit;
+                gate[absRefr].pin[pin_r].bit = ( 1 - gate[absRefa].pin[program.pina(i)].bit ) & gate[absRefb].pin[program.pinb(i)].bit;
             }
             else
             {
-                cerr << "Error: KeccakFExecutor::execute() found invalid op: " << program[i].op << " in evaluation: " << i << endl;
+                cerr << "Error: KeccakFExecutor::execute() found invalid op: " << uint64_t(program.op[i]) << " in evaluation: " << i << endl;
                 exitProcess();
             }
         }
@@ -240,36 +330,31 @@ void KeccakFExecutor::execute (KeccakFExecuteInput &input, KeccakFExecuteOutput
     }
 
     // Execute the program
-    KeccakInstruction instruction;
     for (uint64_t slot=0; slot<Keccak_NumberOfSlots; slot++)
     {
         for (uint64_t i=0; i<program.size(); i++)
         {
-            instruction = program[i];
-            uint64_t absRefa = relRef2AbsRef(instruction.refa, slot);
-            uint64_t absRefb = relRef2AbsRef(instruction.refb, slot);
-            uint64_t absRefr = relRef2AbsRef(instruction.refr, slot);
+            uint64_t pina = program.pina(i);
+            uint64_t pinb = program.pinb(i);
+            uint64_t absRefa = relRef2AbsRef(program.refa(i), slot);
+            uint64_t absRefb = relRef2AbsRef(program.refb(i), slot);
+            uint64_t absRefr = relRef2AbsRef(program.refr(i), slot);
 
-            output.pol[pin_a][absRefr] = output.pol[instruction.pina][absRefa];
-            output.pol[pin_b][absRefr] = output.pol[instruction.pinb][absRefb];
+            output.pol[pin_a][absRefr] = output.pol[pina][absRefa];
+            output.pol[pin_b][absRefr] = output.pol[pinb][absRefb];
 
-            /*if (instruction.refr==(3200*44+1) || instruction.refr==((3200*44)+2) || instruction.refr==1 || instruction.refr==Keccak_SlotSize)
-            {
-                cout << "slot=" << slot << " i=" << i << "/" << program.size() << " refa=" << instruction.refa << " absRefa=" << absRefa << " refb=" << instruction.refb << " absRefb=" << absRefb << " refr=" << instruction.refr << " absRefr=" << absRefr << endl;
-            }*/
-
-            switch (program[i].op)
+            switch (program.op[i])
             {
                 case gop_xor:
-                    output.pol[pin_r][absRefr] = (output.pol[instruction.pina][absRefa] ^ output.pol[instruction.pinb][absRefb]) & Keccak_Mask;
+                    output.pol[pin_r][absRefr] = (output.pol[pina][absRefa] ^ output.pol[pinb][absRefb]) & Keccak_Mask;
                     break;
 
                 case gop_andp:
-                    output.pol[pin_r][absRefr] = ((~output.pol[instruction.pina][absRefa] ) & output.pol[instruction.pinb][absRefb]) & Keccak_Mask;
+                    output.pol[pin_r][absRefr] = ((~output.pol[pina][absRefa] ) & output.pol[pinb][absRefb]) & Keccak_Mask;
                     break;
 
                 default:
-                    cerr << "Error: KeccakFExecutor::execute() found invalid op: " << program[i].op << " in evaluation: " << i << endl;
+                    cerr << "Error: KeccakFExecutor::execute() found invalid op: " << uint64_t(program.op[i]) << " in evaluation: " << i << endl;
                     exitProcess();
             }
         }
@@ -325,80 +410,78 @@ void KeccakFExecutor::execute (const vector<vector<Goldilocks::Element>> &input,
         pols.c[i][ZeroRef] = fr.fromU64( fr.toU64(pols.a[i][ZeroRef]) ^ fr.toU64(pols.b[i][ZeroRef]) );
     }
 
-    // Set Sin values
-    for (uint64_t slot=0; slot<numberOfSlots; slot++)
+    // Execute the program over blocks of KECCAK_BLOCK_SLOTS slots, one slot per vector lane, so that every
+    // instruction advances all the slots of a block.  Each 44-bit value already holds 44 Keccak-F instances
+    // bit-sliced.  Gate values are kept in a per-block array ordered by pin and reference, matching the
+    // program operands encoding, and they are copied to the polynomials only once, at the end
+    const uint64_t numberOfBlocks = (numberOfSlots + KECCAK_BLOCK_SLOTS - 1) / KECCAK_BLOCK_SLOTS;
+    const uint64_t programSize = program.size();
+    const uint8_t * pOp = program.op.data();
+    const uint32_t * pA = program.a.data();
+    const uint32_t * pB = program.b.data();
+    const uint32_t * pR = program.r.data();
+
+#pragma omp parallel for schedule(dynamic)
+    for (uint64_t block=0; block<numberOfBlocks; block++)
     {
-        for (uint64_t i=0; i<1600; i++)
+        const uint64_t slot0 = block*KECCAK_BLOCK_SLOTS;
+        const uint64_t blockSlots = zkmin(KECCAK_BLOCK_SLOTS, numberOfSlots - slot0);
+
+        KeccakBlockValue * value = (KeccakBlockValue *)aligned_alloc(sizeof(KeccakBlockValue), 3*KeccakProgram::pinStride*sizeof(KeccakBlockValue));
+        if (value == NULL)
         {
-            setPol(pols.a, relRef2AbsRef(SinRef0 + i*44, slot), fr.toU64(input[slot][i]));
+            cerr << "Error: KeccakFExecutor::execute() failed calling aligned_alloc()" << endl;
+            exitProcess();
         }
-    }
+        memset((void *)value, 0, 3*KeccakProgram::pinStride*sizeof(KeccakBlockValue));
+        KeccakBlockValue * valueA = value + pin_a*KeccakProgram::pinStride;
+        KeccakBlockValue * valueB = value + pin_b*KeccakProgram::pinStride;
+        KeccakBlockValue * valueR = value + pin_r*KeccakProgram::pinStride;
 
-    // Execute the program
-#pragma omp parallel for
-    for (uint64_t slot=0; slot<numberOfSlots; slot++)
-    {
-        for (uint64_t i=0; i<program.size(); i++)
+        // Set ZeroRef values
+        for (uint64_t lane=0; lane<KECCAK_BLOCK_SLOTS; lane++)
         {
-            uint64_t absRefa = relRef2AbsRef(program[i].refa, slot);
-            uint64_t absRefb = relRef2AbsRef(program[i].refb, slot);
-            uint64_t absRefr = relRef2AbsRef(program[i].refr, slot);
-            
-            switch (program[i].pina)
-            {
-                case pin_a:
-                    setPol(pols.a, absRefr, getPol(pols.a, absRefa));
-                    break;
-                case pin_b:
-                    setPol(pols.a, absRefr, getPol(pols.b, absRefa));
-                    break;
-                case pin_r:
-                    setPol(pols.a, absRefr, getPol(pols.c, absRefa));
-                    break;
-                default:
-                    cerr << "Error: KeccakFExecutor() found invalid program[i].pina=" << program[i].pina << endl;
-                    exitProcess();
-            }
-            switch (program[i].pinb)
+            valueB[ZeroRef][lane] = Keccak_Mask;
+            valueR[ZeroRef][lane] = Keccak_Mask;
+        }
+
+        // Set Sin values
+        for (uint64_t lane=0; lane<blockSlots; lane++)
+        {
+            for (uint64_t i=0; i<1600; i++)
             {
-                case pin_a:
-                    setPol(pols.b, absRefr, getPol(pols.a, absRefb));
-                    break;
-                case pin_b:
-                    setPol(pols.b, absRefr, getPol(pols.b, absRefb));
-                    break;
-                case pin_r:
-                    setPol(pols.b, absRefr, getPol(pols.c, absRefb));
-                    break;
-                default:
-                    cerr << "Error: KeccakFExecutor() found invalid program[i].pinb=" << program[i].pinb << endl;
-                    exitProcess();
+                valueA[SinRef0 + i*44][lane] = fr.toU64(input[slot0 + lane][i]) & Keccak_Mask;
             }
+        }
 
-            /*if (program[i].refr==(3200*44+1) || program[i].refr==((3200*44)+2) || program[i].refr==1 || program[i].refr==Keccak_SlotSize)
-            {
-                cout << "slot=" << slot << " i=" << i << "/" << program.size() << " refa=" << program[i].refa << " absRefa=" << absRefa << " refb=" << program[i].refb << " absRefb=" << absRefb << " refr=" << program[i].refr << " absRefr=" << absRefr << endl;
-            }*/
+        // Execute the program: xor is a^b and andp is (~a)&b = (a&b)^b, so both are (a&(b|x))^b,
+        // with x all ones for xor and zero for andp, which avoids branching on the operation
+        for (uint64_t i=0; i<programSize; i++)
+        {
+            KeccakBlockValue a = value[pA[i]];
+            KeccakBlockValue b = value[pB[i]];
+            KeccakBlockValue x = (KeccakBlockValue){} - (uint64_t)(pOp[i] == gop_xor);
+            uint64_t r = pR[i];
+            valueA[r] = a;
+            valueB[r] = b;
+            valueR[r] = (a & (b | x)) ^ b;
+        }
 
-            switch (program[i].op)
+        // Copy the written values to the polynomials
+        for (uint64_t ref=1; ref<=Keccak_SlotSize; ref++)
+        {
+            uint8_t pins = refPins[ref];
+            if (pins == 0) continue;
+            for (uint64_t lane=0; lane<blockSlots; lane++)
             {
-                case gop_xor:
-                {
-                    setPol(pols.c, absRefr, (getPol(pols.a, absRefr) ^ getPol(pols.b, absRefr)) & Keccak_Mask );
-                    break;
-                }
-                case gop_andp:
-                {
-                    setPol(pols.c, absRefr, ((~getPol(pols.a, absRefr)) & getPol(pols.b, absRefr)) & Keccak_Mask );
-                    break;
-                }
-                default:
-                {
-                    cerr << "Error: KeccakFExecutor::execute() found invalid op: " << program[i].op << " in evaluation: " << i << endl;
-                    exitProcess();
-                }
+                uint64_t absRef = relRef2AbsRef(ref, slot0 + lane);
+                if (pins & (1<<pin_a)) setPol(pols.a, absRef, valueA[ref][lane]);
+                if (pins & (1<<pin_b)) setPol(pols.b, absRef, valueB[ref][lane]);
+                if (pins & (1<<pin_r)) setPol(pols.c, absRef, valueR[ref][lane]);
             }
         }
+
+        free(value);
     }
 
     cout << "KeccakFExecutor successfully processed " << numberOfSlots << " Keccak-F actions (" << (double(input.size())*Keccak_SlotSize*100)/N << "%)" << endl;
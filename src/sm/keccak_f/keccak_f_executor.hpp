@@ -9,11 +9,16 @@
 #include "keccak_instruction.hpp"
 #include "sm/pols_generated/commit_pols.hpp"
 #include "timer.hpp"
+#include "rom_image.hpp"
 
 USING_PROVER_FORK_NAMESPACE;
 
 using namespace std;
 
+// Number of slots executed together, one per 64-bit lane of a 256-bit vector
+#define KECCAK_BLOCK_SLOTS 4
+typedef uint64_t KeccakBlockValue __attribute__((vector_size(KECCAK_BLOCK_SLOTS*sizeof(uint64_t))));
+
 class KeccakFExecuteInput
 {
 public:
@@ -36,8 +41,12 @@ class KeccakFExecutor
     const Config &config;
     const uint64_t N;
     const uint64_t numberOfSlots;
-    vector<KeccakInstruction> program;
+    KeccakProgram program;
+    vector<uint8_t> refPins; // Per reference, bit mask of the pins that get a value: 1<<pin_a, 1<<pin_b, 1<<pin_r
     bool bLoaded;
+
+    /* Sets refPins once the program is loaded */
+    void loadRefPins (void);
 public:
 
     /* Constructor */
@@ -53,14 +62,24 @@ public:
         if (!config.generateProof() && !config.runFileExecute) return;
 
         TimerStart(KECCAK_F_SM_EXECUTOR_LOAD);
-        json j;
-        file2json(config.keccakScriptFile, j);
-        loadScript(j);
+        if (!config.loadRomImages || !loadImage(romImageFileName(config.keccakScriptFile)))
+        {
+            json j;
+            file2json(config.keccakScriptFile, j);
+            loadScript(j);
+        }
         TimerStopAndLog(KECCAK_F_SM_EXECUTOR_LOAD);
     }
 
     /* Loads evaluations and SoutRefs from a json object */
-    void loadScript (json j);
+    void loadScript (json &j);
+
+    /* Loads the program from a binary image of config.keccakScriptFile; returns false if the image is
+       missing or invalid, so that the caller can load the json script instead */
+    bool loadImage (const string &fileName);
+
+    /* Saves the loaded program as a binary image of config.keccakScriptFile */
+    void saveImage (const string &fileName);
 
     /* Executs Keccak-f() over the provided state */
     void execute (KeccakState &S);
@@ -2,7 +2,9 @@
 #define KECCAK_SM_INSTRUCTION_HPP
 
 #include <array>
+#include <vector>
 #include "gate_operation.hpp"
+#include "keccak_config.hpp"
 
 using namespace std;
 
@@ -30,4 +32,42 @@ public:
     }
 };
 
+/* Compact, struct-of-arrays encoding of the Keccak-F program.
+   Pin operands are encoded as pin*pinStride + ref, which is also their index in an array of gate
+   values ordered by pin and then by reference, so executing an instruction needs no decoding */
+class KeccakProgram
+{
+public:
+    static const uint64_t pinStride = Keccak_SlotSize + 1; // References go from 0 to Keccak_SlotSize
+
+    vector<uint8_t> op;  // GateOperation
+    vector<uint32_t> a;  // pina*pinStride + refa
+    vector<uint32_t> b;  // pinb*pinStride + refb
+    vector<uint32_t> r;  // refr
+
+    void push_back (const KeccakInstruction &instruction)
+    {
+        op.push_back(instruction.op);
+        a.push_back(instruction.pina*pinStride + instruction.refa);
+        b.push_back(instruction.pinb*pinStride + instruction.refb);
+        r.push_back(instruction.refr);
+    }
+
+    void clear (void)
+    {
+        op.clear();
+        a.clear();
+        b.clear();
+        r.clear();
+    }
+
+    uint64_t size (void) const { return op.size(); }
+
+    uint64_t refa (uint64_t i) const { return a[i] % pinStride; }
+    uint64_t pina (uint64_t i) const { return a[i] / pinStride; }
+    uint64_t refb (uint64_t i) const { return b[i] % pinStride; }
+    uint64_t pinb (uint64_t i) const { return b[i] / pinStride; }
+    uint64_t refr (uint64_t i) const { return r[i]; }
+};
+
 #endif
\ No newline at end of file
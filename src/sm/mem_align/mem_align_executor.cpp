@@ -17,18 +17,21 @@ uint8_t getByte (mpz_class value, uint8_t index) {
 }
 
 
-void MemAlignExecutor::execute (vector<MemAlignAction> &input, MemAlignCommitPols &pols)
+void MemAlignExecutor::execute (ActionLog<MemAlignAction> &input, MemAlignCommitPols &pols)
 {
-    // Check input size 
-    if (input.size()*32 > N)
-    {
-        cerr << "Error: MemAlignExecutor::execute() Too many entries input.size()=" << input.size() << " > N/32=" << N/32 << endl;
-        exitProcess();
-    }
-
     uint64_t factors[4] = {1, 1<<8, 1<<16, 1<<24};
-    for (uint64_t i=0; i<input.size(); i++) 
+
+    // Process all the inputs, as they are generated by the main executor
+    uint64_t i;
+    for (i=0; input.wait(i); i++) 
     {
+        // Check input size 
+        if ((i + 1)*32 > N)
+        {
+            cerr << "Error: MemAlignExecutor::execute() Too many entries input.size()=" << i + 1 << " > N/32=" << N/32 << endl;
+            exitProcess();
+        }
+
         mpz_class m0v = input[i].m0;
         mpz_class m1v = input[i].m1;
         mpz_class v = input[i].v;
@@ -90,11 +93,22 @@ void MemAlignExecutor::execute (vector<MemAlignAction> &input, MemAlignCommitPol
             }
         }
     }
-    for (uint64_t i = (input.size() * 32); i < N; i++) {
-        for (uint8_t index = 0; index < 8; index++) {
-            pols.factorV[index][i] = fr.fromU64(FACTORV(index, i % 32));
+    for (uint64_t index = (i * 32); index < N; index++) {
+        for (uint8_t f = 0; f < 8; f++) {
+            pols.factorV[f][index] = fr.fromU64(FACTORV(f, index % 32));
         }
     }    
 
     cout << "MemAlignExecutor successfully processed " << input.size() << " memory align actions (" << (double(input.size())*32*100)/N << "%)" << endl;
-}
\ No newline at end of file
+}
+
+void MemAlignExecutor::execute (vector<MemAlignAction> &input, MemAlignCommitPols &pols)
+{
+    ActionLog<MemAlignAction> inputLog;
+    for (uint64_t i=0; i<input.size(); i++)
+    {
+        inputLog.push_back(input[i]);
+    }
+    inputLog.close();
+    execute(inputLog, pols);
+}
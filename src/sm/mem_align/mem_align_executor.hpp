@@ -6,6 +6,7 @@
 #include "config.hpp"
 #include "goldilocks_base_field.hpp"
 #include "sm/pols_generated/commit_pols.hpp"
+#include "action_log.hpp"
 
 USING_PROVER_FORK_NAMESPACE;
 
@@ -33,6 +34,10 @@ public:
         fr(fr),
         config(config),
         N(PROVER_FORK_NAMESPACE::MemAlignCommitPols::pilDegree()) {}
+
+    // Consumes the actions as they are appended to the log, until it is closed
+    void execute (ActionLog<MemAlignAction> &input, PROVER_FORK_NAMESPACE::MemAlignCommitPols &pols);
+
     void execute (vector<MemAlignAction> &input, PROVER_FORK_NAMESPACE::MemAlignCommitPols &pols);
 };
 
@@ -0,0 +1,15 @@
+#ifndef POSEIDON_G_CONSTANTS_HPP
+#define POSEIDON_G_CONSTANTS_HPP
+
+#include "goldilocks_base_field.hpp"
+
+#define POSEIDONG_NUMBER_OF_ROUND_CONSTANTS 372
+
+// Round constants of the Poseidon Goldilocks permutation, 12 per round, shared by the PoseidonG state
+// machine executor and by the multi-lane Merkle tree hashing
+namespace PoseidonGConstants
+{
+    extern const Goldilocks::Element C[POSEIDONG_NUMBER_OF_ROUND_CONSTANTS];
+}
+
+#endif
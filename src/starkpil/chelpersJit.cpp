@@ -0,0 +1,19 @@
+#include "chelpersJit.hpp"
+
+using namespace std;
+
+bool ChelpersJit::run(const string &name, StepsParams &params, uint64_t nrows)
+{
+    auto it = kernels.find(name);
+    if ((it == kernels.end()) || (nrows % nrowsBatch != 0))
+    {
+        return false;
+    }
+    ChelpersJitFunction kernel = it->second;
+#pragma omp parallel for
+    for (uint64_t i = 0; i < nrows; i += nrowsBatch)
+    {
+        kernel(params, i);
+    }
+    return true;
+}
@@ -0,0 +1,36 @@
+#ifndef CHELPERS_JIT_HPP
+#define CHELPERS_JIT_HPP
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include "goldilocks_base_field.hpp"
+#include "polinomial.hpp"
+#include "constant_pols_starks.hpp"
+#include "zhInv.hpp"
+#include "steps.hpp"
+
+// Computes the batch of rows starting at row i, of ChelpersJit::nrowsBatch rows
+typedef void (*ChelpersJitFunction)(StepsParams &params, uint64_t i);
+
+// Optional replacement of the chelpers parsers: at build time, tools/starkpil/chelpers_jit/gen_chelpers_jit.js
+// turns the op and args arrays of every step into a kernel with one block per op and the arguments as literal
+// constants, so there is no dispatch or argument load left at run time.  The kernels are compiled with the
+// prover, so nothing is compiled or loaded at start-up; a step without a kernel is left to the parsers
+class ChelpersJit
+{
+private:
+    std::map<std::string, ChelpersJitFunction> kernels;
+
+public:
+    uint64_t nrowsBatch; // Rows of every batch of the kernels
+
+    ChelpersJit(const std::map<std::string, ChelpersJitFunction> &kernels, uint64_t nrowsBatch) : kernels(kernels), nrowsBatch(nrowsBatch){};
+
+    bool hasKernel(const std::string &name) const { return kernels.find(name) != kernels.end(); };
+
+    // Runs the step over nrows rows; returns false if it has no kernel
+    bool run(const std::string &name, StepsParams &params, uint64_t nrows);
+};
+
+#endif
@@ -0,0 +1,211 @@
+#include <vector>
+#include <immintrin.h>
+#include <omp.h>
+#include "friFold.hpp"
+#include "zkassert.hpp"
+
+#define FRI_FOLD_FIELD_EXTENSION 3
+
+static Goldilocks::Element powElement(const Goldilocks::Element &base, uint64_t exp)
+{
+    Goldilocks::Element result = Goldilocks::one();
+    Goldilocks::Element square = base;
+    while (exp > 0)
+    {
+        if (exp & 1)
+        {
+            result = result * square;
+        }
+        square = square * square;
+        exp >>= 1;
+    }
+    return result;
+}
+
+// Cubic extension product, for FRI_FOLD_LANES elements at a time: c = a*b, where c can be a or b
+static inline void mul3_avx(__m256i (&c)[FRI_FOLD_FIELD_EXTENSION], const __m256i (&a)[FRI_FOLD_FIELD_EXTENSION], const __m256i (&b)[FRI_FOLD_FIELD_EXTENSION])
+{
+    __m256i A, B, C, D, E, F, G, s0, s1;
+    Goldilocks::add_avx(s0, a[0], a[1]);
+    Goldilocks::add_avx(s1, b[0], b[1]);
+    Goldilocks::mult_avx(A, s0, s1);
+    Goldilocks::add_avx(s0, a[0], a[2]);
+    Goldilocks::add_avx(s1, b[0], b[2]);
+    Goldilocks::mult_avx(B, s0, s1);
+    Goldilocks::add_avx(s0, a[1], a[2]);
+    Goldilocks::add_avx(s1, b[1], b[2]);
+    Goldilocks::mult_avx(C, s0, s1);
+    Goldilocks::mult_avx(D, a[0], b[0]);
+    Goldilocks::mult_avx(E, a[1], b[1]);
+    Goldilocks::mult_avx(F, a[2], b[2]);
+    Goldilocks::sub_avx(G, D, E);
+
+    Goldilocks::add_avx(c[0], C, G);
+    Goldilocks::sub_avx(c[0], c[0], F);
+    Goldilocks::add_avx(c[1], A, C);
+    Goldilocks::sub_avx(c[1], c[1], E);
+    Goldilocks::sub_avx(c[1], c[1], E);
+    Goldilocks::sub_avx(c[1], c[1], D);
+    Goldilocks::sub_avx(c[2], B, G);
+}
+
+void FRIFold::fold(Goldilocks::Element *pol, uint64_t polBits, uint64_t reductionBits, const Goldilocks::Element &shiftInv, const Goldilocks::Element *specialX)
+{
+    // A group of one element is already its own evaluation
+    if (reductionBits == 0)
+    {
+        return;
+    }
+    zkassert(reductionBits <= polBits);
+
+    const uint64_t nX = 1 << reductionBits;
+    const uint64_t pol2N = 1 << (polBits - reductionBits);
+    const uint64_t nBlocks = (pol2N + FRI_FOLD_LANES - 1) / FRI_FOLD_LANES;
+
+    // Everything that does not depend on the group is computed once per fold: the twiddles and the
+    // bit reversal of the inverse NTT of size nX, its 1/nX factor, and the coset generators
+    std::vector<Goldilocks::Element> twiddles(nX / 2);
+    Goldilocks::Element wInv = Goldilocks::inv(Goldilocks::w(reductionBits));
+    twiddles[0] = Goldilocks::one();
+    for (uint64_t k = 1; k < nX / 2; k++)
+    {
+        twiddles[k] = twiddles[k - 1] * wInv;
+    }
+    std::vector<uint64_t> reversed(nX);
+    for (uint64_t i = 0; i < nX; i++)
+    {
+        uint64_t r = 0;
+        for (uint64_t b = 0; b < reductionBits; b++)
+        {
+            r |= ((i >> b) & 1) << (reductionBits - 1 - b);
+        }
+        reversed[i] = r;
+    }
+    Goldilocks::Element nXInv = Goldilocks::inv(Goldilocks::fromU64(nX));
+    Goldilocks::Element wi = Goldilocks::inv(Goldilocks::w(polBits));
+    Goldilocks::Element wiLanes = powElement(wi, FRI_FOLD_LANES);
+
+#pragma omp parallel
+    {
+        uint64_t nThreads = omp_get_num_threads();
+        uint64_t thread = omp_get_thread_num();
+        uint64_t blockInit = (nBlocks * thread) / nThreads;
+        uint64_t blockEnd = (nBlocks * (thread + 1)) / nThreads;
+
+        // Per thread buffers, reused by all its blocks
+        __m256i *twiddlesAvx = new __m256i[nX / 2];
+        for (uint64_t k = 0; k < nX / 2; k++)
+        {
+            Goldilocks::copy_avx(twiddlesAvx[k], twiddles[k]);
+        }
+        __m256i *coefs = new __m256i[nX * FRI_FOLD_FIELD_EXTENSION];
+        __m256i xAvx[FRI_FOLD_FIELD_EXTENSION], nXInvAvx;
+        for (uint64_t c = 0; c < FRI_FOLD_FIELD_EXTENSION; c++)
+        {
+            Goldilocks::copy_avx(xAvx[c], specialX[c]);
+        }
+        Goldilocks::copy_avx(nXInvAvx, nXInv);
+
+        // Coset generators of the first block of the thread
+        Goldilocks::Element sinv[FRI_FOLD_LANES];
+        sinv[0] = shiftInv * powElement(wi, blockInit * FRI_FOLD_LANES);
+        for (uint64_t l = 1; l < FRI_FOLD_LANES; l++)
+        {
+            sinv[l] = sinv[l - 1] * wi;
+        }
+
+        Goldilocks::Element aux[FRI_FOLD_LANES];
+        for (uint64_t block = blockInit; block < blockEnd; block++)
+        {
+            uint64_t g = block * FRI_FOLD_LANES;
+            bool bFullBlock = (g + FRI_FOLD_LANES <= pol2N);
+
+            // Load the groups, in bit reversed order
+            for (uint64_t i = 0; i < nX; i++)
+            {
+                for (uint64_t c = 0; c < FRI_FOLD_FIELD_EXTENSION; c++)
+                {
+                    __m256i &coef = coefs[reversed[i] * FRI_FOLD_FIELD_EXTENSION + c];
+                    if (bFullBlock)
+                    {
+                        Goldilocks::copy_avx(coef, &pol[(i * pol2N + g) * FRI_FOLD_FIELD_EXTENSION + c], FRI_FOLD_FIELD_EXTENSION);
+                    }
+                    else
+                    {
+                        for (uint64_t l = 0; l < FRI_FOLD_LANES; l++)
+                        {
+                            uint64_t gl = (g + l < pol2N) ? g + l : pol2N - 1;
+                            aux[l] = pol[(i * pol2N + gl) * FRI_FOLD_FIELD_EXTENSION + c];
+                        }
+                        Goldilocks::copy_avx(coef, aux, 1);
+                    }
+                }
+            }
+
+            // Inverse NTT, without the 1/nX factor
+            for (uint64_t len = 2; len <= nX; len <<= 1)
+            {
+                uint64_t half = len >> 1;
+                uint64_t twiddleStep = nX / len;
+                for (uint64_t start = 0; start < nX; start += len)
+                {
+                    for (uint64_t j = 0; j < half; j++)
+                    {
+                        __m256i *u = &coefs[(start + j) * FRI_FOLD_FIELD_EXTENSION];
+                        __m256i *v = &coefs[(start + j + half) * FRI_FOLD_FIELD_EXTENSION];
+                        for (uint64_t c = 0; c < FRI_FOLD_FIELD_EXTENSION; c++)
+                        {
+                            __m256i t;
+                            Goldilocks::mult_avx(t, v[c], twiddlesAvx[j * twiddleStep]);
+                            Goldilocks::sub_avx(v[c], u[c], t);
+                            Goldilocks::add_avx(u[c], u[c], t);
+                        }
+                    }
+                }
+            }
+
+            // Evaluate sum(coefs[k]*(sinv*specialX)^k) with Horner, and apply the 1/nX factor
+            __m256i sinvAvx, z[FRI_FOLD_FIELD_EXTENSION], acc[FRI_FOLD_FIELD_EXTENSION];
+            Goldilocks::copy_avx(sinvAvx, sinv, 1);
+            for (uint64_t c = 0; c < FRI_FOLD_FIELD_EXTENSION; c++)
+            {
+                Goldilocks::mult_avx(z[c], sinvAvx, xAvx[c]);
+                acc[c] = coefs[(nX - 1) * FRI_FOLD_FIELD_EXTENSION + c];
+            }
+            for (int64_t k = nX - 2; k >= 0; k--)
+            {
+                mul3_avx(acc, acc, z);
+                for (uint64_t c = 0; c < FRI_FOLD_FIELD_EXTENSION; c++)
+                {
+                    Goldilocks::add_avx(acc[c], acc[c], coefs[k * FRI_FOLD_FIELD_EXTENSION + c]);
+                }
+            }
+
+            // Store the results over the first element of every group, which has already been read
+            for (uint64_t c = 0; c < FRI_FOLD_FIELD_EXTENSION; c++)
+            {
+                Goldilocks::mult_avx(acc[c], acc[c], nXInvAvx);
+                if (bFullBlock)
+                {
+                    Goldilocks::copy_avx(&pol[g * FRI_FOLD_FIELD_EXTENSION + c], FRI_FOLD_FIELD_EXTENSION, acc[c]);
+                }
+                else
+                {
+                    Goldilocks::copy_avx(aux, 1, acc[c]);
+                    for (uint64_t l = 0; g + l < pol2N; l++)
+                    {
+                        pol[(g + l) * FRI_FOLD_FIELD_EXTENSION + c] = aux[l];
+                    }
+                }
+            }
+
+            for (uint64_t l = 0; l < FRI_FOLD_LANES; l++)
+            {
+                sinv[l] = sinv[l] * wiLanes;
+            }
+        }
+
+        delete[] twiddlesAvx;
+        delete[] coefs;
+    }
+}
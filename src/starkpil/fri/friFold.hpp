@@ -0,0 +1,19 @@
+#ifndef FRI_FOLD_HPP
+#define FRI_FOLD_HPP
+
+#include "goldilocks_base_field.hpp"
+
+// Number of FRI groups folded together, one per AVX2 lane
+#define FRI_FOLD_LANES 4
+
+class FRIFold
+{
+public:
+    // Folds, in place, the 2^polBits cubic extension evaluations of pol into 2^(polBits-reductionBits)
+    // evaluations at specialX, which are written at the beginning of pol.  Group g, made of the
+    // elements g + i*2^(polBits-reductionBits), is interpolated on the coset shiftInv*wi^g, where wi is
+    // the inverse of the 2^polBits root of unity, and evaluated at specialX
+    static void fold(Goldilocks::Element *pol, uint64_t polBits, uint64_t reductionBits, const Goldilocks::Element &shiftInv, const Goldilocks::Element *specialX);
+};
+
+#endif
@@ -0,0 +1,308 @@
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "friProof.hpp"
+#include "exit_process.hpp"
+#include "zkassert.hpp"
+
+#define FRI_PROOF_BINARY_MAGIC "friproof" // 8 bytes, so that everything after it is 64-bit aligned
+#define FRI_PROOF_BINARY_VERSION 1
+
+Fri::~Fri()
+{
+    if (isQueriesArenaAllocated)
+    {
+        free(queriesArena);
+    }
+    if (pMapping != NULL)
+    {
+        munmap(pMapping, mappingSize);
+    }
+}
+
+Goldilocks::Element *Fri::allocQueriesArena(uint64_t size)
+{
+    zkassert(!isQueriesArenaAllocated && (pMapping == NULL));
+    queriesArena = (Goldilocks::Element *)calloc(size, sizeof(Goldilocks::Element));
+    if (queriesArena == NULL)
+    {
+        std::cerr << "Error: Fri::allocQueriesArena() failed calling calloc() of size=" << size * sizeof(Goldilocks::Element) << std::endl;
+        exitProcess();
+    }
+    queriesArenaSize = size;
+    isQueriesArenaAllocated = true;
+    return queriesArena;
+}
+
+void Fri::setMappedQueriesArena(void *_pMapping, uint64_t _mappingSize, Goldilocks::Element *_queriesArena, uint64_t size)
+{
+    zkassert(!isQueriesArenaAllocated && (pMapping == NULL));
+    pMapping = _pMapping;
+    mappingSize = _mappingSize;
+    queriesArena = _queriesArena;
+    queriesArenaSize = size;
+}
+
+static inline void appendU64(std::string &data, uint64_t value)
+{
+    data.append((const char *)&value, sizeof(uint64_t));
+}
+
+static inline void appendElements(std::string &data, const Goldilocks::Element *pElements, uint64_t size)
+{
+    data.append((const char *)pElements, size * sizeof(Goldilocks::Element));
+}
+
+void FRIProof::serialize(std::string &data) const
+{
+    const Fri &fri = proofs.fri;
+    uint64_t dim = (proofs.evals.size() > 0) ? proofs.evals[0].size() : ((fri.pol.size() > 0) ? fri.pol[0].size() : 0);
+
+    // Header
+    uint64_t nProofs = 0;
+    for (uint64_t si = 0; si < fri.trees.size(); si++)
+    {
+        nProofs += fri.trees[si].polQueries.proofs.size();
+    }
+    data.clear();
+    data.reserve(64 + (fri.trees.size() * 2 + nProofs * 3) * sizeof(uint64_t) + (4 * HASH_SIZE + fri.trees.size() * HASH_SIZE + (proofs.evals.size() + fri.pol.size()) * dim + publics.size() + fri.queriesArenaSize) * sizeof(Goldilocks::Element));
+    data.append(FRI_PROOF_BINARY_MAGIC, 8);
+    appendU64(data, FRI_PROOF_BINARY_VERSION);
+    appendU64(data, fri.pol.size());
+    appendU64(data, dim);
+    appendU64(data, fri.trees.size());
+    appendU64(data, proofs.evals.size());
+    appendU64(data, publics.size());
+    appendU64(data, fri.queriesArenaSize);
+    for (uint64_t si = 0; si < fri.trees.size(); si++)
+    {
+        const ProofQueries &polQueries = fri.trees[si].polQueries;
+        appendU64(data, polQueries.size());
+        appendU64(data, polQueries.nTrees);
+        for (uint64_t i = 0; i < polQueries.proofs.size(); i++)
+        {
+            const MerkleProof &mkProof = polQueries.proofs[i];
+            uint64_t offset = 0;
+            if (mkProof.v.pointer != NULL)
+            {
+                zkassert((mkProof.v.pointer >= fri.queriesArena) && (mkProof.v.pointer + mkProof.v.size() + mkProof.mp.size() * HASH_SIZE <= fri.queriesArena + fri.queriesArenaSize));
+                offset = mkProof.v.pointer - fri.queriesArena;
+            }
+            appendU64(data, offset);
+            appendU64(data, mkProof.v.size());
+            appendU64(data, mkProof.mp.size());
+        }
+    }
+
+    // Body, in the in-memory representation of the field elements
+    appendElements(data, &proofs.root1[0], HASH_SIZE);
+    appendElements(data, &proofs.root2[0], HASH_SIZE);
+    appendElements(data, &proofs.root3[0], HASH_SIZE);
+    appendElements(data, &proofs.root4[0], HASH_SIZE);
+    for (uint64_t si = 0; si < fri.trees.size(); si++)
+    {
+        appendElements(data, &fri.trees[si].root[0], HASH_SIZE);
+    }
+    for (uint64_t i = 0; i < proofs.evals.size(); i++)
+    {
+        appendElements(data, &proofs.evals[i][0], dim);
+    }
+    for (uint64_t i = 0; i < fri.pol.size(); i++)
+    {
+        appendElements(data, &fri.pol[i][0], dim);
+    }
+    appendElements(data, publics.data(), publics.size());
+    appendElements(data, fri.queriesArena, fri.queriesArenaSize);
+}
+
+bool FRIProof::isBinary(const std::string &data)
+{
+    return (data.size() >= 8) && (data.compare(0, 8, FRI_PROOF_BINARY_MAGIC) == 0);
+}
+
+bool FRIProof::isBinaryFile(const std::string &fileName)
+{
+    std::ifstream inputStream(fileName, std::ios::binary);
+    char magic[8];
+    if (!inputStream.good() || !inputStream.read(magic, 8))
+    {
+        return false;
+    }
+    return std::memcmp(magic, FRI_PROOF_BINARY_MAGIC, 8) == 0;
+}
+
+void proof2file(const FRIProof &fproof, const std::string &fileName)
+{
+    std::string data;
+    fproof.serialize(data);
+    std::ofstream outputStream(fileName, std::ios::binary);
+    if (!outputStream.good())
+    {
+        std::cerr << "Error: proof2file() failed creating output proof file " << fileName << std::endl;
+        exitProcess();
+    }
+    outputStream.write(data.data(), data.size());
+    outputStream.close();
+}
+
+// Sequential reader of the 64-bit words of a mapped proof file
+class ProofFileReader
+{
+public:
+    const uint8_t *pData;
+    uint64_t size;
+    uint64_t pos;
+
+    ProofFileReader(const uint8_t *_pData, uint64_t _size, uint64_t _pos) : pData(_pData), size(_size), pos(_pos){};
+
+    bool readU64(uint64_t &value)
+    {
+        if (pos + sizeof(uint64_t) > size)
+        {
+            return false;
+        }
+        std::memcpy(&value, pData + pos, sizeof(uint64_t));
+        pos += sizeof(uint64_t);
+        return true;
+    }
+
+    bool readElements(Goldilocks::Element *pElements, uint64_t n)
+    {
+        if ((n > size) || (pos + n * sizeof(Goldilocks::Element) > size))
+        {
+            return false;
+        }
+        std::memcpy(pElements, pData + pos, n * sizeof(Goldilocks::Element));
+        pos += n * sizeof(Goldilocks::Element);
+        return true;
+    }
+};
+
+FRIProof *file2proof(const std::string &fileName)
+{
+    int fd = open(fileName.c_str(), O_RDONLY);
+    if (fd == -1)
+    {
+        std::cerr << "Error: file2proof() failed opening proof file " << fileName << std::endl;
+        return NULL;
+    }
+    struct stat sb;
+    if ((fstat(fd, &sb) == -1) || (sb.st_size < 8))
+    {
+        std::cerr << "Error: file2proof() found an invalid proof file " << fileName << std::endl;
+        close(fd);
+        return NULL;
+    }
+    uint64_t size = sb.st_size;
+
+    // Private writable mapping: the merkle proofs get non-const pointers, but the file is never modified
+    void *pMapping = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (pMapping == MAP_FAILED)
+    {
+        std::cerr << "Error: file2proof() failed calling mmap() of size=" << size << " for proof file " << fileName << std::endl;
+        return NULL;
+    }
+    const uint8_t *pData = (const uint8_t *)pMapping;
+    if (std::memcmp(pData, FRI_PROOF_BINARY_MAGIC, 8) != 0)
+    {
+        std::cerr << "Error: file2proof() found a proof file that is not in binary format " << fileName << std::endl;
+        munmap(pMapping, size);
+        return NULL;
+    }
+
+    ProofFileReader reader(pData, size, 8);
+    uint64_t version, polN, dim, numSteps, evalSize, nPublics, arenaSize;
+    if (!reader.readU64(version) || (version != FRI_PROOF_BINARY_VERSION) ||
+        !reader.readU64(polN) || !reader.readU64(dim) || !reader.readU64(numSteps) ||
+        !reader.readU64(evalSize) || !reader.readU64(nPublics) || !reader.readU64(arenaSize) ||
+        (arenaSize > size / sizeof(Goldilocks::Element)) || (dim > size) || (numSteps > size) ||
+        (polN > size / sizeof(Goldilocks::Element) / std::max<uint64_t>(dim, 1)) ||
+        (evalSize > size / sizeof(Goldilocks::Element) / std::max<uint64_t>(dim, 1)) || (nPublics > size))
+    {
+        std::cerr << "Error: file2proof() found an invalid header in proof file " << fileName << std::endl;
+        munmap(pMapping, size);
+        return NULL;
+    }
+
+    FRIProof *pProof = new FRIProof(polN, dim, numSteps, evalSize, nPublics);
+    Proofs &proofs = pProof->proofs;
+    Fri &fri = proofs.fri;
+
+    // Shapes and offsets of the queries, resolved once the position of the arena is known
+    std::vector<uint64_t> shapes;
+    bool bValid = true;
+    for (uint64_t si = 0; bValid && (si < numSteps); si++)
+    {
+        uint64_t nQueries, nTrees;
+        if (!reader.readU64(nQueries) || !reader.readU64(nTrees) || (nTrees > size) ||
+            (nQueries > size / (3 * sizeof(uint64_t)) / std::max<uint64_t>(nTrees, 1)))
+        {
+            bValid = false;
+            break;
+        }
+        fri.trees[si].polQueries.resize(nQueries, nTrees);
+        for (uint64_t i = 0; bValid && (i < nQueries * nTrees * 3); i++)
+        {
+            uint64_t value;
+            bValid = reader.readU64(value);
+            shapes.push_back(value);
+        }
+    }
+
+    bValid = bValid &&
+             reader.readElements(&proofs.root1[0], HASH_SIZE) &&
+             reader.readElements(&proofs.root2[0], HASH_SIZE) &&
+             reader.readElements(&proofs.root3[0], HASH_SIZE) &&
+             reader.readElements(&proofs.root4[0], HASH_SIZE);
+    for (uint64_t si = 0; bValid && (si < numSteps); si++)
+    {
+        bValid = reader.readElements(&fri.trees[si].root[0], HASH_SIZE);
+    }
+    for (uint64_t i = 0; bValid && (i < evalSize); i++)
+    {
+        bValid = reader.readElements(&proofs.evals[i][0], dim);
+    }
+    for (uint64_t i = 0; bValid && (i < polN); i++)
+    {
+        bValid = reader.readElements(&fri.pol[i][0], dim);
+    }
+    bValid = bValid && reader.readElements(pProof->publics.data(), nPublics);
+    bValid = bValid && (reader.pos + arenaSize * sizeof(Goldilocks::Element) == size);
+    if (!bValid)
+    {
+        std::cerr << "Error: file2proof() found an invalid or truncated proof file " << fileName << std::endl;
+        delete pProof;
+        munmap(pMapping, size);
+        return NULL;
+    }
+
+    // The queries arena is used in place
+    Goldilocks::Element *pArena = (Goldilocks::Element *)((uint8_t *)pMapping + reader.pos);
+    fri.setMappedQueriesArena(pMapping, size, pArena, arenaSize);
+    uint64_t s = 0;
+    for (uint64_t si = 0; si < numSteps; si++)
+    {
+        std::vector<MerkleProof> &mkProofs = fri.trees[si].polQueries.proofs;
+        for (uint64_t i = 0; i < mkProofs.size(); i++, s += 3)
+        {
+            uint64_t offset = shapes[s];
+            uint64_t nLinears = shapes[s + 1];
+            uint64_t nSiblings = shapes[s + 2];
+            if ((offset > arenaSize) || (nLinears > arenaSize) || (nSiblings > arenaSize) || (offset + nLinears + nSiblings * HASH_SIZE > arenaSize))
+            {
+                std::cerr << "Error: file2proof() found a query out of the arena in proof file " << fileName << std::endl;
+                delete pProof; // Also unmaps the file
+                return NULL;
+            }
+            mkProofs[i] = MerkleProof(nLinears, nSiblings, &pArena[offset]);
+        }
+    }
+
+    return pProof;
+}
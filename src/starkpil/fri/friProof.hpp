@@ -5,26 +5,50 @@
 #include "poseidon_goldilocks.hpp"
 
 #include <vector>
+#include <string>
+#include <nlohmann/json.hpp>
 
 using ordered_json = nlohmann::ordered_json;
 
+// Row of a flat proof array, with the interface of the std::vector it replaces
+template <typename T>
+class ProofRow
+{
+public:
+    T *pointer;
+    uint64_t n;
+
+    ProofRow(T *_pointer, uint64_t _n) : pointer(_pointer), n(_n){};
+    uint64_t size(void) const { return n; }
+    T &operator[](uint64_t i) const { return pointer[i]; }
+};
+
+// Rows of the same width stored one after the other in memory not owned by the array, typically the
+// query arena of the proof; it has the interface of the std::vector<std::vector<T>> it replaces
+template <typename T>
+class ProofArray
+{
+public:
+    T *pointer;
+    uint64_t n;
+    uint64_t width;
+
+    ProofArray() : pointer(NULL), n(0), width(0){};
+    ProofArray(T *_pointer, uint64_t _n, uint64_t _width) : pointer(_pointer), n(_n), width(_width){};
+    uint64_t size(void) const { return n; }
+    ProofRow<T> operator[](uint64_t i) const { return ProofRow<T>(&pointer[i * width], width); }
+};
+
 class MerkleProof
 {
 public:
-    std::vector<std::vector<Goldilocks::Element>> v;
-    std::vector<std::vector<Goldilocks::Element>> mp;
+    ProofArray<Goldilocks::Element> v;  // nLinears opened values, of one element each
+    ProofArray<Goldilocks::Element> mp; // elementsTree sibling hashes
+
+    MerkleProof(){};
+    // pointer must stay valid while the proof is used: the values are not copied
+    MerkleProof(uint64_t nLinears, uint64_t elementsTree, Goldilocks::Element *pointer) : v(pointer, nLinears, 1), mp(&pointer[nLinears], elementsTree, HASH_SIZE){};
 
-    MerkleProof(uint64_t nLinears, uint64_t elementsTree, Goldilocks::Element *pointer) : v(nLinears, std::vector<Goldilocks::Element>(1, Goldilocks::zero())), mp(elementsTree, std::vector<Goldilocks::Element>(HASH_SIZE, Goldilocks::zero()))
-    {
-        for (uint64_t i = 0; i < nLinears; i++)
-        {
-            std::memcpy(&v[i][0], &pointer[i], sizeof(Goldilocks::Element));
-        }
-        for (uint64_t j = 0; j < elementsTree; j++)
-        {
-            std::memcpy(&mp[j][0], &pointer[nLinears + j * HASH_SIZE], HASH_SIZE * sizeof(Goldilocks::Element));
-        }
-    };
     ordered_json merkleProof2json()
     {
         ordered_json j = ordered_json::array();
@@ -62,11 +86,27 @@ public:
     }
 };
 
+// Merkle proofs of all the queries of a step, nTrees per query, stored in a single vector
+class ProofQueries
+{
+public:
+    std::vector<MerkleProof> proofs;
+    uint64_t nTrees = 0;
+
+    void resize(uint64_t nQueries, uint64_t _nTrees)
+    {
+        nTrees = _nTrees;
+        proofs.resize(nQueries * nTrees);
+    }
+    uint64_t size(void) const { return (nTrees == 0) ? 0 : proofs.size() / nTrees; }
+    ProofRow<MerkleProof> operator[](uint64_t i) { return ProofRow<MerkleProof>(&proofs[i * nTrees], nTrees); }
+};
+
 class ProofTree
 {
 public:
     std::vector<Goldilocks::Element> root;
-    std::vector<std::vector<MerkleProof>> polQueries;
+    ProofQueries polQueries;
 
     ProofTree() : root(HASH_SIZE){};
     void setRoot(Goldilocks::Element *_root)
@@ -116,8 +156,24 @@ public:
     std::vector<std::vector<Goldilocks::Element>> pol;
     std::vector<ProofTree> trees;
 
+    // Values and sibling hashes of all the queries of all the steps, referenced by the merkle proofs of the
+    // trees; either allocated by allocQueriesArena() or part of a proof file mapped by file2proof()
+    Goldilocks::Element *queriesArena = NULL;
+    uint64_t queriesArenaSize = 0; // In elements
+    bool isQueriesArenaAllocated = false;
+    void *pMapping = NULL;
+    uint64_t mappingSize = 0;
+
     Fri(uint64_t polN, uint64_t dim, uint64_t numSteps) : pol(polN, std::vector<Goldilocks::Element>(dim, Goldilocks::zero())),
                                                           trees(numSteps){};
+    ~Fri();
+
+    // The merkle proofs point into the arena, so a copy would share, and free, the same memory
+    Fri(const Fri &) = delete;
+    Fri &operator=(const Fri &) = delete;
+
+    Goldilocks::Element *allocQueriesArena(uint64_t size);
+    void setMappedQueriesArena(void *_pMapping, uint64_t _mappingSize, Goldilocks::Element *_queriesArena, uint64_t size);
 
     void setPol(Goldilocks::Element *pPol)
     {
@@ -232,6 +288,19 @@ public:
         uint64_t evalSize,
         uint64_t nPublics) : proofs(polN, dim, numTrees, evalSize),
                              publics(nPublics){};
+
+    // Compact binary serialization: a header with the proof dimensions and the shape of every query, followed by
+    // the roots, evals, final polynomial and publics, and the queries arena as is, so that it can be mapped back
+    void serialize(std::string &data) const;
+    static bool isBinary(const std::string &data);
+    static bool isBinaryFile(const std::string &fileName);
 };
 
+// Saves a proof into a file in binary format, with a single write
+void proof2file(const FRIProof &fproof, const std::string &fileName);
+
+// Maps a proof file saved by proof2file(); the merkle proofs point into the mapping instead of being copied.
+// Returns NULL if the file is not a valid binary proof
+FRIProof *file2proof(const std::string &fileName);
+
 #endif
\ No newline at end of file
@@ -1,5 +1,7 @@
 #include "friProve.hpp"
 #include "timer.hpp"
+#include "friFold.hpp"
+#include "exit_process.hpp"
 
 void FRIProve::prove(FRIProof &fproof, MerkleTreeGL **treesGL, Transcript transcript, Polinomial &friPol, uint64_t polBits, StarkInfo starkInfo)
 {
@@ -21,89 +23,15 @@ void FRIProve::prove(FRIProof &fproof, MerkleTreeGL **treesGL, Transcript transc
         uint64_t reductionBits = polBits - starkInfo.starkStruct.steps[si].nBits;
 
         pol2N = 1 << (polBits - reductionBits);
-        uint64_t nX = (1 << polBits) / pol2N;
-
-        Polinomial pol2_e(pol2N, FIELD_EXTENSION);
+        // Folding is done in place: the first pol2N elements of friPol become the folded polynomial
+        Polinomial pol2_e(friPol.address(), pol2N, FIELD_EXTENSION, FIELD_EXTENSION);
 
         Polinomial special_x(1, FIELD_EXTENSION);
         transcript.getField(special_x.address());
 
-        Polinomial sinv(1, 1);
-        Polinomial wi(1, 1);
-
-        *sinv[0] = *polShiftInv[0];
-        *wi[0] = Goldilocks::inv(Goldilocks::w(polBits));
-
-        uint64_t nn = ((1 << polBits) / nX);
-        u_int64_t maxth = omp_get_max_threads();
-        if (maxth > nn)
+        if (si > 0)
         {
-            maxth = nn;
-        }
-#pragma omp parallel num_threads(maxth)
-        {
-            u_int64_t nth = omp_get_num_threads();
-            u_int64_t thid = omp_get_thread_num();
-            u_int64_t chunk = nn / nth;
-            u_int64_t res = nn - nth * chunk;
-
-            // Evaluate bounds of the loop for the thread
-            uint64_t init = chunk * thid;
-            uint64_t end;
-            if (thid < res)
-            {
-                init += thid;
-                end = init + chunk + 1;
-            }
-            else
-            {
-                init += res;
-                end = init + chunk;
-            }
-            //  Evaluate the starting point for the sinv
-            Goldilocks::Element aux = *wi[0];
-            Goldilocks::Element sinv_ = *sinv[0];
-            for (uint64_t i = 0; i < chunk - 1; ++i)
-            {
-                aux = aux * (*wi[0]);
-            }
-            for (u_int64_t i = 0; i < thid; ++i)
-            {
-                sinv_ = sinv_ * aux;
-            }
-            u_int64_t ncor = res;
-            if (thid < res)
-            {
-                ncor = thid;
-            }
-            for (u_int64_t j = 0; j < ncor; ++j)
-            {
-                sinv_ = sinv_ * (*wi[0]);
-            }
-
-            for (uint64_t g = init; g < end; g++)
-            {
-                if (si == 0)
-                {
-                    Polinomial::copyElement(pol2_e, g, friPol, g);
-                }
-                else
-                {
-                    Polinomial ppar(nX, FIELD_EXTENSION);
-                    Polinomial ppar_c(nX, FIELD_EXTENSION);
-
-                    for (uint64_t i = 0; i < nX; i++)
-                    {
-                        Polinomial::copyElement(ppar, i, friPol, (i * pol2N) + g);
-                    }
-                    NTT_Goldilocks ntt(nX, 1);
-
-                    ntt.INTT(ppar_c.address(), ppar.address(), nX, FIELD_EXTENSION);
-                    polMulAxi(ppar_c, Goldilocks::one(), sinv_); // Multiplies coefs by 1, shiftInv, shiftInv^2, shiftInv^3, ......
-                    evalPol(pol2_e, g, ppar_c, special_x);
-                    sinv_ = sinv_ * (*wi[0]);
-                }
-            }
+            FRIFold::fold(friPol.address(), polBits, reductionBits, *polShiftInv[0], special_x.address());
         }
 
         if (si < starkInfo.starkStruct.steps.size() - 1)
@@ -132,12 +60,6 @@ void FRIProve::prove(FRIProof &fproof, MerkleTreeGL **treesGL, Transcript transc
             }
         }
 
-#pragma omp parallel for
-        for (uint64_t i = 0; i < pol2_e.degree(); i++)
-        {
-            Polinomial::copyElement(friPol, i, pol2_e, i);
-        }
-
         polBits = polBits - reductionBits;
 
         for (uint64_t j = 0; j < reductionBits; j++)
@@ -151,28 +73,45 @@ void FRIProve::prove(FRIProof &fproof, MerkleTreeGL **treesGL, Transcript transc
 
     //TimerStart(STARK_FRI_QUERIES);
 
-    uint64_t ys[starkInfo.starkStruct.nQueries];
-    transcript.getPermutations(ys, starkInfo.starkStruct.nQueries, starkInfo.starkStruct.steps[0].nBits);
+    uint64_t nQueries = starkInfo.starkStruct.nQueries;
+    uint64_t nSteps = starkInfo.starkStruct.steps.size();
 
-    for (uint64_t si = 0; si < starkInfo.starkStruct.steps.size(); si++)
+    // Query indexes of every step, so that all the queries of all the steps can be opened in parallel
+    std::vector<uint64_t> ys(nSteps * nQueries);
+    transcript.getPermutations(&ys[0], nQueries, starkInfo.starkStruct.steps[0].nBits);
+    for (uint64_t si = 1; si < nSteps; si++)
     {
-        for (uint64_t i = 0; i < starkInfo.starkStruct.nQueries; i++)
+        for (uint64_t i = 0; i < nQueries; i++)
         {
-            if (si == 0)
-            {
-                queryPol(fproof, treesGL, ys[i], si);
-            }
-            else
-            {
-                queryPol(fproof, treesFRIGL[si], ys[i], si);
-            }
+            ys[si * nQueries + i] = ys[(si - 1) * nQueries + i] % (1 << starkInfo.starkStruct.steps[si].nBits);
         }
-        if (si < starkInfo.starkStruct.steps.size() - 1)
+    }
+
+    // Every query writes its rows and merkle paths into its own slice of the proof queries arena, where they stay
+    std::vector<uint64_t> querySize(nSteps);
+    std::vector<uint64_t> stepOffset(nSteps + 1, 0);
+    for (uint64_t si = 0; si < nSteps; si++)
+    {
+        uint64_t nTrees = (si == 0) ? FRI_FIRST_STEP_NUM_TREES : 1;
+        querySize[si] = (si == 0) ? getQueryProofSize(treesGL, nTrees) : getQueryProofSize(&treesFRIGL[si], nTrees);
+        stepOffset[si + 1] = stepOffset[si] + nQueries * querySize[si];
+        fproof.proofs.fri.trees[si].polQueries.resize(nQueries, nTrees);
+    }
+    Goldilocks::Element *buff = fproof.proofs.fri.allocQueriesArena(stepOffset[nSteps]);
+
+#pragma omp parallel for schedule(dynamic)
+    for (uint64_t q = 0; q < nSteps * nQueries; q++)
+    {
+        uint64_t si = q / nQueries;
+        uint64_t i = q % nQueries;
+        Goldilocks::Element *pBuff = &buff[stepOffset[si] + i * querySize[si]];
+        if (si == 0)
         {
-            for (uint64_t i = 0; i < starkInfo.starkStruct.nQueries; i++)
-            {
-                ys[i] = ys[i] % (1 << starkInfo.starkStruct.steps[si + 1].nBits);
-            }
+            queryPol(fproof, treesGL, FRI_FIRST_STEP_NUM_TREES, ys[q], si, i, pBuff);
+        }
+        else
+        {
+            queryPol(fproof, &treesFRIGL[si], 1, ys[q], si, i, pBuff);
         }
     }
 
@@ -188,64 +127,25 @@ void FRIProve::prove(FRIProof &fproof, MerkleTreeGL **treesGL, Transcript transc
     return;
 }
 
-void FRIProve::polMulAxi(Polinomial &pol, Goldilocks::Element init, Goldilocks::Element acc)
+uint64_t FRIProve::getQueryProofSize(MerkleTreeGL **trees, uint64_t nTrees)
 {
-    Goldilocks::Element r = init;
-    for (uint64_t i = 0; i < pol.degree(); i++)
+    uint64_t size = 0;
+    for (uint64_t i = 0; i < nTrees; i++)
     {
-        Polinomial::mulElement(pol, i, pol, i, r);
-        r = r * acc;
-    }
-}
-void FRIProve::evalPol(Polinomial &res, uint64_t res_idx, Polinomial &p, Polinomial &x)
-{
-    if (p.degree() == 0)
-    {
-        res[res_idx][0] = Goldilocks::zero();
-        res[res_idx][1] = Goldilocks::zero();
-        res[res_idx][2] = Goldilocks::zero();
-        return;
-    }
-    Polinomial::copyElement(res, res_idx, p, p.degree() - 1);
-    for (int64_t i = p.degree() - 2; i >= 0; i--)
-    {
-        Polinomial aux(1, 3);
-        Polinomial::mulElement(aux, 0, res, res_idx, x, 0);
-        Polinomial::addElement(res, res_idx, aux, 0, p, i);
+        size += trees[i]->width + trees[i]->MerkleProofSize() * HASH_SIZE;
     }
+    return size;
 }
 
-void FRIProve::queryPol(FRIProof &fproof, MerkleTreeGL *treesGL[5], uint64_t idx, uint64_t treeIdx)
+void FRIProve::queryPol(FRIProof &fproof, MerkleTreeGL **trees, uint64_t nTrees, uint64_t idx, uint64_t treeIdx, uint64_t queryIdx, Goldilocks::Element *buff)
 {
-    vector<MerkleProof> vMkProof;
-    for (uint i = 0; i < 5; i++)
+    ProofRow<MerkleProof> vMkProof = fproof.proofs.fri.trees[treeIdx].polQueries[queryIdx];
+    for (uint64_t i = 0; i < nTrees; i++)
     {
-        MerkleTreeGL *treesGLTmp = treesGL[i];
-        Goldilocks::Element buff[treesGLTmp->width + treesGLTmp->MerkleProofSize() * HASH_SIZE] = {Goldilocks::zero()};
-
-        treesGLTmp->getGroupProof(&buff[0], idx);
-
-        MerkleProof mkProof(treesGLTmp->width, treesGLTmp->MerkleProofSize(), &buff[0]);
-        vMkProof.push_back(mkProof);
+        trees[i]->getGroupProof(buff, idx);
+        vMkProof[i] = MerkleProof(trees[i]->width, trees[i]->MerkleProofSize(), buff);
+        buff += trees[i]->width + trees[i]->MerkleProofSize() * HASH_SIZE;
     }
-    fproof.proofs.fri.trees[treeIdx].polQueries.push_back(vMkProof);
-
-    return;
-}
-
-void FRIProve::queryPol(FRIProof &fproof, MerkleTreeGL *treeGL, uint64_t idx, uint64_t treeIdx)
-{
-    vector<MerkleProof> vMkProof;
-
-    Goldilocks::Element buff[treeGL->width * treeGL->width + treeGL->MerkleProofSize() * HASH_SIZE] = {Goldilocks::zero()};
-    treeGL->getGroupProof(&buff[0], idx);
-
-    MerkleProof mkProof(treeGL->width, treeGL->MerkleProofSize(), &buff[0]);
-    vMkProof.push_back(mkProof);
-
-    fproof.proofs.fri.trees[treeIdx].polQueries.push_back(vMkProof);
-
-    return;
 }
 
 void FRIProve::getTransposed(Polinomial &aux, Polinomial &pol, uint64_t trasposeBits)
@@ -10,14 +10,15 @@
 #include "merklehash_goldilocks.hpp"
 #include "merkleTreeGL.hpp"
 
+// Trees opened by the queries of the first step: cm1, cm2, cm3, cm4 and the constants tree
+#define FRI_FIRST_STEP_NUM_TREES 5
+
 class FRIProve
 {
 public:
     static void prove(FRIProof &fproof, MerkleTreeGL **treesGL, Transcript transcript, Polinomial &friPol, uint64_t polBits, StarkInfo starkInfo);
-    static void polMulAxi(Polinomial &pol, Goldilocks::Element init, Goldilocks::Element acc);
-    static void evalPol(Polinomial &res, uint64_t res_idx, Polinomial &p, Polinomial &x);
-    static void queryPol(FRIProof &fproof, MerkleTreeGL **treeGL, uint64_t idx, uint64_t treeIdx);
-    static void queryPol(FRIProof &fproof, MerkleTreeGL *treeGL, uint64_t idx, uint64_t treeIdx);
+    static uint64_t getQueryProofSize(MerkleTreeGL **trees, uint64_t nTrees);
+    static void queryPol(FRIProof &fproof, MerkleTreeGL **trees, uint64_t nTrees, uint64_t idx, uint64_t treeIdx, uint64_t queryIdx, Goldilocks::Element *buff);
     static void getTransposed(Polinomial &aux, Polinomial &pol, uint64_t trasposeBits);
 };
 
@@ -1,5 +1,7 @@
 #include "friProveC12.hpp"
 #include "timer.hpp"
+#include "friFold.hpp"
+#include "exit_process.hpp"
 
 void FRIProveC12::prove(FRIProofC12 &fproof, MerkleTreeBN128 **trees, TranscriptBN128 transcript, Polinomial &friPol, uint64_t polBits, StarkInfo starkInfo)
 {
@@ -27,90 +29,15 @@ void FRIProveC12::prove(FRIProofC12 &fproof, MerkleTreeBN128 **trees, Transcript
         uint64_t reductionBits = polBits - starkInfo.starkStruct.steps[si].nBits;
 
         pol2N = 1 << (polBits - reductionBits);
-        uint64_t nX = (1 << polBits) / pol2N;
-
-        Polinomial pol2_e(pol2N, FIELD_EXTENSION);
+        // Folding is done in place: the first pol2N elements of friPol become the folded polynomial
+        Polinomial pol2_e(friPol.address(), pol2N, FIELD_EXTENSION, FIELD_EXTENSION);
 
         Polinomial special_x(1, FIELD_EXTENSION);
         transcript.getField((uint64_t *)special_x.address());
 
-        Polinomial sinv(1, 1);
-        Polinomial wi(1, 1);
-
-        *sinv[0] = *polShiftInv[0];
-        *wi[0] = Goldilocks::inv(Goldilocks::w(polBits));
-
-        uint64_t nn = ((1 << polBits) / nX);
-        u_int64_t maxth = omp_get_max_threads();
-        if (maxth > nn)
-        {
-            maxth = nn;
-        }
-#pragma omp parallel num_threads(maxth)
+        if (si > 0)
         {
-            u_int64_t nth = omp_get_num_threads();
-            u_int64_t thid = omp_get_thread_num();
-            u_int64_t chunk = nn / nth;
-            u_int64_t res = nn - nth * chunk;
-
-            // Evaluate bounds of the loop for the thread
-            uint64_t init = chunk * thid;
-            uint64_t end;
-            if (thid < res)
-            {
-                init += thid;
-                end = init + chunk + 1;
-            }
-            else
-            {
-                init += res;
-                end = init + chunk;
-            }
-            //  Evaluate the starting point for the sinv
-            Goldilocks::Element aux = *wi[0];
-            Goldilocks::Element sinv_ = *sinv[0];
-            for (uint64_t i = 0; i < chunk - 1; ++i)
-            {
-                aux = aux * (*wi[0]);
-            }
-            for (u_int64_t i = 0; i < thid; ++i)
-            {
-                sinv_ = sinv_ * aux;
-            }
-            u_int64_t ncor = res;
-            if (thid < res)
-            {
-                ncor = thid;
-            }
-            for (u_int64_t j = 0; j < ncor; ++j)
-            {
-                sinv_ = sinv_ * (*wi[0]);
-            }
-
-            for (uint64_t g = init; g < end; g++)
-            {
-                if (si == 0)
-                {
-                    Polinomial::copyElement(pol2_e, g, friPol, g);
-                }
-                else
-                {
-                    Polinomial ppar(nX, FIELD_EXTENSION);
-                    Polinomial ppar_c(nX, FIELD_EXTENSION);
-
-                    for (uint64_t i = 0; i < nX; i++)
-                    {
-                        Polinomial::copyElement(ppar, i, friPol, (i * pol2N) + g);
-                    }
-                    NTT_Goldilocks ntt(nX, 1);
-
-                    ntt.INTT(ppar_c.address(), ppar.address(), nX, FIELD_EXTENSION);
-                    polMulAxi(ppar_c, Goldilocks::one(), sinv_); // Multiplies coefs by 1, shiftInv, shiftInv^2, shiftInv^3, ......
-
-                    evalPol(pol2_e, g, ppar_c, special_x);
-                    sinv_ = sinv_ * (*wi[0]);
-                }
-            }
+            FRIFold::fold(friPol.address(), polBits, reductionBits, *polShiftInv[0], special_x.address());
         }
 
         if (si < starkInfo.starkStruct.steps.size() - 1)
@@ -136,12 +63,6 @@ void FRIProveC12::prove(FRIProofC12 &fproof, MerkleTreeBN128 **trees, Transcript
             }
         }
 
-#pragma omp parallel for
-        for (uint64_t i = 0; i < pol2_e.degree(); i++)
-        {
-            Polinomial::copyElement(friPol, i, pol2_e, i);
-        }
-
         polBits = polBits - reductionBits;
 
         for (uint64_t j = 0; j < reductionBits; j++)
@@ -155,30 +76,53 @@ void FRIProveC12::prove(FRIProofC12 &fproof, MerkleTreeBN128 **trees, Transcript
 
     TimerStart(STARK_FRI_QUERIES);
 
-    uint64_t ys[starkInfo.starkStruct.nQueries];
-    transcript.getPermutations(ys, starkInfo.starkStruct.nQueries, starkInfo.starkStruct.steps[0].nBits);
+    uint64_t nQueries = starkInfo.starkStruct.nQueries;
+    uint64_t nSteps = starkInfo.starkStruct.steps.size();
 
-    for (uint64_t si = 0; si < starkInfo.starkStruct.steps.size(); si++)
+    // Query indexes of every step, so that all the queries of all the steps can be opened in parallel
+    std::vector<uint64_t> ys(nSteps * nQueries);
+    transcript.getPermutations(&ys[0], nQueries, starkInfo.starkStruct.steps[0].nBits);
+    for (uint64_t si = 1; si < nSteps; si++)
     {
-        for (uint64_t i = 0; i < starkInfo.starkStruct.nQueries; i++)
+        for (uint64_t i = 0; i < nQueries; i++)
         {
-            if (si == 0)
-            {
-                queryPol(fproof, trees, ys[i], si);
-            }
-            else
-            {
-                queryPol(fproof, treesFRI[si], ys[i], si);
-            }
+            ys[si * nQueries + i] = ys[(si - 1) * nQueries + i] % (1 << starkInfo.starkStruct.steps[si].nBits);
         }
-        if (si < starkInfo.starkStruct.steps.size() - 1)
+    }
+
+    // Every query writes its rows and merkle paths into its own slice of a single buffer
+    std::vector<uint64_t> querySize(nSteps);
+    std::vector<uint64_t> stepOffset(nSteps + 1, 0);
+    for (uint64_t si = 0; si < nSteps; si++)
+    {
+        querySize[si] = (si == 0) ? getQueryProofSize(trees, FRI_FIRST_STEP_NUM_TREES) : getQueryProofSize(&treesFRI[si], 1);
+        stepOffset[si + 1] = stepOffset[si] + nQueries * querySize[si];
+        fproof.proofs.fri.trees[si].polQueries.resize(nQueries);
+    }
+    uint8_t *buff = (uint8_t *)calloc(stepOffset[nSteps], 1);
+    if (buff == NULL)
+    {
+        std::cerr << "Error: FRIProveC12::prove() failed calling calloc() of size=" << stepOffset[nSteps] << std::endl;
+        exitProcess();
+    }
+
+#pragma omp parallel for schedule(dynamic)
+    for (uint64_t q = 0; q < nSteps * nQueries; q++)
+    {
+        uint64_t si = q / nQueries;
+        uint64_t i = q % nQueries;
+        uint8_t *pBuff = &buff[stepOffset[si] + i * querySize[si]];
+        if (si == 0)
         {
-            for (uint64_t i = 0; i < starkInfo.starkStruct.nQueries; i++)
-            {
-                ys[i] = ys[i] % (1 << starkInfo.starkStruct.steps[si + 1].nBits);
-            }
+            queryPol(fproof, trees, FRI_FIRST_STEP_NUM_TREES, ys[q], si, i, pBuff);
+        }
+        else
+        {
+            queryPol(fproof, &treesFRI[si], 1, ys[q], si, i, pBuff);
         }
     }
+    free(buff);
+
     while (!treesFRI.empty())
     {
         MerkleTreeBN128 *mt = treesFRI.back();
@@ -211,59 +155,24 @@ void FRIProveC12::getTransposed(Polinomial &aux, Polinomial &pol, uint64_t trasp
     }
 }
 
-void FRIProveC12::polMulAxi(Polinomial &pol, Goldilocks::Element init, Goldilocks::Element acc)
-{
-    Goldilocks::Element r = init;
-    for (uint64_t i = 0; i < pol.degree(); i++)
-    {
-        Polinomial::mulElement(pol, i, pol, i, r);
-        r = r * acc;
-    }
-}
-void FRIProveC12::evalPol(Polinomial &res, uint64_t res_idx, Polinomial &p, Polinomial &x)
+uint64_t FRIProveC12::getQueryProofSize(MerkleTreeBN128 **trees, uint64_t nTrees)
 {
-    if (p.degree() == 0)
-    {
-        res[res_idx][0] = Goldilocks::zero();
-        res[res_idx][1] = Goldilocks::zero();
-        res[res_idx][2] = Goldilocks::zero();
-        return;
-    }
-    Polinomial::copyElement(res, res_idx, p, p.degree() - 1);
-    for (int64_t i = p.degree() - 2; i >= 0; i--)
+    uint64_t size = 0;
+    for (uint64_t i = 0; i < nTrees; i++)
     {
-        Polinomial aux(1, 3);
-        Polinomial::mulElement(aux, 0, res, res_idx, x, 0);
-        Polinomial::addElement(res, res_idx, aux, 0, p, i);
+        size += trees[i]->source_width * sizeof(Goldilocks::Element) + MerkleTreeBN128::getMerkleProofSize(trees[i]->height);
     }
+    return size;
 }
 
-void FRIProveC12::queryPol(FRIProofC12 &fproof, MerkleTreeBN128 **trees, uint64_t idx, uint64_t treeIdx)
+void FRIProveC12::queryPol(FRIProofC12 &fproof, MerkleTreeBN128 **trees, uint64_t nTrees, uint64_t idx, uint64_t treeIdx, uint64_t queryIdx, uint8_t *buff)
 {
-    vector<MerkleProofC12> vMkProof;
-    for (uint i = 0; i < 5; i++)
+    vector<MerkleProofC12> &vMkProof = fproof.proofs.fri.trees[treeIdx].polQueries[queryIdx];
+    vMkProof.reserve(nTrees);
+    for (uint64_t i = 0; i < nTrees; i++)
     {
-        RawFr::Element *buff = (RawFr::Element *)calloc(trees[i]->source_width * sizeof(Goldilocks::Element) + MerkleTreeBN128::getMerkleProofSize(trees[i]->height), 1);
-        trees[i]->getGroupProof(&buff[0], idx);
-        MerkleProofC12 mkProof(trees[i]->source_width, MerkleTreeBN128::getMerkleProofLength(trees[i]->height), &buff[0]);
-        vMkProof.push_back(mkProof);
-        free(buff);
+        trees[i]->getGroupProof(buff, idx);
+        vMkProof.push_back(MerkleProofC12(trees[i]->source_width, MerkleTreeBN128::getMerkleProofLength(trees[i]->height), buff));
+        buff += trees[i]->source_width * sizeof(Goldilocks::Element) + MerkleTreeBN128::getMerkleProofSize(trees[i]->height);
     }
-    fproof.proofs.fri.trees[treeIdx].polQueries.push_back(vMkProof);
-
-    return;
-}
-
-void FRIProveC12::queryPol(FRIProofC12 &fproof, MerkleTreeBN128 *tree, uint64_t idx, uint64_t treeIdx)
-{
-
-    vector<MerkleProofC12> vMkProof;
-
-    RawFr::Element *buff = (RawFr::Element *)calloc(tree->source_width * sizeof(Goldilocks::Element) + MerkleTreeBN128::getMerkleProofSize(tree->height), 1);
-    tree->getGroupProof(&buff[0], idx);
-    MerkleProofC12 mkProof(tree->source_width, MerkleTreeBN128::getMerkleProofLength(tree->height), &buff[0]);
-    vMkProof.push_back(mkProof);
-    fproof.proofs.fri.trees[treeIdx].polQueries.push_back(vMkProof);
-    free(buff);
-    return;
 }
\ No newline at end of file
@@ -10,16 +10,17 @@
 #include "ntt_goldilocks.hpp"
 #include "merklehash_goldilocks.hpp"
 
+// Trees opened by the queries of the first step: cm1, cm2, cm3, cm4 and the constants tree
+#define FRI_FIRST_STEP_NUM_TREES 5
+
 class FRIProveC12
 {
 public:
     static void prove(FRIProofC12 &fproof, MerkleTreeBN128 **trees, TranscriptBN128 transcript, Polinomial &friPol, uint64_t polBits, StarkInfo starkInfo);
-    static void polMulAxi(Polinomial &pol, Goldilocks::Element init, Goldilocks::Element acc);
-    static void evalPol(Polinomial &res, uint64_t res_idx, Polinomial &p, Polinomial &x);
     static void getTransposed(Polinomial &aux, Polinomial &pol2_e, uint64_t trasposeBits);
 
-    static void queryPol(FRIProofC12 &fproof, MerkleTreeBN128 **trees, uint64_t idx, uint64_t treeIdx);
-    static void queryPol(FRIProofC12 &fproof, MerkleTreeBN128 *trees, uint64_t idx, uint64_t treeIdx);
+    static uint64_t getQueryProofSize(MerkleTreeBN128 **trees, uint64_t nTrees);
+    static void queryPol(FRIProofC12 &fproof, MerkleTreeBN128 **trees, uint64_t nTrees, uint64_t idx, uint64_t treeIdx, uint64_t queryIdx, uint8_t *buff);
 };
 
 #endif
\ No newline at end of file
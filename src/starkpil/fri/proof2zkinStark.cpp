@@ -2,7 +2,9 @@
 
 #include <string>
 #include <iostream>
+#include <cstring>
 #include "proof2zkinStark.hpp"
+#include "friProve.hpp"
 using namespace std;
 
 ordered_json proof2zkinStark(ordered_json &proof)
@@ -184,4 +186,162 @@ ordered_json joinzkin(ordered_json &zkin1, ordered_json &zkin2, ordered_json &ve
     }
 
     return zkinOut;
-}
\ No newline at end of file
+}
+
+static void addQueriesVals(Zkin &zkin, const std::string &name, std::vector<ProofTree> &trees, uint64_t step, uint64_t treeIndex)
+{
+    ProofQueries &polQueries = trees[step].polQueries;
+    uint64_t nQueries = trees[0].polQueries.size();
+    uint64_t nVals = polQueries[0][treeIndex].v.size();
+    Goldilocks::Element *pVals = zkin.add(name, {nQueries, nVals});
+    for (uint64_t q = 0; q < nQueries; q++)
+    {
+        std::memcpy(&pVals[q * nVals], polQueries[q][treeIndex].v.pointer, nVals * sizeof(Goldilocks::Element));
+    }
+}
+
+static void addQueriesSiblings(Zkin &zkin, const std::string &name, std::vector<ProofTree> &trees, uint64_t step, uint64_t treeIndex)
+{
+    ProofQueries &polQueries = trees[step].polQueries;
+    uint64_t nQueries = trees[0].polQueries.size();
+    uint64_t nSiblings = polQueries[0][treeIndex].mp.size();
+    Goldilocks::Element *pSiblings = zkin.add(name, {nQueries, nSiblings, HASH_SIZE});
+    for (uint64_t q = 0; q < nQueries; q++)
+    {
+        std::memcpy(&pSiblings[q * nSiblings * HASH_SIZE], polQueries[q][treeIndex].mp.pointer, nSiblings * HASH_SIZE * sizeof(Goldilocks::Element));
+    }
+}
+
+bool checkProofShape(FRIProof &fproof, uint64_t numSteps)
+{
+    std::vector<ProofTree> &trees = fproof.proofs.fri.trees;
+    if ((numSteps == 0) || (trees.size() != numSteps))
+    {
+        return false;
+    }
+    uint64_t nQueries = trees[0].polQueries.size();
+    if (nQueries == 0)
+    {
+        return false;
+    }
+    for (uint64_t si = 0; si < numSteps; si++)
+    {
+        ProofQueries &polQueries = trees[si].polQueries;
+        if ((polQueries.nTrees != ((si == 0) ? FRI_FIRST_STEP_NUM_TREES : 1)) || (polQueries.size() != nQueries))
+        {
+            return false;
+        }
+        for (uint64_t q = 1; q < nQueries; q++)
+        {
+            for (uint64_t t = 0; t < polQueries.nTrees; t++)
+            {
+                if ((polQueries[q][t].v.size() != polQueries[0][t].v.size()) || (polQueries[q][t].mp.size() != polQueries[0][t].mp.size()))
+                {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+void proof2zkinStark(FRIProof &fproof, Zkin &zkin)
+{
+    Proofs &proof = fproof.proofs;
+    std::vector<ProofTree> &trees = proof.fri.trees;
+    if (!checkProofShape(fproof, trees.size()))
+    {
+        throw std::runtime_error("proof2zkinStark() found a proof with an invalid shape");
+    }
+
+    zkin.clear();
+    zkin.add("root1", {HASH_SIZE}, &proof.root1[0]);
+    zkin.add("root2", {HASH_SIZE}, &proof.root2[0]);
+    zkin.add("root3", {HASH_SIZE}, &proof.root3[0]);
+    zkin.add("root4", {HASH_SIZE}, &proof.root4[0]);
+
+    uint64_t dim = (proof.evals.size() > 0) ? proof.evals[0].size() : 0;
+    Goldilocks::Element *pEvals = zkin.add("evals", {proof.evals.size(), dim});
+    for (uint64_t i = 0; i < proof.evals.size(); i++)
+    {
+        std::memcpy(&pEvals[i * dim], &proof.evals[i][0], dim * sizeof(Goldilocks::Element));
+    }
+
+    for (uint64_t i = 1; i < trees.size(); i++)
+    {
+        zkin.add("s" + std::to_string(i) + "_root", {HASH_SIZE}, &trees[i].root[0]);
+        addQueriesVals(zkin, "s" + std::to_string(i) + "_vals", trees, i, 0);
+        addQueriesSiblings(zkin, "s" + std::to_string(i) + "_siblings", trees, i, 0);
+    }
+
+    // Trees of step 0 are cm1, cm2, cm3, cm4 and constants; cm2 and cm3 can be empty
+    bool bCm2 = trees[0].polQueries[0][1].v.size() > 0;
+    bool bCm3 = trees[0].polQueries[0][2].v.size() > 0;
+
+    addQueriesVals(zkin, "s0_vals1", trees, 0, 0);
+    if (bCm2)
+        addQueriesVals(zkin, "s0_vals2", trees, 0, 1);
+    if (bCm3)
+        addQueriesVals(zkin, "s0_vals3", trees, 0, 2);
+    addQueriesVals(zkin, "s0_vals4", trees, 0, 3);
+    addQueriesVals(zkin, "s0_valsC", trees, 0, 4);
+    addQueriesSiblings(zkin, "s0_siblings1", trees, 0, 0);
+    if (bCm2)
+        addQueriesSiblings(zkin, "s0_siblings2", trees, 0, 1);
+    if (bCm3)
+        addQueriesSiblings(zkin, "s0_siblings3", trees, 0, 2);
+    addQueriesSiblings(zkin, "s0_siblings4", trees, 0, 3);
+    addQueriesSiblings(zkin, "s0_siblingsC", trees, 0, 4);
+
+    std::vector<std::vector<Goldilocks::Element>> &pol = proof.fri.pol;
+    uint64_t polDim = (pol.size() > 0) ? pol[0].size() : 0;
+    Goldilocks::Element *pFinalPol = zkin.add("finalPol", {pol.size(), polDim});
+    for (uint64_t i = 0; i < pol.size(); i++)
+    {
+        std::memcpy(&pFinalPol[i * polDim], &pol[i][0], polDim * sizeof(Goldilocks::Element));
+    }
+}
+
+void joinzkin(Zkin &zkin1, Zkin &zkin2, ordered_json &verKey, Zkin &zkinOut)
+{
+    const Goldilocks::Element *publics1 = zkin1.get("publics");
+    const Goldilocks::Element *publics2 = zkin2.get("publics");
+    if ((publics1 == NULL) || (publics2 == NULL))
+    {
+        throw std::runtime_error("joinzkin() found a zkin without publics");
+    }
+    if ((zkin1.find("publics")->size < ZKIN_AGGREGATED_NPUBLICS) || (zkin2.find("publics")->size < ZKIN_AGGREGATED_NPUBLICS))
+    {
+        throw std::runtime_error("joinzkin() found a zkin with less than " + std::to_string(ZKIN_AGGREGATED_NPUBLICS) + " publics");
+    }
+
+    zkinOut.clear();
+
+    // oldStateRoot, oldAccInputHash0, oldBatchNum, chainId and forkid from the first zkin;
+    // newStateRoot, newAccInputHash0, newLocalExitRoot and newBatchNum from the second one
+    Goldilocks::Element *publics = zkinOut.add("publics", {ZKIN_AGGREGATED_NPUBLICS});
+    std::memcpy(&publics[0], &publics1[0], 19 * sizeof(Goldilocks::Element));
+    std::memcpy(&publics[19], &publics2[19], 25 * sizeof(Goldilocks::Element));
+
+    const char *signals[] = {"publics", "root1", "root2", "root3", "root4", "evals",
+                             "s0_vals1", "s0_vals3", "s0_vals4", "s0_valsC",
+                             "s0_siblings1", "s0_siblings3", "s0_siblings4", "s0_siblingsC",
+                             "s1_root", "s2_root", "s3_root", "s4_root",
+                             "s1_siblings", "s2_siblings", "s3_siblings", "s4_siblings",
+                             "s1_vals", "s2_vals", "s3_vals", "s4_vals", "finalPol"};
+    uint64_t nSignals = sizeof(signals) / sizeof(signals[0]);
+    for (uint64_t i = 0; i < nSignals; i++)
+    {
+        zkinOut.copy(std::string("a_") + signals[i], zkin1, signals[i]);
+    }
+    for (uint64_t i = 0; i < nSignals; i++)
+    {
+        zkinOut.copy(std::string("b_") + signals[i], zkin2, signals[i]);
+    }
+
+    Goldilocks::Element *rootC = zkinOut.add("rootC", {4});
+    for (int i = 0; i < 4; i++)
+    {
+        rootC[i] = Goldilocks::fromU64(verKey["constRoot"][i]);
+    }
+}
@@ -3,10 +3,23 @@
 
 #include <nlohmann/json.hpp>
 #include "friProof.hpp"
+#include "zkin.hpp"
 
 using ordered_json = nlohmann::ordered_json;
 
+#define ZKIN_AGGREGATED_NPUBLICS 44 // Publics of a batch proof, the minimum joinzkin() reads from every zkin
+
 ordered_json proof2zkinStark(ordered_json &fproof);
 ordered_json joinzkin(ordered_json &zkin1, ordered_json &zkin2, ordered_json &verKey);
 
+// Returns false if the proof does not have numSteps steps, with the 5 trees of step 0 and 1 tree in
+// every other step, at least one query in every step, and the same shape of every tree in all queries
+bool checkProofShape(FRIProof &fproof, uint64_t numSteps);
+
+// Typed versions, building the zkin directly from the proof field elements; proof2zkinStark() throws
+// if the proof fails checkProofShape()
+void proof2zkinStark(FRIProof &fproof, Zkin &zkin);
+// Throws if a zkin has less than ZKIN_AGGREGATED_NPUBLICS publics
+void joinzkin(Zkin &zkin1, Zkin &zkin2, ordered_json &verKey, Zkin &zkinOut);
+
 #endif
\ No newline at end of file
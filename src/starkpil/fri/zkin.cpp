@@ -0,0 +1,316 @@
+#include <cstring>
+#include <cstdint>
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include "zkin.hpp"
+#include "exit_process.hpp"
+
+#define ZKIN_BINARY_MAGIC "zkin"
+#define ZKIN_BINARY_VERSION 1
+
+Goldilocks::Element *Zkin::add(const std::string &name, const std::vector<uint64_t> &shape)
+{
+    Signal signal;
+    signal.name = name;
+    signal.shape = shape;
+    signal.offset = values.size();
+    signal.size = 1;
+    for (uint64_t i = 0; i < shape.size(); i++)
+    {
+        signal.size *= shape[i];
+    }
+    signals.push_back(signal);
+    values.resize(signal.offset + signal.size, Goldilocks::zero());
+    return &values[signal.offset];
+}
+
+void Zkin::add(const std::string &name, const std::vector<uint64_t> &shape, const Goldilocks::Element *pValues)
+{
+    Goldilocks::Element *pDest = add(name, shape);
+    std::memcpy(pDest, pValues, signals.back().size * sizeof(Goldilocks::Element));
+}
+
+void Zkin::copy(const std::string &name, const Zkin &other, const std::string &otherName)
+{
+    const Signal *pSignal = other.find(otherName);
+    if (pSignal == NULL)
+    {
+        return;
+    }
+    add(name, pSignal->shape, &other.values[pSignal->offset]);
+}
+
+const Zkin::Signal *Zkin::find(const std::string &name) const
+{
+    for (uint64_t i = 0; i < signals.size(); i++)
+    {
+        if (signals[i].name == name)
+        {
+            return &signals[i];
+        }
+    }
+    return NULL;
+}
+
+const Goldilocks::Element *Zkin::get(const std::string &name) const
+{
+    const Signal *pSignal = find(name);
+    return (pSignal == NULL) ? NULL : &values[pSignal->offset];
+}
+
+void Zkin::clear(void)
+{
+    signals.clear();
+    values.clear();
+}
+
+static void values2json(ordered_json &j, const Goldilocks::Element *pValues, const std::vector<uint64_t> &shape, uint64_t dim)
+{
+    if (dim == shape.size())
+    {
+        j = Goldilocks::toString(*pValues);
+        return;
+    }
+    uint64_t stride = 1;
+    for (uint64_t i = dim + 1; i < shape.size(); i++)
+    {
+        stride *= shape[i];
+    }
+    j = ordered_json::array();
+    for (uint64_t i = 0; i < shape[dim]; i++)
+    {
+        ordered_json element;
+        values2json(element, &pValues[i * stride], shape, dim + 1);
+        j.push_back(element);
+    }
+}
+
+void Zkin::toJson(ordered_json &j) const
+{
+    j = ordered_json::object();
+    for (uint64_t i = 0; i < signals.size(); i++)
+    {
+        values2json(j[signals[i].name], &values[signals[i].offset], signals[i].shape, 0);
+    }
+}
+
+static void json2shape(const ordered_json &j, std::vector<uint64_t> &shape)
+{
+    const ordered_json *pJson = &j;
+    while (pJson->is_array())
+    {
+        shape.push_back(pJson->size());
+        if (pJson->size() == 0)
+        {
+            break;
+        }
+        pJson = &(*pJson)[0];
+    }
+}
+
+// Appends the leaves of j to values, checking that every nested array has the length of the shape
+// dimension it belongs to, so that ragged arrays are rejected instead of producing a zkin whose
+// shape and size disagree
+static void json2values(const ordered_json &j, const std::vector<uint64_t> &shape, uint64_t dim, std::vector<Goldilocks::Element> &values)
+{
+    if (dim < shape.size())
+    {
+        if (!j.is_array() || (j.size() != shape[dim]))
+        {
+            throw std::runtime_error("Zkin::fromJson() found an array that does not match the signal shape");
+        }
+        for (uint64_t i = 0; i < j.size(); i++)
+        {
+            json2values(j[i], shape, dim + 1, values);
+        }
+    }
+    else if (j.is_string())
+    {
+        values.push_back(Goldilocks::fromString(j.get<std::string>()));
+    }
+    else if (j.is_number_unsigned())
+    {
+        values.push_back(Goldilocks::fromU64(j.get<uint64_t>()));
+    }
+    else
+    {
+        throw std::runtime_error("Zkin::fromJson() found an invalid JSON type");
+    }
+}
+
+void Zkin::fromJson(const ordered_json &j)
+{
+    clear();
+    for (ordered_json::const_iterator it = j.begin(); it != j.end(); ++it)
+    {
+        Signal signal;
+        signal.name = it.key();
+        json2shape(it.value(), signal.shape);
+        signal.offset = values.size();
+        json2values(it.value(), signal.shape, 0, values);
+        signal.size = values.size() - signal.offset;
+        signals.push_back(signal);
+    }
+}
+
+static inline void appendU64(std::string &data, uint64_t value)
+{
+    data.append((const char *)&value, sizeof(uint64_t));
+}
+
+static inline bool readU64(const std::string &data, uint64_t &pos, uint64_t &value)
+{
+    if ((pos > data.size()) || (data.size() - pos < sizeof(uint64_t)))
+    {
+        return false;
+    }
+    std::memcpy(&value, data.data() + pos, sizeof(uint64_t));
+    pos += sizeof(uint64_t);
+    return true;
+}
+
+void Zkin::serialize(std::string &data) const
+{
+    data.clear();
+    data.reserve(64 + signals.size() * 64 + values.size() * sizeof(uint64_t));
+    data.append(ZKIN_BINARY_MAGIC, 4);
+    appendU64(data, ZKIN_BINARY_VERSION);
+    appendU64(data, signals.size());
+    for (uint64_t i = 0; i < signals.size(); i++)
+    {
+        appendU64(data, signals[i].name.size());
+        data.append(signals[i].name);
+        appendU64(data, signals[i].shape.size());
+        for (uint64_t d = 0; d < signals[i].shape.size(); d++)
+        {
+            appendU64(data, signals[i].shape[d]);
+        }
+        appendU64(data, signals[i].size);
+        for (uint64_t k = 0; k < signals[i].size; k++)
+        {
+            appendU64(data, Goldilocks::toU64(values[signals[i].offset + k]));
+        }
+    }
+}
+
+bool Zkin::isBinary(const std::string &data)
+{
+    return (data.size() >= 4) && (data.compare(0, 4, ZKIN_BINARY_MAGIC) == 0);
+}
+
+bool Zkin::deserialize(const std::string &data)
+{
+    clear();
+    if (!isBinary(data))
+    {
+        return false;
+    }
+    uint64_t pos = 4;
+    uint64_t version, nSignals;
+    if (!readU64(data, pos, version) || (version != ZKIN_BINARY_VERSION) || !readU64(data, pos, nSignals))
+    {
+        return false;
+    }
+    signals.reserve(std::min(nSignals, (uint64_t)(data.size() - pos) / (3 * sizeof(uint64_t))));
+    values.reserve((data.size() - pos) / sizeof(uint64_t));
+    // The data comes from the network, so every length is checked against the remaining bytes with
+    // divisions, which cannot overflow, and the size of every signal must match its shape
+    for (uint64_t i = 0; i < nSignals; i++)
+    {
+        Signal signal;
+        uint64_t nameSize, nDims, value;
+        if (!readU64(data, pos, nameSize) || (nameSize > data.size() - pos))
+        {
+            clear();
+            return false;
+        }
+        signal.name = data.substr(pos, nameSize);
+        pos += nameSize;
+        if (!readU64(data, pos, nDims) || (nDims > (data.size() - pos) / sizeof(uint64_t)))
+        {
+            clear();
+            return false;
+        }
+        uint64_t shapeSize = 1;
+        bool bOverflow = false;
+        for (uint64_t d = 0; d < nDims; d++)
+        {
+            readU64(data, pos, value);
+            signal.shape.push_back(value);
+            if ((value != 0) && (shapeSize > UINT64_MAX / value))
+            {
+                bOverflow = true;
+            }
+            shapeSize *= value;
+        }
+        if (bOverflow ||
+            !readU64(data, pos, signal.size) ||
+            (signal.size != shapeSize) ||
+            (signal.size > (data.size() - pos) / sizeof(uint64_t)))
+        {
+            clear();
+            return false;
+        }
+        signal.offset = values.size();
+        for (uint64_t k = 0; k < signal.size; k++)
+        {
+            readU64(data, pos, value);
+            values.push_back(Goldilocks::fromU64(value));
+        }
+        signals.push_back(signal);
+    }
+    return pos == data.size();
+}
+
+void Zkin::fromString(const std::string &data)
+{
+    if (isBinary(data))
+    {
+        if (!deserialize(data))
+        {
+            throw std::runtime_error("Zkin::fromString() failed deserializing binary zkin");
+        }
+    }
+    else
+    {
+        fromJson(ordered_json::parse(data));
+    }
+}
+
+void zkin2file(const Zkin &zkin, const std::string &fileName)
+{
+    std::string data;
+    zkin.serialize(data);
+    std::ofstream outputStream(fileName, std::ios::binary);
+    if (!outputStream.good())
+    {
+        std::cerr << "Error: zkin2file() failed creating output zkin file " << fileName << std::endl;
+        exitProcess();
+    }
+    outputStream.write(data.data(), data.size());
+    outputStream.close();
+}
+
+void file2zkin(const std::string &fileName, Zkin &zkin)
+{
+    std::ifstream inputStream(fileName, std::ios::binary);
+    if (!inputStream.good())
+    {
+        std::cerr << "Error: file2zkin() failed loading input zkin file " << fileName << std::endl;
+        exitProcess();
+    }
+    std::stringstream ss;
+    ss << inputStream.rdbuf();
+    inputStream.close();
+    try
+    {
+        zkin.fromString(ss.str());
+    }
+    catch (std::exception &e)
+    {
+        std::cerr << "Error: file2zkin() failed parsing input zkin file " << fileName << " exception=" << e.what() << std::endl;
+        exitProcess();
+    }
+}
@@ -0,0 +1,61 @@
+#ifndef ZKIN_HPP
+#define ZKIN_HPP
+
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+#include "goldilocks_base_field.hpp"
+
+using ordered_json = nlohmann::ordered_json;
+
+// Typed, in-memory circom input of a STARK verifier circuit.
+// Every signal is a named, flattened array of field elements, with the shape it has in JSON,
+// so that the circom witness loaders can consume it directly and JSON is only generated on demand
+class Zkin
+{
+public:
+    struct Signal
+    {
+        std::string name;
+        std::vector<uint64_t> shape; // e.g. {nQueries, nSiblings, HASH_SIZE}; empty for scalars
+        uint64_t offset;             // Offset of the first element in values
+        uint64_t size;               // Number of elements
+    };
+
+    std::vector<Signal> signals;
+    std::vector<Goldilocks::Element> values;
+
+    // Adds a new signal and returns the address of its values, valid until the next add() call
+    Goldilocks::Element *add(const std::string &name, const std::vector<uint64_t> &shape);
+    void add(const std::string &name, const std::vector<uint64_t> &shape, const Goldilocks::Element *pValues);
+
+    // Copies the signal otherName of other as a new signal name of this zkin; ignored if not present
+    void copy(const std::string &name, const Zkin &other, const std::string &otherName);
+
+    // Returns NULL if the signal is not present
+    const Signal *find(const std::string &name) const;
+    const Goldilocks::Element *get(const std::string &name) const;
+
+    void clear(void);
+
+    // JSON conversion, with nested arrays following every signal shape
+    void toJson(ordered_json &j) const;
+    void fromJson(const ordered_json &j);
+
+    // Compact binary serialization: "zkin" magic, version, number of signals, and then for every signal
+    // its name, shape and values as raw 64-bit integers in little endian order
+    void serialize(std::string &data) const;
+    bool deserialize(const std::string &data); // returns false if data is not a valid zkin binary
+    static bool isBinary(const std::string &data);
+
+    // Parses a zkin received as a string, either in binary or in JSON format
+    void fromString(const std::string &data);
+};
+
+// Saves a zkin into a file in binary format
+void zkin2file(const Zkin &zkin, const std::string &fileName);
+
+// Loads a zkin from a file, either in binary or in JSON format
+void file2zkin(const std::string &fileName, Zkin &zkin);
+
+#endif
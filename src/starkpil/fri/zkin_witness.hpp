@@ -0,0 +1,59 @@
+#ifndef ZKIN_WITNESS_HPP
+#define ZKIN_WITNESS_HPP
+
+#include <string>
+#include <sstream>
+#include <stdexcept>
+#include "fr_goldilocks.hpp"
+#include "zkin.hpp"
+
+// Sets the input signals of a circom witness calculator from a zkin.
+// Every verifier circuit has its own Circom_CalcWit class and fnv1a() in its own namespace, so both
+// are provided by the caller, e.g. zkin2witness(ctx, zkin, fnv1a) from within that namespace
+template <class CalcWit, class HashFunction>
+void zkin2witness(CalcWit *ctx, const Zkin &zkin, HashFunction hash)
+{
+    if (zkin.signals.size() == 0)
+    {
+        ctx->tryRunCircuit();
+    }
+    for (uint64_t s = 0; s < zkin.signals.size(); s++)
+    {
+        const Zkin::Signal &signal = zkin.signals[s];
+        uint64_t h = hash(signal.name);
+        uint64_t signalSize = ctx->getInputSignalSize(h);
+        if (signal.size < signalSize)
+        {
+            std::ostringstream errStrStream;
+            errStrStream << "Error loading signal " << signal.name << ": Not enough values\n";
+            throw std::runtime_error(errStrStream.str());
+        }
+        if (signal.size > signalSize)
+        {
+            std::ostringstream errStrStream;
+            errStrStream << "Error loading signal " << signal.name << ": Too many values\n";
+            throw std::runtime_error(errStrStream.str());
+        }
+        for (uint64_t i = 0; i < signal.size; i++)
+        {
+            // Field elements are set directly in normal form, with no string conversion
+            FrGElement v;
+            v.shortVal = 0;
+            v.type = FrG_LONG;
+            v.longVal[0] = Goldilocks::toU64(zkin.values[signal.offset + i]);
+            try
+            {
+                ctx->setInputSignal(h, i, v);
+            }
+            catch (std::runtime_error &e)
+            {
+                std::ostringstream errStrStream;
+                errStrStream << "Error setting signal: " << signal.name << "\n"
+                             << e.what();
+                throw std::runtime_error(errStrStream.str());
+            }
+        }
+    }
+}
+
+#endif
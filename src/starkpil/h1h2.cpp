@@ -0,0 +1,240 @@
+#include <iostream>
+#include <vector>
+#include <omp.h>
+#include "h1h2.hpp"
+#include "exit_process.hpp"
+#include "zkassert.hpp"
+
+#define H1H2_EMPTY_SLOT UINT64_MAX
+
+// Number of slots of the hash table of the t values: a power of two, at most half full
+static inline uint64_t tableSize(uint64_t N)
+{
+    uint64_t size = 2;
+    while (size < 2 * N)
+    {
+        size <<= 1;
+    }
+    return size;
+}
+
+static inline void getKey(Polinomial &pol, uint64_t idx, uint64_t (&key)[3])
+{
+    Goldilocks::Element *pElements = pol[idx];
+    for (uint64_t d = 0; d < pol.dim(); d++)
+    {
+        key[d] = Goldilocks::toU64(pElements[d]);
+    }
+}
+
+static inline uint64_t hashKey(const uint64_t (&key)[3], uint64_t dim)
+{
+    uint64_t h = key[0];
+    for (uint64_t d = 1; d < dim; d++)
+    {
+        h = (h ^ (h >> 29)) * 0xbf58476d1ce4e5b9ULL + key[d];
+    }
+    h = (h ^ (h >> 31)) * 0x94d049bb133111ebULL;
+    return h ^ (h >> 32);
+}
+
+static inline bool sameKey(Polinomial &tPol, uint64_t idx, const uint64_t (&key)[3])
+{
+    Goldilocks::Element *pElements = tPol[idx];
+    for (uint64_t d = 0; d < tPol.dim(); d++)
+    {
+        if (Goldilocks::toU64(pElements[d]) != key[d])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Returns the last row of t with this key, or H1H2_EMPTY_SLOT if there is none
+static inline uint64_t findKey(const uint64_t *table, uint64_t mask, Polinomial &tPol, const uint64_t (&key)[3])
+{
+    uint64_t slot = hashKey(key, tPol.dim()) & mask;
+    while (true)
+    {
+        uint64_t idx = table[slot];
+        if ((idx == H1H2_EMPTY_SLOT) || sameKey(tPol, idx, key))
+        {
+            return idx;
+        }
+        slot = (slot + 1) & mask;
+    }
+}
+
+uint64_t H1H2::getBufferSize(uint64_t N)
+{
+    return tableSize(N) + N + 1;
+}
+
+void H1H2::calculate(Polinomial &h1, Polinomial &h2, Polinomial &fPol, Polinomial &tPol, uint64_t pNumber, uint64_t *buffer, uint64_t bufferSize)
+{
+    const uint64_t N = tPol.degree();
+    const uint64_t dim = tPol.dim();
+    zkassert((dim == 1) || (dim == 3));
+    zkassert((fPol.degree() == N) && (fPol.dim() == dim));
+    zkassert((h1.degree() == N) && (h2.degree() == N) && (h1.dim() == dim) && (h2.dim() == dim));
+    zkassert(bufferSize >= getBufferSize(N));
+
+    // The buffer holds the hash table, indexing every t value by its last row, followed by the
+    // number of times every t row appears in the sorted sequence, later turned into its first position
+    const uint64_t mask = tableSize(N) - 1;
+    uint64_t *table = buffer;
+    uint64_t *counter = &buffer[mask + 1];
+
+#pragma omp parallel for
+    for (uint64_t i = 0; i <= mask; i++)
+    {
+        table[i] = H1H2_EMPTY_SLOT;
+    }
+#pragma omp parallel for
+    for (uint64_t i = 0; i < N; i++)
+    {
+        counter[i] = 1;
+    }
+
+    // Insert the t rows; when a value is repeated, its slot keeps the highest row
+#pragma omp parallel for
+    for (uint64_t i = 0; i < N; i++)
+    {
+        uint64_t key[3];
+        getKey(tPol, i, key);
+        uint64_t slot = hashKey(key, dim) & mask;
+        while (true)
+        {
+            uint64_t idx = __atomic_load_n(&table[slot], __ATOMIC_ACQUIRE);
+            if (idx == H1H2_EMPTY_SLOT)
+            {
+                if (__atomic_compare_exchange_n(&table[slot], &idx, i, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+                {
+                    break;
+                }
+                // Somebody else took the slot, so check it again
+                continue;
+            }
+            if (sameKey(tPol, idx, key))
+            {
+                while ((idx < i) && !__atomic_compare_exchange_n(&table[slot], &idx, i, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+                    ;
+                break;
+            }
+            slot = (slot + 1) & mask;
+        }
+    }
+
+    // Count the f rows that go after every t row; consecutive f rows often share their value,
+    // so every thread accumulates runs before touching the shared counters
+    uint64_t firstMissing = UINT64_MAX;
+#pragma omp parallel
+    {
+        uint64_t runIdx = H1H2_EMPTY_SLOT;
+        uint64_t runLength = 0;
+#pragma omp for reduction(min : firstMissing)
+        for (uint64_t i = 0; i < N; i++)
+        {
+            uint64_t key[3];
+            getKey(fPol, i, key);
+            uint64_t idx = findKey(table, mask, tPol, key);
+            if (idx == H1H2_EMPTY_SLOT)
+            {
+                firstMissing = std::min(firstMissing, i);
+                continue;
+            }
+            if (idx != runIdx)
+            {
+                if (runLength > 0)
+                {
+                    __atomic_fetch_add(&counter[runIdx], runLength, __ATOMIC_RELAXED);
+                }
+                runIdx = idx;
+                runLength = 0;
+            }
+            runLength++;
+        }
+        if (runLength > 0)
+        {
+            __atomic_fetch_add(&counter[runIdx], runLength, __ATOMIC_RELAXED);
+        }
+    }
+    if (firstMissing != UINT64_MAX)
+    {
+        std::cerr << "Error: H1H2::calculate() Number not included: w=" << firstMissing << " plookup_number=" << pNumber << "\nPol:" << Goldilocks::toString(fPol[firstMissing], 16) << std::endl;
+        exitProcess();
+    }
+
+    // Exclusive prefix sum of the counters, so that counter[i] is the first position of t row i
+    // in the sorted sequence of 2N values, and counter[N] = 2N
+    uint64_t nThreads = omp_get_max_threads();
+    std::vector<uint64_t> partialSums(nThreads + 1, 0);
+#pragma omp parallel num_threads(nThreads)
+    {
+        uint64_t thread = omp_get_thread_num();
+        uint64_t nChunks = omp_get_num_threads();
+        uint64_t begin = (N * thread) / nChunks;
+        uint64_t end = (N * (thread + 1)) / nChunks;
+        uint64_t sum = 0;
+        for (uint64_t i = begin; i < end; i++)
+        {
+            sum += counter[i];
+        }
+        partialSums[thread + 1] = sum;
+#pragma omp barrier
+#pragma omp single
+        for (uint64_t t = 0; t < nChunks; t++)
+        {
+            partialSums[t + 1] += partialSums[t];
+        }
+        sum = partialSums[thread];
+        for (uint64_t i = begin; i < end; i++)
+        {
+            uint64_t count = counter[i];
+            counter[i] = sum;
+            sum += count;
+        }
+    }
+    counter[N] = 2 * N;
+
+    // Write the sorted sequence: even positions go to h1 and odd ones to h2. Every thread writes
+    // its own range of positions, starting from the t row found by binary search
+#pragma omp parallel
+    {
+        uint64_t thread = omp_get_thread_num();
+        uint64_t nChunks = omp_get_num_threads();
+        uint64_t begin = (N * thread) / nChunks * 2;
+        uint64_t end = (N * (thread + 1)) / nChunks * 2;
+        if (begin < end)
+        {
+            uint64_t low = 0, high = N;
+            while (high - low > 1)
+            {
+                uint64_t mid = (low + high) / 2;
+                if (counter[mid] <= begin)
+                {
+                    low = mid;
+                }
+                else
+                {
+                    high = mid;
+                }
+            }
+            uint64_t id = low;
+            for (uint64_t p = begin; p < end; p++)
+            {
+                while (counter[id + 1] <= p)
+                {
+                    id++;
+                }
+                Goldilocks::Element *pSrc = tPol[id];
+                Goldilocks::Element *pDst = (p & 1) ? h2[p >> 1] : h1[p >> 1];
+                for (uint64_t d = 0; d < dim; d++)
+                {
+                    pDst[d] = pSrc[d];
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,22 @@
+#ifndef H1H2_HPP
+#define H1H2_HPP
+
+#include <cstdint>
+#include "polinomial.hpp"
+
+// Plookup h1 and h2 polynomials, computed in parallel within every lookup.
+// The columns are read and written in place, whatever their stride, and the only memory used
+// is the caller's buffer, of at least getBufferSize(N) 64-bit words
+class H1H2
+{
+public:
+    // N+1 counters plus a hash table of at most 4N words, the smallest power of two not below 2N;
+    // 3N+1 words in all when N is a power of two
+    static uint64_t getBufferSize(uint64_t N);
+
+    // Sorts the concatenation of t and f by the position in t of the last row with every value,
+    // and distributes it alternately between h1 and h2; every f value must be included in t
+    static void calculate(Polinomial &h1, Polinomial &h2, Polinomial &fPol, Polinomial &tPol, uint64_t pNumber, uint64_t *buffer, uint64_t bufferSize);
+};
+
+#endif
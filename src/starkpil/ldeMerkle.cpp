@@ -0,0 +1,148 @@
+#include <algorithm>
+#include <cstring>
+#include <vector>
+#include <omp.h>
+#include "ldeMerkle.hpp"
+#include "zkassert.hpp"
+
+#define LDE_MERKLE_BLOCK_ROWS 64 // Rows of every region combined and hashed together by the last pass
+
+// region[n2] = coefs[n1 + R*n2] * shift^(n1 + R*n2), for n2 in [first, last), i.e. the coefficients
+// n1, n1+R, n1+2R... of the polynomial evaluated over the coset
+static void gatherRows(Goldilocks::Element *region, const Goldilocks::Element *coefs, uint64_t n1, uint64_t R, uint64_t first, uint64_t last, uint64_t ncols)
+{
+    Goldilocks::Element shiftR = Goldilocks::exp(Goldilocks::shift(), R);
+    Goldilocks::Element s = Goldilocks::exp(Goldilocks::shift(), n1 + R * first);
+    for (uint64_t n2 = first; n2 < last; n2++)
+    {
+        const Goldilocks::Element *pSrc = &coefs[(n1 + R * n2) * ncols];
+        Goldilocks::Element *pDst = &region[n2 * ncols];
+        for (uint64_t c = 0; c < ncols; c++)
+        {
+            pDst[c] = pSrc[c] * s;
+        }
+        s = s * shiftR;
+    }
+}
+
+static void gatherRowsParallel(Goldilocks::Element *region, const Goldilocks::Element *coefs, uint64_t n1, uint64_t R, uint64_t first, uint64_t last, uint64_t ncols)
+{
+    uint64_t nChunks = std::min((uint64_t)omp_get_max_threads(), last - first);
+#pragma omp parallel for
+    for (uint64_t chunk = 0; chunk < nChunks; chunk++)
+    {
+        gatherRows(region, coefs, n1, R, first + ((last - first) * chunk) / nChunks, first + ((last - first) * (chunk + 1)) / nChunks, ncols);
+    }
+}
+
+void LDEMerkle::extendAndMerkelize(NTT_Goldilocks &ntt, MerkleTreeGL &tree, Goldilocks::Element *dst, Goldilocks::Element *src, uint64_t NExtended, uint64_t N, uint64_t ncols, Goldilocks::Element *buffer)
+{
+    zkassert((tree.source == dst) && (tree.height == NExtended) && (tree.width == ncols));
+
+    const uint64_t R = NExtended / N;
+    if ((R < 2) || (N < R) || (ncols == 0))
+    {
+        ntt.extendPol(dst, src, NExtended, N, ncols, buffer);
+        tree.merkelize();
+        return;
+    }
+    const uint64_t NR = N / R;
+    uint64_t nBitsExt = 0;
+    while (((uint64_t)1 << nBitsExt) < NExtended)
+    {
+        nBitsExt++;
+    }
+
+    // Coefficients, computed over the last region
+    Goldilocks::Element *coefs = &dst[(R - 1) * N * ncols];
+    ntt.INTT(coefs, src, N, ncols, buffer);
+
+    // Region n1 gets the evaluations over the N roots of unity of the coefficients n1, n1+R, n1+2R...
+    for (uint64_t n1 = 0; n1 < R; n1++)
+    {
+        Goldilocks::Element *region = &dst[n1 * N * ncols];
+        if (n1 < R - 1)
+        {
+            gatherRowsParallel(region, coefs, n1, R, 0, NR, ncols);
+        }
+        else
+        {
+            // The last region is compacted in place: row n2 only overwrites the coefficients of rows
+            // below n2/R, so the rows are processed in rounds [c, R*c) once all the rows below c are done
+            uint64_t c = std::min(NR, (uint64_t)LDE_MERKLE_BLOCK_ROWS);
+            gatherRows(region, coefs, n1, R, 0, c, ncols);
+            while (c < NR)
+            {
+                uint64_t next = std::min(NR, R * c);
+                gatherRowsParallel(region, coefs, n1, R, c, next, ncols);
+                c = next;
+            }
+        }
+#pragma omp parallel for
+        for (uint64_t i = NR; i < N; i++)
+        {
+            std::memset(&region[i * ncols], 0, ncols * sizeof(Goldilocks::Element));
+        }
+        ntt.NTT(region, region, N, ncols, buffer);
+    }
+
+    // Radix R pass: row k1*N+k2 of the result is sum(wR^(n1*k1) * wM^(n1*k2) * region[n1][k2]) over n1,
+    // where wM is the root of unity of NExtended and wR = wM^N.  Every block of rows k2 is combined and
+    // hashed by the same thread
+    Goldilocks::Element wM = Goldilocks::w(nBitsExt);
+    Goldilocks::Element wR = Goldilocks::exp(wM, N);
+    std::vector<Goldilocks::Element> wRPowers(R);
+    wRPowers[0] = Goldilocks::one();
+    for (uint64_t i = 1; i < R; i++)
+    {
+        wRPowers[i] = wRPowers[i - 1] * wR;
+    }
+    uint64_t nBlocks = (N + LDE_MERKLE_BLOCK_ROWS - 1) / LDE_MERKLE_BLOCK_ROWS;
+
+#pragma omp parallel for
+    for (uint64_t b = 0; b < nBlocks; b++)
+    {
+        uint64_t k2Begin = b * LDE_MERKLE_BLOCK_ROWS;
+        uint64_t k2End = std::min(N, k2Begin + LDE_MERKLE_BLOCK_ROWS);
+        Goldilocks::Element t = Goldilocks::exp(wM, k2Begin);
+        std::vector<Goldilocks::Element *> rows(R);
+        std::vector<Goldilocks::Element> v(R);
+        for (uint64_t k2 = k2Begin; k2 < k2End; k2++)
+        {
+            Goldilocks::Element tw = t;
+            rows[0] = &dst[k2 * ncols];
+            for (uint64_t n1 = 1; n1 < R; n1++)
+            {
+                rows[n1] = &dst[(n1 * N + k2) * ncols];
+                for (uint64_t c = 0; c < ncols; c++)
+                {
+                    rows[n1][c] = rows[n1][c] * tw;
+                }
+                tw = tw * t;
+            }
+            for (uint64_t c = 0; c < ncols; c++)
+            {
+                for (uint64_t n1 = 0; n1 < R; n1++)
+                {
+                    v[n1] = rows[n1][c];
+                }
+                for (uint64_t k1 = 0; k1 < R; k1++)
+                {
+                    Goldilocks::Element acc = v[0];
+                    for (uint64_t n1 = 1; n1 < R; n1++)
+                    {
+                        acc = acc + v[n1] * wRPowers[(n1 * k1) % R];
+                    }
+                    rows[k1][c] = acc;
+                }
+            }
+            t = t * wM;
+        }
+        for (uint64_t k1 = 0; k1 < R; k1++)
+        {
+            tree.hashLeaves(k1 * N + k2Begin, k1 * N + k2End);
+        }
+    }
+
+    tree.merkelizeNodes();
+}
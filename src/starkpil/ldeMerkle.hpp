@@ -0,0 +1,25 @@
+#ifndef LDE_MERKLE_HPP
+#define LDE_MERKLE_HPP
+
+#include <cstdint>
+#include "goldilocks_base_field.hpp"
+#include "ntt_goldilocks.hpp"
+#include "merkleTreeGL.hpp"
+
+// Low degree extension of a stage followed by the merkelization of the extended rows, pipelined so
+// that every block of extended rows is hashed while it is still in cache, instead of reading the
+// whole extended buffer again after the extension.
+//
+// The extension of size NExtended = R*N is split in the R size N NTTs of the coefficients n1, n1+R,
+// n1+2R... (one per n1 < R), computed over the R regions of N rows of dst, followed by a radix R pass
+// that combines row k of every region into rows k, N+k, 2N+k... of the result; that last pass is done
+// in blocks of rows, and it is there where the leaves are hashed
+class LDEMerkle
+{
+public:
+    // Same result as ntt.extendPol(dst, src, NExtended, N, ncols, buffer) followed by tree.merkelize(),
+    // where tree.source is dst; buffer is only passed to the N rows transforms of ntt
+    static void extendAndMerkelize(NTT_Goldilocks &ntt, MerkleTreeGL &tree, Goldilocks::Element *dst, Goldilocks::Element *src, uint64_t NExtended, uint64_t N, uint64_t ncols, Goldilocks::Element *buffer);
+};
+
+#endif
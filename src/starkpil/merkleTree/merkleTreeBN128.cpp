@@ -110,30 +110,31 @@ void MerkleTreeBN128::linearHash()
             }
         }
 
+        // Rows have the same width, so they are hashed in groups of POSEIDON_OPT_LANES rows with the same
+        // sequence of hash widths; the last group repeats its last row in the unused lanes
 #pragma omp parallel for
-        for (uint64_t i = 0; i < height; i++)
+        for (uint64_t i = 0; i < height; i += POSEIDON_OPT_LANES)
         {
-            uint pending = width;
+            uint64_t nLanes = std::min(height - i, (uint64_t)POSEIDON_OPT_LANES);
+            uint64_t pending = width;
             Poseidon_opt p;
-            std::vector<RawFr::Element> elements(17);
+            RawFr::Element elements[POSEIDON_OPT_LANES * 17];
             while (pending > 0)
             {
-                std::memset(&elements[0], 0, 17 * sizeof(RawFr::Element));
-                if (pending >= 16)
+                uint64_t batch = std::min(pending, (uint64_t)16);
+                uint64_t t = batch + 1;
+                for (uint64_t l = 0; l < POSEIDON_OPT_LANES; l++)
                 {
-                    std::memcpy(&elements[1], &buff[i * width + width - pending], 16 * sizeof(RawFr::Element));
-                    std::memcpy(&elements[0], &nodes[i], sizeof(RawFr::Element));
-                    p.hash(elements, &nodes[i]);
-                    pending = pending - 16;
+                    uint64_t row = i + std::min(l, nLanes - 1);
+                    std::memcpy(&elements[l * t], &nodes[row], sizeof(RawFr::Element));
+                    std::memcpy(&elements[l * t + 1], &buff[row * width + width - pending], batch * sizeof(RawFr::Element));
                 }
-                else
+                p.hash<POSEIDON_OPT_LANES>(elements, t);
+                for (uint64_t l = 0; l < nLanes; l++)
                 {
-                    std::vector<RawFr::Element> elements_last(pending + 1);
-                    std::memcpy(&elements_last[1], &buff[i * width + width - pending], pending * sizeof(RawFr::Element));
-                    std::memcpy(&elements_last[0], &nodes[i], sizeof(RawFr::Element));
-                    p.hash(elements_last, &nodes[i]);
-                    pending = 0;
+                    std::memcpy(&nodes[i + l], &elements[l * t], sizeof(RawFr::Element));
                 }
+                pending = pending - batch;
             }
         }
         free(buff);
@@ -164,16 +165,23 @@ void MerkleTreeBN128::merkelize()
     while (n256 > 1)
     {
         uint64_t batches = ceil((double)n256 / 16);
+        uint64_t numHashes = (batches == 1) ? n256 : 16;
 #pragma omp parallel for
-        for (uint64_t i = 0; i < batches; i++)
+        for (uint64_t i = 0; i < batches; i += POSEIDON_OPT_LANES)
         {
+            uint64_t nLanes = std::min(batches - i, (uint64_t)POSEIDON_OPT_LANES);
             Poseidon_opt p;
-            vector<RawFr::Element> elements(17);
-            std::memset(&elements[0], 0, 17 * sizeof(RawFr::Element));
-            uint numHashes = 16;
-            (batches == 1) ? numHashes = n256 : numHashes = 16;
-            std::memcpy(&elements[1], &cursor[i * 16], numHashes * sizeof(RawFr::Element));
-            p.hash(elements, &cursorNext[i]);
+            RawFr::Element elements[POSEIDON_OPT_LANES][17];
+            std::memset(&elements[0][0], 0, sizeof(elements));
+            for (uint64_t l = 0; l < POSEIDON_OPT_LANES; l++)
+            {
+                std::memcpy(&elements[l][1], &cursor[(i + std::min(l, nLanes - 1)) * 16], numHashes * sizeof(RawFr::Element));
+            }
+            p.hash<17, POSEIDON_OPT_LANES>(elements);
+            for (uint64_t l = 0; l < nLanes; l++)
+            {
+                std::memcpy(&cursorNext[i + l], &elements[l][0], sizeof(RawFr::Element));
+            }
         }
 
         n256 = nextN256;
@@ -202,19 +210,12 @@ void MerkleTreeBN128::getGroupProof(void *res, uint64_t idx)
 {
     assert(idx < height);
 
-    Goldilocks::Element v[source_width];
-    for (uint64_t i = 0; i < source_width; i++)
-    {
-        v[i] = getElement(idx, i);
-    }
-    std::memcpy(res, &v[0], source_width * sizeof(Goldilocks::Element));
-    void *resCursor = (uint8_t *)res + source_width * sizeof(Goldilocks::Element);
+    std::memcpy(res, &source[source_width * idx], source_width * sizeof(Goldilocks::Element));
+    RawFr::Element *mp = (RawFr::Element *)((uint8_t *)res + source_width * sizeof(Goldilocks::Element));
 
-    RawFr::Element *mp = (RawFr::Element *)calloc(getMerkleProofSize(height), 1);
+    // The path is generated in place, after the row
+    std::memset(mp, 0, getMerkleProofSize(height));
     merkle_genMerkleProof(mp, idx, 0, height);
-
-    std::memcpy(resCursor, &mp[0], getMerkleProofSize(height));
-    free(mp);
 }
 
 Goldilocks::Element MerkleTreeBN128::getElement(uint64_t idx, uint64_t subIdx)
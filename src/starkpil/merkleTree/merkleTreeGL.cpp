@@ -1,4 +1,5 @@
 #include "merkleTreeGL.hpp"
+#include "poseidon_goldilocks_lanes.hpp"
 #include <cassert>
 #include <algorithm> // std::max
 
@@ -11,12 +12,11 @@ void MerkleTreeGL::getElement(Goldilocks::Element &element, uint64_t idx, uint64
 
 void MerkleTreeGL::getGroupProof(Goldilocks::Element *proof, uint64_t idx)
 {
+    assert(idx < height);
 
-#pragma omp parallel for
-    for (uint64_t i = 0; i < width; i++)
-    {
-        getElement(proof[i], idx, i);
-    }
+    // The row is contiguous in source, and this is called from parallel regions, so it is copied
+    // without opening a nested one
+    std::memcpy(proof, &source[idx * width], width * sizeof(Goldilocks::Element));
 
     genMerkleProof(&proof[width], idx, 0, height * HASH_SIZE);
 }
@@ -34,12 +34,9 @@ void MerkleTreeGL::genMerkleProof(Goldilocks::Element *proof, uint64_t idx, uint
     genMerkleProof(&proof[HASH_SIZE], nextIdx, offset + nextN * 2, nextN);
 }
 
-void MerkleTreeGL::merkelize()
+void MerkleTreeGL::hashLeaves(uint64_t rowBegin, uint64_t rowEnd)
 {
-    if (height == 0)
-    {
-        return;
-    }
+    assert(rowEnd <= height);
     uint64_t batch_size = std::max((uint64_t)8, (width + 3) / 4);
     uint64_t nbatches = 1;
     if (width > 0)
@@ -48,22 +45,65 @@ void MerkleTreeGL::merkelize()
     }
     uint64_t nlastb = width - (nbatches - 1) * batch_size;
 
-    // Hash the leaves
-#pragma omp parallel for
-    for (uint64_t i = 0; i < height; i++)
+    // Rows are read directly from source, and hashed in groups of nLanes rows in lockstep, and the
+    // remaining ones one by one
+    uint64_t nLanes = PoseidonGoldilocksLanes::lanes();
+    uint64_t i = rowBegin;
+    if (nLanes > 1)
+    {
+        Goldilocks::Element buff0[nLanes * nbatches * CAPACITY];
+        for (; i + nLanes <= rowEnd; i += nLanes)
+        {
+            for (uint64_t j = 0; j < nbatches; j++)
+            {
+                uint64_t nn = batch_size;
+                if (j == nbatches - 1)
+                    nn = nlastb;
+                PoseidonGoldilocksLanes::linear_hash(&buff0[j * CAPACITY], nbatches * CAPACITY, &source[i * width + j * batch_size], width, nn);
+            }
+            PoseidonGoldilocksLanes::linear_hash(&nodes[i * CAPACITY], CAPACITY, buff0, nbatches * CAPACITY, nbatches * CAPACITY);
+        }
+    }
+
+    Goldilocks::Element buff0[nbatches * CAPACITY];
+    for (; i < rowEnd; i++)
     {
-        Goldilocks::Element buff0[nbatches * CAPACITY];
         for (uint64_t j = 0; j < nbatches; j++)
         {
             uint64_t nn = batch_size;
             if (j == nbatches - 1)
                 nn = nlastb;
-            Goldilocks::Element buff1[batch_size];
-            std::memcpy(&buff1[0], &source[i * width + j * batch_size], nn * sizeof(Goldilocks::Element));
-            PoseidonGoldilocks::linear_hash(&buff0[j * CAPACITY], buff1, nn);
+            PoseidonGoldilocks::linear_hash(&buff0[j * CAPACITY], &source[i * width + j * batch_size], nn);
         }
         PoseidonGoldilocks::linear_hash(&nodes[i * CAPACITY], buff0, nbatches * CAPACITY);
     }
+}
+
+void MerkleTreeGL::merkelize()
+{
+    if (height == 0)
+    {
+        return;
+    }
+
+    // Hash the leaves, in blocks of rows
+    uint64_t nBlocks = (height + MERKLEHASHGL_LEAVES_BLOCK - 1) / MERKLEHASHGL_LEAVES_BLOCK;
+#pragma omp parallel for
+    for (uint64_t b = 0; b < nBlocks; b++)
+    {
+        hashLeaves(b * MERKLEHASHGL_LEAVES_BLOCK, std::min(height, (b + 1) * MERKLEHASHGL_LEAVES_BLOCK));
+    }
+
+    merkelizeNodes();
+}
+
+void MerkleTreeGL::merkelizeNodes()
+{
+    if (height == 0)
+    {
+        return;
+    }
+    uint64_t nLanes = PoseidonGoldilocksLanes::lanes();
 
     // Build the merkle tree
     uint64_t pending = height;
@@ -74,8 +114,19 @@ void MerkleTreeGL::merkelize()
 
     while (pending > 1)
     {
+        // Every node is the hash of its two children with a zero capacity, i.e. a linear hash of RATE elements.
+        // The last node of an odd level reads past it, so it is left to the loop below
+        uint64_t nodeGroups = (nLanes > 1) ? (pending / 2) / nLanes : 0;
+
+#pragma omp parallel for
+        for (uint64_t g = 0; g < nodeGroups; g++)
+        {
+            uint64_t i = g * nLanes;
+            PoseidonGoldilocksLanes::linear_hash(&cursor_write[i * CAPACITY], CAPACITY, &cursor_read[i * RATE], RATE, RATE);
+        }
+
 #pragma omp parallel for
-        for (uint64_t i = 0; i < nextN; i++)
+        for (uint64_t i = nodeGroups * nLanes; i < nextN; i++)
         {
             Goldilocks::Element pol_input[SPONGE_WIDTH];
             std::memset(pol_input, 0, SPONGE_WIDTH * sizeof(Goldilocks::Element));
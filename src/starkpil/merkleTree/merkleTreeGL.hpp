@@ -6,6 +6,7 @@
 #include <math.h>
 
 #define MERKLEHASHGL_ARITY 2
+#define MERKLEHASHGL_LEAVES_BLOCK 64 // Rows per block of leaves hashed by merkelize()
 class MerkleTreeGL
 {
 private:
@@ -58,6 +59,12 @@ public:
     }
 
     void merkelize();
+
+    // Split merkelize(): hashLeaves() computes the leaves of rows [rowBegin, rowEnd), without opening
+    // any parallel region, so that they can be hashed as soon as those rows of source are final, and
+    // merkelizeNodes() builds the rest of the tree once all the leaves are hashed
+    void hashLeaves(uint64_t rowBegin, uint64_t rowEnd);
+    void merkelizeNodes();
     uint64_t getTreeNumElements()
     {
         return height * HASH_SIZE + (height - 1) * HASH_SIZE;
@@ -0,0 +1,467 @@
+#include <iostream>
+#include <cstring>
+#include <immintrin.h>
+#include "poseidon_goldilocks_lanes.hpp"
+#include "poseidon_g_constants.hpp"
+
+using namespace std;
+
+#define POSEIDON_LANES_PRIME 0xFFFFFFFF00000001ULL
+#define POSEIDON_LANES_EPSILON 0xFFFFFFFFULL // 2^64 mod p
+#define POSEIDON_LANES_FULL_ROUNDS 8
+#define POSEIDON_LANES_PARTIAL_ROUNDS 22
+#define POSEIDON_LANES_ROUNDS (POSEIDON_LANES_FULL_ROUNDS + POSEIDON_LANES_PARTIAL_ROUNDS)
+
+#define AVX512_TARGET __attribute__((target("avx512f")))
+
+typedef void (*LinearHashFunction)(Goldilocks::Element *output, uint64_t outputStride, const Goldilocks::Element *input, uint64_t inputStride, uint64_t size);
+
+// MDS matrix, M[x][y] = MCIRC[(y - x) mod 12] + MDIAG[x]*(x == y), as in the PoseidonG state machine executor;
+// it is a compile time constant so that its coefficients can be folded into the multiplications
+static constexpr uint64_t MCIRC[SPONGE_WIDTH] = {17, 15, 41, 16, 2, 28, 13, 13, 39, 18, 34, 20};
+static constexpr uint64_t MDIAG[SPONGE_WIDTH] = {8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+
+static constexpr uint64_t mds(uint64_t x, uint64_t y)
+{
+    return MCIRC[(y + SPONGE_WIDTH - x) % SPONGE_WIDTH] + ((x == y) ? MDIAG[x] : 0);
+}
+
+// Round constants, rearranged at start-up from the canonical ones used by the PoseidonG state machine
+// executor, as in the optimized Poseidon: a partial round only applies the S-box to state[0], so the
+// constants it adds to the other elements are carried forward through the MDS into the next round, and
+// every partial round only adds PARTIAL_RC[r] to state[0]; the carry left by the last partial round is
+// added to the constants of the next full round, FULL_RC[POSEIDON_LANES_FULL_ROUNDS / 2]
+static uint64_t FULL_RC[POSEIDON_LANES_FULL_ROUNDS][SPONGE_WIDTH];
+static uint64_t PARTIAL_RC[POSEIDON_LANES_PARTIAL_ROUNDS];
+
+static inline bool isFullRound(uint64_t r)
+{
+    return (r < POSEIDON_LANES_FULL_ROUNDS / 2) || (r >= POSEIDON_LANES_FULL_ROUNDS / 2 + POSEIDON_LANES_PARTIAL_ROUNDS);
+}
+
+static void initConstants(void)
+{
+    Goldilocks::Element carry[SPONGE_WIDTH];
+    for (uint64_t s = 0; s < SPONGE_WIDTH; s++)
+    {
+        carry[s] = Goldilocks::zero();
+    }
+    for (uint64_t r = 0; r < POSEIDON_LANES_ROUNDS; r++)
+    {
+        Goldilocks::Element c[SPONGE_WIDTH];
+        for (uint64_t s = 0; s < SPONGE_WIDTH; s++)
+        {
+            c[s] = Goldilocks::add(PoseidonGConstants::C[r * SPONGE_WIDTH + s], carry[s]);
+            carry[s] = Goldilocks::zero();
+        }
+        if (isFullRound(r))
+        {
+            uint64_t fullRound = (r < POSEIDON_LANES_FULL_ROUNDS / 2) ? r : r - POSEIDON_LANES_PARTIAL_ROUNDS;
+            for (uint64_t s = 0; s < SPONGE_WIDTH; s++)
+            {
+                FULL_RC[fullRound][s] = Goldilocks::toU64(c[s]);
+            }
+            continue;
+        }
+        PARTIAL_RC[r - POSEIDON_LANES_FULL_ROUNDS / 2] = Goldilocks::toU64(c[0]);
+        for (uint64_t x = 0; x < SPONGE_WIDTH; x++)
+        {
+            for (uint64_t y = 1; y < SPONGE_WIDTH; y++)
+            {
+                carry[x] = Goldilocks::add(carry[x], Goldilocks::mul(Goldilocks::fromU64(mds(x, y)), c[y]));
+            }
+        }
+    }
+}
+
+/**************/
+/* AVX2 (x4) */
+/**************/
+
+static inline __m256i avx2_cmpgt_u64(const __m256i &a, const __m256i &b)
+{
+    const __m256i sign = _mm256_set1_epi64x(0x8000000000000000LL);
+    return _mm256_cmpgt_epi64(_mm256_xor_si256(a, sign), _mm256_xor_si256(b, sign));
+}
+
+// Any 64-bit value into [0, p)
+static inline __m256i avx2_canonical(const __m256i &a)
+{
+    const __m256i ge = avx2_cmpgt_u64(a, _mm256_set1_epi64x(POSEIDON_LANES_PRIME - 1));
+    return _mm256_add_epi64(a, _mm256_and_si256(ge, _mm256_set1_epi64x(POSEIDON_LANES_EPSILON)));
+}
+
+// a + b, with a < 2^64 and b < p
+static inline __m256i avx2_add(const __m256i &a, const __m256i &b)
+{
+    const __m256i s = _mm256_add_epi64(a, b);
+    const __m256i carry = avx2_cmpgt_u64(a, s);
+    return avx2_canonical(_mm256_add_epi64(s, _mm256_and_si256(carry, _mm256_set1_epi64x(POSEIDON_LANES_EPSILON))));
+}
+
+// The S-box and the round constants use the AVX2 field operations of the Goldilocks library
+static inline void avx2_pow7(__m256i &x)
+{
+    __m256i x2, x3, x4;
+    Goldilocks::mult_avx(x2, x, x);
+    Goldilocks::mult_avx(x3, x2, x);
+    Goldilocks::mult_avx(x4, x2, x2);
+    Goldilocks::mult_avx(x, x3, x4);
+}
+
+// MDS coefficients are small, so every row is accumulated separately for the low and the high 32 bits
+// of the state elements, without carries, and only reduced once
+static inline void avx2_mds(__m256i (&state)[SPONGE_WIDTH])
+{
+    __m256i hi[SPONGE_WIDTH];
+    for (uint64_t y = 0; y < SPONGE_WIDTH; y++)
+    {
+        hi[y] = _mm256_srli_epi64(state[y], 32);
+    }
+    __m256i acc[SPONGE_WIDTH];
+#pragma GCC unroll 12
+    for (uint64_t x = 0; x < SPONGE_WIDTH; x++)
+    {
+        __m256i sumLo = _mm256_setzero_si256();
+        __m256i sumHi = _mm256_setzero_si256();
+#pragma GCC unroll 12
+        for (uint64_t y = 0; y < SPONGE_WIDTH; y++)
+        {
+            const __m256i c = _mm256_set1_epi64x(mds(x, y));
+            sumLo = _mm256_add_epi64(sumLo, _mm256_mul_epu32(state[y], c));
+            sumHi = _mm256_add_epi64(sumHi, _mm256_mul_epu32(hi[y], c));
+        }
+        // sumLo + sumHi*2^32 = sumLo + (sumHi mod 2^32)*2^32 + (sumHi/2^32)*(2^32 - 1)
+        const __m256i h1 = _mm256_srli_epi64(sumHi, 32);
+        const __m256i b = _mm256_add_epi64(sumLo, _mm256_sub_epi64(_mm256_slli_epi64(h1, 32), h1));
+        acc[x] = avx2_add(_mm256_slli_epi64(sumHi, 32), b);
+    }
+    for (uint64_t x = 0; x < SPONGE_WIDTH; x++)
+    {
+        state[x] = acc[x];
+    }
+}
+
+static inline void avx2_full_round(__m256i (&state)[SPONGE_WIDTH], uint64_t r)
+{
+    for (uint64_t s = 0; s < SPONGE_WIDTH; s++)
+    {
+        Goldilocks::add_avx(state[s], state[s], _mm256_set1_epi64x(FULL_RC[r][s]));
+        avx2_pow7(state[s]);
+    }
+    avx2_mds(state);
+}
+
+static inline void avx2_permute(__m256i (&state)[SPONGE_WIDTH])
+{
+    for (uint64_t r = 0; r < POSEIDON_LANES_FULL_ROUNDS / 2; r++)
+    {
+        avx2_full_round(state, r);
+    }
+    for (uint64_t r = 0; r < POSEIDON_LANES_PARTIAL_ROUNDS; r++)
+    {
+        Goldilocks::add_avx(state[0], state[0], _mm256_set1_epi64x(PARTIAL_RC[r]));
+        avx2_pow7(state[0]);
+        avx2_mds(state);
+    }
+    for (uint64_t r = POSEIDON_LANES_FULL_ROUNDS / 2; r < POSEIDON_LANES_FULL_ROUNDS; r++)
+    {
+        avx2_full_round(state, r);
+    }
+}
+
+static void avx2_linear_hash(Goldilocks::Element *output, uint64_t outputStride, const Goldilocks::Element *input, uint64_t inputStride, uint64_t size)
+{
+    const __m256i index = _mm256_set_epi64x(3 * inputStride, 2 * inputStride, inputStride, 0);
+    __m256i state[SPONGE_WIDTH];
+    for (uint64_t k = RATE; k < SPONGE_WIDTH; k++)
+    {
+        state[k] = _mm256_setzero_si256();
+    }
+    for (uint64_t pos = 0; pos < size; pos += RATE)
+    {
+        if (pos > 0)
+        {
+            for (uint64_t k = 0; k < CAPACITY; k++)
+            {
+                state[RATE + k] = state[k];
+            }
+        }
+        uint64_t n = (size - pos < RATE) ? size - pos : RATE;
+        for (uint64_t k = 0; k < n; k++)
+        {
+            state[k] = avx2_canonical(_mm256_i64gather_epi64((const long long *)&input[pos + k], index, sizeof(Goldilocks::Element)));
+        }
+        for (uint64_t k = n; k < RATE; k++)
+        {
+            state[k] = _mm256_setzero_si256();
+        }
+        avx2_permute(state);
+    }
+    uint64_t result[4];
+    for (uint64_t k = 0; k < CAPACITY; k++)
+    {
+        _mm256_storeu_si256((__m256i *)result, state[k]);
+        for (uint64_t l = 0; l < 4; l++)
+        {
+            output[l * outputStride + k] = Goldilocks::fromU64(result[l]);
+        }
+    }
+}
+
+/*****************/
+/* AVX-512 (x8) */
+/*****************/
+
+// The AVX-512 field operations of the Goldilocks library are only built with __AVX512__, which the
+// Makefile does not define, so this engine has its own ones, compiled for the avx512f target and only
+// selected at runtime
+
+// GCC reports false positives inside the AVX-512 intrinsics headers when they are inlined into target functions
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+
+static inline AVX512_TARGET __m512i avx512_canonical(const __m512i &a)
+{
+    const __mmask8 ge = _mm512_cmpge_epu64_mask(a, _mm512_set1_epi64(POSEIDON_LANES_PRIME));
+    return _mm512_mask_sub_epi64(a, ge, a, _mm512_set1_epi64(POSEIDON_LANES_PRIME));
+}
+
+// a + b, with a < 2^64 and b < p
+static inline AVX512_TARGET __m512i avx512_add(const __m512i &a, const __m512i &b)
+{
+    const __m512i s = _mm512_add_epi64(a, b);
+    const __mmask8 carry = _mm512_cmplt_epu64_mask(s, a);
+    return avx512_canonical(_mm512_mask_add_epi64(s, carry, s, _mm512_set1_epi64(POSEIDON_LANES_EPSILON)));
+}
+
+static inline AVX512_TARGET __m512i avx512_reduce128(const __m512i &hi, const __m512i &lo)
+{
+    const __m512i epsilon = _mm512_set1_epi64(POSEIDON_LANES_EPSILON);
+    const __m512i hiHi = _mm512_srli_epi64(hi, 32);
+    const __m512i hiLo = _mm512_and_si512(hi, epsilon);
+    __m512i t0 = _mm512_sub_epi64(lo, hiHi);
+    t0 = _mm512_mask_sub_epi64(t0, _mm512_cmplt_epu64_mask(lo, hiHi), t0, epsilon);
+    const __m512i t1 = _mm512_sub_epi64(_mm512_slli_epi64(hiLo, 32), hiLo);
+    return avx512_add(t0, t1);
+}
+
+static inline AVX512_TARGET __m512i avx512_mul(const __m512i &a, const __m512i &b)
+{
+    const __m512i mask = _mm512_set1_epi64(0xFFFFFFFFLL);
+    const __m512i aHi = _mm512_srli_epi64(a, 32);
+    const __m512i bHi = _mm512_srli_epi64(b, 32);
+    const __m512i ll = _mm512_mul_epu32(a, b);
+    const __m512i lh = _mm512_mul_epu32(a, bHi);
+    const __m512i hl = _mm512_mul_epu32(aHi, b);
+    const __m512i hh = _mm512_mul_epu32(aHi, bHi);
+    const __m512i t = _mm512_add_epi64(hl, _mm512_srli_epi64(ll, 32));
+    const __m512i u = _mm512_add_epi64(lh, _mm512_and_si512(t, mask));
+    const __m512i lo = _mm512_or_si512(_mm512_slli_epi64(u, 32), _mm512_and_si512(ll, mask));
+    const __m512i hi = _mm512_add_epi64(hh, _mm512_add_epi64(_mm512_srli_epi64(t, 32), _mm512_srli_epi64(u, 32)));
+    return avx512_reduce128(hi, lo);
+}
+
+static inline AVX512_TARGET __m512i avx512_pow7(const __m512i &x)
+{
+    const __m512i x2 = avx512_mul(x, x);
+    const __m512i x3 = avx512_mul(x2, x);
+    const __m512i x4 = avx512_mul(x2, x2);
+    return avx512_mul(x3, x4);
+}
+
+static inline AVX512_TARGET void avx512_mds(__m512i (&state)[SPONGE_WIDTH])
+{
+    __m512i hi[SPONGE_WIDTH];
+    for (uint64_t y = 0; y < SPONGE_WIDTH; y++)
+    {
+        hi[y] = _mm512_srli_epi64(state[y], 32);
+    }
+    __m512i acc[SPONGE_WIDTH];
+#pragma GCC unroll 12
+    for (uint64_t x = 0; x < SPONGE_WIDTH; x++)
+    {
+        __m512i sumLo = _mm512_setzero_si512();
+        __m512i sumHi = _mm512_setzero_si512();
+#pragma GCC unroll 12
+        for (uint64_t y = 0; y < SPONGE_WIDTH; y++)
+        {
+            const __m512i c = _mm512_set1_epi64(mds(x, y));
+            sumLo = _mm512_add_epi64(sumLo, _mm512_mul_epu32(state[y], c));
+            sumHi = _mm512_add_epi64(sumHi, _mm512_mul_epu32(hi[y], c));
+        }
+        const __m512i h1 = _mm512_srli_epi64(sumHi, 32);
+        const __m512i b = _mm512_add_epi64(sumLo, _mm512_sub_epi64(_mm512_slli_epi64(h1, 32), h1));
+        acc[x] = avx512_add(_mm512_slli_epi64(sumHi, 32), b);
+    }
+    for (uint64_t x = 0; x < SPONGE_WIDTH; x++)
+    {
+        state[x] = acc[x];
+    }
+}
+
+static inline AVX512_TARGET void avx512_full_round(__m512i (&state)[SPONGE_WIDTH], uint64_t r)
+{
+    for (uint64_t s = 0; s < SPONGE_WIDTH; s++)
+    {
+        state[s] = avx512_pow7(avx512_add(state[s], _mm512_set1_epi64(FULL_RC[r][s])));
+    }
+    avx512_mds(state);
+}
+
+static inline AVX512_TARGET void avx512_permute(__m512i (&state)[SPONGE_WIDTH])
+{
+    for (uint64_t r = 0; r < POSEIDON_LANES_FULL_ROUNDS / 2; r++)
+    {
+        avx512_full_round(state, r);
+    }
+    for (uint64_t r = 0; r < POSEIDON_LANES_PARTIAL_ROUNDS; r++)
+    {
+        state[0] = avx512_pow7(avx512_add(state[0], _mm512_set1_epi64(PARTIAL_RC[r])));
+        avx512_mds(state);
+    }
+    for (uint64_t r = POSEIDON_LANES_FULL_ROUNDS / 2; r < POSEIDON_LANES_FULL_ROUNDS; r++)
+    {
+        avx512_full_round(state, r);
+    }
+}
+
+static AVX512_TARGET void avx512_linear_hash(Goldilocks::Element *output, uint64_t outputStride, const Goldilocks::Element *input, uint64_t inputStride, uint64_t size)
+{
+    const __m512i index = _mm512_set_epi64(7 * inputStride, 6 * inputStride, 5 * inputStride, 4 * inputStride, 3 * inputStride, 2 * inputStride, inputStride, 0);
+    __m512i state[SPONGE_WIDTH];
+    for (uint64_t k = RATE; k < SPONGE_WIDTH; k++)
+    {
+        state[k] = _mm512_setzero_si512();
+    }
+    for (uint64_t pos = 0; pos < size; pos += RATE)
+    {
+        if (pos > 0)
+        {
+            for (uint64_t k = 0; k < CAPACITY; k++)
+            {
+                state[RATE + k] = state[k];
+            }
+        }
+        uint64_t n = (size - pos < RATE) ? size - pos : RATE;
+        for (uint64_t k = 0; k < n; k++)
+        {
+            state[k] = avx512_canonical(_mm512_i64gather_epi64(index, (const void *)&input[pos + k], sizeof(Goldilocks::Element)));
+        }
+        for (uint64_t k = n; k < RATE; k++)
+        {
+            state[k] = _mm512_setzero_si512();
+        }
+        avx512_permute(state);
+    }
+    uint64_t result[8];
+    for (uint64_t k = 0; k < CAPACITY; k++)
+    {
+        _mm512_storeu_si512((void *)result, state[k]);
+        for (uint64_t l = 0; l < 8; l++)
+        {
+            output[l * outputStride + k] = Goldilocks::fromU64(result[l]);
+        }
+    }
+}
+
+#pragma GCC diagnostic pop
+
+/*************/
+/* Dispatch */
+/*************/
+
+struct PoseidonLanesEngine
+{
+    const char *name;
+    uint64_t lanes;
+    LinearHashFunction linearHash;
+};
+
+// Compares an engine against PoseidonGoldilocks::linear_hash() for several input sizes
+static bool checkEngine(const PoseidonLanesEngine &engine)
+{
+    const uint64_t stride = 37;
+    Goldilocks::Element input[POSEIDON_LANES_MAX * stride];
+    uint64_t seed = 0x9E3779B97F4A7C15ULL;
+    for (uint64_t i = 0; i < POSEIDON_LANES_MAX * stride; i++)
+    {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        input[i] = Goldilocks::fromU64(seed);
+    }
+    const uint64_t sizes[] = {RATE, 13, 16, stride};
+    for (uint64_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+    {
+        Goldilocks::Element output[POSEIDON_LANES_MAX * CAPACITY];
+        engine.linearHash(output, CAPACITY, input, stride, sizes[s]);
+        for (uint64_t l = 0; l < engine.lanes; l++)
+        {
+            Goldilocks::Element expected[CAPACITY];
+            PoseidonGoldilocks::linear_hash(expected, &input[l * stride], sizes[s]);
+            for (uint64_t k = 0; k < CAPACITY; k++)
+            {
+                if (!Goldilocks::equal(output[l * CAPACITY + k], expected[k]))
+                {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+static PoseidonLanesEngine selectEngine(void)
+{
+    initConstants();
+
+    PoseidonLanesEngine candidates[2];
+    uint64_t nCandidates = 0;
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f"))
+    {
+        candidates[nCandidates++] = {"AVX-512", 8, avx512_linear_hash};
+    }
+    if (__builtin_cpu_supports("avx2"))
+    {
+        candidates[nCandidates++] = {"AVX2", 4, avx2_linear_hash};
+    }
+
+    for (uint64_t i = 0; i < nCandidates; i++)
+    {
+        if (checkEngine(candidates[i]))
+        {
+            return candidates[i];
+        }
+        cerr << "Error: PoseidonGoldilocksLanes selectEngine() " << candidates[i].name << " engine does not match PoseidonGoldilocks; discarding it" << endl;
+    }
+    PoseidonLanesEngine scalar = {"scalar", 1, NULL};
+    return scalar;
+}
+
+static const PoseidonLanesEngine &getEngine(void)
+{
+    static const PoseidonLanesEngine engine = selectEngine();
+    return engine;
+}
+
+uint64_t PoseidonGoldilocksLanes::lanes(void)
+{
+    return getEngine().lanes;
+}
+
+void PoseidonGoldilocksLanes::linear_hash(Goldilocks::Element *output, uint64_t outputStride, const Goldilocks::Element *input, uint64_t inputStride, uint64_t size)
+{
+    const PoseidonLanesEngine &engine = getEngine();
+
+    // Short inputs are not hashed, but copied and padded with zeros, as PoseidonGoldilocks does
+    if ((size <= CAPACITY) || (engine.linearHash == NULL))
+    {
+        for (uint64_t l = 0; l < engine.lanes; l++)
+        {
+            PoseidonGoldilocks::linear_hash(&output[l * outputStride], (Goldilocks::Element *)&input[l * inputStride], size);
+        }
+        return;
+    }
+
+    engine.linearHash(output, outputStride, input, inputStride, size);
+}
@@ -0,0 +1,25 @@
+#ifndef POSEIDON_GOLDILOCKS_LANES_HPP
+#define POSEIDON_GOLDILOCKS_LANES_HPP
+
+#include "goldilocks_base_field.hpp"
+#include "poseidon_goldilocks.hpp"
+
+#define POSEIDON_LANES_MAX 8
+
+// Poseidon Goldilocks linear hashes of several independent inputs computed in lockstep, one input per
+// SIMD lane: 8 lanes with AVX-512, 4 lanes with AVX2.  The engine is selected at runtime the first time
+// it is used, and it is only selected if its results match PoseidonGoldilocks::linear_hash()
+class PoseidonGoldilocksLanes
+{
+public:
+    // Number of inputs hashed in lockstep by the selected engine; 1 if no engine is available, and then
+    // callers must use PoseidonGoldilocks directly
+    static uint64_t lanes(void);
+
+    // Computes lanes() linear hashes of size elements each.  Input l is read from input[l*inputStride],
+    // and its CAPACITY elements result is written at output[l*outputStride].  Hashing RATE elements
+    // is equivalent to PoseidonGoldilocks::hash() with a zero capacity
+    static void linear_hash(Goldilocks::Element *output, uint64_t outputStride, const Goldilocks::Element *input, uint64_t inputStride, uint64_t size);
+};
+
+#endif
@@ -244,364 +244,73 @@ public:
         return Goldilocks::toU64(_pAddress[idx * _offset]);
     }
 
-    static void calculateH1H2(Polinomial &h1, Polinomial &h2, Polinomial &fPol, Polinomial &tPol)
-    {
-        map<std::vector<Goldilocks::Element>, uint64_t, CompareFe> idx_t;
-        multimap<std::vector<Goldilocks::Element>, uint64_t, CompareFe> s;
-        multimap<std::vector<Goldilocks::Element>, uint64_t>::iterator it;
-        uint64_t i = 0;
-
-        for (uint64_t i = 0; i < tPol.degree(); i++)
-        {
-            vector<Goldilocks::Element> key = tPol.toVector(i);
-            std::pair<vector<Goldilocks::Element>, uint64_t> pr(key, i);
-
-            auto const result = idx_t.insert(pr);
-            if (not result.second)
-            {
-                result.first->second = i;
-            }
-
-            s.insert(pr);
-        }
-
-        for (uint64_t i = 0; i < fPol.degree(); i++)
-        {
-            vector<Goldilocks::Element> key = fPol.toVector(i);
-
-            if (idx_t.find(key) == idx_t.end())
-            {
-                cerr << "Error: calculateH1H2() Number not included: " << Goldilocks::toString(fPol[i], 16) << endl;
-                exit(-1);
-            }
-            uint64_t idx = idx_t[key];
-            s.insert(pair<vector<Goldilocks::Element>, uint64_t>(key, idx));
-        }
-
-        multimap<uint64_t, vector<Goldilocks::Element>> s_sorted;
-        multimap<uint64_t, vector<Goldilocks::Element>>::iterator it_sorted;
-
-        for (it = s.begin(); it != s.end(); it++)
-        {
-            s_sorted.insert(make_pair(it->second, it->first));
-        }
-
-        for (it_sorted = s_sorted.begin(); it_sorted != s_sorted.end(); it_sorted++, i++)
-        {
-            if ((i & 1) == 0)
-            {
-                Polinomial::copyElement(h1, i / 2, it_sorted->second);
-            }
-            else
-            {
-                Polinomial::copyElement(h2, i / 2, it_sorted->second);
-            }
-        }
-    };
-
-    static void calculateH1H2_(Polinomial &h1, Polinomial &h2, Polinomial &fPol, Polinomial &tPol, uint64_t pNumber)
-    {
-        map<std::vector<Goldilocks::Element>, uint64_t, CompareFe> idx_t;
-        multimap<std::vector<Goldilocks::Element>, uint64_t, CompareFe> s;
-        multimap<std::vector<Goldilocks::Element>, uint64_t>::iterator it;
-
-        vector<int> counter(tPol.degree(), 1);
-
-        for (uint64_t i = 0; i < tPol.degree(); i++)
-        {
-            vector<Goldilocks::Element> key = tPol.toVector(i);
-            idx_t[key] = i + 1;
-        }
-
-        for (uint64_t i = 0; i < fPol.degree(); i++)
-        {
-            vector<Goldilocks::Element> key = fPol.toVector(i);
-            uint64_t indx = idx_t[key];
-            if (indx == 0)
-            {
-                cerr << "Error: calculateH1H2() Number not included: w=" << i << " plookup_number=" << pNumber << "\nPol:" << Goldilocks::toString(fPol[i], 16) << endl;
-                exit(-1);
-            }
-            ++counter[indx - 1];
-        }
-
-        uint64_t id = 0;
-        for (u_int64_t i = 0; i < tPol.degree(); ++i)
-        {
-            if (counter[id] == 0)
-            {
-                ++id;
-            }
-            counter[id] -= 1;
-            Polinomial::copyElement(h1, i, tPol, id);
-
-            if (counter[id] == 0)
-            {
-                ++id;
-            }
-            counter[id] -= 1;
-            Polinomial::copyElement(h2, i, tPol, id);
-        }
-    }
-
-    static void calculateH1H2_opt1(Polinomial &h1, Polinomial &h2, Polinomial &fPol, Polinomial &tPol, uint64_t pNumber, uint64_t *buffer, uint64_t size_keys, uint64_t size_values)
+    // z[0] = 1 and z[i] = z[i-1]*num[i-1]/den[i-1], as a parallel prefix product over chunks of rows.
+    // Every chunk inverts its den values with a single inversion, using its rows of z as scratch,
+    // and computes its local running product; the chunk totals are then scanned and applied
+    static void calculateZ(Polinomial &z, Polinomial &num, Polinomial &den)
     {
-        vector<int> counter(tPol.degree(), 1);  // this 1 is important, space of the original buffer could be used
-        vector<bool> touched(size_keys, false); // faster use this than initialize buffer, bitmask could be used
-        uint32_t pos = 0;
-
-        // double time1 = omp_get_wtime();
-        for (uint64_t i = 0; i < tPol.degree(); i++)
-        {
-            uint64_t key = tPol.firstValueU64(i);
-            uint64_t ind = key % size_keys;
-            if (!touched[ind])
-            {
-                buffer[ind] = pos;
-                uint32_t offset = size_keys + 3 * pos;
-                buffer[offset] = key;
-                buffer[offset + 1] = i;
-                buffer[offset + 2] = 0;
-                pos += 1;
-                touched[ind] = true;
-            }
-            else
-            {
-                uint64_t pos_ = buffer[ind];
-                bool exit_ = false;
-                do
-                {
-                    uint32_t offset = size_keys + 3 * pos_;
-                    if (key == buffer[offset])
-                    {
-                        buffer[offset + 1] = i;
-                        exit_ = true;
-                    }
-                    else
-                    {
-                        if (buffer[offset + 2] != 0)
-                        {
-                            pos_ = buffer[offset + 2];
-                        }
-                        else
-                        {
-                            buffer[offset + 2] = pos;
-                            // new offset
-                            offset = size_keys + 3 * pos;
-                            buffer[offset] = key;
-                            buffer[offset + 1] = i;
-                            buffer[offset + 2] = 0;
-                            pos += 1;
-                            exit_ = true;
-                        }
-                    }
-                } while (!exit_);
-            }
-        }
+        uint64_t size = num.degree();
+        assert(z.dim() == FIELD_EXTENSION && num.dim() == FIELD_EXTENSION && den.dim() == FIELD_EXTENSION);
+        assert(den.degree() == size && z.degree() >= size && size > 0);
 
-        // double time2 = omp_get_wtime();
+        uint64_t nChunks = std::min((uint64_t)omp_get_max_threads(), size);
+        Polinomial totals(nChunks + 1, FIELD_EXTENSION);
 
-        for (uint64_t i = 0; i < fPol.degree(); i++)
+#pragma omp parallel for num_threads(nChunks) schedule(static, 1)
+        for (uint64_t c = 0; c < nChunks; c++)
         {
-            uint64_t indx = 0;
-            uint64_t key = fPol.firstValueU64(i);
-            uint64_t ind = key % size_keys;
-            if (!touched[ind])
-            {
-                cerr << "Error: calculateH1H2() Number not included: w=" << i << " plookup_number=" << pNumber << "\nPol:" << Goldilocks::toString(fPol[i], 16) << endl;
-                exit(-1);
-            }
-            uint64_t pos_ = buffer[ind];
-            bool exit_ = false;
-            do
-            {
-                uint32_t offset = size_keys + 3 * pos_;
-                if (key == buffer[offset])
-                {
-                    indx = buffer[offset + 1];
-                    exit_ = true;
-                }
-                else
-                {
-                    if (buffer[offset + 2] != 0)
-                    {
-                        pos_ = buffer[offset + 2];
-                    }
-                    else
-                    {
-                        cerr << "Error: calculateH1H2() Number not included: w=" << i << " plookup_number=" << pNumber << "\nPol:" << Goldilocks::toString(fPol[i], 16) << endl;
-                        exit(-1);
-                    }
-                }
-            } while (!exit_);
-            ++counter[indx];
-        }
+            uint64_t begin = (size * c) / nChunks;
+            uint64_t end = (size * (c + 1)) / nChunks;
+            Goldilocks::Element inv[FIELD_EXTENSION];
+            Goldilocks::Element denI[FIELD_EXTENSION];
+            Polinomial invPol(inv, 1, FIELD_EXTENSION);
+            Polinomial denIPol(denI, 1, FIELD_EXTENSION);
 
-        // double time3 = omp_get_wtime();
-        uint64_t id = 0;
-        for (u_int64_t i = 0; i < tPol.degree(); ++i)
-        {
-            if (counter[id] == 0)
+            // z[i] = den[begin]*...*den[i]
+            Polinomial::copyElement(z, begin, den, begin);
+            for (uint64_t i = begin + 1; i < end; i++)
             {
-                ++id;
+                Polinomial::mulElement(z, i, z, i - 1, den, i);
             }
 
-            counter[id] -= 1;
-            Polinomial::copyElement(h1, i, tPol, id);
-
-            if (counter[id] == 0)
+            // Walk back with the inverse of the whole product, leaving z[i] = num[i]/den[i]
+            Goldilocks3::inv((Goldilocks3::Element *)inv, (Goldilocks3::Element *)z[end - 1]);
+            for (uint64_t i = end - 1; i > begin; i--)
             {
-                ++id;
+                Polinomial::mulElement(denIPol, 0, invPol, 0, z, i - 1);
+                Polinomial::mulElement(invPol, 0, invPol, 0, den, i);
+                Polinomial::mulElement(z, i, num, i, denIPol, 0);
             }
-            counter[id] -= 1;
-            Polinomial::copyElement(h2, i, tPol, id);
-        }
-        // double time4 = omp_get_wtime();
-        // std::cout << "holu: " << id << " " << pos << " times: " << time2 - time1 << " " << time3 - time2 << " " << time4 - time3 << " " << h2.dim() << std::endl;
-    }
-
-    static void calculateH1H2_opt3(Polinomial &h1, Polinomial &h2, Polinomial &fPol, Polinomial &tPol, uint64_t pNumber, uint64_t *buffer, uint64_t size_keys, uint64_t size_values)
-    {
-        vector<int> counter(tPol.degree(), 1);  // this 1 is important, space of the original buffer could be used
-        vector<bool> touched(size_keys, false); // faster use this than initialize buffer, bitmask could be used
-        uint32_t pos = 0;
-        uint64_t key[3];
+            Polinomial::mulElement(z, begin, num, begin, invPol, 0);
 
-        // double time1 = omp_get_wtime();
-        for (uint64_t i = 0; i < tPol.degree(); i++)
-        {
-            tPol.toVectorU64(i, key);
-            uint64_t ind = key[0] % size_keys;
-            if (!touched[ind])
-            {
-                buffer[ind] = pos;
-                uint32_t offset = size_keys + 5 * pos;
-                buffer[offset] = key[0];
-                buffer[offset + 1] = key[1];
-                buffer[offset + 2] = key[2];
-                buffer[offset + 3] = i;
-                buffer[offset + 4] = 0;
-                pos += 1;
-                touched[ind] = true;
-            }
-            else
+            // Local running product; its last value is the total of the chunk
+            for (uint64_t i = begin + 1; i < end; i++)
             {
-                uint64_t pos_ = buffer[ind];
-                bool exit_ = false;
-                do
-                {
-                    uint32_t offset = size_keys + 5 * pos_;
-                    if (key[0] == buffer[offset] && key[1] == buffer[offset + 1] && key[2] == buffer[offset + 2])
-                    {
-                        buffer[offset + 3] = i;
-                        exit_ = true;
-                    }
-                    else
-                    {
-                        if (buffer[offset + 4] != 0)
-                        {
-                            pos_ = buffer[offset + 4];
-                        }
-                        else
-                        {
-                            buffer[offset + 4] = pos;
-                            // new offset
-                            offset = size_keys + 5 * pos;
-                            buffer[offset] = key[0];
-                            buffer[offset + 1] = key[1];
-                            buffer[offset + 2] = key[2];
-                            buffer[offset + 3] = i;
-                            buffer[offset + 4] = 0;
-                            pos += 1;
-                            exit_ = true;
-                        }
-                    }
-                } while (!exit_);
+                Polinomial::mulElement(z, i, z, i - 1, z, i);
             }
+            Polinomial::copyElement(totals, c + 1, z, end - 1);
         }
 
-        // double time2 = omp_get_wtime();
-
-        for (uint64_t i = 0; i < fPol.degree(); i++)
+        // totals[c] = product of all the chunks before c
+        Goldilocks3::copy((Goldilocks3::Element *)totals[0], &Goldilocks3::one());
+        for (uint64_t c = 1; c <= nChunks; c++)
         {
-            uint64_t indx = 0;
-            fPol.toVectorU64(i, key);
-            uint64_t ind = key[0] % size_keys;
-            if (!touched[ind])
-            {
-                cerr << "Error: calculateH1H2() Number not included: w=" << i << " plookup_number=" << pNumber << "\nPol:" << Goldilocks::toString(fPol[i], 16) << endl;
-                exit(-1);
-            }
-            uint64_t pos_ = buffer[ind];
-            bool exit_ = false;
-            do
-            {
-                uint32_t offset = size_keys + 5 * pos_;
-                if (key[0] == buffer[offset] && key[1] == buffer[offset + 1] && key[2] == buffer[offset + 2])
-                {
-                    indx = buffer[offset + 3];
-                    exit_ = true;
-                }
-                else
-                {
-                    if (buffer[offset + 4] != 0)
-                    {
-                        pos_ = buffer[offset + 4];
-                    }
-                    else
-                    {
-                        cerr << "Error: calculateH1H2() Number not included: w=" << i << " plookup_number=" << pNumber << "\nPol:" << Goldilocks::toString(fPol[i], 16) << endl;
-                        exit(-1);
-                    }
-                }
-            } while (!exit_);
-            ++counter[indx];
+            Polinomial::mulElement(totals, c, totals, c - 1, totals, c);
         }
+        zkassert(Goldilocks3::isOne((Goldilocks3::Element &)*totals[nChunks]));
 
-        // double time3 = omp_get_wtime();
-        uint64_t id = 0;
-        for (u_int64_t i = 0; i < tPol.degree(); ++i)
+        // Shift every chunk one row, so that z[i] does not include row i, and apply the chunk prefix
+#pragma omp parallel for num_threads(nChunks) schedule(static, 1)
+        for (uint64_t c = 0; c < nChunks; c++)
         {
-            if (counter[id] == 0)
+            uint64_t begin = (size * c) / nChunks;
+            uint64_t end = (size * (c + 1)) / nChunks;
+            for (uint64_t i = end - 1; i > begin; i--)
             {
-                ++id;
+                Polinomial::mulElement(z, i, z, i - 1, totals, c);
             }
-
-            counter[id] -= 1;
-            Polinomial::copyElement(h1, i, tPol, id);
-
-            if (counter[id] == 0)
-            {
-                ++id;
-            }
-            counter[id] -= 1;
-            Polinomial::copyElement(h2, i, tPol, id);
-        }
-        // double time4 = omp_get_wtime();
-        // std::cout << "holu: " << id << " " << pos << " times: " << time2 - time1 << " " << time3 - time2 << " " << time4 - time3 << " " << h2.dim() << std::endl;
-    }
-
-    static void calculateZ(Polinomial &z, Polinomial &num, Polinomial &den)
-    {
-        uint64_t size = num.degree();
-
-        Polinomial denI(size, 3);
-        Polinomial checkVal(1, 3);
-        Goldilocks::Element *pZ = z[0];
-        Goldilocks3::copy((Goldilocks3::Element *)&pZ[0], &Goldilocks3::one());
-
-        batchInverse(denI, den);
-        for (uint64_t i = 1; i < size; i++)
-        {
-            Polinomial tmp(1, 3);
-            Polinomial::mulElement(tmp, 0, num, i - 1, denI, i - 1);
-            Polinomial::mulElement(z, i, z, i - 1, tmp, 0);
+            Polinomial::copyElement(z, begin, totals, c);
         }
-        Polinomial tmp(1, 3);
-        Polinomial::mulElement(tmp, 0, num, size - 1, denI, size - 1);
-        Polinomial::mulElement(checkVal, 0, z, size - 1, tmp, 0);
-
-        zkassert(Goldilocks3::isOne((Goldilocks3::Element &)*checkVal[0]));
     }
 
     // compute the multiplications of the polynomials in src in parallel with partitions of size partitionSize
@@ -0,0 +1,181 @@
+#include <algorithm>
+#include <cstring>
+#include <omp.h>
+#include "rowTiles.hpp"
+#include "polinomial.hpp"
+#include "constant_pols_starks.hpp"
+#include "zhInv.hpp"
+#include "steps.hpp"
+#include "zkassert.hpp"
+
+RowTiles::RowTiles(uint64_t nrows, uint64_t nextRows, uint64_t l2Size, uint64_t nrowsBatch, const std::vector<Section> &sections) : nrows(nrows),
+                                                                                                                                      nextRows(nextRows),
+                                                                                                                                      sections(sections)
+{
+    zkassert((nrows & (nrows - 1)) == 0);
+    zkassert((nrowsBatch > 0) && ((nrowsBatch & (nrowsBatch - 1)) == 0) && (nrowsBatch <= nrows));
+
+    // The scratch buffer, of the rows of a tile plus as many next rows, takes at most half of the L2
+    uint64_t rowBytes = 0;
+    for (const Section &section : sections)
+    {
+        rowBytes += section.rowSize * sizeof(Goldilocks::Element);
+    }
+    uint64_t maxRows = l2Size / (4 * std::max(rowBytes, (uint64_t)1));
+
+    // A power of two, of at least one batch, leaving at least one tile per thread
+    tileRows = nrowsBatch;
+    while ((tileRows * 2 <= maxRows) && (tileRows * 2 * omp_get_max_threads() <= nrows))
+    {
+        tileRows *= 2;
+    }
+
+    scratchSize = 0;
+    for (const Section &section : sections)
+    {
+        offsets.push_back(scratchSize);
+        scratchSize += 2 * tileRows * section.rowSize;
+    }
+}
+
+void RowTiles::copyTile(uint64_t row0, Goldilocks::Element *pScratch) const
+{
+    uint64_t next0 = (row0 + nextRows) % nrows;
+    uint64_t nextBefore = std::min(tileRows, nrows - next0); // Next rows before wrapping around
+    for (uint64_t s = 0; s < sections.size(); s++)
+    {
+        const Section &section = sections[s];
+        Goldilocks::Element *pTile = &pScratch[offsets[s]];
+        Goldilocks::Element *pNext = &pTile[tileRows * section.rowSize];
+        std::memcpy(pTile, &section.pAddress[row0 * section.rowSize], tileRows * section.rowSize * sizeof(Goldilocks::Element));
+        std::memcpy(pNext, &section.pAddress[next0 * section.rowSize], nextBefore * section.rowSize * sizeof(Goldilocks::Element));
+        std::memcpy(&pNext[nextBefore * section.rowSize], section.pAddress, (tileRows - nextBefore) * section.rowSize * sizeof(Goldilocks::Element));
+    }
+}
+
+bool RowTiles::remapArgs(const StepsParserArgs &parserArgs, const Goldilocks::Element *pPols, const Goldilocks::Element *pConstPols, RowTilesArgs &tileArgs, std::string &reason) const
+{
+    // The constant section, read with their columns, and the offset in pPols of the rest
+    uint64_t constSection = sections.size();
+    std::vector<uint64_t> polsOffsets(sections.size(), 0);
+    for (uint64_t s = 0; s < sections.size(); s++)
+    {
+        if (sections[s].pAddress == pConstPols)
+        {
+            constSection = s;
+        }
+        else if (sections[s].pAddress >= pPols)
+        {
+            polsOffsets[s] = sections[s].pAddress - pPols;
+        }
+    }
+
+    tileArgs.args.assign(parserArgs.pArgs, parserArgs.pArgs + parserArgs.nArgs);
+    tileArgs.constOffset = (constSection < sections.size()) ? scratchOffset(constSection, false) : 0;
+
+    uint64_t iArgs = 0;
+    for (uint64_t kk = 0; kk < parserArgs.nOps; kk++)
+    {
+        uint64_t opcode = parserArgs.pOps[kk];
+        if (opcode >= parserArgs.nOpcodes)
+        {
+            reason = "invalid opcode=" + std::to_string(opcode) + " at op=" + std::to_string(kk);
+            return false;
+        }
+        const char *pKinds = parserArgs.pOpcodeArgs[opcode];
+        uint64_t section = sections.size(); // Of the last 'P' or 'C'
+        for (uint64_t k = 0; pKinds[k] != 0; k++, iArgs++)
+        {
+            if (iArgs >= parserArgs.nArgs)
+            {
+                reason = "ran out of arguments at op=" + std::to_string(kk);
+                return false;
+            }
+            uint64_t &arg = tileArgs.args[iArgs];
+            switch (pKinds[k])
+            {
+            case 'P':
+                section = sections.size();
+                for (uint64_t s = 0; s < sections.size(); s++)
+                {
+                    if ((s != constSection) && (sections[s].pAddress >= pPols) && (arg >= polsOffsets[s]) && (arg < polsOffsets[s] + sections[s].rowSize))
+                    {
+                        section = s;
+                    }
+                }
+                if (section == sections.size())
+                {
+                    reason = "opcode=" + std::to_string(opcode) + " reads offset=" + std::to_string(arg) + " outside of the tiles";
+                    return false;
+                }
+                arg = scratchOffset(section, false) + arg - polsOffsets[section];
+                break;
+            case 'S':
+                if ((section == sections.size()) || (section == constSection) || (arg != sections[section].rowSize))
+                {
+                    reason = "opcode=" + std::to_string(opcode) + " reads with row size=" + std::to_string(arg) + " a section of another one";
+                    return false;
+                }
+                break;
+            case 'C':
+                if ((constSection == sections.size()) || (arg >= sections[constSection].rowSize))
+                {
+                    reason = "opcode=" + std::to_string(opcode) + " reads constant column=" + std::to_string(arg) + " outside of the tiles";
+                    return false;
+                }
+                section = constSection;
+                break;
+            case 'H':
+                if ((section == sections.size()) || ((arg != 0) && (arg != nextRows)))
+                {
+                    reason = "opcode=" + std::to_string(opcode) + " reads rows shifted by " + std::to_string(arg) + ", which are not in the tiles";
+                    return false;
+                }
+                arg = (arg == 0) ? 0 : tileRows;
+                break;
+            case 'N':
+                if ((section == sections.size()) || (arg != nrows))
+                {
+                    reason = "opcode=" + std::to_string(opcode) + " reads a domain of " + std::to_string(arg) + " rows";
+                    return false;
+                }
+                arg = 2 * tileRows;
+                break;
+            case 'W':
+                reason = "opcode=" + std::to_string(opcode) + " writes the pols";
+                return false;
+            default:
+                break;
+            }
+        }
+    }
+    if (iArgs != parserArgs.nArgs)
+    {
+        reason = "used " + std::to_string(iArgs) + " arguments instead of " + std::to_string(parserArgs.nArgs);
+        return false;
+    }
+    return true;
+}
+
+void RowTiles::run(uint64_t nrowsBatch, const std::function<void(uint64_t, Goldilocks::Element *)> &batchFunction) const
+{
+    zkassert((nrowsBatch > 0) && (tileRows % nrowsBatch == 0));
+    uint64_t nTiles = nrows / tileRows;
+
+#pragma omp parallel
+    {
+        uint64_t thread = omp_get_thread_num();
+        uint64_t nThreads = omp_get_num_threads();
+        uint64_t tileBegin = (nTiles * thread) / nThreads;
+        uint64_t tileEnd = (nTiles * (thread + 1)) / nThreads;
+        std::vector<Goldilocks::Element> scratch(scratchSize);
+        for (uint64_t tile = tileBegin; tile < tileEnd; tile++)
+        {
+            copyTile(tile * tileRows, scratch.data());
+            for (uint64_t i = tile * tileRows; i < (tile + 1) * tileRows; i += nrowsBatch)
+            {
+                batchFunction(i, scratch.data());
+            }
+        }
+    }
+}
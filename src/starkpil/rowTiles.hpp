@@ -0,0 +1,74 @@
+#ifndef ROW_TILES_HPP
+#define ROW_TILES_HPP
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+#include "goldilocks_base_field.hpp"
+
+struct StepsParserArgs;
+
+// Arguments of the ops of a chelpers parser rewritten by RowTiles::remapArgs(), to read the tiled sections from the
+// scratch buffer of every tile
+struct RowTilesArgs
+{
+    std::vector<uint64_t> args;
+    uint64_t constOffset; // Offset in the scratch buffer of the constant pols of the tile, read with their columns
+};
+
+// Runs the rows of a domain in tiles of rows, every thread going through a contiguous range of tiles.
+// Before computing a tile, the rows of the tile of every row-major section, and their next rows
+// (wrapping around the end of the domain), are copied into a compact scratch buffer of the thread, so
+// that the wide strided gathers of every row hit the L2 cache.  In the scratch buffer every section
+// takes 2 * tileRows rows of its width: the rows of the tile, and then their next rows
+class RowTiles
+{
+public:
+    struct Section
+    {
+        const Goldilocks::Element *pAddress;
+        uint64_t rowSize; // Elements of every row
+    };
+
+private:
+    uint64_t nrows;
+    uint64_t nextRows;
+    std::vector<Section> sections;
+    std::vector<uint64_t> offsets; // Offset of every section in the scratch buffer
+    uint64_t scratchSize;
+
+    void copyTile(uint64_t row0, Goldilocks::Element *pScratch) const;
+
+public:
+    uint64_t tileRows;
+
+    // l2Size is the L2 cache size in bytes, which holds the scratch buffer and the rest of the work
+    RowTiles(uint64_t nrows, uint64_t nextRows, uint64_t l2Size, uint64_t nrowsBatch, const std::vector<Section> &sections);
+
+    const std::vector<Section> &getSections(void) const { return sections; };
+    uint64_t getNrows(void) const { return nrows; };
+    uint64_t getNextRows(void) const { return nextRows; };
+
+    // Offset in the scratch buffer of the first row of the tile of a section, or of its next row
+    uint64_t scratchOffset(uint64_t section, bool bNext) const { return offsets[section] + (bNext ? tileRows * sections[section].rowSize : 0); };
+
+    // Rewrites the arguments of the ops of a chelpers parser whose rows i of the pols at pPols and of the constant
+    // pols at pConstPols are the sections of the tiles, so that the parser reads them from the scratch buffer at row
+    // i % tileRows instead.  Every opcode describes its arguments with a character each:
+    //   'P' offset in pPols of a section, mapped to its offset in the scratch buffer
+    //   'S' row size of the previous 'P', which must be the one of its section
+    //   'C' column of the constant pols, which are read from the scratch buffer at tileArgs.constOffset
+    //   'H' row shift of the previous 'P' or 'C': 0, or nextRows, mapped to tileRows
+    //   'N' rows of the domain of the previous 'P' or 'C', mapped to the 2 * tileRows rows of the tile
+    //   'W' offset in pPols of a row written, which cannot be tiled
+    //   '-' any other argument, which is kept
+    // Returns false if the parser cannot read the tiles, with the reason
+    bool remapArgs(const StepsParserArgs &parserArgs, const Goldilocks::Element *pPols, const Goldilocks::Element *pConstPols, RowTilesArgs &tileArgs, std::string &reason) const;
+
+    // Calls batchFunction(i, pScratch) for every row i multiple of nrowsBatch, which must divide tileRows,
+    // with the scratch buffer of the tile of row i, which starts at a multiple of tileRows
+    void run(uint64_t nrowsBatch, const std::function<void(uint64_t, Goldilocks::Element *)> &batchFunction) const;
+};
+
+#endif
@@ -20,6 +20,7 @@ using json = nlohmann::json;
 #include "timer.hpp"
 #include "execFile.hpp"
 #include "commit_pols_starks.hpp"
+#include "zkin_witness.hpp"
 
 using namespace std;
 
@@ -314,7 +315,7 @@ namespace CircomRecursive1
     inStream.close();
     loadJsonImpl(ctx, j);
   }
-  void getCommitedPols(CommitPolsStarks *commitPols, const std::string zkevmVerifier, const std::string execFile, nlohmann::json &zkin, uint64_t N)
+  void getCommitedPols(CommitPolsStarks *commitPols, const std::string zkevmVerifier, const std::string execFile, Zkin &zkin, uint64_t N)
   {
     //-------------------------------------------
     // Verifier stark proof
@@ -322,16 +323,16 @@ namespace CircomRecursive1
     TimerStart(CIRCOM_LOAD_CIRCUIT_BATCH_PROOF_2);
     Circom_Circuit *circuit = loadCircuit(zkevmVerifier);
     TimerStopAndLog(CIRCOM_LOAD_CIRCUIT_BATCH_PROOF_2);
-    TimerStart(CIRCOM_LOAD_JSON_BATCH_PROOF);
+    TimerStart(CIRCOM_LOAD_ZKIN_BATCH_PROOF);
     Circom_CalcWit *ctx = new Circom_CalcWit(circuit);
 
-    loadJsonImpl(ctx, zkin);
+    zkin2witness(ctx, zkin, fnv1a);
     if (ctx->getRemaingInputsToBeSet() != 0)
     {
       cerr << "Error: Prover::genBatchProof() Not all inputs have been set. Only " << get_main_input_signal_no() - ctx->getRemaingInputsToBeSet() << " out of " << get_main_input_signal_no() << endl;
       exitProcess();
     }
-    TimerStopAndLog(CIRCOM_LOAD_JSON_BATCH_PROOF);
+    TimerStopAndLog(CIRCOM_LOAD_ZKIN_BATCH_PROOF);
     //-------------------------------------------
     // Compute witness and commited pols
     //-------------------------------------------
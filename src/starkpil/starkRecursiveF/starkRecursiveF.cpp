@@ -219,7 +219,7 @@ void StarkRecursiveF::genProof( FRIProofC12 &proof, Goldilocks::Element publicIn
     TimerStopAndLog(STARK_RECURSIVE_F_STEP_2_CALCULATE_EXPS);
 
     TimerStart(STARK_RECURSIVE_F_STEP_2_CALCULATEH1H2);
-#pragma omp parallel for
+    assert(H1H2::getBufferSize(N) <= starkInfo.mapSectionsN.section[eSection::cm1_n] * NExtended * FIELD_EXTENSION);
     for (uint64_t i = 0; i < starkInfo.puCtx.size(); i++)
     {
         Polinomial fPol = starkInfo.getPolinomial(mem, starkInfo.exp2pol[to_string(starkInfo.puCtx[i].fExpId)]);
@@ -227,7 +227,7 @@ void StarkRecursiveF::genProof( FRIProofC12 &proof, Goldilocks::Element publicIn
         Polinomial h1 = starkInfo.getPolinomial(mem, starkInfo.cm_n[numCommited + i * 2]);
         Polinomial h2 = starkInfo.getPolinomial(mem, starkInfo.cm_n[numCommited + i * 2 + 1]);
 
-        Polinomial::calculateH1H2(h1, h2, fPol, tPol);
+        H1H2::calculate(h1, h2, fPol, tPol, i, (uint64_t *)pBuffer, starkInfo.mapSectionsN.section[eSection::cm1_n] * NExtended * FIELD_EXTENSION);
     }
     numCommited = numCommited + starkInfo.puCtx.size() * 2;
     TimerStopAndLog(STARK_RECURSIVE_F_STEP_2_CALCULATEH1H2);
@@ -4,6 +4,7 @@
 #include "stark_info.hpp"
 #include "transcriptBN128.hpp"
 #include "zhInv.hpp"
+#include "h1h2.hpp"
 #include "merklehash_goldilocks.hpp"
 #include "polinomial.hpp"
 #include "ntt_goldilocks.hpp"
@@ -45,14 +45,22 @@ void Starks::genProof(FRIProof &proof, Goldilocks::Element *publicInputs, Steps
     //--------------------------------
     TimerStart(STARK_STEP_1);
     TimerStart(STARK_STEP_1_LDE_AND_MERKLETREE);
-    TimerStart(STARK_STEP_1_LDE);
-
-    ntt.extendPol(p_cm1_2ns, p_cm1_n, NExtended, N, starkInfo.mapSectionsN.section[eSection::cm1_n], p_cm2_2ns);
-    TimerStopAndLog(STARK_STEP_1_LDE);
-    TimerStart(STARK_STEP_1_MERKLETREE);
-    treesGL[0]->merkelize();
+    if (config.pipelineLdeAndMerkle)
+    {
+        TimerStart(STARK_STEP_1_LDE_AND_MERKLETREE_PIPELINE);
+        LDEMerkle::extendAndMerkelize(ntt, *treesGL[0], p_cm1_2ns, p_cm1_n, NExtended, N, starkInfo.mapSectionsN.section[eSection::cm1_n], p_cm2_2ns);
+        TimerStopAndLog(STARK_STEP_1_LDE_AND_MERKLETREE_PIPELINE);
+    }
+    else
+    {
+        TimerStart(STARK_STEP_1_LDE);
+        ntt.extendPol(p_cm1_2ns, p_cm1_n, NExtended, N, starkInfo.mapSectionsN.section[eSection::cm1_n], p_cm2_2ns);
+        TimerStopAndLog(STARK_STEP_1_LDE);
+        TimerStart(STARK_STEP_1_MERKLETREE);
+        treesGL[0]->merkelize();
+        TimerStopAndLog(STARK_STEP_1_MERKLETREE);
+    }
     treesGL[0]->getRoot(root0.address());
-    TimerStopAndLog(STARK_STEP_1_MERKLETREE);
     std::cout << "MerkleTree rootGL 0: [ " << root0.toString(4) << " ]" << std::endl;
     transcript.put(root0.address(), HASH_SIZE);
     TimerStopAndLog(STARK_STEP_1_LDE_AND_MERKLETREE);
@@ -69,7 +77,10 @@ void Starks::genProof(FRIProof &proof, Goldilocks::Element *publicInputs, Steps
     // Calculate exps
     if (nrowsStepBatch > 1)
     {
-        steps->step2prev_parser_first_avx(params, N, nrowsStepBatch);
+        if ((pChelpersJit == NULL) || !pChelpersJit->run("step2prev", params, N))
+        {
+            steps->step2prev_parser_first_avx(params, N, nrowsStepBatch);
+        }
     }
     else
     {
@@ -81,54 +92,37 @@ void Starks::genProof(FRIProof &proof, Goldilocks::Element *publicInputs, Steps
     }
     TimerStopAndLog(STARK_STEP_2_CALCULATE_EXPS);
 
-    TimerStart(STARK_STEP_2_CALCULATEH1H2_TRANSPOSE);
-    Polinomial *transPols = transposeH1H2Columns(pAddress, numCommited, pBuffer);
-    TimerStopAndLog(STARK_STEP_2_CALCULATEH1H2_TRANSPOSE);
     TimerStart(STARK_STEP_2_CALCULATEH1H2);
-
-    uint64_t nthreads = starkInfo.puCtx.size();
-    if (nthreads == 0)
-    {
-        nthreads += 1;
-    }
-    uint64_t buffSize = 8 * starkInfo.puCtx.size() * N;
-    assert(buffSize <= starkInfo.mapSectionsN.section[eSection::cm3_2ns] * NExtended);
-    uint64_t *mam = (uint64_t *)pAddress;
-    uint64_t *pbufferH = &mam[starkInfo.mapOffsets.section[eSection::cm3_2ns]];
-    uint64_t buffSizeThread = buffSize / nthreads;
-
-#pragma omp parallel for num_threads(nthreads)
+    assert(H1H2::getBufferSize(N) <= bufferSize);
     for (uint64_t i = 0; i < starkInfo.puCtx.size(); i++)
     {
-        int indx1 = 4 * i;
-        if (transPols[indx1 + 2].dim() == 1)
-        {
-            uint64_t buffSizeThreadValues = 3 * N;
-            uint64_t buffSizeThreadKeys = buffSizeThread - buffSizeThreadValues;
-            Polinomial::calculateH1H2_opt1(transPols[indx1 + 2], transPols[indx1 + 3], transPols[indx1], transPols[indx1 + 1], i, &pbufferH[omp_get_thread_num() * buffSizeThread], buffSizeThreadKeys, buffSizeThreadValues);
-        }
-        else
-        {
-            assert(transPols[indx1 + 2].dim() == 3);
-            uint64_t buffSizeThreadValues = 5 * N;
-            uint64_t buffSizeThreadKeys = buffSizeThread - buffSizeThreadValues;
-            Polinomial::calculateH1H2_opt3(transPols[indx1 + 2], transPols[indx1 + 3], transPols[indx1], transPols[indx1 + 1], i, &pbufferH[omp_get_thread_num() * buffSizeThread], buffSizeThreadKeys, buffSizeThreadValues);
-        }
+        Polinomial fPol = starkInfo.getPolinomial(mem, starkInfo.exp2pol[to_string(starkInfo.puCtx[i].fExpId)]);
+        Polinomial tPol = starkInfo.getPolinomial(mem, starkInfo.exp2pol[to_string(starkInfo.puCtx[i].tExpId)]);
+        Polinomial h1 = starkInfo.getPolinomial(mem, starkInfo.cm_n[numCommited + i * 2]);
+        Polinomial h2 = starkInfo.getPolinomial(mem, starkInfo.cm_n[numCommited + i * 2 + 1]);
+
+        H1H2::calculate(h1, h2, fPol, tPol, i, (uint64_t *)pBuffer, bufferSize);
     }
+    numCommited = numCommited + starkInfo.puCtx.size() * 2;
     TimerStopAndLog(STARK_STEP_2_CALCULATEH1H2);
 
-    TimerStart(STARK_STEP_2_CALCULATEH1H2_TRANSPOSE_2);
-    transposeH1H2Rows(pAddress, numCommited, transPols);
-    TimerStopAndLog(STARK_STEP_2_CALCULATEH1H2_TRANSPOSE_2);
-
     TimerStart(STARK_STEP_2_LDE_AND_MERKLETREE);
-    TimerStart(STARK_STEP_2_LDE);
-    ntt.extendPol(p_cm2_2ns, p_cm2_n, NExtended, N, starkInfo.mapSectionsN.section[eSection::cm2_n], pBuffer);
-    TimerStopAndLog(STARK_STEP_2_LDE);
-    TimerStart(STARK_STEP_2_MERKLETREE);
-    treesGL[1]->merkelize();
+    if (config.pipelineLdeAndMerkle)
+    {
+        TimerStart(STARK_STEP_2_LDE_AND_MERKLETREE_PIPELINE);
+        LDEMerkle::extendAndMerkelize(ntt, *treesGL[1], p_cm2_2ns, p_cm2_n, NExtended, N, starkInfo.mapSectionsN.section[eSection::cm2_n], pBuffer);
+        TimerStopAndLog(STARK_STEP_2_LDE_AND_MERKLETREE_PIPELINE);
+    }
+    else
+    {
+        TimerStart(STARK_STEP_2_LDE);
+        ntt.extendPol(p_cm2_2ns, p_cm2_n, NExtended, N, starkInfo.mapSectionsN.section[eSection::cm2_n], pBuffer);
+        TimerStopAndLog(STARK_STEP_2_LDE);
+        TimerStart(STARK_STEP_2_MERKLETREE);
+        treesGL[1]->merkelize();
+        TimerStopAndLog(STARK_STEP_2_MERKLETREE);
+    }
     treesGL[1]->getRoot(root1.address());
-    TimerStopAndLog(STARK_STEP_2_MERKLETREE);
     std::cout << "MerkleTree rootGL 1: [ " << root1.toString(4) << " ]" << std::endl;
     transcript.put(root1.address(), HASH_SIZE);
 
@@ -145,7 +139,10 @@ void Starks::genProof(FRIProof &proof, Goldilocks::Element *publicInputs, Steps
 
     if (nrowsStepBatch > 1)
     {
-        steps->step3prev_parser_first_avx(params, N, nrowsStepBatch);
+        if ((pChelpersJit == NULL) || !pChelpersJit->run("step3prev", params, N))
+        {
+            steps->step3prev_parser_first_avx(params, N, nrowsStepBatch);
+        }
     }
     else
     {
@@ -157,28 +154,38 @@ void Starks::genProof(FRIProof &proof, Goldilocks::Element *publicInputs, Steps
     }
     TimerStopAndLog(STARK_STEP_3_CALCULATE_EXPS);
 
-    TimerStart(STARK_STEP_3_CALCULATE_Z_TRANSPOSE);
-    Polinomial *newpols_ = transposeZColumns(pAddress, numCommited, pBuffer);
-    TimerStopAndLog(STARK_STEP_3_CALCULATE_Z_TRANSPOSE);
-
     TimerStart(STARK_STEP_3_CALCULATE_Z);
-    u_int64_t numpols = starkInfo.ciCtx.size() + starkInfo.peCtx.size() + starkInfo.puCtx.size();
-#pragma omp parallel for
-    for (uint64_t i = 0; i < numpols; i++)
+    for (uint64_t i = 0; i < starkInfo.puCtx.size(); i++)
     {
-        int indx1 = 3 * i;
-        Polinomial::calculateZ(newpols_[indx1 + 2], newpols_[indx1], newpols_[indx1 + 1]);
+        Polinomial pNum = starkInfo.getPolinomial(mem, starkInfo.exp2pol[to_string(starkInfo.puCtx[i].numId)]);
+        Polinomial pDen = starkInfo.getPolinomial(mem, starkInfo.exp2pol[to_string(starkInfo.puCtx[i].denId)]);
+        Polinomial z = starkInfo.getPolinomial(mem, starkInfo.cm_n[numCommited++]);
+        Polinomial::calculateZ(z, pNum, pDen);
+    }
+    for (uint64_t i = 0; i < starkInfo.peCtx.size(); i++)
+    {
+        Polinomial pNum = starkInfo.getPolinomial(mem, starkInfo.exp2pol[to_string(starkInfo.peCtx[i].numId)]);
+        Polinomial pDen = starkInfo.getPolinomial(mem, starkInfo.exp2pol[to_string(starkInfo.peCtx[i].denId)]);
+        Polinomial z = starkInfo.getPolinomial(mem, starkInfo.cm_n[numCommited++]);
+        Polinomial::calculateZ(z, pNum, pDen);
+    }
+    for (uint64_t i = 0; i < starkInfo.ciCtx.size(); i++)
+    {
+        Polinomial pNum = starkInfo.getPolinomial(mem, starkInfo.exp2pol[to_string(starkInfo.ciCtx[i].numId)]);
+        Polinomial pDen = starkInfo.getPolinomial(mem, starkInfo.exp2pol[to_string(starkInfo.ciCtx[i].denId)]);
+        Polinomial z = starkInfo.getPolinomial(mem, starkInfo.cm_n[numCommited++]);
+        Polinomial::calculateZ(z, pNum, pDen);
     }
     TimerStopAndLog(STARK_STEP_3_CALCULATE_Z);
-    TimerStart(STARK_STEP_3_CALCULATE_Z_TRANSPOSE_2);
-    transposeZRows(pAddress, numCommited, newpols_);
-    TimerStopAndLog(STARK_STEP_3_CALCULATE_Z_TRANSPOSE_2);
     TimerStart(STARK_STEP_3_CALCULATE_EXPS_2);
 
     // Calculate exps
     if (nrowsStepBatch > 1)
     {
-        steps->step3_parser_first_avx(params, N, nrowsStepBatch);
+        if ((pChelpersJit == NULL) || !pChelpersJit->run("step3", params, N))
+        {
+            steps->step3_parser_first_avx(params, N, nrowsStepBatch);
+        }
     }
     else
     {
@@ -191,13 +198,22 @@ void Starks::genProof(FRIProof &proof, Goldilocks::Element *publicInputs, Steps
 
     TimerStopAndLog(STARK_STEP_3_CALCULATE_EXPS_2);
     TimerStart(STARK_STEP_3_LDE_AND_MERKLETREE);
-    TimerStart(STARK_STEP_3_LDE);
-    ntt.extendPol(p_cm3_2ns, p_cm3_n, NExtended, N, starkInfo.mapSectionsN.section[eSection::cm3_n], pBuffer);
-    TimerStopAndLog(STARK_STEP_3_LDE);
-    TimerStart(STARK_STEP_3_MERKLETREE);
-    treesGL[2]->merkelize();
+    if (config.pipelineLdeAndMerkle)
+    {
+        TimerStart(STARK_STEP_3_LDE_AND_MERKLETREE_PIPELINE);
+        LDEMerkle::extendAndMerkelize(ntt, *treesGL[2], p_cm3_2ns, p_cm3_n, NExtended, N, starkInfo.mapSectionsN.section[eSection::cm3_n], pBuffer);
+        TimerStopAndLog(STARK_STEP_3_LDE_AND_MERKLETREE_PIPELINE);
+    }
+    else
+    {
+        TimerStart(STARK_STEP_3_LDE);
+        ntt.extendPol(p_cm3_2ns, p_cm3_n, NExtended, N, starkInfo.mapSectionsN.section[eSection::cm3_n], pBuffer);
+        TimerStopAndLog(STARK_STEP_3_LDE);
+        TimerStart(STARK_STEP_3_MERKLETREE);
+        treesGL[2]->merkelize();
+        TimerStopAndLog(STARK_STEP_3_MERKLETREE);
+    }
     treesGL[2]->getRoot(root2.address());
-    TimerStopAndLog(STARK_STEP_3_MERKLETREE);
     std::cout << "MerkleTree rootGL 2: [ " << root2.toString(4) << " ]" << std::endl;
     transcript.put(root2.address(), HASH_SIZE);
     TimerStopAndLog(STARK_STEP_3_LDE_AND_MERKLETREE);
@@ -219,7 +235,19 @@ void Starks::genProof(FRIProof &proof, Goldilocks::Element *publicInputs, Steps
 
     if (nrowsStepBatch > 1)
     {
-        steps->step42ns_parser_first_avx(params, NExtended, nrowsStepBatch);
+        if ((pChelpersJit == NULL) || !pChelpersJit->run("step42ns", params, NExtended))
+        {
+            StepsParserArgs parserArgs;
+            RowTilesArgs tileArgs;
+            if ((pTiles4 != NULL) && steps->step42ns_parser_args(parserArgs) && getTileArgs(*pTiles4, parserArgs, "step42ns", tileArgs))
+            {
+                steps->step42ns_parser_first_avx_tiles(params, *pTiles4, tileArgs, nrowsStepBatch);
+            }
+            else
+            {
+                steps->step42ns_parser_first_avx(params, NExtended, nrowsStepBatch);
+            }
+        }
     }
     else
     {
@@ -341,7 +369,19 @@ void Starks::genProof(FRIProof &proof, Goldilocks::Element *publicInputs, Steps
     TimerStart(STARK_STEP_5_CALCULATE_EXPS);
     if (nrowsStepBatch > 1)
     {
-        steps->step52ns_parser_first_avx(params, NExtended, nrowsStepBatch);
+        if ((pChelpersJit == NULL) || !pChelpersJit->run("step52ns", params, NExtended))
+        {
+            StepsParserArgs parserArgs;
+            RowTilesArgs tileArgs;
+            if ((pTiles5 != NULL) && steps->step52ns_parser_args(parserArgs) && getTileArgs(*pTiles5, parserArgs, "step52ns", tileArgs))
+            {
+                steps->step52ns_parser_first_avx_tiles(params, *pTiles5, tileArgs, nrowsStepBatch);
+            }
+            else
+            {
+                steps->step52ns_parser_first_avx(params, NExtended, nrowsStepBatch);
+            }
+        }
     }
     else
     {
@@ -368,156 +408,6 @@ void Starks::genProof(FRIProof &proof, Goldilocks::Element *publicInputs, Steps
     TimerStopAndLog(STARK_STEP_FRI);
 }
 
-Polinomial *Starks::transposeH1H2Columns(void *pAddress, uint64_t &numCommited, Goldilocks::Element *pBuffer)
-{
-    Goldilocks::Element *mem = (Goldilocks::Element *)pAddress;
-
-    u_int64_t stride_pol0 = N * FIELD_EXTENSION + 8;
-    uint64_t tot_pols0 = 4 * starkInfo.puCtx.size();
-    Polinomial *transPols = new Polinomial[tot_pols0];
-
-    assert(starkInfo.mapSectionsN.section[eSection::cm1_n] * NExtended * FIELD_EXTENSION >= 3 * tot_pols0 * N);
-
-    // #pragma omp parallel for
-    for (uint64_t i = 0; i < starkInfo.puCtx.size(); i++)
-    {
-        Polinomial fPol = starkInfo.getPolinomial(mem, starkInfo.exp2pol[to_string(starkInfo.puCtx[i].fExpId)]);
-        Polinomial tPol = starkInfo.getPolinomial(mem, starkInfo.exp2pol[to_string(starkInfo.puCtx[i].tExpId)]);
-        Polinomial h1 = starkInfo.getPolinomial(mem, starkInfo.cm_n[numCommited + i * 2]);
-        Polinomial h2 = starkInfo.getPolinomial(mem, starkInfo.cm_n[numCommited + i * 2 + 1]);
-
-        uint64_t indx = i * 4;
-        transPols[indx].potConstruct(&(pBuffer[indx * stride_pol0]), fPol.degree(), fPol.dim(), fPol.dim());
-        Polinomial::copy(transPols[indx], fPol);
-        indx++;
-        transPols[indx].potConstruct(&(pBuffer[indx * stride_pol0]), tPol.degree(), tPol.dim(), tPol.dim());
-        Polinomial::copy(transPols[indx], tPol);
-        indx++;
-
-        transPols[indx].potConstruct(&(pBuffer[indx * stride_pol0]), h1.degree(), h1.dim(), h1.dim());
-        indx++;
-
-        transPols[indx].potConstruct(&(pBuffer[indx * stride_pol0]), h2.degree(), h2.dim(), h2.dim());
-    }
-    return transPols;
-}
-void Starks::transposeH1H2Rows(void *pAddress, uint64_t &numCommited, Polinomial *transPols)
-{
-    Goldilocks::Element *mem = (Goldilocks::Element *)pAddress;
-
-    for (uint64_t i = 0; i < starkInfo.puCtx.size(); i++)
-    {
-        int indx1 = 4 * i + 2;
-        int indx2 = 4 * i + 3;
-        Polinomial h1 = starkInfo.getPolinomial(mem, starkInfo.cm_n[numCommited + i * 2]);
-        Polinomial h2 = starkInfo.getPolinomial(mem, starkInfo.cm_n[numCommited + i * 2 + 1]);
-        Polinomial::copy(h1, transPols[indx1]);
-        Polinomial::copy(h2, transPols[indx2]);
-    }
-    if (starkInfo.puCtx.size() > 0)
-    {
-        delete[] transPols;
-    }
-    numCommited = numCommited + starkInfo.puCtx.size() * 2;
-}
-Polinomial *Starks::transposeZColumns(void *pAddress, uint64_t &numCommited, Goldilocks::Element *pBuffer)
-{
-    Goldilocks::Element *mem = (Goldilocks::Element *)pAddress;
-
-    u_int64_t stride_pol_ = N * FIELD_EXTENSION + 8; // assuming all polinomials have same degree
-    uint64_t tot_pols = 3 * (starkInfo.puCtx.size() + starkInfo.peCtx.size() + starkInfo.ciCtx.size());
-    Polinomial *newpols_ = new Polinomial[tot_pols];
-    assert(starkInfo.mapSectionsN.section[eSection::cm1_n] * NExtended * FIELD_EXTENSION >= tot_pols * stride_pol_);
-
-    if (pBuffer == NULL || newpols_ == NULL)
-    {
-        cout << "memory problems!" << endl;
-        exit(1);
-    }
-
-    // #pragma omp parallel for (better without)
-    for (uint64_t i = 0; i < starkInfo.puCtx.size(); i++)
-    {
-        Polinomial pNum = starkInfo.getPolinomial(mem, starkInfo.exp2pol[to_string(starkInfo.puCtx[i].numId)]);
-        Polinomial pDen = starkInfo.getPolinomial(mem, starkInfo.exp2pol[to_string(starkInfo.puCtx[i].denId)]);
-        Polinomial z = starkInfo.getPolinomial(mem, starkInfo.cm_n[numCommited + i]);
-        u_int64_t indx = i * 3;
-        newpols_[indx].potConstruct(&(pBuffer[indx * stride_pol_]), pNum.degree(), pNum.dim(), pNum.dim());
-        Polinomial::copy(newpols_[indx], pNum);
-        indx++;
-        assert(pNum.degree() <= N);
-
-        newpols_[indx].potConstruct(&(pBuffer[indx * stride_pol_]), pDen.degree(), pDen.dim(), pDen.dim());
-        Polinomial::copy(newpols_[indx], pDen);
-        indx++;
-        assert(pDen.degree() <= N);
-
-        newpols_[indx].potConstruct(&(pBuffer[indx * stride_pol_]), z.degree(), z.dim(), z.dim());
-        assert(z.degree() <= N);
-    }
-    numCommited += starkInfo.puCtx.size();
-    u_int64_t offset = 3 * starkInfo.puCtx.size();
-    for (uint64_t i = 0; i < starkInfo.peCtx.size(); i++)
-    {
-        Polinomial pNum = starkInfo.getPolinomial(mem, starkInfo.exp2pol[to_string(starkInfo.peCtx[i].numId)]);
-        Polinomial pDen = starkInfo.getPolinomial(mem, starkInfo.exp2pol[to_string(starkInfo.peCtx[i].denId)]);
-        Polinomial z = starkInfo.getPolinomial(mem, starkInfo.cm_n[numCommited + i]);
-        u_int64_t indx = 3 * i + offset;
-        newpols_[indx].potConstruct(&(pBuffer[indx * stride_pol_]), pNum.degree(), pNum.dim(), pNum.dim());
-        Polinomial::copy(newpols_[indx], pNum);
-        indx++;
-        assert(pNum.degree() <= N);
-
-        newpols_[indx].potConstruct(&(pBuffer[indx * stride_pol_]), pDen.degree(), pDen.dim(), pDen.dim());
-        Polinomial::copy(newpols_[indx], pDen);
-        indx++;
-        assert(pDen.degree() <= N);
-
-        newpols_[indx].potConstruct(&(pBuffer[indx * stride_pol_]), z.degree(), z.dim(), z.dim());
-        assert(z.degree() <= N);
-    }
-    numCommited += starkInfo.peCtx.size();
-    offset += 3 * starkInfo.peCtx.size();
-    for (uint64_t i = 0; i < starkInfo.ciCtx.size(); i++)
-    {
-
-        Polinomial pNum = starkInfo.getPolinomial(mem, starkInfo.exp2pol[to_string(starkInfo.ciCtx[i].numId)]);
-        Polinomial pDen = starkInfo.getPolinomial(mem, starkInfo.exp2pol[to_string(starkInfo.ciCtx[i].denId)]);
-        Polinomial z = starkInfo.getPolinomial(mem, starkInfo.cm_n[numCommited + i]);
-        u_int64_t indx = 3 * i + offset;
-
-        newpols_[indx].potConstruct(&(pBuffer[indx * stride_pol_]), pNum.degree(), pNum.dim(), pNum.dim());
-        Polinomial::copy(newpols_[indx], pNum);
-        indx++;
-        assert(pNum.degree() <= N);
-
-        newpols_[indx].potConstruct(&(pBuffer[indx * stride_pol_]), pDen.degree(), pDen.dim(), pDen.dim());
-        Polinomial::copy(newpols_[indx], pDen);
-        indx++;
-        assert(pDen.degree() <= N);
-
-        newpols_[indx].potConstruct(&(pBuffer[indx * stride_pol_]), z.degree(), z.dim(), z.dim());
-        assert(z.degree() <= N);
-    }
-    numCommited += starkInfo.ciCtx.size();
-    numCommited -= starkInfo.ciCtx.size() + starkInfo.peCtx.size() + starkInfo.puCtx.size();
-    return newpols_;
-}
-void Starks::transposeZRows(void *pAddress, uint64_t &numCommited, Polinomial *transPols)
-{
-    u_int64_t numpols = starkInfo.ciCtx.size() + starkInfo.peCtx.size() + starkInfo.puCtx.size();
-    Goldilocks::Element *mem = (Goldilocks::Element *)pAddress;
-    for (uint64_t i = 0; i < numpols; i++)
-    {
-        int indx1 = 3 * i;
-        Polinomial z = starkInfo.getPolinomial(mem, starkInfo.cm_n[numCommited + i]);
-        Polinomial::copy(z, transPols[indx1 + 2]);
-    }
-    if (numpols > 0)
-    {
-        delete[] transPols;
-    }
-}
 void Starks::evmap(void *pAddress, Polinomial &evals, Polinomial &LEv, Polinomial &LpEv)
 {
     Goldilocks::Element *mem = (Goldilocks::Element *)pAddress;
@@ -632,3 +522,14 @@ void Starks::evmap(void *pAddress, Polinomial &evals, Polinomial &LEv, Polinomia
     }
     free(evals_acc);
 }
+
+bool Starks::getTileArgs(const RowTiles &tiles, const StepsParserArgs &parserArgs, const string &step, RowTilesArgs &tileArgs)
+{
+    string reason;
+    if (!tiles.remapArgs(parserArgs, mem, (Goldilocks::Element *)pConstPolsAddress2ns, tileArgs, reason))
+    {
+        cout << "Starks::genProof() " << step << " runs without tiles, since its parser cannot read them: " << reason << endl;
+        return false;
+    }
+    return true;
+}
@@ -4,6 +4,7 @@
 #include <algorithm>
 #include "config.hpp"
 #include "utils.hpp"
+#include "zkassert.hpp"
 #include "timer.hpp"
 #include "constant_pols_starks.hpp"
 #include "friProof.hpp"
@@ -11,10 +12,15 @@
 #include "friProve.hpp"
 #include "transcript.hpp"
 #include "zhInv.hpp"
+#include "h1h2.hpp"
+#include "ldeMerkle.hpp"
 #include "steps.hpp"
+#include "chelpersJit.hpp"
+#include "rowTiles.hpp"
 
 #define STARK_C12_A_NUM_TREES 5
 #define NUM_CHALLENGES 8
+#define STARKS_TILE_NROWS_BATCH 8 // Rows of the largest batch of the chelpers parsers run in the tiles
 
 struct StarkFiles
 {
@@ -30,6 +36,7 @@ public:
     const Config &config;
     StarkInfo starkInfo;
     uint64_t nrowsStepBatch;
+    ChelpersJit *pChelpersJit; // If not NULL, runs the steps instead of the parsers of the Steps
 
 private:
     void *pConstPolsAddress;
@@ -61,13 +68,20 @@ private:
     Goldilocks::Element *p_q_2ns;
     Goldilocks::Element *p_f_2ns;
     Goldilocks::Element *pBuffer;
+    uint64_t bufferSize; // Elements of the region behind pBuffer, up to the end of the memory at pAddress
+
+    // Tiles of the rows of steps 4 and 5, if config.stepsTileL2Size is set, or else NULL
+    RowTiles *pTiles4;
+    RowTiles *pTiles5;
 
     void *pAddress;
 
     Polinomial x;
 
 public:
-    Starks(const Config &config, StarkFiles starkFiles, void *_pAddress) : config(config),
+    // _memSize is the size in bytes of the memory at _pAddress, where the committed polynomials are
+    // followed by the buffer used by the steps
+    Starks(const Config &config, StarkFiles starkFiles, void *_pAddress, uint64_t _memSize) : config(config),
                                                                            starkInfo(config, starkFiles.zkevmStarkInfo),
                                                                            starkFiles(starkFiles),
                                                                            zi(config.generateProof() ? starkInfo.starkStruct.nBits : 0,
@@ -82,6 +96,10 @@ public:
                                                                            x(config.generateProof() ? N << (starkInfo.starkStruct.nBitsExt - starkInfo.starkStruct.nBits) : 0, config.generateProof() ? FIELD_EXTENSION : 0)
     {
         nrowsStepBatch = 1;
+        pChelpersJit = NULL;
+        pTiles4 = NULL;
+        pTiles5 = NULL;
+        bufferSize = 0;
         // Avoid unnecessary initialization if we are not going to generate any proof
         if (!config.generateProof())
             return;
@@ -158,6 +176,8 @@ public:
 
         mem = (Goldilocks::Element *)pAddress;
         pBuffer = &mem[starkInfo.mapTotalN];
+        zkassert(_memSize >= starkInfo.mapTotalN * sizeof(Goldilocks::Element));
+        bufferSize = _memSize / sizeof(Goldilocks::Element) - starkInfo.mapTotalN;
 
         p_cm1_2ns = &mem[starkInfo.mapOffsets.section[eSection::cm1_2ns]];
         p_cm1_n = &mem[starkInfo.mapOffsets.section[eSection::cm1_n]];
@@ -185,6 +205,19 @@ public:
         treesGL[3] = new MerkleTreeGL(NExtended, starkInfo.mapSectionsN.section[eSection::cm4_2ns], cm4_2ns);
         treesGL[4] = new MerkleTreeGL((Goldilocks::Element *)pConstTreeAddress);
         TimerStopAndLog(MERKLE_TREE_ALLOCATION);
+
+        // The row-major sections gathered by every row of the extended domain in steps 4 and 5, with
+        // tiles that hold whole batches of any parser
+        if (config.stepsTileL2Size > 0)
+        {
+            vector<RowTiles::Section> sections = {{p_cm1_2ns, starkInfo.mapSectionsN.section[eSection::cm1_2ns]},
+                                                  {p_cm2_2ns, starkInfo.mapSectionsN.section[eSection::cm2_2ns]},
+                                                  {p_cm3_2ns, starkInfo.mapSectionsN.section[eSection::cm3_2ns]},
+                                                  {(Goldilocks::Element *)pConstPolsAddress2ns, starkInfo.nConstants}};
+            pTiles4 = new RowTiles(NExtended, 1 << extendBits, config.stepsTileL2Size, STARKS_TILE_NROWS_BATCH, sections);
+            sections.push_back({cm4_2ns, starkInfo.mapSectionsN.section[eSection::cm4_2ns]});
+            pTiles5 = new RowTiles(NExtended, 1 << extendBits, config.stepsTileL2Size, STARKS_TILE_NROWS_BATCH, sections);
+        }
     };
     ~Starks()
     {
@@ -216,14 +249,15 @@ public:
         {
             delete treesGL[i];
         }
+        delete pTiles4;
+        delete pTiles5;
     };
 
     void genProof(FRIProof &proof, Goldilocks::Element *publicInputs, Steps *steps);
 
-    Polinomial *transposeH1H2Columns(void *pAddress, uint64_t &numCommited, Goldilocks::Element *pBuffer);
-    void transposeH1H2Rows(void *pAddress, uint64_t &numCommited, Polinomial *transPols);
-    Polinomial *transposeZColumns(void *pAddress, uint64_t &numCommited, Goldilocks::Element *pBuffer);
-    void transposeZRows(void *pAddress, uint64_t &numCommited, Polinomial *transPols);
+    // Rewrites the arguments of the parser of a step to read the tiles; returns false if it cannot read them
+    bool getTileArgs(const RowTiles &tiles, const StepsParserArgs &parserArgs, const std::string &step, RowTilesArgs &tileArgs);
+
     void evmap(void *pAddress, Polinomial &evals, Polinomial &LEv, Polinomial &LpEv);
 };
 
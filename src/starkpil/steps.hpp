@@ -18,9 +18,26 @@ struct StepsParams
     Goldilocks::Element *f_2ns;
 };
 
+// The op and args arrays of the parser of a step, and the kinds of the arguments of every opcode, with a character per
+// argument, as described in RowTiles::remapArgs()
+struct StepsParserArgs
+{
+    const uint64_t *pOps;
+    uint64_t nOps;
+    const uint64_t *pArgs;
+    uint64_t nArgs;
+    const char *const *pOpcodeArgs;
+    uint64_t nOpcodes;
+};
+
+class RowTiles;
+struct RowTilesArgs;
+
 class Steps
 {
 public:
+    virtual ~Steps(){};
+
     virtual void step2prev_first(StepsParams &params, uint64_t i) = 0;
     virtual void step2prev_i(StepsParams &params, uint64_t i) = 0;
     virtual void step2prev_last(StepsParams &params, uint64_t i) = 0;
@@ -44,6 +61,8 @@ public:
     virtual void step42ns_parser_first(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch){};
     virtual void step42ns_parser_first_avx(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch){};
     virtual void step42ns_parser_first_avx_jump(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch){};
+    virtual void step42ns_parser_first_avx_tiles(StepsParams &params, const RowTiles &tiles, const RowTilesArgs &tileArgs, uint64_t nrowsBatch){};
+    virtual bool step42ns_parser_args(StepsParserArgs &parserArgs) { return false; };
 
     virtual void step52ns_first(StepsParams &params, uint64_t i) = 0;
     virtual void step52ns_i(StepsParams &params, uint64_t i) = 0;
@@ -51,6 +70,8 @@ public:
 
     virtual void step52ns_parser_first(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch){};
     virtual void step52ns_parser_first_avx(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch){};
+    virtual void step52ns_parser_first_avx_tiles(StepsParams &params, const RowTiles &tiles, const RowTilesArgs &tileArgs, uint64_t nrowsBatch){};
+    virtual bool step52ns_parser_args(StepsParserArgs &parserArgs) { return false; };
 };
 
 #endif // STEPS
@@ -81,10 +81,11 @@ void TranscriptBN128::_updateState()
     }
 
     Poseidon_opt p;
-    out.insert(out.end(), state.begin(), state.end());
-    out.insert(out.end(), pending.begin(), pending.end());
-
-    p.hash(out);
+    RawFr::Element elements[1][17];
+    elements[0][0] = state[0];
+    std::memcpy(&elements[0][1], &pending[0], 16 * sizeof(RawFr::Element));
+    p.hash(elements);
+    out.insert(out.end(), &elements[0][0], &elements[0][17]);
 
     state[0] = out[0];
     out3.clear();
@@ -33,12 +33,43 @@ public:
     void step42ns_parser_first(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch);
     void step42ns_parser_first_avx(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch);
     void step42ns_parser_first_avx_jump(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch);
+    void step42ns_parser_first_avx_tiles(StepsParams &params, const RowTiles &tiles, const RowTilesArgs &tileArgs, uint64_t nrowsBatch);
+    bool step42ns_parser_args(StepsParserArgs &parserArgs);
 
     void step52ns_first(StepsParams &params, uint64_t i);
     void step52ns_i(StepsParams &params, uint64_t i);
     void step52ns_last(StepsParams &params, uint64_t i);
     void step52ns_parser_first(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch);
     void step52ns_parser_first_avx(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch);
+    void step52ns_parser_first_avx_tiles(StepsParams &params, const RowTiles &tiles, const RowTilesArgs &tileArgs, uint64_t nrowsBatch);
+    bool step52ns_parser_args(StepsParserArgs &parserArgs);
+
+    // step42ns_parser_args(), step52ns_parser_args() and the kernels of the parsers above for ChelpersJit are
+    // generated at build time by gen_chelpers_jit.js
+    virtual void getJitKernels(std::map<std::string, ChelpersJitFunction> &kernels);
+};
+
+// The AVX2 parsers and kernels above widened by gen_chelpers_jit.js to ZKEVM_STEPS_AVX512_NROWS_BATCH rows per batch
+// with AVX-512, reading the same op and args arrays.  They are compiled with -mavx512f into ZKEVM_STEPS_AVX512_LIB,
+// which is only loaded on the CPUs that support it, and created by its ZKEVM_STEPS_AVX512_NEW function
+class ZkevmStepsAvx512 : public ZkevmSteps
+{
+public:
+    void step2prev_parser_first_avx(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch);
+    void step3prev_parser_first_avx(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch);
+    void step3_parser_first_avx(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch);
+    void step42ns_parser_first_avx(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch);
+    void step42ns_parser_first_avx_tiles(StepsParams &params, const RowTiles &tiles, const RowTilesArgs &tileArgs, uint64_t nrowsBatch);
+    void step52ns_parser_first_avx(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch);
+    void step52ns_parser_first_avx_tiles(StepsParams &params, const RowTiles &tiles, const RowTilesArgs &tileArgs, uint64_t nrowsBatch);
+
+    void getJitKernels(std::map<std::string, ChelpersJitFunction> &kernels);
 };
 
+#define ZKEVM_STEPS_AVX2_NROWS_BATCH 4
+#define ZKEVM_STEPS_AVX512_NROWS_BATCH 8
+#define ZKEVM_STEPS_AVX512_LIB "libzkevmchelpersavx512.so" // Looked for in the directory of the executable
+#define ZKEVM_STEPS_AVX512_NEW "zkevmStepsAvx512New"
+typedef ZkevmSteps *(*ZkevmStepsAvx512New)(void);
+
 #endif // STARKS_STEPS_HPP
@@ -1,5 +1,8 @@
 #include <iostream>
 #include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
 #include "database.hpp"
 #include "config.hpp"
 #include "scalar.hpp"
@@ -10,6 +13,7 @@
 #include <unistd.h>
 #include "timer.hpp"
 #include "statedb_singleton.hpp"
+#include "zkmax.hpp"
 
 #ifdef DATABASE_USE_CACHE
 
@@ -68,8 +72,11 @@ zkresult Database::read(const string &_key, vector<Goldilocks::Element> &value,
     key = stringToLower(key);
 
 #ifdef DATABASE_USE_CACHE
+    Goldilocks::Element keyFea[4];
+    if (useDBMTCache) string2fea(fr, key, keyFea);
+
     // If the key is found in local database (cached) simply return it
-    if ((useDBMTCache) && (Database::dbMTCache.find(key, value)))
+    if ((useDBMTCache) && (Database::dbMTCache.find(keyFea, value)))
     {
         // Add to the read log
         if (dbReadLog != NULL) dbReadLog->add(key, value);
@@ -80,23 +87,24 @@ zkresult Database::read(const string &_key, vector<Goldilocks::Element> &value,
 #endif
     if (useRemoteDB)
     {
-        // If multi write is enabled, flush pending data, since some previously written keys
-        // could be in the multi write string but flushed from the cache
-        if (config.dbMultiWrite)
+        // If multi write is enabled, the key could be pending to be written and evicted from the cache,
+        // so look for it in the multi write queues before reading it remotelly
+        string sData;
+        if (config.dbMultiWrite && readMultiWrite(key, sData))
         {
-            flush();
+            r = ZKR_SUCCESS;
+        }
+        else
+        {
+            r = readRemote(false, key, sData);
         }
-
-        // Otherwise, read it remotelly
-        string sData;
-        r = readRemote(false, key, sData);
         if (r == ZKR_SUCCESS)
         {
             string2fea(fr, sData, value);
 
 #ifdef DATABASE_USE_CACHE
             // Store it locally to avoid any future remote access for this key
-            if (useDBMTCache) Database::dbMTCache.add(key, value, update);
+            if (useDBMTCache) Database::dbMTCache.add(keyFea, value, update);
 #endif
 
             // Add to the read log
@@ -169,7 +177,9 @@ zkresult Database::write(const string &_key, const vector<Goldilocks::Element> &
     if ((r == ZKR_SUCCESS) && (useDBMTCache))
     {
         // Create in memory cache
-        Database::dbMTCache.add(key, value, update);
+        Goldilocks::Element keyFea[4];
+        string2fea(fr, key, keyFea);
+        Database::dbMTCache.add(keyFea, value, update);
     }
 #endif
 
@@ -187,6 +197,147 @@ zkresult Database::write(const string &_key, const vector<Goldilocks::Element> &
     return r;
 }
 
+zkresult Database::read(const Goldilocks::Element (&key)[4], Goldilocks::Element (&value)[12], DatabaseMap *dbReadLog, const bool update)
+{
+    // Check that it has been initialized before
+    if (!bInitialized)
+    {
+        cerr << "Error: Database::read() called uninitialized" << endl;
+        exitProcess();
+    }
+
+    zkresult r;
+
+#ifdef DATABASE_USE_CACHE
+    // If the key is found in local database (cached) simply return it
+    uint64_t size;
+    if ((useDBMTCache) && (Database::dbMTCache.find(key, value, size)))
+    {
+        // Add to the read log
+        if (dbReadLog != NULL) dbReadLog->add(key, value);
+
+        r = ZKR_SUCCESS;
+    }
+    else
+#endif
+    if (useRemoteDB)
+    {
+        // Keys are only converted to strings to access the remote database
+        string keyString = fea2string64(fr, key);
+
+        // If multi write is enabled, the key could be pending to be written and evicted from the cache,
+        // so look for it in the multi write queues before reading it remotelly
+        string sData;
+        if (config.dbMultiWrite && readMultiWrite(keyString, sData))
+        {
+            r = ZKR_SUCCESS;
+        }
+        else
+        {
+            r = readRemote(false, keyString, sData);
+        }
+        if (r == ZKR_SUCCESS)
+        {
+            vector<Goldilocks::Element> remoteValue;
+            string2fea(fr, sData, remoteValue);
+            if (remoteValue.size() > 12)
+            {
+                cerr << "Error: Database::read() got a remote value of size=" << remoteValue.size() << " for key=" << keyString << endl;
+                return ZKR_DB_ERROR;
+            }
+            for (uint64_t i = 0; i < 12; i++)
+            {
+                value[i] = (i < remoteValue.size()) ? remoteValue[i] : fr.zero();
+            }
+
+#ifdef DATABASE_USE_CACHE
+            // Store it locally to avoid any future remote access for this key
+            if (useDBMTCache) Database::dbMTCache.add(key, value, 12, update);
+#endif
+
+            // Add to the read log
+            if (dbReadLog != NULL) dbReadLog->add(key, value);
+        }
+    }
+    else
+    {
+        cerr << "Error: Database::read() requested a key that does not exist: " << fea2string64(fr, key) << endl;
+        r = ZKR_DB_KEY_NOT_FOUND;
+    }
+
+#ifdef LOG_DB_READ
+    cout << "Database::read()";
+    if (r != ZKR_SUCCESS)
+        cout << " ERROR=" << r << " (" << zkresult2string(r) << ")";
+    cout << " key=" << fea2string64(fr, key);
+    cout << " value=";
+    for (uint64_t i = 0; i < 12; i++)
+        cout << fr.toString(value[i], 16) << ":";
+    cout << endl;
+#endif
+
+    return r;
+}
+
+zkresult Database::write(const Goldilocks::Element (&key)[4], const Goldilocks::Element (&value)[12], const bool persistent, const bool update)
+{
+    // Check that it has  been initialized before
+    if (!bInitialized)
+    {
+        cerr << "Error: Database::write() called uninitialized" << endl;
+        exitProcess();
+    }
+
+    if (config.dbMultiWrite && !useDBMTCache && !persistent)
+    {
+        cerr << "Error: Database::write() called with multi-write active, cache disabled and no persistance in database, so there is no place to store the date" << endl;
+        return ZKR_DB_ERROR;
+    }
+
+    zkresult r;
+
+    if ( useRemoteDB
+#ifdef DATABASE_USE_CACHE
+         && persistent
+#endif
+         )
+    {
+        // Keys and values are only converted to strings to access the remote database
+        char valueString[12*16 + 1];
+        for (uint64_t i = 0; i < 12; i++)
+        {
+            snprintf(valueString + i*16, 17, "%016lx", fr.toU64(value[i]));
+        }
+
+        r = writeRemote(false, fea2string64(fr, key), string(valueString, 12*16), update);
+    }
+    else
+    {
+        r = ZKR_SUCCESS;
+    }
+
+#ifdef DATABASE_USE_CACHE
+    if ((r == ZKR_SUCCESS) && (useDBMTCache))
+    {
+        // Create in memory cache
+        Database::dbMTCache.add(key, value, 12, update);
+    }
+#endif
+
+#ifdef LOG_DB_WRITE
+    cout << "Database::write()";
+    if (r != ZKR_SUCCESS)
+        cout << " ERROR=" << r << " (" << zkresult2string(r) << ")";
+    cout << " key=" << fea2string64(fr, key);
+    cout << " value=";
+    for (uint64_t i = 0; i < 12; i++)
+        cout << fr.toString(value[i], 16) << ":";
+    cout << " persistent=" << persistent << " update=" << update << endl;
+#endif
+
+    return r;
+}
+
 void Database::initRemote(void)
 {
     TimerStart(DB_INIT_REMOTE);
@@ -396,6 +547,71 @@ zkresult Database::readRemote(bool bProgram, const string &key, string &value)
     return ZKR_SUCCESS;
 }
 
+zkresult Database::readRemoteBatch(const vector<string> &keys, unordered_map<string, string> &values)
+{
+    const string &tableName = config.dbNodesTableName;
+
+    if (config.logRemoteDbReads)
+    {
+        cout << "   Database::readRemoteBatch() table=" << tableName << " keys=" << keys.size() << endl;
+    }
+
+    if (keys.size() == 0)
+    {
+        return ZKR_SUCCESS;
+    }
+
+    // Get a free read db connection
+    DatabaseConnection * pDatabaseConnection = getConnection();
+
+    try
+    {
+        // Prepare the query
+        string query = "SELECT * FROM " + tableName + " WHERE hash = ANY (ARRAY[";
+        for (uint64_t i=0; i<keys.size(); i++)
+        {
+            if (i > 0) query += ",";
+            query += "E\'\\\\x" + keys[i] + "\'";
+        }
+        query += "]::BYTEA[]);";
+
+        pqxx::result rows;
+
+        // Start a transaction.
+        pqxx::nontransaction n(*(pDatabaseConnection->pConnection));
+
+        // Execute the query
+        rows = n.exec(query);
+
+        // Commit your transaction
+        n.commit();
+
+        // Process the result
+        for (uint64_t i=0; i<rows.size(); i++)
+        {
+            pqxx::row const row = rows[i];
+            if (row.size() != 2)
+            {
+                cerr << "Error: Database::readRemoteBatch() table="<< tableName << " got an invalid number of colums for the row: " << row.size() << endl;
+                exitProcess();
+            }
+            pqxx::field const fieldHash = row[0];
+            pqxx::field const fieldData = row[1];
+            values[removeBSXIfExists(fieldHash.c_str())] = removeBSXIfExists(fieldData.c_str());
+        }
+    }
+    catch (const std::exception &e)
+    {
+        cerr << "Error: Database::readRemoteBatch() table="<< tableName << " exception: " << e.what() << " connection=" << pDatabaseConnection << endl;
+        exitProcess();
+    }
+
+    // Dispose the read db conneciton
+    disposeConnection(pDatabaseConnection);
+
+    return ZKR_SUCCESS;
+}
+
 zkresult Database::writeRemote(bool bProgram, const string &key, const string &value, const bool update)
 {
     zkresult result = ZKR_SUCCESS;
@@ -408,6 +624,7 @@ zkresult Database::writeRemote(bool bProgram, const string &key, const string &v
         {
             multiWriteLock();
             multiWriteNodesStateRoot = "INSERT INTO " + tableName + " ( hash, data ) VALUES ( E\'\\\\x" + key + "\', E\'\\\\x" + value + "\' ) ";
+            multiWriteNodesPending[key] = value;
             multiWriteUnlock();       
         }
         else
@@ -422,6 +639,10 @@ zkresult Database::writeRemote(bool bProgram, const string &key, const string &v
             {
                 multiWrite += ", ( E\'\\\\x" + key + "\', E\'\\\\x" + value + "\' )";
             }
+            if (!bProgram && (update || (multiWriteNodesPending.find(key) == multiWriteNodesPending.end())))
+            {
+                multiWriteNodesPending[key] = value;
+            }
             multiWriteUnlock();       
         }
     }
@@ -463,6 +684,42 @@ zkresult Database::writeRemote(bool bProgram, const string &key, const string &v
     return result;
 }
 
+bool Database::readMultiWrite(const string &key, string &value)
+{
+    multiWriteLock();
+    unordered_map<string, string>::const_iterator it = multiWriteNodesPending.find(key);
+    bool bFound = (it != multiWriteNodesPending.end());
+    if (!bFound)
+    {
+        it = multiWriteNodesFlushing.find(key);
+        bFound = (it != multiWriteNodesFlushing.end());
+    }
+    if (bFound)
+    {
+        value = it->second;
+    }
+    multiWriteUnlock();
+    return bFound;
+}
+
+void Database::requeueMultiWrite(string &multiWrite, const string &failed)
+{
+    if (failed.size() == 0)
+    {
+        return;
+    }
+    if (multiWrite.size() == 0)
+    {
+        multiWrite = failed;
+        return;
+    }
+
+    // The failed values go first, since they were written before the ones queued meanwhile
+    size_t valuesPosition = multiWrite.find(" VALUES ");
+    zkassert(valuesPosition != string::npos);
+    multiWrite = failed + ", " + multiWrite.substr(valuesPosition + 8);
+}
+
 zkresult Database::setProgram(const string &_key, const vector<uint8_t> &data, const bool persistent, const bool update)
 {
     // Check that it has been initialized before
@@ -597,106 +854,53 @@ zkresult Database::flush()
 
     zkresult zkr = ZKR_SUCCESS;
 
+    // Flushes are serialized, so that the queries of a flush are executed after the ones of the previous one
+    pthread_mutex_lock(&flushMutex);
+
+    // Take the multi write queues, so that writes can keep on being queued while the queries are executed;
+    // the nodes taken can still be read from multiWriteNodesFlushing until they have been written
+    string program;
+    string programUpdate;
+    string nodes;
+    string nodesUpdate;
+    string nodesStateRoot;
     multiWriteLock();
+    program.swap(multiWriteProgram);
+    programUpdate.swap(multiWriteProgramUpdate);
+    nodes.swap(multiWriteNodes);
+    nodesUpdate.swap(multiWriteNodesUpdate);
+    nodesStateRoot.swap(multiWriteNodesStateRoot);
+    multiWriteNodesFlushing.swap(multiWriteNodesPending);
+    multiWriteUnlock();
 
-    if ( (multiWriteNodes.size() > 0) || (multiWriteNodesStateRoot.size() > 0) || (multiWriteNodesUpdate.size() > 0) || (multiWriteProgram.size() > 0) || (multiWriteProgramUpdate.size() > 0) )
+    if ( (nodes.size() > 0) || (nodesStateRoot.size() > 0) || (nodesUpdate.size() > 0) || (program.size() > 0) || (programUpdate.size() > 0) )
     {
-
         // Get a free write db connection
         DatabaseConnection * pDatabaseConnection = getConnection();
 
+        // Queries are executed in this order, every one in its own transaction, and the first failure stops the flush
+        string * queries[5] = { &program, &programUpdate, &nodes, &nodesUpdate, &nodesStateRoot };
+        const char * conflicts[5] = { " ON CONFLICT (hash) DO NOTHING;", " ON CONFLICT (hash) DO UPDATE SET data = EXCLUDED.data;", " ON CONFLICT (hash) DO NOTHING;", " ON CONFLICT (hash) DO UPDATE SET data = EXCLUDED.data;", " ON CONFLICT (hash) DO UPDATE SET data = EXCLUDED.data;" };
         try
         {
-            string query;
-            if (multiWriteProgram.size() > 0)
+            for (uint64_t i = 0; i < 5; i++)
             {
-                query = multiWriteProgram + " ON CONFLICT (hash) DO NOTHING;";
-                
-                // Start a transaction
-                pqxx::work w(*(pDatabaseConnection->pConnection));
-
-                // Execute the query
-                pqxx::result res = w.exec(query);
-
-                // Commit your transaction
-                w.commit();
-
-                //cout << "Database::flush() sent " << query << endl;
-
-                // Delete the accumulated query data only if the query succeeded
-                multiWriteProgram.clear();
-            }
-            if (multiWriteProgramUpdate.size() > 0)
-            {
-                query = multiWriteProgramUpdate + " ON CONFLICT (hash) DO UPDATE SET data = EXCLUDED.data;";
-                
-                // Start a transaction
-                pqxx::work w(*(pDatabaseConnection->pConnection));
-
-                // Execute the query
-                pqxx::result res = w.exec(query);
-
-                // Commit your transaction
-                w.commit();
-
-                //cout << "Database::flush() sent " << query << endl;
-
-                // Delete the accumulated query data only if the query succeeded
-                multiWriteProgramUpdate.clear();
-            }
-            if (multiWriteNodes.size() > 0)
-            {
-                query = multiWriteNodes + " ON CONFLICT (hash) DO NOTHING;";
-                
-                // Start a transaction
-                pqxx::work w(*(pDatabaseConnection->pConnection));
-
-                // Execute the query
-                pqxx::result res = w.exec(query);
-
-                // Commit your transaction
-                w.commit();
-
-                //cout << "Database::flush() sent " << query << endl;
-
-                // Delete the accumulated query data only if the query succeeded
-                multiWriteNodes.clear();
-            }
-            if (multiWriteNodesUpdate.size() > 0)
-            {
-                query = multiWriteNodesUpdate + " ON CONFLICT (hash) DO UPDATE SET data = EXCLUDED.data;";
-                
-                // Start a transaction
-                pqxx::work w(*(pDatabaseConnection->pConnection));
-
-                // Execute the query
-                pqxx::result res = w.exec(query);
-
-                // Commit your transaction
-                w.commit();
-
-                //cout << "Database::flush() sent " << query << endl;
+                if (queries[i]->size() == 0)
+                {
+                    continue;
+                }
 
-                // Delete the accumulated query data only if the query succeeded
-                multiWriteNodesUpdate.clear();
-            }
-            if (multiWriteNodesStateRoot.size() > 0)
-            {
-                query = multiWriteNodesStateRoot + " ON CONFLICT (hash) DO UPDATE SET data = EXCLUDED.data;";
-                
                 // Start a transaction
                 pqxx::work w(*(pDatabaseConnection->pConnection));
 
                 // Execute the query
-                pqxx::result res = w.exec(query);
+                pqxx::result res = w.exec(*queries[i] + conflicts[i]);
 
                 // Commit your transaction
                 w.commit();
 
-                //cout << "Database::flush() sent " << query << endl;
-
                 // Delete the accumulated query data only if the query succeeded
-                multiWriteNodesStateRoot.clear();
+                queries[i]->clear();
             }
         }
         catch (const std::exception &e)
@@ -708,8 +912,32 @@ zkresult Database::flush()
         // Dispose the write db connection
         disposeConnection(pDatabaseConnection);
     }
+
+    multiWriteLock();
+
+    // Queries that failed are queued again, to be retried by the next flush; a state root queued
+    // meanwhile is newer than the failed one
+    requeueMultiWrite(multiWriteProgram, program);
+    requeueMultiWrite(multiWriteProgramUpdate, programUpdate);
+    requeueMultiWrite(multiWriteNodes, nodes);
+    requeueMultiWrite(multiWriteNodesUpdate, nodesUpdate);
+    if ((nodesStateRoot.size() > 0) && (multiWriteNodesStateRoot.size() == 0))
+    {
+        multiWriteNodesStateRoot = nodesStateRoot;
+    }
+
+    // The nodes of this flush can be read remotely once written; otherwise they are pending again,
+    // unless a newer value of the same node has been queued meanwhile
+    if ( (nodes.size() > 0) || (nodesUpdate.size() > 0) || (nodesStateRoot.size() > 0) )
+    {
+        multiWriteNodesPending.insert(multiWriteNodesFlushing.begin(), multiWriteNodesFlushing.end());
+    }
+    multiWriteNodesFlushing.clear();
+
     multiWriteUnlock();
 
+    pthread_mutex_unlock(&flushMutex);
+
     //TimerStopAndLog(DATABASE_FLUSH);
     
     return zkr;
@@ -852,6 +1080,435 @@ Database::~Database()
     }
 }
 
+#ifdef DATABASE_USE_CACHE
+
+// Time between progress logs of loadDb2MemCache()
+#define LOAD_DB_TO_CACHE_LOG_INTERVAL_US (10*1000*1000)
+
+// Time between checkpoints of loadDb2MemCache(), if config.loadDBToMemCacheCheckpointFile is set
+#define LOAD_DB_TO_CACHE_CHECKPOINT_INTERVAL_US (60*1000*1000)
+
+// First 8 bytes of a loadDb2MemCache() checkpoint file
+#define LOAD_DB_TO_CACHE_CHECKPOINT_MAGIC 0x3174706B63624D44ULL
+
+// Node of the tree pending to be loaded into the cache by loadDb2MemCache()
+class LoadDb2MemCacheNode
+{
+public:
+    string hash; // 64 hex characters
+    uint64_t level;
+    bool bValue; // Value nodes are read from leaf nodes, and have no children
+};
+
+/* Work shared by the loadDb2MemCache() threads.  Nodes are read in batches of batchSize, and the
+   children of every batch are queued as soon as it is read, so batches of several levels are read
+   at the same time.
+
+   If a checkpoint file is configured, every node read from the database is appended to the nodes
+   file (<checkpoint file>.nodes), and the checkpoint file records the state root, the pending nodes
+   and the size of the nodes file at a moment when no batch was in flight.  A new process started on
+   the same state root adds the recorded nodes to the cache without querying the database again, and
+   continues from the pending nodes */
+class LoadDb2MemCacheContext
+{
+public:
+    Goldilocks fr;
+    Database *pDatabase;
+    uint64_t batchSize;
+    mutex mlock;
+    condition_variable cv;
+    deque<LoadDb2MemCacheNode> pending; // Nodes to read
+    uint64_t inFlight = 0; // Batches being read
+    bool bStop = false;
+    bool bError = false;
+
+    // Checkpoint
+    string checkpointFile; // Empty if disabled
+    string stateRoot; // 64 hex characters
+    FILE *pNodesFile = NULL;
+    bool bCheckpoint = false; // A checkpoint is due, so no new batch is started until it is saved
+    struct timeval lastCheckpointTime;
+
+    // Progress counters
+    uint64_t nodes = 0; // Nodes loaded, including the ones that were already cached
+    uint64_t cachedNodes = 0; // Nodes found in the cache, which were not read again
+    uint64_t queries = 0;
+    uint64_t maxLevel = 0;
+    struct timeval startTime;
+    struct timeval lastLogTime;
+
+    void logProgress(const string &prefix)
+    {
+        cout << prefix << " nodes=" << nodes << " cachedNodes=" << cachedNodes << " queries=" << queries << " pending=" << pending.size() << " level=" << maxLevel << " cache at " << (double(Database::dbMTCache.getCurrentSize())/double(Database::dbMTCache.getMaxSize()))*100 << "% time=" << TimeDiff(startTime)/1000000 << "s" << endl;
+    }
+
+    // Appends the records of a batch to the nodes file; called with mlock held
+    bool writeNodes(const vector<uint64_t> &records)
+    {
+        if (fwrite(records.data(), sizeof(uint64_t), records.size(), pNodesFile) != records.size())
+        {
+            cerr << "Error: loadDb2MemCache() failed writing to the nodes file of " << checkpointFile << endl;
+            return false;
+        }
+        return true;
+    }
+
+    /* Saves the state root, the size of the nodes file and the pending nodes; called with mlock held
+       and no batch in flight, so that every node is either in the nodes file or pending.  The file is
+       written aside and then renamed, so a process killed while saving keeps the previous checkpoint */
+    bool saveCheckpoint(void)
+    {
+        if (fflush(pNodesFile) != 0)
+        {
+            cerr << "Error: loadDb2MemCache() failed flushing the nodes file of " << checkpointFile << endl;
+            return false;
+        }
+        long nodesFileSize = ftell(pNodesFile);
+        string tmpFile = checkpointFile + ".tmp";
+        FILE *pFile = fopen(tmpFile.c_str(), "wb");
+        if (pFile == NULL)
+        {
+            cerr << "Error: loadDb2MemCache() failed opening file " << tmpFile << endl;
+            return false;
+        }
+        bool bOk = (nodesFileSize >= 0);
+        uint64_t header[4] = { LOAD_DB_TO_CACHE_CHECKPOINT_MAGIC, 0, (uint64_t)nodesFileSize, pending.size() };
+        bOk = bOk && (fwrite(header, sizeof(uint64_t), 2, pFile) == 2);
+        bOk = bOk && (fwrite(stateRoot.c_str(), 1, 64, pFile) == 64);
+        bOk = bOk && (fwrite(&header[2], sizeof(uint64_t), 2, pFile) == 2);
+        for (uint64_t i=0; (i<pending.size()) && bOk; i++)
+        {
+            Goldilocks::Element hash[4];
+            string2fea(fr, pending[i].hash, hash);
+            uint64_t record[6] = { fr.toU64(hash[0]), fr.toU64(hash[1]), fr.toU64(hash[2]), fr.toU64(hash[3]), pending[i].level, pending[i].bValue };
+            bOk = (fwrite(record, sizeof(uint64_t), 6, pFile) == 6);
+        }
+        bOk = (fclose(pFile) == 0) && bOk;
+        if (!bOk || (rename(tmpFile.c_str(), checkpointFile.c_str()) != 0))
+        {
+            cerr << "Error: loadDb2MemCache() failed writing file " << checkpointFile << endl;
+            remove(tmpFile.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    /* Loads the checkpoint of stateRoot, if any: adds the saved nodes to the cache, and sets pending
+       to the nodes left; the nodes file is truncated to its checkpointed size and left open to append
+       to it.  Returns false if there is no valid checkpoint of this state root */
+    bool loadCheckpoint(void)
+    {
+        FILE *pFile = fopen(checkpointFile.c_str(), "rb");
+        if (pFile == NULL)
+        {
+            return false;
+        }
+        uint64_t header[4];
+        char root[64];
+        bool bOk = (fread(header, sizeof(uint64_t), 2, pFile) == 2) && (header[0] == LOAD_DB_TO_CACHE_CHECKPOINT_MAGIC);
+        bOk = bOk && (fread(root, 1, 64, pFile) == 64);
+        bOk = bOk && (fread(&header[2], sizeof(uint64_t), 2, pFile) == 2);
+        if (!bOk || (string(root, 64) != stateRoot))
+        {
+            fclose(pFile);
+            cout << "loadDb2MemCache() ignoring checkpoint " << checkpointFile << " since it is not of state root=" << stateRoot << endl;
+            return false;
+        }
+        uint64_t nodesFileSize = header[2];
+        uint64_t nPending = header[3];
+        deque<LoadDb2MemCacheNode> checkpointPending;
+        for (uint64_t i=0; (i<nPending) && bOk; i++)
+        {
+            uint64_t record[6];
+            bOk = (fread(record, sizeof(uint64_t), 6, pFile) == 6);
+            if (bOk)
+            {
+                LoadDb2MemCacheNode node;
+                Goldilocks::Element hash[4] = { fr.fromU64(record[0]), fr.fromU64(record[1]), fr.fromU64(record[2]), fr.fromU64(record[3]) };
+                node.hash = fea2string64(fr, hash);
+                node.level = record[4];
+                node.bValue = (record[5] != 0);
+                checkpointPending.push_back(node);
+            }
+        }
+        fclose(pFile);
+        if (!bOk)
+        {
+            cerr << "Error: loadDb2MemCache() found an invalid checkpoint " << checkpointFile << endl;
+            return false;
+        }
+
+        // Add the saved nodes to the cache
+        string nodesFile = checkpointFile + ".nodes";
+        FILE *pNodes = fopen(nodesFile.c_str(), "r+b");
+        if ((pNodes == NULL) || (ftruncate(fileno(pNodes), nodesFileSize) != 0))
+        {
+            cerr << "Error: loadDb2MemCache() failed opening file " << nodesFile << " with size=" << nodesFileSize << endl;
+            if (pNodes != NULL) fclose(pNodes);
+            return false;
+        }
+        uint64_t position = 0;
+        uint64_t restoredNodes = 0;
+        vector<Goldilocks::Element> value;
+        while (position < nodesFileSize)
+        {
+            uint64_t record[4 + 1 + 12];
+            bOk = (fread(record, sizeof(uint64_t), 5, pNodes) == 5) && (record[4] <= 12);
+            bOk = bOk && (fread(&record[5], sizeof(uint64_t), record[4], pNodes) == record[4]);
+            if (!bOk)
+            {
+                break;
+            }
+            Goldilocks::Element key[4] = { fr.fromU64(record[0]), fr.fromU64(record[1]), fr.fromU64(record[2]), fr.fromU64(record[3]) };
+            value.clear();
+            for (uint64_t i=0; i<record[4]; i++)
+            {
+                value.push_back(fr.fromU64(record[5 + i]));
+            }
+            Database::dbMTCache.add(key, value, true);
+            restoredNodes++;
+            position += (5 + record[4])*sizeof(uint64_t);
+        }
+        if (!bOk || (position != nodesFileSize) || (fseek(pNodes, nodesFileSize, SEEK_SET) != 0))
+        {
+            cerr << "Error: loadDb2MemCache() found an invalid nodes file " << nodesFile << endl;
+            fclose(pNodes);
+            return false;
+        }
+
+        pNodesFile = pNodes;
+        pending = checkpointPending;
+        nodes = restoredNodes;
+        cout << "loadDb2MemCache() resumed from checkpoint " << checkpointFile << " with restoredNodes=" << restoredNodes << " pending=" << pending.size() << endl;
+        return true;
+    }
+
+    // Starts a new nodes file and saves a first checkpoint with the state root as the only pending node
+    bool newCheckpoint(void)
+    {
+        string nodesFile = checkpointFile + ".nodes";
+        pNodesFile = fopen(nodesFile.c_str(), "wb");
+        if (pNodesFile == NULL)
+        {
+            cerr << "Error: loadDb2MemCache() failed opening file " << nodesFile << endl;
+            return false;
+        }
+        return saveCheckpoint();
+    }
+};
+
+// Parses a node value and appends its children, if any, to children
+static bool loadDb2MemCacheChildren(Goldilocks &fr, const LoadDb2MemCacheNode &node, const vector<Goldilocks::Element> &dbValue, vector<LoadDb2MemCacheNode> &children)
+{
+    if (node.bValue)
+    {
+        return true;
+    }
+    if (dbValue.size() != 12)
+    {
+        cerr << "Error: loadDb2MemCache() read node " << node.hash << " with dbValue.size()=" << dbValue.size() << endl;
+        return false;
+    }
+
+    // If capacity is X000
+    if (!fr.isZero(dbValue[9]) || !fr.isZero(dbValue[10]) || !fr.isZero(dbValue[11]))
+    {
+        return true;
+    }
+
+    LoadDb2MemCacheNode child;
+    child.level = node.level + 1;
+    Goldilocks::Element leftHash[4] = {dbValue[0], dbValue[1], dbValue[2], dbValue[3]};
+    Goldilocks::Element rightHash[4] = {dbValue[4], dbValue[5], dbValue[6], dbValue[7]};
+    bool bRightHashIsZero = fr.isZero(rightHash[0]) && fr.isZero(rightHash[1]) && fr.isZero(rightHash[2]) && fr.isZero(rightHash[3]);
+
+    // If capacity is 0000, this is an intermediate node that contains left and right hashes of its children
+    if (fr.isZero(dbValue[8]))
+    {
+        child.bValue = false;
+        if (!fr.isZero(leftHash[0]) || !fr.isZero(leftHash[1]) || !fr.isZero(leftHash[2]) || !fr.isZero(leftHash[3]))
+        {
+            child.hash = fea2string64(fr, leftHash);
+            children.push_back(child);
+        }
+        if (!bRightHashIsZero)
+        {
+            child.hash = fea2string64(fr, rightHash);
+            children.push_back(child);
+        }
+    }
+    // If capacity is 1000, this is a leaf node that contains right hash of the value node
+    else if (fr.isOne(dbValue[8]) && !bRightHashIsZero)
+    {
+        child.bValue = true;
+        child.hash = fea2string64(fr, rightHash);
+        children.push_back(child);
+    }
+
+    return true;
+}
+
+// Appends the record of a node to the nodes file records: key, value size and value
+static void loadDb2MemCacheRecord(Goldilocks &fr, const Goldilocks::Element (&key)[4], const vector<Goldilocks::Element> &dbValue, vector<uint64_t> &records)
+{
+    for (uint64_t i=0; i<4; i++)
+    {
+        records.push_back(fr.toU64(key[i]));
+    }
+    records.push_back(dbValue.size());
+    for (uint64_t i=0; i<dbValue.size(); i++)
+    {
+        records.push_back(fr.toU64(dbValue[i]));
+    }
+}
+
+static void loadDb2MemCacheThread(LoadDb2MemCacheContext *pContext)
+{
+    Goldilocks &fr = pContext->fr;
+    vector<LoadDb2MemCacheNode> batch;
+    vector<LoadDb2MemCacheNode> toRead;
+    vector<LoadDb2MemCacheNode> children;
+    vector<string> keys;
+    unordered_map<string, string> values;
+    vector<Goldilocks::Element> dbValue;
+    vector<uint64_t> records;
+    bool bRecord = !pContext->checkpointFile.empty();
+
+    while (true)
+    {
+        // Get the next batch of nodes, or return if there is no more work
+        batch.clear();
+        {
+            unique_lock<mutex> guard(pContext->mlock);
+            pContext->cv.wait(guard, [pContext]{ return pContext->bStop || (!pContext->bCheckpoint && !pContext->pending.empty()) || (pContext->inFlight == 0); });
+            if (!pContext->bStop && pContext->bCheckpoint && (pContext->inFlight == 0))
+            {
+                // A failed checkpoint only disables the next ones; the load itself can go on
+                if ((pContext->pNodesFile != NULL) && !pContext->saveCheckpoint())
+                {
+                    fclose(pContext->pNodesFile);
+                    pContext->pNodesFile = NULL;
+                }
+                pContext->bCheckpoint = false;
+                gettimeofday(&pContext->lastCheckpointTime, NULL);
+                pContext->cv.notify_all();
+            }
+            if (pContext->bStop || pContext->pending.empty())
+            {
+                pContext->cv.notify_all();
+                return;
+            }
+            while (!pContext->pending.empty() && (batch.size() < pContext->batchSize))
+            {
+                batch.push_back(pContext->pending.front());
+                pContext->pending.pop_front();
+            }
+            pContext->inFlight++;
+        }
+
+        // Nodes that are already cached, e.g. by a previous call in this same process that was stopped,
+        // are not read again, but their children are still loaded
+        bool bError = false;
+        uint64_t maxLevel = 0;
+        children.clear();
+        toRead.clear();
+        keys.clear();
+        values.clear();
+        records.clear();
+        for (uint64_t i=0; (i<batch.size()) && !bError; i++)
+        {
+            Goldilocks::Element key[4];
+            string2fea(fr, batch[i].hash, key);
+            if (Database::dbMTCache.find(key, dbValue))
+            {
+                bError = !loadDb2MemCacheChildren(fr, batch[i], dbValue, children);
+                maxLevel = zkmax(maxLevel, batch[i].level);
+            }
+            else
+            {
+                toRead.push_back(batch[i]);
+                keys.push_back(batch[i].hash);
+            }
+        }
+        uint64_t cachedNodes = batch.size() - toRead.size();
+
+        if ((keys.size() > 0) && !bError)
+        {
+            zkresult zkr = pContext->pDatabase->readRemoteBatch(keys, values);
+            if (zkr != ZKR_SUCCESS)
+            {
+                cerr << "Error: loadDb2MemCache() failed calling db.readRemoteBatch() result=" << zkr << "=" << zkresult2string(zkr) << endl;
+                bError = true;
+            }
+        }
+
+        // Add the read nodes to the cache, and get their children
+        for (uint64_t i=0; (i<toRead.size()) && !bError; i++)
+        {
+            unordered_map<string, string>::const_iterator it = values.find(toRead[i].hash);
+            if (it == values.end())
+            {
+                cerr << "Error: loadDb2MemCache() could not find node " << toRead[i].hash << " in database" << endl;
+                bError = true;
+                break;
+            }
+            Goldilocks::Element key[4];
+            string2fea(fr, toRead[i].hash, key);
+            dbValue.clear();
+            string2fea(fr, it->second, dbValue);
+            Database::dbMTCache.add(key, dbValue, true);
+            bError = !loadDb2MemCacheChildren(fr, toRead[i], dbValue, children);
+            if (bRecord)
+            {
+                loadDb2MemCacheRecord(fr, key, dbValue, records);
+            }
+            maxLevel = zkmax(maxLevel, toRead[i].level);
+        }
+
+        // Queue the children, and report the progress
+        {
+            lock_guard<mutex> guard(pContext->mlock);
+            pContext->inFlight--;
+            pContext->nodes += batch.size();
+            pContext->cachedNodes += cachedNodes;
+            pContext->queries += (keys.size() > 0) ? 1 : 0;
+            pContext->maxLevel = zkmax(pContext->maxLevel, maxLevel);
+            if (bError)
+            {
+                pContext->bError = true;
+                pContext->bStop = true;
+            }
+            pContext->pending.insert(pContext->pending.end(), children.begin(), children.end());
+
+            // Record the read nodes for a later process; a failed write only disables the checkpoints
+            if ((pContext->pNodesFile != NULL) && !bError && !pContext->writeNodes(records))
+            {
+                fclose(pContext->pNodesFile);
+                pContext->pNodesFile = NULL;
+            }
+            if ((pContext->pNodesFile != NULL) && (TimeDiff(pContext->lastCheckpointTime) > LOAD_DB_TO_CACHE_CHECKPOINT_INTERVAL_US))
+            {
+                pContext->bCheckpoint = true;
+            }
+
+            double sizePercentage = double(Database::dbMTCache.getCurrentSize())*100.0/double(Database::dbMTCache.getMaxSize());
+            if (!pContext->bStop && (sizePercentage > 90))
+            {
+                cout << "loadDb2MemCache() stopping since size percentage=" << sizePercentage << endl;
+                pContext->bStop = true;
+            }
+            if (TimeDiff(pContext->lastLogTime) > LOAD_DB_TO_CACHE_LOG_INTERVAL_US)
+            {
+                pContext->logProgress("loadDb2MemCache() progress:");
+                gettimeofday(&pContext->lastLogTime, NULL);
+            }
+        }
+        pContext->cv.notify_all();
+    }
+}
+
+#endif
+
 void loadDb2MemCache(const Config config)
 {
     if (config.databaseURL == "local")
@@ -864,7 +1521,8 @@ void loadDb2MemCache(const Config config)
 
     TimerStart(LOAD_DB_TO_CACHE);
 
-    Goldilocks fr;
+    LoadDb2MemCacheContext context;
+    Goldilocks &fr = context.fr;
     StateDB * pStateDB = (StateDB *)stateDBSingleton.get(fr, config);
 
     vector<Goldilocks::Element> dbValue;
@@ -893,98 +1551,63 @@ void loadDb2MemCache(const Config config)
         return;
     }
 
-    unordered_map<uint64_t, vector<string>> treeMap;
-    vector<string> emptyVector;
-    string hash, leftHash, rightHash;
-    uint64_t counter = 0;
+    // Every thread uses one connection while reading, so leave at least one of them to the rest of
+    // database clients
+    uint64_t nThreads = 1;
+    if (config.dbConnectionsPool)
+    {
+        nThreads = zkmin(config.loadDBToMemCacheThreads, config.dbNumberOfPoolConnections - 1);
+        nThreads = zkmax(nThreads, (uint64_t)1);
+    }
 
-    treeMap[0] = emptyVector;
-    treeMap[0].push_back(stateRootKey);
-    unordered_map<uint64_t, std::vector<std::string>>::iterator treeMapIterator;
-    for (uint64_t level=0; level<256; level++)
+    LoadDb2MemCacheNode root;
+    Goldilocks::Element rootHash[4] = {dbValue[0], dbValue[1], dbValue[2], dbValue[3]};
+    root.hash = fea2string64(fr, rootHash);
+    root.level = 0;
+    root.bValue = false;
+    context.pDatabase = &pStateDB->db;
+    context.batchSize = zkmax(config.loadDBToMemCacheBatchSize, (uint64_t)1);
+    context.checkpointFile = config.loadDBToMemCacheCheckpointFile;
+    context.stateRoot = root.hash;
+    gettimeofday(&context.startTime, NULL);
+    context.lastLogTime = context.startTime;
+    context.lastCheckpointTime = context.startTime;
+
+    // Resume from the checkpoint of this same state root, if any, or else start from the state root
+    if (context.checkpointFile.empty() || !context.loadCheckpoint())
     {
-        treeMapIterator = treeMap.find(level);
-        if (treeMapIterator == treeMap.end())
+        context.pending.push_back(root);
+        if (!context.checkpointFile.empty() && !context.newCheckpoint() && (context.pNodesFile != NULL))
         {
-            break;
+            fclose(context.pNodesFile);
+            context.pNodesFile = NULL;
         }
+    }
 
-        if (treeMapIterator->second.size()==0)
-        {
-            break;
-        }
+    cout << "loadDb2MemCache() starting with threads=" << nThreads << " batchSize=" << context.batchSize << endl;
 
-        treeMap[level+1] = emptyVector;
+    vector<thread> threads;
+    for (uint64_t i=0; i<nThreads; i++)
+    {
+        threads.push_back(thread(loadDb2MemCacheThread, &context));
+    }
+    for (uint64_t i=0; i<nThreads; i++)
+    {
+        threads[i].join();
+    }
 
-        //cout << "loadDb2MemCache() searching at level=" << level << " for elements=" << treeMapIterator->second.size() << endl;
-        
-        for (uint64_t i=0; i<treeMapIterator->second.size(); i++)
+    // Save the last checkpoint, with no pending nodes if the load is complete, so that a new process
+    // gets the same nodes from the nodes file; after an error, the previous checkpoint is kept
+    if (context.pNodesFile != NULL)
+    {
+        if (!context.bError)
         {
-            hash = treeMapIterator->second[i];
-            dbValue.clear();
-            zkresult zkr = pStateDB->db.read(hash, dbValue, NULL, true);
-            if (zkr != ZKR_SUCCESS)
-            {
-                cerr << "Error: loadDb2MemCache() failed calling db.read(" << hash << ") result=" << zkr << "=" << zkresult2string(zkr) << endl;
-                TimerStopAndLog(LOAD_DB_TO_CACHE);
-                return;
-            }
-            if (dbValue.size() != 12)
-            {
-                cerr << "Error: loadDb2MemCache() failed calling db.read(" << hash << ") dbValue.size()=" << dbValue.size() << endl;
-                TimerStopAndLog(LOAD_DB_TO_CACHE);
-                return;
-            }
-            counter++;
-            double sizePercentage = double(Database::dbMTCache.getCurrentSize())*100.0/double(Database::dbMTCache.getMaxSize());
-            if ( sizePercentage > 90 )
-            {
-                cout << "loadDb2MemCache() stopping since size percentage=" << sizePercentage << endl;
-                break;
-            }
-
-            // If capaxity is X000
-            if (fr.isZero(dbValue[9]) && fr.isZero(dbValue[10]) && fr.isZero(dbValue[11]))
-            {
-                // If capacity is 0000, this is an intermediate node that contains left and right hashes of its children
-                if (fr.isZero(dbValue[8]))
-                {
-                    leftHash = fea2string(fr, dbValue[0], dbValue[1], dbValue[2], dbValue[3]);
-                    if (leftHash != "0")
-                    {
-                        treeMap[level+1].push_back(leftHash);
-                        //cout << "loadDb2MemCache() level=" << level << " found leftHash=" << leftHash << endl;
-                    }
-                    rightHash = fea2string(fr, dbValue[4], dbValue[5], dbValue[6], dbValue[7]);
-                    if (rightHash != "0")
-                    {
-                        treeMap[level+1].push_back(rightHash);
-                        //cout << "loadDb2MemCache() level=" << level << " found rightHash=" << rightHash << endl;
-                    }
-                }
-                // If capacity is 1000, this is a leaf node that contains right hash of the value node
-                else if (fr.isOne(dbValue[8]))
-                {
-                    rightHash = fea2string(fr, dbValue[4], dbValue[5], dbValue[6], dbValue[7]);
-                    if (rightHash != "0")
-                    {
-                        //cout << "loadDb2MemCache() level=" << level << " found value rightHash=" << rightHash << endl;
-                        dbValue.clear();
-                        zkresult zkr = pStateDB->db.read(rightHash, dbValue, NULL, true);
-                        if (zkr != ZKR_SUCCESS)
-                        {
-                            cerr << "Error: loadDb2MemCache() failed calling db.read(" << rightHash << ") result=" << zkr << "=" << zkresult2string(zkr) << endl;
-                            TimerStopAndLog(LOAD_DB_TO_CACHE);
-                            return;
-                        }
-                        counter++;
-                    }
-                }
-            }
+            context.saveCheckpoint();
         }
+        fclose(context.pNodesFile);
     }
 
-    cout << "loadDb2MemCache() done counter=" << counter << " cache at " << (double(Database::dbMTCache.getCurrentSize())/double(Database::dbMTCache.getMaxSize()))*100 << "%" << endl;
+    context.logProgress(context.bError ? "Error: loadDb2MemCache() failed:" : "loadDb2MemCache() done:");
 
     TimerStopAndLog(LOAD_DB_TO_CACHE);
 
@@ -3,6 +3,7 @@
 
 #include <vector>
 #include <map>
+#include <unordered_map>
 #include <pqxx/pqxx>
 #include "goldilocks_base_field.hpp"
 #include "compare_fe.hpp"
@@ -60,15 +61,20 @@ private:
     string multiWriteNodes;
     string multiWriteNodesUpdate;
     string multiWriteNodesStateRoot;
+    unordered_map<string, string> multiWriteNodesPending; // Data of the nodes in the multi write queues, by key
+    unordered_map<string, string> multiWriteNodesFlushing; // Data of the nodes taken from the multi write queues by the running flush, by key
     pthread_mutex_t multiWriteMutex; // Mutex to protect the multi write queues
     void multiWriteLock(void) { pthread_mutex_lock(&multiWriteMutex); };
     void multiWriteUnlock(void) { pthread_mutex_unlock(&multiWriteMutex); };
+    pthread_mutex_t flushMutex; // Mutex to serialize flushes, held while their queries are executed without multiWriteMutex
 
 private:
     // Remote database based on Postgres (PostgreSQL)
     void initRemote(void);
     zkresult readRemote(bool bProgram, const string &key, string &value);
     zkresult writeRemote(bool bProgram, const string &key, const string &value, const bool update);
+    bool readMultiWrite(const string &key, string &value); // Returns true if the node is pending to be written
+    void requeueMultiWrite(string &multiWrite, const string &failed); // Puts the values of a failed multi write query back in its queue
 
 public:
 #ifdef DATABASE_USE_CACHE
@@ -91,6 +97,7 @@ public:
     {
         // Init mutexes
         pthread_mutex_init(&multiWriteMutex, NULL);
+        pthread_mutex_init(&flushMutex, NULL);
         pthread_mutex_init(&connMutex, NULL);
     };
     ~Database();
@@ -99,9 +106,17 @@ public:
     void init(void);
     zkresult read(const string &_key, vector<Goldilocks::Element> &value, DatabaseMap *dbReadLog, const bool update = false);
     zkresult write(const string &_key, const vector<Goldilocks::Element> &value, const bool persistent, const bool update = false);
+
+    // Binary key methods, used by the SMT, which only convert keys and values to strings to access the remote database
+    zkresult read(const Goldilocks::Element (&key)[4], Goldilocks::Element (&value)[12], DatabaseMap *dbReadLog, const bool update = false);
+    zkresult write(const Goldilocks::Element (&key)[4], const Goldilocks::Element (&value)[12], const bool persistent, const bool update = false);
     zkresult getProgram(const string &_key, vector<uint8_t> &value, DatabaseMap *dbReadLog, const bool update = false);
     zkresult setProgram(const string &_key, const vector<uint8_t> &value, const bool persistent, const bool update = false);
 
+    // Reads several nodes from the remote database with one query, bypassing the cache; keys are
+    // 64 hex characters, and nodes that are not found are not added to values
+    zkresult readRemoteBatch(const vector<string> &keys, unordered_map<string, string> &values);
+
 #ifdef DATABASE_COMMIT
     void setAutoCommit(const bool autoCommit);
     void commit();
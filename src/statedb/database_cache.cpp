@@ -1,3 +1,4 @@
+#include <immintrin.h>
 #include "database_cache.hpp"
 #include "utils.hpp"
 #include "scalar.hpp"
@@ -147,72 +148,296 @@ DatabaseCache::~DatabaseCache()
 
 // DatabaseMTCache class implementation
 
-// Add a record in the head of the MT cache. Returns true if the cache is full (or no cache), false otherwise
-bool DatabaseMTCache::add(const string &key, const vector<Goldilocks::Element> &value, const bool update)
+void DatabaseMTCache::setMaxSize(int64_t size)
 {
-    lock_guard<recursive_mutex> guard(mlock);
+    freeEntries();
 
-    if (maxSize == 0) return true;
+    maxSize = (size > 0) ? size : 0;
+    if (maxSize == 0) return;
 
-    return addKeyValue(key, (const void *)&value, update);
+    // Use as many shards as fit in maxSize with at least one bucket each, so that a small cache never
+    // allocates more than maxSize
+    const uint64_t bucketSize = DATABASE_MT_CACHE_WAYS*sizeof(DatabaseMTCacheEntry);
+    uint64_t totalBuckets = maxSize / bucketSize;
+    if (totalBuckets == 0)
+    {
+        cerr << "Error: DatabaseMTCache::setMaxSize() got size=" << maxSize << " smaller than one bucket of " << bucketSize << " bytes; the cache is disabled" << endl;
+        maxSize = 0;
+        return;
+    }
+    numberOfShards = DATABASE_MT_CACHE_SHARDS;
+    while (numberOfShards > totalBuckets) numberOfShards /= 2;
+    uint64_t numberOfBuckets = totalBuckets / numberOfShards;
+
+    for (uint64_t i = 0; i < numberOfShards; i++)
+    {
+        // Zeroed entries are free entries; calloc() lets the OS map their memory pages only when used
+        shards[i].entries = (DatabaseMTCacheEntry *)calloc(numberOfBuckets*DATABASE_MT_CACHE_WAYS, sizeof(DatabaseMTCacheEntry));
+        shards[i].hands = (uint8_t *)calloc(numberOfBuckets, sizeof(uint8_t));
+        if ((shards[i].entries == NULL) || (shards[i].hands == NULL))
+        {
+            cerr << "Error: DatabaseMTCache::setMaxSize() failed calling calloc() for shard=" << i << " numberOfBuckets=" << numberOfBuckets << endl;
+            exitProcess();
+        }
+        shards[i].numberOfBuckets = numberOfBuckets;
+    }
 }
 
-bool DatabaseMTCache::find(const string &key, vector<Goldilocks::Element> &value)
+void DatabaseMTCache::freeEntries(void)
 {
-    lock_guard<recursive_mutex> guard(mlock);
+    for (uint64_t i = 0; i < DATABASE_MT_CACHE_SHARDS; i++)
+    {
+        if (shards[i].entries != NULL) free(shards[i].entries);
+        if (shards[i].hands != NULL) free(shards[i].hands);
+        shards[i].entries = NULL;
+        shards[i].hands = NULL;
+        shards[i].numberOfBuckets = 0;
+        shards[i].overflow.clear();
+        shards[i].overflowEntries = 0;
+        shards[i].usedEntries = 0;
+    }
+    numberOfShards = 0;
+}
 
-    if (maxSize == 0) return false;
+// Keys are hashes, so their elements are already uniformly distributed
+DatabaseMTCacheEntry * DatabaseMTCache::getBucket(const uint64_t (&key)[4], DatabaseMTCacheShard * &pShard)
+{
+    pShard = &shards[key[0] & (numberOfShards - 1)];
+    return &pShard->entries[(key[1] % pShard->numberOfBuckets)*DATABASE_MT_CACHE_WAYS];
+}
 
-    DatabaseCacheRecord* record;
-    bool found = findKey(key, record);
-    if (found) 
+void DatabaseMTCache::writeEntry(DatabaseMTCacheEntry &entry, const uint64_t (&key)[4], const Goldilocks::Element * value, const uint64_t size)
+{
+    uint64_t sequence = entry.sequence.load(memory_order_relaxed);
+    entry.sequence.store(sequence + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    for (uint64_t i = 0; i < 4; i++)
     {
-        value = *((vector<Goldilocks::Element>*) record->value);
+        entry.key[i].store(key[i], memory_order_relaxed);
     }
-
-    return found;
+    for (uint64_t i = 0; i < size; i++)
+    {
+        entry.value[i].store(Goldilocks::toU64(value[i]), memory_order_relaxed);
+    }
+    entry.size.store(size, memory_order_relaxed);
+    entry.referenced.store(1, memory_order_relaxed);
+    entry.sequence.store(sequence + 2, memory_order_release);
 }
 
-DatabaseCacheRecord * DatabaseMTCache::allocRecord(const string key, const void * value)
+// Add a record to the MT cache. Returns true if another record had to be evicted (or no cache), false otherwise
+bool DatabaseMTCache::add(const Goldilocks::Element (&key)[4], const Goldilocks::Element * value, const uint64_t size, const bool update)
 {
-    // Allocate memory
-    DatabaseCacheRecord * pRecord = new(DatabaseCacheRecord);
-    if (pRecord == NULL)
+    if (maxSize == 0) return true;
+
+    if ((size == 0) || (size > DATABASE_MT_CACHE_VALUE_SIZE))
     {
-        cerr << "Error: DatabaseMTCache::allocRecord() failed calling new(DatabaseCacheRecord)" << endl;
+        cerr << "Error: DatabaseMTCache::add() got invalid size=" << size << endl;
         exitProcess();
     }
-    vector<Goldilocks::Element>* pValue = new(vector<Goldilocks::Element>);
-    if (pValue == NULL)
+
+    uint64_t k[4];
+    for (uint64_t i = 0; i < 4; i++) k[i] = Goldilocks::toU64(key[i]);
+
+    DatabaseMTCacheShard * pShard;
+    DatabaseMTCacheEntry * bucket = getBucket(k, pShard);
+    uint64_t bucketIndex = (bucket - pShard->entries)/DATABASE_MT_CACHE_WAYS;
+
+    lock_guard<mutex> guard(pShard->writeMutex);
+
+    // If the key is already in the cache, update it if requested
+    int64_t freeWay = -1;
+    for (uint64_t w = 0; w < DATABASE_MT_CACHE_WAYS; w++)
     {
-        cerr << "Error: DatabaseMTCache::allocRecord() failed calling new(vector<Goldilocks::Element>)" << endl;
-        exitProcess();
+        DatabaseMTCacheEntry &entry = bucket[w];
+        if (entry.size.load(memory_order_relaxed) == 0)
+        {
+            if (freeWay < 0) freeWay = w;
+            continue;
+        }
+        if ( (entry.key[0].load(memory_order_relaxed) == k[0]) &&
+             (entry.key[1].load(memory_order_relaxed) == k[1]) &&
+             (entry.key[2].load(memory_order_relaxed) == k[2]) &&
+             (entry.key[3].load(memory_order_relaxed) == k[3]) )
+        {
+            if (update)
+            {
+                writeEntry(entry, k, value, size);
+                return true;
+            }
+            entry.referenced.store(1, memory_order_relaxed);
+            return false;
+        }
     }
 
-    // Copy vector
-    *pValue = *(const vector<Goldilocks::Element> *)value;
+    // The key can also be in the overflow map, if eviction is disabled
+    if (!pShard->overflow.empty())
+    {
+        auto it = pShard->overflow.find({k[0], k[1], k[2], k[3]});
+        if (it != pShard->overflow.end())
+        {
+            if (update)
+            {
+                it->second.size = size;
+                for (uint64_t i = 0; i < size; i++) it->second.value[i] = Goldilocks::toU64(value[i]);
+                return true;
+            }
+            return false;
+        }
+    }
 
-    // Assign values to record
-    pRecord->value = pValue;
-    pRecord->key = key;
-    pRecord->size = 2*(
-        sizeof(DatabaseCacheRecord)+
-        (pRecord->key.capacity()+1)+
-        sizeof(vector<Goldilocks::Element>)+
-        sizeof(Goldilocks::Element)*pValue->capacity() );
-        
-    return pRecord;
+    // Use a free entry, if any
+    if (freeWay >= 0)
+    {
+        writeEntry(bucket[freeWay], k, value, size);
+        pShard->usedEntries.fetch_add(1, memory_order_relaxed);
+        return false;
+    }
+
+    // If eviction is disabled, the cache is the only copy of the record, so keep it in the overflow map
+    if (!bEviction)
+    {
+        DatabaseMTCacheOverflowValue &overflowValue = pShard->overflow[{k[0], k[1], k[2], k[3]}];
+        overflowValue.size = size;
+        for (uint64_t i = 0; i < size; i++) overflowValue.value[i] = Goldilocks::toU64(value[i]);
+        pShard->overflowEntries.store(pShard->overflow.size(), memory_order_release);
+        return false;
+    }
+
+    // Otherwise, evict the first entry not referenced since the hand last passed over it
+    uint8_t &hand = pShard->hands[bucketIndex];
+    while (bucket[hand].referenced.load(memory_order_relaxed) != 0)
+    {
+        bucket[hand].referenced.store(0, memory_order_relaxed);
+        hand = (hand + 1) % DATABASE_MT_CACHE_WAYS;
+    }
+    writeEntry(bucket[hand], k, value, size);
+    hand = (hand + 1) % DATABASE_MT_CACHE_WAYS;
+    pShard->evictions.fetch_add(1, memory_order_relaxed);
+
+    return true;
 }
 
-void DatabaseMTCache::freeRecord(DatabaseCacheRecord* record)
+bool DatabaseMTCache::find(const Goldilocks::Element (&key)[4], Goldilocks::Element (&value)[DATABASE_MT_CACHE_VALUE_SIZE], uint64_t &size)
 {
-    delete (vector<Goldilocks::Element>*)(record->value);
-    delete record;
+    if (maxSize == 0) return false;
+
+    uint64_t k[4];
+    for (uint64_t i = 0; i < 4; i++) k[i] = Goldilocks::toU64(key[i]);
+
+    DatabaseMTCacheShard * pShard;
+    DatabaseMTCacheEntry * bucket = getBucket(k, pShard);
+
+    for (uint64_t w = 0; w < DATABASE_MT_CACHE_WAYS; w++)
+    {
+        DatabaseMTCacheEntry &entry = bucket[w];
+        while (true)
+        {
+            uint64_t sequence = entry.sequence.load(memory_order_acquire);
+            if (sequence & 1) // Being written
+            {
+                _mm_pause();
+                continue;
+            }
+
+            bool match = (entry.size.load(memory_order_relaxed) != 0) &&
+                         (entry.key[0].load(memory_order_relaxed) == k[0]) &&
+                         (entry.key[1].load(memory_order_relaxed) == k[1]) &&
+                         (entry.key[2].load(memory_order_relaxed) == k[2]) &&
+                         (entry.key[3].load(memory_order_relaxed) == k[3]);
+            size = 0;
+            if (match)
+            {
+                size = entry.size.load(memory_order_relaxed);
+                for (uint64_t i = 0; i < DATABASE_MT_CACHE_VALUE_SIZE; i++)
+                {
+                    value[i] = Goldilocks::fromU64((i < size) ? entry.value[i].load(memory_order_relaxed) : 0);
+                }
+            }
+
+            // If the entry changed while we read it, read it again
+            atomic_thread_fence(memory_order_acquire);
+            if (entry.sequence.load(memory_order_relaxed) != sequence) continue;
+
+            if (!match) break;
+
+            if (entry.referenced.load(memory_order_relaxed) == 0)
+            {
+                entry.referenced.store(1, memory_order_relaxed);
+            }
+            pShard->hits.fetch_add(1, memory_order_relaxed);
+            return true;
+        }
+    }
+
+    // Records that did not fit in their bucket, if eviction is disabled
+    if (pShard->overflowEntries.load(memory_order_acquire) > 0)
+    {
+        lock_guard<mutex> guard(pShard->writeMutex);
+        auto it = pShard->overflow.find({k[0], k[1], k[2], k[3]});
+        if (it != pShard->overflow.end())
+        {
+            size = it->second.size;
+            for (uint64_t i = 0; i < DATABASE_MT_CACHE_VALUE_SIZE; i++)
+            {
+                value[i] = Goldilocks::fromU64((i < size) ? it->second.value[i] : 0);
+            }
+            pShard->hits.fetch_add(1, memory_order_relaxed);
+            return true;
+        }
+    }
+
+    pShard->misses.fetch_add(1, memory_order_relaxed);
+    return false;
+}
+
+bool DatabaseMTCache::find(const Goldilocks::Element (&key)[4], vector<Goldilocks::Element> &value)
+{
+    Goldilocks::Element aux[DATABASE_MT_CACHE_VALUE_SIZE];
+    uint64_t size;
+    if (!find(key, aux, size)) return false;
+    value.assign(aux, aux + size);
+    return true;
+}
+
+uint64_t DatabaseMTCache::getCurrentSize(void)
+{
+    uint64_t usedEntries = 0;
+    uint64_t overflowEntries = 0;
+    for (uint64_t i = 0; i < DATABASE_MT_CACHE_SHARDS; i++)
+    {
+        usedEntries += shards[i].usedEntries.load(memory_order_relaxed);
+        overflowEntries += shards[i].overflowEntries.load(memory_order_relaxed);
+    }
+    return usedEntries*sizeof(DatabaseMTCacheEntry) + overflowEntries*(sizeof(array<uint64_t, 4>) + sizeof(DatabaseMTCacheOverflowValue));
+}
+
+void DatabaseMTCache::getShardStats(uint64_t shard, uint64_t &hits, uint64_t &misses, uint64_t &evictions)
+{
+    zkassert(shard < DATABASE_MT_CACHE_SHARDS);
+    hits = shards[shard].hits.load(memory_order_relaxed);
+    misses = shards[shard].misses.load(memory_order_relaxed);
+    evictions = shards[shard].evictions.load(memory_order_relaxed);
 }
 
-void DatabaseMTCache::updateRecord(DatabaseCacheRecord* record, const void * value)
+void DatabaseMTCache::print(bool printContent)
 {
-    *(vector<Goldilocks::Element>*)(record->value) = *(vector<Goldilocks::Element>*)(value);
+    uint64_t hits = 0, misses = 0, evictions = 0;
+    for (uint64_t i = 0; i < DATABASE_MT_CACHE_SHARDS; i++)
+    {
+        uint64_t shardHits, shardMisses, shardEvictions;
+        getShardStats(i, shardHits, shardMisses, shardEvictions);
+        if (printContent)
+        {
+            cout << "Shard " << i << ": used entries=" << shards[i].usedEntries << " overflow entries=" << shards[i].overflowEntries << " hits=" << shardHits << " misses=" << shardMisses << " evictions=" << shardEvictions << endl;
+        }
+        hits += shardHits;
+        misses += shardMisses;
+        evictions += shardEvictions;
+    }
+    cout << "Cache " << name << " current size: " << getCurrentSize() << endl;
+    cout << "Cache max size: " << maxSize << endl;
+    cout << "Cache shards: " << numberOfShards << " buckets per shard: " << (maxSize > 0 ? shards[0].numberOfBuckets : 0) << " ways: " << DATABASE_MT_CACHE_WAYS << " eviction: " << (bEviction ? "enabled" : "disabled") << endl;
+    cout << "Cache hits: " << hits << " misses: " << misses << " evictions: " << evictions << " hit ratio=" << ((hits + misses) > 0 ? double(hits)*100.0/double(hits + misses) : 0) << "%" << endl;
 }
 
 // DatabaseProgramCache class implementation
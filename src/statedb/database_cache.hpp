@@ -5,6 +5,9 @@
 #include "goldilocks_base_field.hpp"
 #include <nlohmann/json.hpp>
 #include <mutex>
+#include <atomic>
+#include <array>
+#include <unordered_map>
 
 using namespace std;
 using json = nlohmann::json;
@@ -54,14 +57,101 @@ public:
     void print(bool printContent);
 };
 
-class DatabaseMTCache : public DatabaseCache
+// Number of shards of the MT cache, each one with its own write mutex and counters; must be a power of 2
+#define DATABASE_MT_CACHE_SHARDS 256
+
+// Number of entries per bucket of the MT cache; a key can only be stored in the entries of its bucket
+#define DATABASE_MT_CACHE_WAYS 8
+
+// Maximum number of field elements of an MT cache value
+#define DATABASE_MT_CACHE_VALUE_SIZE 12
+
+// MT cache entry.  Writers are serialized by the shard mutex, and they make sequence odd while they
+// modify the entry, so that readers can copy it without locks and retry if it changed meanwhile
+struct DatabaseMTCacheEntry
 {
-public:  
-    bool add(const string &key, const vector<Goldilocks::Element> &value, const bool update); // returns true if cache is full
-    bool find(const string &key, vector<Goldilocks::Element> &value);
-    DatabaseCacheRecord* allocRecord(const string key, const void * value);
-    void freeRecord(DatabaseCacheRecord* record);
-    void updateRecord(DatabaseCacheRecord* record, const void * value);
+    atomic<uint64_t> sequence;
+    atomic<uint64_t> key[4];
+    atomic<uint64_t> value[DATABASE_MT_CACHE_VALUE_SIZE];
+    atomic<uint64_t> size; // Number of elements of value, or 0 if the entry is free
+    atomic<uint8_t> referenced; // CLOCK reference bit, set when the entry is used
+};
+
+// Value of a record that did not fit in its bucket and could not evict another one
+struct DatabaseMTCacheOverflowValue
+{
+    uint64_t size;
+    uint64_t value[DATABASE_MT_CACHE_VALUE_SIZE];
+};
+
+// Keys are hashes, so any of their elements is already a good hash
+struct DatabaseMTCacheKeyHash
+{
+    size_t operator()(const array<uint64_t, 4> &key) const { return key[2]; };
+};
+
+struct alignas(64) DatabaseMTCacheShard
+{
+    mutex writeMutex;
+    DatabaseMTCacheEntry * entries; // numberOfBuckets*DATABASE_MT_CACHE_WAYS entries
+    uint8_t * hands; // CLOCK hand of every bucket, protected by writeMutex
+    uint64_t numberOfBuckets;
+    unordered_map<array<uint64_t, 4>, DatabaseMTCacheOverflowValue, DatabaseMTCacheKeyHash> overflow; // Protected by writeMutex
+    atomic<uint64_t> overflowEntries; // overflow.size(), read by find() without the mutex
+    atomic<uint64_t> usedEntries;
+    atomic<uint64_t> hits;
+    atomic<uint64_t> misses;
+    atomic<uint64_t> evictions;
+};
+
+// Cache of MT nodes, keyed by their 4 field elements hash.  It is split in shards by the key, every
+// shard is a set-associative table, and eviction within a bucket follows the CLOCK algorithm.
+// When eviction is disabled, because the cache is the only storage of the database (local mode), a
+// record that does not fit in its bucket goes to the overflow map of its shard instead
+class DatabaseMTCache
+{
+private:
+    uint64_t maxSize;
+    uint64_t numberOfShards; // Shards in use, a power of 2 not greater than DATABASE_MT_CACHE_SHARDS
+    bool bEviction;
+    DatabaseMTCacheShard shards[DATABASE_MT_CACHE_SHARDS];
+    string name;
+
+    void freeEntries(void);
+    DatabaseMTCacheEntry * getBucket(const uint64_t (&key)[4], DatabaseMTCacheShard * &pShard);
+    void writeEntry(DatabaseMTCacheEntry &entry, const uint64_t (&key)[4], const Goldilocks::Element * value, const uint64_t size);
+
+public:
+    DatabaseMTCache() : maxSize(0), numberOfShards(0), bEviction(true)
+    {
+        for (uint64_t i = 0; i < DATABASE_MT_CACHE_SHARDS; i++)
+        {
+            shards[i].entries = NULL;
+            shards[i].hands = NULL;
+            shards[i].numberOfBuckets = 0;
+            shards[i].overflowEntries = 0;
+            shards[i].usedEntries = 0;
+            shards[i].hits = 0;
+            shards[i].misses = 0;
+            shards[i].evictions = 0;
+        }
+    };
+    ~DatabaseMTCache() { freeEntries(); };
+
+    bool add(const Goldilocks::Element (&key)[4], const Goldilocks::Element * value, const uint64_t size, const bool update); // returns true if a record had to be evicted (or no cache)
+    bool add(const Goldilocks::Element (&key)[4], const vector<Goldilocks::Element> &value, const bool update) { return add(key, value.data(), value.size(), update); };
+    bool find(const Goldilocks::Element (&key)[4], Goldilocks::Element (&value)[DATABASE_MT_CACHE_VALUE_SIZE], uint64_t &size); // value elements beyond size are set to zero
+    bool find(const Goldilocks::Element (&key)[4], vector<Goldilocks::Element> &value);
+
+    uint64_t getMaxSize(void) { return maxSize; };
+    uint64_t getCurrentSize(void);
+    bool enabled() { return (maxSize > 0); };
+    void setMaxSize(int64_t size); // size is in bytes, 0 = no cache; must be called before the cache is used
+    void setEviction(bool enabled) { bEviction = enabled; }; // Must be called before the cache is used
+    void setName(const char * pChar) { name = pChar; };
+    uint64_t getNumberOfShards(void) { return numberOfShards; };
+    void getShardStats(uint64_t shard, uint64_t &hits, uint64_t &misses, uint64_t &evictions);
+    void print(bool printContent);
 };
 
 class DatabaseProgramCache : public DatabaseCache
@@ -10,6 +10,17 @@ void DatabaseMap::add(const string key, vector<Goldilocks::Element> value)
     if (callbackOnChange) onChangeCallback();
 }
 
+void DatabaseMap::add(const Goldilocks::Element (&key)[4], const Goldilocks::Element (&value)[12])
+{
+    lock_guard<recursive_mutex> guard(mlock);
+
+    DatabaseMapKey mapKey;
+    for (uint64_t i=0; i<4; i++) mapKey.fe[i] = Goldilocks::toU64(key[i]);
+    array<Goldilocks::Element, 12> &mapValue = mtBinaryDB[mapKey];
+    for (uint64_t i=0; i<12; i++) mapValue[i] = value[i];
+    if (callbackOnChange) onChangeCallback();
+}
+
 void DatabaseMap::add(const string key, vector<uint8_t> value)
 {
     lock_guard<recursive_mutex> guard(mlock);
@@ -46,6 +57,37 @@ bool DatabaseMap::findMT(const string key, vector<Goldilocks::Element> &value)
         return true;
     }
 
+    // Look for it also among the nodes added with a binary key
+    if (mtBinaryDB.size() > 0)
+    {
+        Goldilocks fr;
+        Goldilocks::Element keyFea[4];
+        Goldilocks::Element valueFea[12];
+        string2fea(fr, key, keyFea);
+        if (findMT(keyFea, valueFea))
+        {
+            value.assign(valueFea, valueFea + 12);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool DatabaseMap::findMT(const Goldilocks::Element (&key)[4], Goldilocks::Element (&value)[12])
+{
+    lock_guard<recursive_mutex> guard(mlock);
+
+    DatabaseMapKey mapKey;
+    for (uint64_t i=0; i<4; i++) mapKey.fe[i] = Goldilocks::toU64(key[i]);
+    DatabaseMap::MTBinaryMap::iterator it = mtBinaryDB.find(mapKey);
+
+    if (it != mtBinaryDB.end())
+    {
+        for (uint64_t i=0; i<12; i++) value[i] = it->second[i];
+        return true;
+    }
+
     return false;
 }
 
@@ -68,7 +110,18 @@ DatabaseMap::MTMap DatabaseMap::getMTDB()
 {
     lock_guard<recursive_mutex> guard(mlock);
 
-    return mtDB;
+    if (mtBinaryDB.size() == 0) return mtDB;
+
+    // Convert the binary keys to the same string format used by Database
+    Goldilocks fr;
+    MTMap result = mtDB;
+    for (DatabaseMap::MTBinaryMap::const_iterator it = mtBinaryDB.begin(); it != mtBinaryDB.end(); it++)
+    {
+        Goldilocks::Element key[4];
+        for (uint64_t i=0; i<4; i++) key[i] = Goldilocks::fromU64(it->first.fe[i]);
+        result[fea2string64(fr, key)] = vector<Goldilocks::Element>(it->second.begin(), it->second.end());
+    }
+    return result;
 }
 
 DatabaseMap::ProgramMap DatabaseMap::getProgramDB()
@@ -2,6 +2,8 @@
 #define DATABASE_MAP_HPP
 
 #include <vector>
+#include <array>
+#include <unordered_map>
 #include "goldilocks_base_field.hpp"
 #include <nlohmann/json.hpp>
 #include <mutex>
@@ -12,17 +14,35 @@ using json = nlohmann::json;
 class DatabaseMap;
 
 
+// Binary key of an MT node, i.e. its hash
+struct DatabaseMapKey
+{
+    uint64_t fe[4];
+    bool operator==(const DatabaseMapKey &other) const
+    {
+        return (fe[0] == other.fe[0]) && (fe[1] == other.fe[1]) && (fe[2] == other.fe[2]) && (fe[3] == other.fe[3]);
+    }
+};
+
+// Keys are hashes, so any of their elements is already a good hash
+struct DatabaseMapKeyHash
+{
+    size_t operator()(const DatabaseMapKey &key) const { return key.fe[0]; }
+};
+
 class DatabaseMap
 {
 public:
     typedef unordered_map<string, vector<Goldilocks::Element>> MTMap;
     typedef unordered_map<string, vector<uint8_t>> ProgramMap;
+    typedef unordered_map<DatabaseMapKey, array<Goldilocks::Element, 12>, DatabaseMapKeyHash> MTBinaryMap;
 
 private:
     typedef void(*onChangeCallbackFunctionPtr)(void*, DatabaseMap *dbMap);
 
     recursive_mutex mlock;
     MTMap mtDB;
+    MTBinaryMap mtBinaryDB; // Nodes added with a binary key; converted to MTMap only by getMTDB()
     ProgramMap programDB;
     bool callbackOnChange = false;
     onChangeCallbackFunctionPtr cbFunction = NULL;
@@ -33,10 +53,12 @@ private:
 public:
     DatabaseMap(){};
     void add(const string key, vector<Goldilocks::Element> value);
+    void add(const Goldilocks::Element (&key)[4], const Goldilocks::Element (&value)[12]);
     void add(const string key, vector<uint8_t> value);
     void add(MTMap &db);
     void add(ProgramMap &db);
     bool findMT(const string key, vector<Goldilocks::Element> &value);
+    bool findMT(const Goldilocks::Element (&key)[4], Goldilocks::Element (&value)[12]);
     bool findProgram(const string key, vector<uint8_t> &value);
     MTMap getMTDB();
     ProgramMap getProgramDB();
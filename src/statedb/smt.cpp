@@ -5,6 +5,11 @@
 #include "zkmax.hpp"
 
 zkresult Smt::set(Database &db, const Goldilocks::Element (&oldRoot)[4], const Goldilocks::Element (&key)[4], const mpz_class &value, const bool persistent, SmtSetResult &result, DatabaseMap *dbReadLog)
+{
+    return set(db, oldRoot, key, value, persistent, result, dbReadLog, NULL);
+}
+
+zkresult Smt::set(Database &db, const Goldilocks::Element (&oldRoot)[4], const Goldilocks::Element (&key)[4], const mpz_class &value, const bool persistent, SmtSetResult &result, DatabaseMap *dbReadLog, DatabaseMap::MTBinaryMap *pBatchNodes)
 {
 #ifdef LOG_SMT
     cout << "Smt::set() called with oldRoot=" << fea2string(fr,oldRoot) << " key=" << fea2string(fr,key) << " value=" << value.get_str(16) << " persistent=" << persistent << endl;
@@ -45,18 +50,16 @@ zkresult Smt::set(Database &db, const Goldilocks::Element (&oldRoot)[4], const G
     while ( (!fr.isZero(r[0]) || !fr.isZero(r[1]) || !fr.isZero(r[2]) || !fr.isZero(r[3])) && !bFoundKey )
     {
         // Read the content of db for entry r: siblings[level] = db.read(r)
-        string rootString = fea2string(fr, r);
-        vector<Goldilocks::Element> dbValue;
-
-        dbres = db.read(rootString, dbValue, dbReadLog);
+        Goldilocks::Element dbValue[12];
+        dbres = readNode(db, r, dbValue, dbReadLog, pBatchNodes);
         if (dbres != ZKR_SUCCESS)
         {
-            cerr << "Error: Smt::set() db.read error: " << dbres << " (" << zkresult2string(dbres) << ") root:" << rootString << endl;
+            cerr << "Error: Smt::set() db.read error: " << dbres << " (" << zkresult2string(dbres) << ") root:" << fea2string(fr, r) << endl;
             return dbres;
         }
 
         // Get a copy of the content of this database entry, at the corresponding level: 0, 1...
-        siblings[level] = dbValue;
+        siblings[level].assign(dbValue, dbValue + 12);
 
         // if siblings[level][8]=1 then this is a leaf
         if ( siblings[level].size()>8 && fr.equal(siblings[level][8], fr.one()) )
@@ -66,12 +69,11 @@ zkresult Smt::set(Database &db, const Goldilocks::Element (&oldRoot)[4], const G
             foundOldValH[1] = siblings[level][5];
             foundOldValH[2] = siblings[level][6];
             foundOldValH[3] = siblings[level][7];
-            string valueHashString = fea2string(fr, foundOldValH);
-            vector<Goldilocks::Element> dbValue;
-            dbres = db.read(valueHashString, dbValue, dbReadLog);
+            Goldilocks::Element dbValue[12];
+            dbres = readNode(db, foundOldValH, dbValue, dbReadLog, pBatchNodes);
             if (dbres != ZKR_SUCCESS)
             {
-                cerr << "Error: Smt::set() db.read error: " << dbres << " (" << zkresult2string(dbres) << ") key:" << valueHashString << endl;
+                cerr << "Error: Smt::set() db.read error: " << dbres << " (" << zkresult2string(dbres) << ") key:" << fea2string(fr, foundOldValH) << endl;
                 return dbres;
             }
 
@@ -151,7 +153,7 @@ zkresult Smt::set(Database &db, const Goldilocks::Element (&oldRoot)[4], const G
 
                 // Save and get the new value hash
                 Goldilocks::Element newValH[4];
-                dbres = hashSave(db, v, c, persistent, newValH);
+                dbres = hashSave(db, v, c, persistent, newValH, pBatchNodes);
                 if (dbres != ZKR_SUCCESS)
                 {
                     return dbres;
@@ -166,7 +168,7 @@ zkresult Smt::set(Database &db, const Goldilocks::Element (&oldRoot)[4], const G
 
                 // Save and get the hash
                 Goldilocks::Element newLeafHash[4];
-                dbres = hashSave(db, v, c, persistent, newLeafHash);
+                dbres = hashSave(db, v, c, persistent, newLeafHash, pBatchNodes);
                 if (dbres != ZKR_SUCCESS)
                 {
                     return dbres;
@@ -228,7 +230,7 @@ zkresult Smt::set(Database &db, const Goldilocks::Element (&oldRoot)[4], const G
 
                 // Save and get the hash
                 Goldilocks::Element oldLeafHash[4];
-                dbres = hashSave(db, v, c, persistent, oldLeafHash);
+                dbres = hashSave(db, v, c, persistent, oldLeafHash, pBatchNodes);
                 if (dbres != ZKR_SUCCESS)
                 {
                     return dbres;
@@ -261,7 +263,7 @@ zkresult Smt::set(Database &db, const Goldilocks::Element (&oldRoot)[4], const G
 
                 // Create the intermediate node
                 Goldilocks::Element newValH[4];
-                dbres = hashSave(db, valueFea, c, persistent, newValH);
+                dbres = hashSave(db, valueFea, c, persistent, newValH, pBatchNodes);
                 if (dbres != ZKR_SUCCESS)
                 {
                     return dbres;
@@ -278,7 +280,7 @@ zkresult Smt::set(Database &db, const Goldilocks::Element (&oldRoot)[4], const G
 
                 // Create the node and store the hash in newLeafHash
                 Goldilocks::Element newLeafHash[4];
-                dbres = hashSave(db, v, c, persistent, newLeafHash);
+                dbres = hashSave(db, v, c, persistent, newLeafHash, pBatchNodes);
                 if (dbres != ZKR_SUCCESS)
                 {
                     return dbres;
@@ -299,7 +301,7 @@ zkresult Smt::set(Database &db, const Goldilocks::Element (&oldRoot)[4], const G
 
                 // Create the node and store the calculated hash in r2
                 Goldilocks::Element r2[4];
-                dbres = hashSave(db, node, c, persistent, r2);
+                dbres = hashSave(db, node, c, persistent, r2, pBatchNodes);
                 if (dbres != ZKR_SUCCESS)
                 {
                     return dbres;
@@ -326,7 +328,7 @@ zkresult Smt::set(Database &db, const Goldilocks::Element (&oldRoot)[4], const G
                     c[0] = fr.zero();
 
                     // Create the intermediate node and store the calculated hash in r2
-                    dbres = hashSave(db, node, c, persistent, r2);
+                    dbres = hashSave(db, node, c, persistent, r2, pBatchNodes);
                     if (dbres != ZKR_SUCCESS)
                     {
                         return dbres;
@@ -383,7 +385,7 @@ zkresult Smt::set(Database &db, const Goldilocks::Element (&oldRoot)[4], const G
 
             // Create the node and store the calculated hash in newValH
             Goldilocks::Element newValH[4];
-            dbres = hashSave(db, valueFea, c, persistent, newValH);
+            dbres = hashSave(db, valueFea, c, persistent, newValH, pBatchNodes);
             if (dbres != ZKR_SUCCESS)
             {
                 return dbres;
@@ -401,7 +403,7 @@ zkresult Smt::set(Database &db, const Goldilocks::Element (&oldRoot)[4], const G
 
             // Create the new leaf node and store the calculated hash in newLeafHash
             Goldilocks::Element newLeafHash[4];
-            dbres = hashSave(db, keyvalVector, c, persistent, newLeafHash);
+            dbres = hashSave(db, keyvalVector, c, persistent, newLeafHash, pBatchNodes);
             if (dbres != ZKR_SUCCESS)
             {
                 return dbres;
@@ -457,19 +459,18 @@ zkresult Smt::set(Database &db, const Goldilocks::Element (&oldRoot)[4], const G
                     // Calculate the key of the deleted element
                     Goldilocks::Element auxFea[4];
                     for (uint64_t i=0; i<4; i++) auxFea[i] = siblings[level][uKey*4+i];
-                    string auxString = fea2string(fr, auxFea);
 
                     // Read its 2 siblings
-                    vector<Goldilocks::Element> dbValue;
-                    dbres = db.read(auxString, dbValue, dbReadLog);
+                    Goldilocks::Element dbValue[12];
+                    dbres = readNode(db, auxFea, dbValue, dbReadLog, pBatchNodes);
                     if ( dbres != ZKR_SUCCESS)
                     {
-                        cerr << "Error: Smt::set() db.read error: " << dbres << " (" << zkresult2string(dbres) << ") root:" << auxString << endl;
+                        cerr << "Error: Smt::set() db.read error: " << dbres << " (" << zkresult2string(dbres) << ") root:" << fea2string(fr, auxFea) << endl;
                         return dbres;
                     }
 
                     // Store them in siblings
-                    siblings[level+1] = dbValue;
+                    siblings[level+1].assign(dbValue, dbValue + 12);
 
                     // If it is a leaf node
                     if ( siblings[level+1].size()>8 && fr.equal( siblings[level+1][8], fr.one() ) )
@@ -477,21 +478,15 @@ zkresult Smt::set(Database &db, const Goldilocks::Element (&oldRoot)[4], const G
                         // Calculate the value hash
                         Goldilocks::Element valH[4];
                         for (uint64_t i=0; i<4; i++) valH[i] = siblings[level+1][4+i];
-                        string valHString = fea2string(fr, valH);
 
                         // Read its siblings
-                        vector<Goldilocks::Element> dbValue;
-                        dbres = db.read(valHString, dbValue, dbReadLog);
+                        Goldilocks::Element dbValue[12];
+                        dbres = readNode(db, valH, dbValue, dbReadLog, pBatchNodes);
                         if (dbres != ZKR_SUCCESS)
                         {
-                            cerr << "Error: Smt::set() db.read error: " << dbres << " (" << zkresult2string(dbres) << ") root:" << valHString << endl;
+                            cerr << "Error: Smt::set() db.read error: " << dbres << " (" << zkresult2string(dbres) << ") root:" << fea2string(fr, valH) << endl;
                             return dbres;
                         }
-                        else if (dbValue.size()<8)
-                        {
-                            cerr << "Error: Smt::set() dbValue.size()<8 root:" << valHString << endl;
-                            return ZKR_SMT_INVALID_DATA_SIZE;
-                        }
 
                         // Store the value as a scalar in val
                         Goldilocks::Element valA[8];
@@ -539,7 +534,7 @@ zkresult Smt::set(Database &db, const Goldilocks::Element (&oldRoot)[4], const G
 
                         // Create node and store computed hash in oldLeafHash
                         Goldilocks::Element oldLeafHash[4];
-                        dbres = hashSave(db, a, c, persistent, oldLeafHash);
+                        dbres = hashSave(db, a, c, persistent, oldLeafHash, pBatchNodes);
                         if (dbres != ZKR_SUCCESS)
                         {
                             return dbres;
@@ -624,7 +619,7 @@ zkresult Smt::set(Database &db, const Goldilocks::Element (&oldRoot)[4], const G
         Goldilocks::Element a[8], c[4];
         for (uint64_t i=0; i<8; i++) a[i] = siblings[level][i];
         for (uint64_t i=0; i<4; i++) c[i] = siblings[level][8+i];
-        dbres = hashSave(db, a, c, persistent, newRoot);
+        dbres = hashSave(db, a, c, persistent, newRoot, pBatchNodes);
         if (dbres != ZKR_SUCCESS)
         {
             return dbres;
@@ -645,7 +640,8 @@ zkresult Smt::set(Database &db, const Goldilocks::Element (&oldRoot)[4], const G
         }
     }
 
-    if ( persistent &&
+    // Batches save the state root only once, after their last set
+    if ( persistent && (pBatchNodes == NULL) &&
          (
             !fr.equal(oldRoot[0], newRoot[0]) ||
             !fr.equal(oldRoot[1], newRoot[1]) ||
@@ -695,6 +691,11 @@ zkresult Smt::set(Database &db, const Goldilocks::Element (&oldRoot)[4], const G
 }
 
 zkresult Smt::get(Database &db, const Goldilocks::Element (&root)[4], const Goldilocks::Element (&key)[4], SmtGetResult &result, DatabaseMap *dbReadLog)
+{
+    return get(db, root, key, result, dbReadLog, NULL);
+}
+
+zkresult Smt::get(Database &db, const Goldilocks::Element (&root)[4], const Goldilocks::Element (&key)[4], SmtGetResult &result, DatabaseMap *dbReadLog, DatabaseMap::MTBinaryMap *pBatchNodes)
 {
 #ifdef LOG_SMT
     cout << "Smt::get() called with root=" << fea2string(fr,root) << " and key=" << fea2string(fr,key) << endl;
@@ -736,17 +737,16 @@ zkresult Smt::get(Database &db, const Goldilocks::Element (&root)[4], const Gold
     while ( ( !fr.isZero(r[0]) || !fr.isZero(r[1]) || !fr.isZero(r[2]) || !fr.isZero(r[3]) ) && !bFoundKey )
     {
         // Read the content of db for entry r: siblings[level] = db.read(r)
-        string rString = fea2string(fr, r);
-        vector<Goldilocks::Element> dbValue;
-        dbres = db.read(rString, dbValue, dbReadLog);
+        Goldilocks::Element dbValue[12];
+        dbres = readNode(db, r, dbValue, dbReadLog, pBatchNodes);
         if (dbres != ZKR_SUCCESS)
         {
-            cerr << "Error: Smt::get() db.read error: " << dbres << " (" << zkresult2string(dbres) << ") root:" << rString << endl;
+            cerr << "Error: Smt::get() db.read error: " << dbres << " (" << zkresult2string(dbres) << ") root:" << fea2string(fr, r) << endl;
             return dbres;
         }
 
         // Get a copy of the content of this database entry, at the corresponding level: 0, 1...
-        siblings[level] = dbValue;
+        siblings[level].assign(dbValue, dbValue + 12);
 
         // if siblings[level][8]=1 then this is a leaf
         if (siblings[level].size()>8 && fr.equal(siblings[level][8], fr.one()))
@@ -757,12 +757,11 @@ zkresult Smt::get(Database &db, const Goldilocks::Element (&root)[4], const Gold
             valueHashFea[1] = siblings[level][5];
             valueHashFea[2] = siblings[level][6];
             valueHashFea[3] = siblings[level][7];
-            string valueHashString = fea2string(fr, valueHashFea);
-            vector<Goldilocks::Element> dbValue;
-            dbres = db.read(valueHashString, dbValue, dbReadLog);
+            Goldilocks::Element dbValue[12];
+            dbres = readNode(db, valueHashFea, dbValue, dbReadLog, pBatchNodes);
             if (dbres != ZKR_SUCCESS)
             {
-                cerr << "Error: Smt::get() db.read error: " << dbres << " (" << zkresult2string(dbres) << ") root:" << valueHashString << endl;
+                cerr << "Error: Smt::get() db.read error: " << dbres << " (" << zkresult2string(dbres) << ") root:" << fea2string(fr, valueHashFea) << endl;
                 return dbres;
             }
 
@@ -873,6 +872,93 @@ zkresult Smt::get(Database &db, const Goldilocks::Element (&root)[4], const Gold
     return ZKR_SUCCESS;
 }
 
+zkresult Smt::getBatch(Database &db, const Goldilocks::Element (&root)[4], const vector<SmtKeyValue> &keyValues, vector<SmtGetResult> &results, DatabaseMap *dbReadLog)
+{
+    // Nodes read by any get of the batch, shared by the rest of gets, since the paths of all keys
+    // start at the same root
+    DatabaseMap::MTBinaryMap batchNodes;
+
+    results.resize(keyValues.size());
+    for (uint64_t i=0; i<keyValues.size(); i++)
+    {
+        zkresult zkr = get(db, root, keyValues[i].key, results[i], dbReadLog, &batchNodes);
+        if (zkr != ZKR_SUCCESS)
+        {
+            cerr << "Error: Smt::getBatch() failed calling get() i=" << i << " key=" << fea2string(fr, keyValues[i].key) << " result=" << zkr << "=" << zkresult2string(zkr) << endl;
+            return zkr;
+        }
+    }
+
+    return ZKR_SUCCESS;
+}
+
+zkresult Smt::setBatch(Database &db, const Goldilocks::Element (&oldRoot)[4], const vector<SmtKeyValue> &keyValues, const bool persistent, Goldilocks::Element (&newRoot)[4], vector<SmtSetResult> &results, DatabaseMap *dbReadLog)
+{
+    // Nodes read or written by any set of the batch; every set starts at the root written by the
+    // previous one, so the upper levels of its path are always found here
+    DatabaseMap::MTBinaryMap batchNodes;
+
+    for (uint64_t i=0; i<4; i++) newRoot[i] = oldRoot[i];
+
+    results.resize(keyValues.size());
+    for (uint64_t i=0; i<keyValues.size(); i++)
+    {
+        zkresult zkr = set(db, newRoot, keyValues[i].key, keyValues[i].value, persistent, results[i], dbReadLog, &batchNodes);
+        if (zkr != ZKR_SUCCESS)
+        {
+            cerr << "Error: Smt::setBatch() failed calling set() i=" << i << " key=" << fea2string(fr, keyValues[i].key) << " result=" << zkr << "=" << zkresult2string(zkr) << endl;
+            return zkr;
+        }
+        for (uint64_t j=0; j<4; j++) newRoot[j] = results[i].newRoot[j];
+    }
+
+    if ( persistent &&
+         (
+            !fr.equal(oldRoot[0], newRoot[0]) ||
+            !fr.equal(oldRoot[1], newRoot[1]) ||
+            !fr.equal(oldRoot[2], newRoot[2]) ||
+            !fr.equal(oldRoot[3], newRoot[3])
+        ) )
+    {
+        zkresult zkr = saveStateRoot(db, newRoot);
+        if (zkr != ZKR_SUCCESS)
+        {
+            return zkr;
+        }
+    }
+
+    return ZKR_SUCCESS;
+}
+
+zkresult Smt::readNode(Database &db, const Goldilocks::Element (&key)[4], Goldilocks::Element (&value)[12], DatabaseMap *dbReadLog, DatabaseMap::MTBinaryMap *pBatchNodes)
+{
+    if (pBatchNodes == NULL)
+    {
+        return db.read(key, value, dbReadLog);
+    }
+
+    DatabaseMapKey mapKey;
+    for (uint64_t i=0; i<4; i++) mapKey.fe[i] = fr.toU64(key[i]);
+
+    // Nodes already used by the batch are not read again, but they are still reported in the read
+    // log, as the same individual read would have done
+    DatabaseMap::MTBinaryMap::const_iterator it = pBatchNodes->find(mapKey);
+    if (it != pBatchNodes->end())
+    {
+        for (uint64_t i=0; i<12; i++) value[i] = it->second[i];
+        if (dbReadLog != NULL) dbReadLog->add(key, value);
+        return ZKR_SUCCESS;
+    }
+
+    zkresult zkr = db.read(key, value, dbReadLog);
+    if (zkr == ZKR_SUCCESS)
+    {
+        array<Goldilocks::Element, 12> &mapValue = (*pBatchNodes)[mapKey];
+        for (uint64_t i=0; i<12; i++) mapValue[i] = value[i];
+    }
+    return zkr;
+}
+
 // Split the fe key into 4-bits chuncks, e.g. 0x123456EF -> { 1, 2, 3, 4, 5, 6, E, F }
 void Smt::splitKey ( const Goldilocks::Element (&key)[4], vector<uint64_t> &result )
 {
@@ -952,7 +1038,7 @@ void Smt::removeKeyBits ( const Goldilocks::Element (&key)[4], uint64_t nBits, G
     }
 }
 
-zkresult Smt::hashSave ( Database &db, const Goldilocks::Element (&a)[8], const Goldilocks::Element (&c)[4], const bool persistent, Goldilocks::Element (&hash)[4])
+zkresult Smt::hashSave ( Database &db, const Goldilocks::Element (&a)[8], const Goldilocks::Element (&c)[4], const bool persistent, Goldilocks::Element (&hash)[4], DatabaseMap::MTBinaryMap *pBatchNodes)
 {
     // Calculate the poseidon hash of the vector of field elements: v = a | c
     Goldilocks::Element v[12];
@@ -960,23 +1046,26 @@ zkresult Smt::hashSave ( Database &db, const Goldilocks::Element (&a)[8], const
     for (uint64_t i=0; i<4; i++) v[8+i] = c[i];
     poseidon.hash(hash, v);
 
-    // Fill a database value with the field elements
-    string hashString = fea2string(fr, hash);
+    // Let the next sets of the batch, if any, find this node without reading the database
+    if (pBatchNodes != NULL)
+    {
+        DatabaseMapKey mapKey;
+        for (uint64_t i=0; i<4; i++) mapKey.fe[i] = fr.toU64(hash[i]);
+        array<Goldilocks::Element, 12> &mapValue = (*pBatchNodes)[mapKey];
+        for (uint64_t i=0; i<12; i++) mapValue[i] = v[i];
+    }
 
     // Add the key:value pair to the database, using the hash as a key
-    vector<Goldilocks::Element> dbValue;
-    for (uint64_t i=0; i<8; i++) dbValue.push_back(a[i]);
-    for (uint64_t i=0; i<4; i++) dbValue.push_back(c[i]);
     zkresult zkr;
-    zkr = db.write(hashString, dbValue, persistent);
+    zkr = db.write(hash, v, persistent);
     if (zkr != ZKR_SUCCESS)
     {
-        cerr << "Error: Smt::hashSave() failed calling db.write() key=" << hashString << " result=" << zkr << "=" << zkresult2string(zkr) << endl;
+        cerr << "Error: Smt::hashSave() failed calling db.write() key=" << fea2string(fr, hash) << " result=" << zkr << "=" << zkresult2string(zkr) << endl;
     }
 
 #ifdef LOG_SMT
-    cout << "Smt::hashSave() key=" << hashString << " value=";
-    for (uint64_t i=0; i<12; i++) cout << fr.toString(dbValue[i],16) << ":";
+    cout << "Smt::hashSave() key=" << fea2string(fr, hash) << " value=";
+    for (uint64_t i=0; i<12; i++) cout << fr.toString(v[i],16) << ":";
     cout << " zkr=" << zkr;
     cout << endl;
 #endif
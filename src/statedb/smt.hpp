@@ -47,20 +47,40 @@ public:
     string toString (Goldilocks &fr);
 };
 
+// SMT batch get/set method input data
+class SmtKeyValue
+{
+public:
+    Goldilocks::Element key[4];
+    mpz_class value; // value to set; ignored by getBatch()
+};
+
 // SMT class
 class Smt
 {
 private:
     Goldilocks  &fr;
     PoseidonGoldilocks poseidon;
+
+    // Batch versions of set and get: nodes are read from, and written to, pBatchNodes too
+    zkresult set(Database &db, const Goldilocks::Element (&oldRoot)[4], const Goldilocks::Element (&key)[4], const mpz_class &value, const bool persistent, SmtSetResult &result, DatabaseMap *dbReadLog, DatabaseMap::MTBinaryMap *pBatchNodes);
+    zkresult get(Database &db, const Goldilocks::Element (&root)[4], const Goldilocks::Element (&key)[4], SmtGetResult &result, DatabaseMap *dbReadLog, DatabaseMap::MTBinaryMap *pBatchNodes);
+    zkresult readNode(Database &db, const Goldilocks::Element (&key)[4], Goldilocks::Element (&value)[12], DatabaseMap *dbReadLog, DatabaseMap::MTBinaryMap *pBatchNodes);
 public:
     Smt(Goldilocks &fr) : fr(fr) {}
     zkresult set(Database &db, const Goldilocks::Element (&oldRoot)[4], const Goldilocks::Element (&key)[4], const mpz_class &value, const bool persistent, SmtSetResult &result, DatabaseMap *dbReadLog = NULL);
     zkresult get(Database &db, const Goldilocks::Element (&root)[4], const Goldilocks::Element (&key)[4], SmtGetResult &result, DatabaseMap *dbReadLog = NULL);
+
+    // Gets the values of several keys from the same root, reading every tree node only once
+    zkresult getBatch(Database &db, const Goldilocks::Element (&root)[4], const vector<SmtKeyValue> &keyValues, vector<SmtGetResult> &results, DatabaseMap *dbReadLog = NULL);
+
+    // Sets several key-values in order, i.e. as consecutive set() calls, where every set starts at the
+    // new root of the previous one; newRoot is the root after the last set
+    zkresult setBatch(Database &db, const Goldilocks::Element (&oldRoot)[4], const vector<SmtKeyValue> &keyValues, const bool persistent, Goldilocks::Element (&newRoot)[4], vector<SmtSetResult> &results, DatabaseMap *dbReadLog = NULL);
     void splitKey(const Goldilocks::Element (&key)[4], vector<uint64_t> &result);
     void joinKey(const vector<uint64_t> &bits, const Goldilocks::Element (&rkey)[4], Goldilocks::Element (&key)[4]);
     void removeKeyBits(const Goldilocks::Element (&key)[4], uint64_t nBits, Goldilocks::Element (&rkey)[4]);
-    zkresult hashSave(Database &db, const Goldilocks::Element (&a)[8], const Goldilocks::Element (&c)[4], const bool persistent, Goldilocks::Element (&hash)[4]);
+    zkresult hashSave(Database &db, const Goldilocks::Element (&a)[8], const Goldilocks::Element (&c)[4], const bool persistent, Goldilocks::Element (&hash)[4], DatabaseMap::MTBinaryMap *pBatchNodes = NULL);
     zkresult saveStateRoot(Database &db, const Goldilocks::Element (&stateRoot)[4]);
     int64_t getUniqueSibling(vector<Goldilocks::Element> &a);
 };
@@ -0,0 +1,154 @@
+#ifndef ACTION_LOG_HPP
+#define ACTION_LOG_HPP
+
+#include <atomic>
+#include <iostream>
+#include <new>
+#include <pthread.h>
+#include "exit_process.hpp"
+
+// Append-only log of state machine actions, written by one producer thread (the main executor) and
+// read, at the same time, by one consumer thread (a secondary executor).
+// Elements are stored in fixed size chunks that are never moved, so that an element can be read
+// without locks as soon as it has been published, while new elements are still being appended.
+// A consumer that catches up with the producer blocks on a condition variable; the producer only
+// takes the mutex to signal it when consumerWaiting is set, so appending stays lock-free otherwise.
+template <class T>
+class ActionLog
+{
+private:
+    static const uint64_t chunkBits = 14;
+    static const uint64_t chunkSize = 1 << chunkBits; // Elements per chunk
+    static const uint64_t maxChunks = 4096;            // Up to 2^26 elements
+
+    T **chunks;                           // Table of chunks, allocated when first used
+    uint64_t producerSize;                // Number of elements, only accessed by the producer
+    std::atomic<uint64_t> publishedSize;  // Number of elements visible to the consumer
+    std::atomic<bool> closed;             // Set by the producer when no more elements will be added
+    mutable std::atomic<bool> consumerWaiting; // Set by the consumer while it waits for the producer
+    mutable pthread_mutex_t mutex;        // Protects the wait of the consumer
+    mutable pthread_cond_t cond;          // Signaled by the producer when consumerWaiting is set
+
+    T *slot(uint64_t i)
+    {
+        uint64_t chunk = i >> chunkBits;
+        if (chunk >= maxChunks)
+        {
+            std::cerr << "Error: ActionLog::push_back() exceeded the maximum number of elements=" << maxChunks * chunkSize << std::endl;
+            exitProcess();
+        }
+        if (chunks[chunk] == NULL)
+        {
+            chunks[chunk] = (T *)::operator new(chunkSize * sizeof(T));
+        }
+        return &chunks[chunk][i & (chunkSize - 1)];
+    }
+
+    // Publishes the producer size and wakes up the consumer if it is waiting; the size store and the
+    // consumerWaiting load are sequentially consistent, as the consumer ones, so that either the
+    // producer sees the flag or the consumer sees the new size
+    void publish(void)
+    {
+        publishedSize.store(producerSize, std::memory_order_seq_cst);
+        if (consumerWaiting.load(std::memory_order_seq_cst))
+        {
+            pthread_mutex_lock(&mutex);
+            pthread_cond_signal(&cond);
+            pthread_mutex_unlock(&mutex);
+        }
+    }
+
+public:
+    ActionLog() : producerSize(0), publishedSize(0), closed(false), consumerWaiting(false)
+    {
+        chunks = new T *[maxChunks]();
+        pthread_mutex_init(&mutex, NULL);
+        pthread_cond_init(&cond, NULL);
+    }
+
+    ~ActionLog()
+    {
+        for (uint64_t i = 0; i < producerSize; i++)
+        {
+            (*this)[i].~T();
+        }
+        for (uint64_t c = 0; c < maxChunks; c++)
+        {
+            if (chunks[c] != NULL)
+            {
+                ::operator delete(chunks[c]);
+            }
+        }
+        delete[] chunks;
+        pthread_cond_destroy(&cond);
+        pthread_mutex_destroy(&mutex);
+    }
+
+    ActionLog(const ActionLog &) = delete;
+    ActionLog &operator=(const ActionLog &) = delete;
+
+    // Producer interface
+    void push_back(const T &element)
+    {
+        new (slot(producerSize)) T(element);
+        producerSize++;
+        publish();
+    }
+
+    void push_back(T &&element)
+    {
+        new (slot(producerSize)) T(std::move(element));
+        producerSize++;
+        publish();
+    }
+
+    void close(void)
+    {
+        pthread_mutex_lock(&mutex);
+        closed.store(true, std::memory_order_seq_cst);
+        pthread_cond_signal(&cond);
+        pthread_mutex_unlock(&mutex);
+    }
+
+    // Consumer interface
+    uint64_t size(void) const
+    {
+        return publishedSize.load(std::memory_order_acquire);
+    }
+
+    bool isClosed(void) const
+    {
+        return closed.load(std::memory_order_acquire);
+    }
+
+    // Blocks until element i has been published, returning true, or until the log is closed without it,
+    // returning false
+    bool wait(uint64_t i) const
+    {
+        if (i < size())
+        {
+            return true;
+        }
+        pthread_mutex_lock(&mutex);
+        consumerWaiting.store(true, std::memory_order_seq_cst);
+        while ((i >= publishedSize.load(std::memory_order_seq_cst)) && !closed.load(std::memory_order_seq_cst))
+        {
+            pthread_cond_wait(&cond, &mutex);
+        }
+        consumerWaiting.store(false, std::memory_order_relaxed);
+        pthread_mutex_unlock(&mutex);
+        return i < size();
+    }
+
+    T &operator[](uint64_t i)
+    {
+        return chunks[i >> chunkBits][i & (chunkSize - 1)];
+    }
+
+    const T &operator[](uint64_t i) const
+    {
+        return chunks[i >> chunkBits][i & (chunkSize - 1)];
+    }
+};
+
+#endif
@@ -0,0 +1,160 @@
+#include <fstream>
+#include <iostream>
+#include <cstring>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "rom_image.hpp"
+#include "exit_process.hpp"
+
+uint64_t romImageHash (const uint8_t * pData, uint64_t size)
+{
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    uint64_t i = 0;
+    for (; i + 8 <= size; i += 8)
+    {
+        uint64_t word;
+        memcpy(&word, pData + i, 8);
+        hash = (hash ^ word) * 0x100000001b3ULL;
+    }
+    if (i < size)
+    {
+        uint64_t word = 0;
+        memcpy(&word, pData + i, size - i);
+        hash = (hash ^ word) * 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+string romImageFileName (const string &jsonFileName)
+{
+    if ((jsonFileName.size() > 5) && (jsonFileName.compare(jsonFileName.size() - 5, 5, ".json") == 0))
+    {
+        return jsonFileName.substr(0, jsonFileName.size() - 5) + ".bin";
+    }
+    return jsonFileName + ".bin";
+}
+
+// Reads the whole content of a file; returns false if it cannot be read
+static bool readFile (const string &fileName, string &content)
+{
+    ifstream inputStream(fileName, ios::binary);
+    if (!inputStream.good())
+    {
+        return false;
+    }
+    content.assign(istreambuf_iterator<char>(inputStream), istreambuf_iterator<char>());
+    return !inputStream.bad();
+}
+
+bool RomImage::map (const string &fileName, tRomImageType type, const string &sourceFileName)
+{
+    unmap();
+
+    int fd = open(fileName.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        return false;
+    }
+    struct stat sb;
+    if ((fstat(fd, &sb) != 0) || ((uint64_t)sb.st_size < sizeof(RomImageHeader)))
+    {
+        cerr << "Error: RomImage::map() found invalid size of image file " << fileName << endl;
+        close(fd);
+        return false;
+    }
+    void * pMap = mmap(NULL, sb.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (pMap == MAP_FAILED)
+    {
+        cerr << "Error: RomImage::map() failed calling mmap() of image file " << fileName << endl;
+        return false;
+    }
+    pAddress = pMap;
+    size = sb.st_size;
+
+    // Check the header and the payload
+    const RomImageHeader * pHeader = (const RomImageHeader *)pAddress;
+    const uint8_t * pData = (const uint8_t *)pAddress + sizeof(RomImageHeader);
+    if ( (memcmp(pHeader->magic, ROM_IMAGE_MAGIC, sizeof(pHeader->magic)) != 0) ||
+         (pHeader->version != ROM_IMAGE_VERSION) ||
+         (pHeader->type != type) ||
+         (pHeader->payloadSize != size - sizeof(RomImageHeader)) )
+    {
+        cerr << "Error: RomImage::map() found invalid header in image file " << fileName << ", it must be generated again" << endl;
+        unmap();
+        return false;
+    }
+    if (romImageHash(pData, pHeader->payloadSize) != pHeader->payloadHash)
+    {
+        cerr << "Error: RomImage::map() found invalid payload hash in image file " << fileName << endl;
+        unmap();
+        return false;
+    }
+
+    // If the source file is present, the image must have been generated from its current content
+    string source;
+    if (readFile(sourceFileName, source))
+    {
+        if ( (source.size() != pHeader->sourceSize) ||
+             (romImageHash((const uint8_t *)source.data(), source.size()) != pHeader->sourceHash) )
+        {
+            cerr << "Error: RomImage::map() found image file " << fileName << " was not generated from the current " << sourceFileName << ", it must be generated again" << endl;
+            unmap();
+            return false;
+        }
+    }
+
+    pPayload = pData;
+    payloadSize = pHeader->payloadSize;
+    return true;
+}
+
+void RomImage::unmap (void)
+{
+    if (pAddress != NULL)
+    {
+        munmap(pAddress, size);
+    }
+    pAddress = NULL;
+    size = 0;
+    pPayload = NULL;
+    payloadSize = 0;
+}
+
+void RomImage::write (const string &fileName, tRomImageType type, const string &payload, const string &sourceFileName)
+{
+    string source;
+    if (!readFile(sourceFileName, source))
+    {
+        cerr << "Error: RomImage::write() failed reading source file " << sourceFileName << endl;
+        exitProcess();
+    }
+
+    RomImageHeader header;
+    memcpy(header.magic, ROM_IMAGE_MAGIC, sizeof(header.magic));
+    header.version = ROM_IMAGE_VERSION;
+    header.type = type;
+    header.payloadSize = payload.size();
+    header.payloadHash = romImageHash((const uint8_t *)payload.data(), payload.size());
+    header.sourceSize = source.size();
+    header.sourceHash = romImageHash((const uint8_t *)source.data(), source.size());
+
+    // Written to a temporary file and then renamed, so that an executor never maps a partial image
+    string tmpFileName = fileName + "." + to_string(getpid()) + ".tmp";
+    ofstream outputStream(tmpFileName, ios::binary | ios::trunc);
+    outputStream.write((const char *)&header, sizeof(header));
+    outputStream.write(payload.data(), payload.size());
+    outputStream.close();
+    if (outputStream.fail())
+    {
+        cerr << "Error: RomImage::write() failed writing image file " << tmpFileName << endl;
+        exitProcess();
+    }
+    if (rename(tmpFileName.c_str(), fileName.c_str()) != 0)
+    {
+        cerr << "Error: RomImage::write() failed renaming " << tmpFileName << " to " << fileName << endl;
+        exitProcess();
+    }
+}
@@ -0,0 +1,115 @@
+#ifndef ROM_IMAGE_HPP
+#define ROM_IMAGE_HPP
+
+#include <string>
+#include <cstring>
+#include <cstdint>
+
+using namespace std;
+
+/* Binary images of the main SM ROM and of the Keccak-F script, generated from their JSON files by the
+   runRomImageGenerator tool and mapped into memory at start-up, to avoid parsing the JSON files.
+   An image is a RomImageHeader followed by a payload whose layout depends on the image type.
+   An image is only used if its magic, version, type and payload hash match, and, if the JSON file
+   it was generated from is present, if the size and hash of that JSON file match too; otherwise
+   the caller falls back to the JSON file */
+
+#define ROM_IMAGE_MAGIC "ZKROMIMG"
+#define ROM_IMAGE_VERSION 1
+
+typedef enum : uint32_t
+{
+    rit_mainRom = 1,        // Main SM ROM, as written by Rom::saveImage()
+    rit_keccakProgram = 2   // KeccakProgram arrays, as written by KeccakFExecutor::saveImage()
+} tRomImageType;
+
+class RomImageHeader
+{
+public:
+    char magic[8];          // ROM_IMAGE_MAGIC, without the trailing zero
+    uint32_t version;       // ROM_IMAGE_VERSION
+    uint32_t type;          // tRomImageType
+    uint64_t payloadSize;   // Bytes following the header
+    uint64_t payloadHash;   // romImageHash() of the payload
+    uint64_t sourceSize;    // Size of the JSON file the image was generated from
+    uint64_t sourceHash;    // romImageHash() of the JSON file the image was generated from
+};
+
+class RomImage
+{
+    void * pAddress;
+    uint64_t size;
+public:
+    const uint8_t * pPayload;
+    uint64_t payloadSize;
+
+    RomImage() : pAddress(NULL), size(0), pPayload(NULL), payloadSize(0) {};
+    ~RomImage() { unmap(); };
+
+    /* Maps the image file into memory and checks it; returns false if the file does not exist or is
+       not a valid image of the source file, without exiting */
+    bool map (const string &fileName, tRomImageType type, const string &sourceFileName);
+    void unmap (void);
+
+    /* Writes an image file with the provided payload, generated from the source file */
+    static void write (const string &fileName, tRomImageType type, const string &payload, const string &sourceFileName);
+};
+
+/* Sequential writer of an image payload */
+class RomImageWriter
+{
+public:
+    string data;
+    void writeU8  (uint8_t value) { data.append((const char *)&value, sizeof(value)); };
+    void writeU32 (uint32_t value) { data.append((const char *)&value, sizeof(value)); };
+    void writeU64 (uint64_t value) { data.append((const char *)&value, sizeof(value)); };
+    void writeString (const string &value) { writeU64(value.size()); data.append(value); };
+};
+
+/* Sequential reader of an image payload; reading past its end returns zeros and sets bError, so that
+   the caller only needs to check bError once done */
+class RomImageReader
+{
+    const uint8_t * p;
+    const uint8_t * pEnd;
+    void read (void * pValue, uint64_t size)
+    {
+        if ((uint64_t)(pEnd - p) < size)
+        {
+            memset(pValue, 0, size);
+            p = pEnd;
+            bError = true;
+            return;
+        }
+        memcpy(pValue, p, size);
+        p += size;
+    }
+public:
+    bool bError;
+    RomImageReader (const RomImage &image) : p(image.pPayload), pEnd(image.pPayload + image.payloadSize), bError(false) {};
+    uint8_t readU8 (void) { uint8_t value; read(&value, sizeof(value)); return value; };
+    uint32_t readU32 (void) { uint32_t value; read(&value, sizeof(value)); return value; };
+    uint64_t readU64 (void) { uint64_t value; read(&value, sizeof(value)); return value; };
+    void readString (string &value)
+    {
+        uint64_t size = readU64();
+        if ((uint64_t)(pEnd - p) < size)
+        {
+            value.clear();
+            p = pEnd;
+            bError = true;
+            return;
+        }
+        value.assign((const char *)p, size);
+        p += size;
+    };
+    bool isEnd (void) const { return p == pEnd; };
+};
+
+// FNV-1a hash, computed over 64-bit little-endian words, with the remaining bytes as a last word
+uint64_t romImageHash (const uint8_t * pData, uint64_t size);
+
+// Returns the image file name of a JSON file, e.g. "config/scripts/rom.bin" for "config/scripts/rom.json"
+string romImageFileName (const string &jsonFileName);
+
+#endif
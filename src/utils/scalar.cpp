@@ -75,6 +75,28 @@ void string2fea(Goldilocks &fr, const string os, vector<Goldilocks::Element> &fe
     }
 }
 
+// Inverse of fea2string(): parses a hexa string of up to 64 chars, with or without 0x, into 4 field elements
+void string2fea (Goldilocks &fr, const string &s, Goldilocks::Element (&fea)[4])
+{
+    uint64_t begin = ( (s.size() >= 2) && (s.at(1) == 'x') && (s.at(0) == '0') ) ? 2 : 0;
+    if (s.size() - begin > 64)
+    {
+        cerr << "Error: string2fea() found string too long: " << s << endl;
+        exitProcess();
+    }
+    uint64_t limbs[4] = {0, 0, 0, 0};
+    uint64_t bit = 0;
+    for (uint64_t i = s.size(); i > begin; i--)
+    {
+        limbs[bit >> 6] |= uint64_t(char2byte(s[i-1])) << (bit & 63);
+        bit += 4;
+    }
+    for (uint64_t i = 0; i < 4; i++)
+    {
+        fea[i] = fr.fromU64(limbs[i]);
+    }
+}
+
 string fea2string (Goldilocks &fr, const Goldilocks::Element(&fea)[4])
 {
     mpz_class auxScalar;
@@ -82,6 +104,14 @@ string fea2string (Goldilocks &fr, const Goldilocks::Element(&fea)[4])
     return auxScalar.get_str(16);
 }
 
+// Same as NormalizeToNFormat(fea2string(fr, fea), 64), without the intermediate scalar
+string fea2string64 (Goldilocks &fr, const Goldilocks::Element(&fea)[4])
+{
+    char buffer[65];
+    snprintf(buffer, sizeof(buffer), "%016lx%016lx%016lx%016lx", fr.toU64(fea[3]), fr.toU64(fea[2]), fr.toU64(fea[1]), fr.toU64(fea[0]));
+    return string(buffer, 64);
+}
+
 string fea2string (Goldilocks &fr, const Goldilocks::Element &fea0, const Goldilocks::Element &fea1, const Goldilocks::Element &fea2, const Goldilocks::Element &fea3)
 {
     const Goldilocks::Element fea[4] = {fea0, fea1, fea2, fea3};
@@ -0,0 +1,419 @@
+#ifndef U256_HPP
+#define U256_HPP
+
+#include <cstdint>
+#include <gmpxx.h>
+
+/* Fixed-width 256-bit unsigned integer, as 4 little-endian 64-bit limbs.  Every operation that can
+   leave the [0, 2^256) range returns false instead, so that the caller can fall back to mpz_class */
+
+class U256
+{
+public:
+    uint64_t limbs[4];
+};
+
+inline void u256Set (U256 &r, uint64_t a)
+{
+    r.limbs[0] = a;
+    r.limbs[1] = 0;
+    r.limbs[2] = 0;
+    r.limbs[3] = 0;
+}
+
+inline bool u256IsZero (const U256 &a)
+{
+    return (a.limbs[0] | a.limbs[1] | a.limbs[2] | a.limbs[3]) == 0;
+}
+
+// Returns -1, 0 or 1 if a is lower than, equal to or greater than b
+inline int u256Compare (const U256 &a, const U256 &b)
+{
+    for (int i = 3; i >= 0; i--)
+    {
+        if (a.limbs[i] != b.limbs[i])
+        {
+            return (a.limbs[i] > b.limbs[i]) ? 1 : -1;
+        }
+    }
+    return 0;
+}
+
+// Returns false if the scalar is negative or does not fit in 256 bits
+inline bool scalar2u256 (const mpz_class &s, U256 &r)
+{
+    if ((mpz_sgn(s.get_mpz_t()) < 0) || (mpz_sizeinbase(s.get_mpz_t(), 2) > 256))
+    {
+        return false;
+    }
+    u256Set(r, 0);
+    mpz_export(r.limbs, NULL, -1, sizeof(uint64_t), 0, 0, s.get_mpz_t());
+    return true;
+}
+
+// Does not allocate memory once the scalar has room for 4 limbs
+inline void u2562scalar (const U256 &a, mpz_class &s)
+{
+    mpz_import(s.get_mpz_t(), 4, -1, sizeof(uint64_t), 0, 0, a.limbs);
+}
+
+inline bool u256Add (const U256 &a, const U256 &b, U256 &r)
+{
+    unsigned __int128 carry = 0;
+    for (uint64_t i = 0; i < 4; i++)
+    {
+        carry += (unsigned __int128)a.limbs[i] + b.limbs[i];
+        r.limbs[i] = (uint64_t)carry;
+        carry >>= 64;
+    }
+    return carry == 0;
+}
+
+inline bool u256Sub (const U256 &a, const U256 &b, U256 &r)
+{
+    if (u256Compare(a, b) < 0)
+    {
+        return false;
+    }
+    uint64_t borrow = 0;
+    for (uint64_t i = 0; i < 4; i++)
+    {
+        unsigned __int128 diff = (unsigned __int128)a.limbs[i] - b.limbs[i] - borrow;
+        r.limbs[i] = (uint64_t)diff;
+        borrow = (uint64_t)(diff >> 64) & 1;
+    }
+    return true;
+}
+
+inline bool u256Mul (const U256 &a, const U256 &b, U256 &r)
+{
+    uint64_t result[4] = {0, 0, 0, 0};
+    for (uint64_t i = 0; i < 4; i++)
+    {
+        if (a.limbs[i] == 0)
+        {
+            continue;
+        }
+        unsigned __int128 carry = 0;
+        for (uint64_t j = 0; j < 4; j++)
+        {
+            unsigned __int128 product = (unsigned __int128)a.limbs[i] * b.limbs[j] + carry;
+            if (i + j < 4)
+            {
+                product += result[i + j];
+                result[i + j] = (uint64_t)product;
+            }
+            else if ((uint64_t)product != 0)
+            {
+                return false;
+            }
+            carry = product >> 64;
+        }
+        if (carry != 0)
+        {
+            return false;
+        }
+    }
+    for (uint64_t i = 0; i < 4; i++)
+    {
+        r.limbs[i] = result[i];
+    }
+    return true;
+}
+
+// Returns the number of significant bits of a, 0 if a is zero
+inline uint64_t u256Bits (const U256 &a)
+{
+    for (int i = 3; i >= 0; i--)
+    {
+        if (a.limbs[i] != 0)
+        {
+            return i*64 + 64 - __builtin_clzll(a.limbs[i]);
+        }
+    }
+    return 0;
+}
+
+// Computes the quotient and the remainder; returns false if b is zero
+inline bool u256DivMod (const U256 &a, const U256 &b, U256 &quotient, U256 &remainder)
+{
+    if (u256IsZero(b))
+    {
+        return false;
+    }
+    if (u256Compare(a, b) < 0)
+    {
+        remainder = a;
+        u256Set(quotient, 0);
+        return true;
+    }
+    U256 q;
+    if ((b.limbs[1] | b.limbs[2] | b.limbs[3]) == 0)
+    {
+        // One 128-by-64-bit division per limb
+        unsigned __int128 rest = 0;
+        for (int i = 3; i >= 0; i--)
+        {
+            rest = (rest << 64) | a.limbs[i];
+            q.limbs[i] = (uint64_t)(rest / b.limbs[0]);
+            rest = rest % b.limbs[0];
+        }
+        quotient = q;
+        u256Set(remainder, (uint64_t)rest);
+        return true;
+    }
+
+    // Shift and subtract, one bit of a at a time; before every shift the rest is at most a >> 1, so
+    // shifting it never loses bits
+    U256 rest;
+    u256Set(q, 0);
+    u256Set(rest, 0);
+    for (int i = (int)u256Bits(a) - 1; i >= 0; i--)
+    {
+        rest.limbs[3] = (rest.limbs[3] << 1) | (rest.limbs[2] >> 63);
+        rest.limbs[2] = (rest.limbs[2] << 1) | (rest.limbs[1] >> 63);
+        rest.limbs[1] = (rest.limbs[1] << 1) | (rest.limbs[0] >> 63);
+        rest.limbs[0] = (rest.limbs[0] << 1) | ((a.limbs[i/64] >> (i%64)) & 1);
+        if (u256Compare(rest, b) >= 0)
+        {
+            u256Sub(rest, b, rest);
+            q.limbs[i/64] |= (uint64_t)1 << (i%64);
+        }
+    }
+    quotient = q;
+    remainder = rest;
+    return true;
+}
+
+inline bool u256Shl (const U256 &a, uint64_t bits, U256 &r)
+{
+    if (u256IsZero(a))
+    {
+        r = a;
+        return true;
+    }
+    if (bits >= 256)
+    {
+        return false;
+    }
+    uint64_t limbShift = bits / 64;
+    uint64_t bitShift = bits % 64;
+    U256 result;
+    for (int i = 3; i >= 0; i--)
+    {
+        uint64_t limb = 0;
+        if (i >= (int)limbShift)
+        {
+            limb = a.limbs[i - limbShift] << bitShift;
+            if ((bitShift != 0) && (i > (int)limbShift))
+            {
+                limb |= a.limbs[i - limbShift - 1] >> (64 - bitShift);
+            }
+        }
+        result.limbs[i] = limb;
+    }
+    // Shifting back must give a, or else some bits were lost
+    for (uint64_t i = 4 - limbShift; i < 4; i++)
+    {
+        if (a.limbs[i] != 0)
+        {
+            return false;
+        }
+    }
+    if ((bitShift != 0) && ((a.limbs[3 - limbShift] >> (64 - bitShift)) != 0))
+    {
+        return false;
+    }
+    r = result;
+    return true;
+}
+
+inline void u256Shr (const U256 &a, uint64_t bits, U256 &r)
+{
+    if (bits >= 256)
+    {
+        u256Set(r, 0);
+        return;
+    }
+    uint64_t limbShift = bits / 64;
+    uint64_t bitShift = bits % 64;
+    U256 result;
+    for (uint64_t i = 0; i < 4; i++)
+    {
+        uint64_t limb = 0;
+        if (i + limbShift < 4)
+        {
+            limb = a.limbs[i + limbShift] >> bitShift;
+            if ((bitShift != 0) && (i + limbShift + 1 < 4))
+            {
+                limb |= a.limbs[i + limbShift + 1] << (64 - bitShift);
+            }
+        }
+        result.limbs[i] = limb;
+    }
+    r = result;
+}
+
+inline void u256And (const U256 &a, const U256 &b, U256 &r)
+{
+    for (uint64_t i = 0; i < 4; i++)
+    {
+        r.limbs[i] = a.limbs[i] & b.limbs[i];
+    }
+}
+
+inline void u256Or (const U256 &a, const U256 &b, U256 &r)
+{
+    for (uint64_t i = 0; i < 4; i++)
+    {
+        r.limbs[i] = a.limbs[i] | b.limbs[i];
+    }
+}
+
+inline void u256Xor (const U256 &a, const U256 &b, U256 &r)
+{
+    for (uint64_t i = 0; i < 4; i++)
+    {
+        r.limbs[i] = a.limbs[i] ^ b.limbs[i];
+    }
+}
+
+/* Signed integer whose magnitude fits in 256 bits, with the mpz_class semantics: division truncates
+   towards zero, and the remainder takes the sign of the dividend.  Zero is never negative */
+
+class S256
+{
+public:
+    U256 abs;
+    bool negative;
+};
+
+inline void s256Set (S256 &r, uint64_t a)
+{
+    u256Set(r.abs, a);
+    r.negative = false;
+}
+
+inline void s256Set (S256 &r, const U256 &a)
+{
+    r.abs = a;
+    r.negative = false;
+}
+
+inline bool s256IsZero (const S256 &a)
+{
+    return u256IsZero(a.abs);
+}
+
+// Builds r from a magnitude and a sign, keeping zero not negative
+inline void s256Build (S256 &r, const U256 &abs, bool negative)
+{
+    r.abs = abs;
+    r.negative = negative && !u256IsZero(abs);
+}
+
+inline int s256Compare (const S256 &a, const S256 &b)
+{
+    if (a.negative != b.negative)
+    {
+        return a.negative ? -1 : 1;
+    }
+    int c = u256Compare(a.abs, b.abs);
+    return a.negative ? -c : c;
+}
+
+// Returns false if the magnitude of the scalar does not fit in 256 bits
+inline bool scalar2s256 (const mpz_class &s, S256 &r)
+{
+    if (mpz_sizeinbase(s.get_mpz_t(), 2) > 256)
+    {
+        return false;
+    }
+    u256Set(r.abs, 0);
+    mpz_export(r.abs.limbs, NULL, -1, sizeof(uint64_t), 0, 0, s.get_mpz_t());
+    r.negative = mpz_sgn(s.get_mpz_t()) < 0;
+    return true;
+}
+
+// Does not allocate memory once the scalar has room for 4 limbs
+inline void s2562scalar (const S256 &a, mpz_class &s)
+{
+    u2562scalar(a.abs, s);
+    if (a.negative)
+    {
+        mpz_neg(s.get_mpz_t(), s.get_mpz_t());
+    }
+}
+
+inline bool s256Add (const S256 &a, const S256 &b, S256 &r)
+{
+    U256 abs;
+    if (a.negative == b.negative)
+    {
+        if (!u256Add(a.abs, b.abs, abs))
+        {
+            return false;
+        }
+        s256Build(r, abs, a.negative);
+        return true;
+    }
+    // Different signs: the result takes the sign of the greater magnitude
+    if (u256Compare(a.abs, b.abs) >= 0)
+    {
+        u256Sub(a.abs, b.abs, abs);
+        s256Build(r, abs, a.negative);
+    }
+    else
+    {
+        u256Sub(b.abs, a.abs, abs);
+        s256Build(r, abs, b.negative);
+    }
+    return true;
+}
+
+inline void s256Neg (const S256 &a, S256 &r)
+{
+    s256Build(r, a.abs, !a.negative);
+}
+
+inline bool s256Sub (const S256 &a, const S256 &b, S256 &r)
+{
+    S256 negB;
+    s256Neg(b, negB);
+    return s256Add(a, negB, r);
+}
+
+inline bool s256Mul (const S256 &a, const S256 &b, S256 &r)
+{
+    U256 abs;
+    if (!u256Mul(a.abs, b.abs, abs))
+    {
+        return false;
+    }
+    s256Build(r, abs, a.negative != b.negative);
+    return true;
+}
+
+inline bool s256DivMod (const S256 &a, const S256 &b, S256 &quotient, S256 &remainder)
+{
+    U256 q, rest;
+    if (!u256DivMod(a.abs, b.abs, q, rest))
+    {
+        return false;
+    }
+    s256Build(quotient, q, a.negative != b.negative);
+    s256Build(remainder, rest, a.negative);
+    return true;
+}
+
+// ~a, which is -a - 1 in two's complement of unlimited width
+inline bool s256BitNot (const S256 &a, S256 &r)
+{
+    S256 one;
+    s256Set(one, 1);
+    S256 negA;
+    s256Neg(a, negA);
+    return s256Sub(negA, one, r);
+}
+
+#endif
@@ -0,0 +1,177 @@
+#include <iostream>
+#include <atomic>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include "lazy_main_executor_test.hpp"
+#include "executor/lazy_main_executor.hpp"
+
+using namespace std;
+
+#define LAZY_MAIN_EXECUTOR_TEST_THREADS 8
+#define LAZY_MAIN_EXECUTOR_TEST_ITERATIONS 2000
+
+namespace
+{
+
+atomic<uint64_t> errors(0);
+atomic<uint64_t> created(0);
+atomic<uint64_t> destroyed(0);
+
+// Stands for a main executor; counts its instances, and how many guards are using it when destroyed
+class TestMainExecutor
+{
+public:
+    atomic<uint64_t> users;
+    TestMainExecutor (Goldilocks &fr, PoseidonGoldilocks &poseidon, const Config &config) : users(0)
+    {
+        created++;
+        usleep(1000); // As loading a ROM, to let concurrent first uses overlap
+    };
+    ~TestMainExecutor ()
+    {
+        if (users != 0)
+        {
+            cerr << "Error: LazyMainExecutorTest() destroyed a main executor with users=" << users << endl;
+            errors++;
+        }
+        destroyed++;
+    };
+};
+
+typedef LazyMainExecutor<TestMainExecutor> TestLazyMainExecutor;
+
+class TestContext
+{
+public:
+    TestLazyMainExecutor &lazyMainExecutor;
+    pthread_barrier_t barrier;
+    atomic<bool> bDone;
+    TestContext (TestLazyMainExecutor &lazyMainExecutor) : lazyMainExecutor(lazyMainExecutor), bDone(false) {};
+};
+
+void * firstUseThread (void * arg)
+{
+    TestContext &ctx = *(TestContext *)arg;
+    pthread_barrier_wait(&ctx.barrier);
+    TestLazyMainExecutor::Guard guard(ctx.lazyMainExecutor);
+    guard.mainExecutor.users++;
+    sched_yield();
+    guard.mainExecutor.users--;
+    return NULL;
+}
+
+void * userThread (void * arg)
+{
+    TestContext &ctx = *(TestContext *)arg;
+    for (uint64_t i=0; i<LAZY_MAIN_EXECUTOR_TEST_ITERATIONS; i++)
+    {
+        TestLazyMainExecutor::Guard guard(ctx.lazyMainExecutor);
+        guard.mainExecutor.users++;
+        sched_yield();
+        guard.mainExecutor.users--;
+    }
+    return NULL;
+}
+
+void * evictorThread (void * arg)
+{
+    TestContext &ctx = *(TestContext *)arg;
+    while (!ctx.bDone)
+    {
+        ctx.lazyMainExecutor.evictIfIdle(0);
+        sched_yield();
+    }
+    return NULL;
+}
+
+void check (bool bCondition, const string &description)
+{
+    if (!bCondition)
+    {
+        cerr << "Error: LazyMainExecutorTest() " << description << " with created=" << created << " destroyed=" << destroyed << endl;
+        errors++;
+    }
+}
+
+} // namespace
+
+void LazyMainExecutorTest (Goldilocks &fr, PoseidonGoldilocks &poseidon, const Config &config)
+{
+    errors = 0;
+    created = 0;
+    destroyed = 0;
+
+    // Creation, eviction and destruction, in one thread
+    {
+        TestLazyMainExecutor lazyMainExecutor(fr, poseidon, config, "test");
+        check(created == 0, "created the main executor before its first use");
+        lazyMainExecutor.create();
+        lazyMainExecutor.create();
+        check(created == 1, "did not create the main executor once in create()");
+        {
+            TestLazyMainExecutor::Guard guard(lazyMainExecutor);
+            TestLazyMainExecutor::Guard nestedGuard(lazyMainExecutor);
+            check(&guard.mainExecutor == &nestedGuard.mainExecutor, "got different main executors");
+            lazyMainExecutor.evictIfIdle(0);
+            check(destroyed == 0, "evicted a main executor in use");
+        }
+        lazyMainExecutor.evictIfIdle(3600);
+        check(destroyed == 0, "evicted a main executor used less than the idle time ago");
+        lazyMainExecutor.evictIfIdle(0);
+        check(destroyed == 1, "did not evict an idle main executor");
+        lazyMainExecutor.evictIfIdle(0);
+        check(destroyed == 1, "evicted a main executor twice");
+        {
+            TestLazyMainExecutor::Guard guard(lazyMainExecutor);
+            check(created == 2, "did not create the main executor again after its eviction");
+        }
+    }
+    check(destroyed == created, "did not destroy the main executor with its LazyMainExecutor");
+
+    // Concurrent first uses must wait for the same instance
+    created = 0;
+    destroyed = 0;
+    {
+        TestLazyMainExecutor lazyMainExecutor(fr, poseidon, config, "test");
+        TestContext ctx(lazyMainExecutor);
+        pthread_barrier_init(&ctx.barrier, NULL, LAZY_MAIN_EXECUTOR_TEST_THREADS);
+        pthread_t threads[LAZY_MAIN_EXECUTOR_TEST_THREADS];
+        for (uint64_t i=0; i<LAZY_MAIN_EXECUTOR_TEST_THREADS; i++)
+        {
+            pthread_create(&threads[i], NULL, firstUseThread, &ctx);
+        }
+        for (uint64_t i=0; i<LAZY_MAIN_EXECUTOR_TEST_THREADS; i++)
+        {
+            pthread_join(threads[i], NULL);
+        }
+        pthread_barrier_destroy(&ctx.barrier);
+        check(created == 1, "created more than one main executor on concurrent first uses");
+    }
+
+    // Users and an evictor running concurrently: the main executor must never be destroyed in use,
+    // which TestMainExecutor checks
+    created = 0;
+    destroyed = 0;
+    {
+        TestLazyMainExecutor lazyMainExecutor(fr, poseidon, config, "test");
+        TestContext ctx(lazyMainExecutor);
+        pthread_t evictor;
+        pthread_create(&evictor, NULL, evictorThread, &ctx);
+        pthread_t threads[LAZY_MAIN_EXECUTOR_TEST_THREADS];
+        for (uint64_t i=0; i<LAZY_MAIN_EXECUTOR_TEST_THREADS; i++)
+        {
+            pthread_create(&threads[i], NULL, userThread, &ctx);
+        }
+        for (uint64_t i=0; i<LAZY_MAIN_EXECUTOR_TEST_THREADS; i++)
+        {
+            pthread_join(threads[i], NULL);
+        }
+        ctx.bDone = true;
+        pthread_join(evictor, NULL);
+        check(created >= 1, "did not create the main executor");
+    }
+    check(destroyed == created, "leaked a main executor");
+
+    cout << "LazyMainExecutorTest() done with errors=" << errors << endl;
+}
@@ -0,0 +1,10 @@
+#ifndef LAZY_MAIN_EXECUTOR_TEST_HPP
+#define LAZY_MAIN_EXECUTOR_TEST_HPP
+
+#include "config.hpp"
+#include "goldilocks_base_field.hpp"
+#include "poseidon_goldilocks.hpp"
+
+void LazyMainExecutorTest (Goldilocks &fr, PoseidonGoldilocks &poseidon, const Config &config);
+
+#endif
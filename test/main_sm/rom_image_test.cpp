@@ -0,0 +1,364 @@
+#include <iostream>
+#include <fstream>
+#include <cstddef>
+#include <cstdlib>
+#include <unistd.h>
+#include "rom_image_test.hpp"
+#include "rom_image.hpp"
+#include "main_sm/fork_4/main/rom.hpp"
+#include "sm/keccak_f/keccak_f_executor.hpp"
+#include "utils.hpp"
+#include "exit_process.hpp"
+
+using namespace std;
+
+namespace
+{
+
+uint64_t errors = 0;
+uint64_t seed = 0x0123456789ABCDEFULL;
+
+uint64_t random64 (void)
+{
+    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    return seed;
+}
+
+void writeBinaryFile (const string &fileName, const string &content)
+{
+    ofstream outputStream(fileName, ios::binary | ios::trunc);
+    outputStream.write(content.data(), content.size());
+}
+
+string readBinaryFile (const string &fileName)
+{
+    ifstream inputStream(fileName, ios::binary);
+    return string(istreambuf_iterator<char>(inputStream), istreambuf_iterator<char>());
+}
+
+// Maps the image and checks that it is accepted or rejected as expected, and, if accepted, that it
+// provides the expected payload
+void checkMap (const string &fileName, tRomImageType type, const string &sourceFileName, bool bExpected, const string &payload, const string &description)
+{
+    RomImage image;
+    bool bResult = image.map(fileName, type, sourceFileName);
+    if (bResult != bExpected)
+    {
+        cerr << "Error: RomImageTest() " << description << " got map()=" << bResult << " instead of " << bExpected << endl;
+        errors++;
+        return;
+    }
+    if (bResult && ((image.payloadSize != payload.size()) || (memcmp(image.pPayload, payload.data(), payload.size()) != 0)))
+    {
+        cerr << "Error: RomImageTest() " << description << " got a different payload" << endl;
+        errors++;
+    }
+}
+
+// Writes a copy of the image with the lowest bit of its byte at the offset flipped
+void corruptImage (const string &image, uint64_t offset, const string &fileName)
+{
+    string corrupted = image;
+    corrupted[offset] ^= 1;
+    writeBinaryFile(fileName, corrupted);
+}
+
+/* Checks the image format: the round trip of a payload, the rejection of every kind of invalid image,
+   and the bounds of the payload reader */
+void RomImageFormatTest (const string &directory)
+{
+    string sourceFileName = directory + "/source.json";
+    string imageFileName = directory + "/source.bin";
+    string corruptedFileName = directory + "/corrupted.bin";
+    string source = "{\"program\":[1,2,3]}";
+    writeBinaryFile(sourceFileName, source);
+
+    // A payload size that is not a multiple of 8 bytes, so that the hash of its last word is checked too
+    string payload;
+    for (uint64_t i=0; i<1003; i++)
+    {
+        payload.push_back((char)random64());
+    }
+    RomImage::write(imageFileName, rit_mainRom, payload, sourceFileName);
+    checkMap(imageFileName, rit_mainRom, sourceFileName, true, payload, "valid image");
+    cout << "RomImageTest() checking invalid images, the errors that follow are expected" << endl;
+    checkMap(imageFileName, rit_keccakProgram, sourceFileName, false, payload, "wrong type");
+    checkMap(directory + "/missing.bin", rit_mainRom, sourceFileName, false, payload, "missing image");
+
+    string image = readBinaryFile(imageFileName);
+    corruptImage(image, offsetof(RomImageHeader, magic), corruptedFileName);
+    checkMap(corruptedFileName, rit_mainRom, sourceFileName, false, payload, "corrupted magic");
+    corruptImage(image, offsetof(RomImageHeader, version), corruptedFileName);
+    checkMap(corruptedFileName, rit_mainRom, sourceFileName, false, payload, "corrupted version");
+    corruptImage(image, offsetof(RomImageHeader, type), corruptedFileName);
+    checkMap(corruptedFileName, rit_mainRom, sourceFileName, false, payload, "corrupted type");
+    corruptImage(image, offsetof(RomImageHeader, payloadSize), corruptedFileName);
+    checkMap(corruptedFileName, rit_mainRom, sourceFileName, false, payload, "corrupted payload size");
+    corruptImage(image, offsetof(RomImageHeader, payloadHash), corruptedFileName);
+    checkMap(corruptedFileName, rit_mainRom, sourceFileName, false, payload, "corrupted payload hash");
+    corruptImage(image, sizeof(RomImageHeader), corruptedFileName);
+    checkMap(corruptedFileName, rit_mainRom, sourceFileName, false, payload, "corrupted first payload byte");
+    corruptImage(image, image.size() - 1, corruptedFileName);
+    checkMap(corruptedFileName, rit_mainRom, sourceFileName, false, payload, "corrupted last payload byte");
+    writeBinaryFile(corruptedFileName, image.substr(0, image.size() - 1));
+    checkMap(corruptedFileName, rit_mainRom, sourceFileName, false, payload, "truncated payload");
+    writeBinaryFile(corruptedFileName, image.substr(0, sizeof(RomImageHeader) - 1));
+    checkMap(corruptedFileName, rit_mainRom, sourceFileName, false, payload, "truncated header");
+    writeBinaryFile(corruptedFileName, image + "x");
+    checkMap(corruptedFileName, rit_mainRom, sourceFileName, false, payload, "extended payload");
+
+    // The source file must match the image if it is present, and the image is used as is if it is not
+    string changedSource = source;
+    changedSource[changedSource.size() - 2] = '4';
+    writeBinaryFile(sourceFileName, changedSource);
+    checkMap(imageFileName, rit_mainRom, sourceFileName, false, payload, "changed source");
+    writeBinaryFile(sourceFileName, source + " ");
+    checkMap(imageFileName, rit_mainRom, sourceFileName, false, payload, "extended source");
+    remove(sourceFileName.c_str());
+    checkMap(imageFileName, rit_mainRom, sourceFileName, true, payload, "missing source");
+
+    // Payload writer and reader
+    RomImageWriter writer;
+    writer.writeU8(0xA5);
+    writer.writeU32(0x01234567);
+    writer.writeU64(0x0123456789ABCDEFULL);
+    writer.writeString("label");
+    writer.writeString("");
+    writeBinaryFile(sourceFileName, source);
+    RomImage::write(imageFileName, rit_mainRom, writer.data, sourceFileName);
+    RomImage readerImage;
+    if (!readerImage.map(imageFileName, rit_mainRom, sourceFileName))
+    {
+        cerr << "Error: RomImageTest() failed mapping the reader image" << endl;
+        errors++;
+    }
+    else
+    {
+        RomImageReader reader(readerImage);
+        string label, empty;
+        bool bOk = (reader.readU8() == 0xA5);
+        bOk = bOk && (reader.readU32() == 0x01234567);
+        bOk = bOk && (reader.readU64() == 0x0123456789ABCDEFULL);
+        reader.readString(label);
+        reader.readString(empty);
+        if (!bOk || (label != "label") || (empty != "") || reader.bError || !reader.isEnd())
+        {
+            cerr << "Error: RomImageTest() failed reading back the written values" << endl;
+            errors++;
+        }
+        if ((reader.readU64() != 0) || !reader.bError || !reader.isEnd())
+        {
+            cerr << "Error: RomImageTest() did not detect a read past the end" << endl;
+            errors++;
+        }
+
+        // A string size larger than the rest of the payload
+        RomImageReader stringReader(readerImage);
+        stringReader.readU8();
+        stringReader.readU32();
+        string value = "previous";
+        stringReader.readString(value);
+        if (!value.empty() || !stringReader.bError || !stringReader.isEnd())
+        {
+            cerr << "Error: RomImageTest() did not detect a string past the end" << endl;
+            errors++;
+        }
+    }
+
+    if ((romImageFileName("config/scripts/rom.json") != "config/scripts/rom.bin") ||
+        (romImageFileName("config/scripts/rom") != "config/scripts/rom.bin"))
+    {
+        cerr << "Error: RomImageTest() got a wrong romImageFileName()" << endl;
+        errors++;
+    }
+
+    remove(sourceFileName.c_str());
+    remove(imageFileName.c_str());
+    remove(corruptedFileName.c_str());
+}
+
+// Compares two commands, including the variable slots and the presence of the compiled programs
+bool compareRomCommand (const fork_4::RomCommand &a, const fork_4::RomCommand &b)
+{
+    if ( (a.toString() != b.toString()) ||
+         (a.isPresent != b.isPresent) ||
+         (a.varSlot != b.varSlot) ||
+         ((a.pProgram == NULL) != (b.pProgram == NULL)) ||
+         ((a.pProgram != NULL) && (a.pProgram->instructions.size() != b.pProgram->instructions.size())) ||
+         (a.values.size() != b.values.size()) ||
+         (a.params.size() != b.params.size()) )
+    {
+        return false;
+    }
+    for (uint64_t i=0; i<a.values.size(); i++)
+    {
+        if (!compareRomCommand(*a.values[i], *b.values[i])) return false;
+    }
+    for (uint64_t i=0; i<a.params.size(); i++)
+    {
+        if (!compareRomCommand(*a.params[i], *b.params[i])) return false;
+    }
+    return true;
+}
+
+bool compareRomCommandArray (const vector<fork_4::RomCommand *> &a, const vector<fork_4::RomCommand *> &b)
+{
+    if (a.size() != b.size()) return false;
+    for (uint64_t i=0; i<a.size(); i++)
+    {
+        if (!compareRomCommand(*a[i], *b[i])) return false;
+    }
+    return true;
+}
+
+/* Checks that the main SM ROM loaded from its image is the ROM loaded from its JSON file, and that
+   images with a valid hash but an invalid payload are rejected */
+void RomImageMainRomTest (Goldilocks &fr, const Config &config, const string &directory)
+{
+    // Main SM ROM, loaded from this path by MainExecutor
+    string romFileName = "src/main_sm/fork_4/scripts/rom.json";
+    if (!fileExists(romFileName))
+    {
+        cout << "RomImageTest() skipping the main SM ROM, since " << romFileName << " is missing" << endl;
+        return;
+    }
+    string imageFileName = directory + "/rom.bin";
+
+    json romJson;
+    file2json(romFileName, romJson);
+    fork_4::Rom jsonRom(config);
+    jsonRom.load(fr, romJson);
+    jsonRom.saveImage(fr, imageFileName, romFileName);
+
+    fork_4::Rom imageRom(config);
+    if (!imageRom.loadImage(fr, imageFileName, romFileName))
+    {
+        cerr << "Error: RomImageTest() failed loading the main SM ROM image" << endl;
+        errors++;
+        remove(imageFileName.c_str());
+        return;
+    }
+
+    if (imageRom.size != jsonRom.size)
+    {
+        cerr << "Error: RomImageTest() got ROM size=" << imageRom.size << " instead of " << jsonRom.size << endl;
+        errors++;
+    }
+    for (uint64_t i=0; (i<imageRom.size) && (i<jsonRom.size); i++)
+    {
+        fork_4::RomLine &a = jsonRom.line[i];
+        fork_4::RomLine &b = imageRom.line[i];
+        if ( (a.toString(fr) != b.toString(fr)) ||
+             (a.offsetLabel != b.offsetLabel) ||
+             !compareRomCommandArray(a.cmdBefore, b.cmdBefore) ||
+             !compareRomCommandArray(a.cmdAfter, b.cmdAfter) ||
+             !compareRomCommand(a.freeInTag, b.freeInTag) )
+        {
+            cerr << "Error: RomImageTest() got a different ROM line " << i << ": " << b.toString(fr) << " instead of " << a.toString(fr) << endl;
+            errors++;
+        }
+    }
+    if ( (imageRom.labels != jsonRom.labels) ||
+         (imageRom.memoryMap != jsonRom.memoryMap) ||
+         (imageRom.varSlots != jsonRom.varSlots) ||
+         (imageRom.varNames != jsonRom.varNames) )
+    {
+        cerr << "Error: RomImageTest() got different ROM labels, memory map or variables" << endl;
+        errors++;
+    }
+    if ( (imageRom.memLengthOffset != jsonRom.memLengthOffset) ||
+         (imageRom.lastCtxUsedOffset != jsonRom.lastCtxUsedOffset) ||
+         (imageRom.MAX_CNT_STEPS_LIMIT != jsonRom.MAX_CNT_STEPS_LIMIT) ||
+         (imageRom.MAX_CNT_ARITH_LIMIT != jsonRom.MAX_CNT_ARITH_LIMIT) ||
+         (imageRom.MAX_CNT_BINARY_LIMIT != jsonRom.MAX_CNT_BINARY_LIMIT) ||
+         (imageRom.MAX_CNT_MEM_ALIGN_LIMIT != jsonRom.MAX_CNT_MEM_ALIGN_LIMIT) ||
+         (imageRom.MAX_CNT_KECCAK_F_LIMIT != jsonRom.MAX_CNT_KECCAK_F_LIMIT) ||
+         (imageRom.MAX_CNT_PADDING_PG_LIMIT != jsonRom.MAX_CNT_PADDING_PG_LIMIT) ||
+         (imageRom.MAX_CNT_POSEIDON_G_LIMIT != jsonRom.MAX_CNT_POSEIDON_G_LIMIT) )
+    {
+        cerr << "Error: RomImageTest() got different ROM offsets or constants" << endl;
+        errors++;
+    }
+
+    // Payloads with a valid hash, shorter or longer than the ROM, must be rejected without exiting
+    string payload = readBinaryFile(imageFileName).substr(sizeof(RomImageHeader));
+    string invalidPayloads[3] = { payload.substr(0, payload.size() / 2), payload.substr(0, payload.size() - 1), payload + "x" };
+    for (uint64_t i=0; i<3; i++)
+    {
+        RomImage::write(imageFileName, rit_mainRom, invalidPayloads[i], romFileName);
+        fork_4::Rom invalidRom(config);
+        if (invalidRom.loadImage(fr, imageFileName, romFileName) || (invalidRom.line != NULL) || (invalidRom.size != 0))
+        {
+            cerr << "Error: RomImageTest() accepted an invalid main SM ROM payload of size=" << invalidPayloads[i].size() << endl;
+            errors++;
+        }
+    }
+
+    remove(imageFileName.c_str());
+}
+
+/* Checks that the Keccak-F program loaded from its image computes the same gates as the one loaded
+   from its JSON script */
+void RomImageKeccakTest (Goldilocks &fr, const Config &config, const string &directory)
+{
+    if (!fileExists(config.keccakScriptFile))
+    {
+        cout << "RomImageTest() skipping the Keccak-F script, since " << config.keccakScriptFile << " is missing" << endl;
+        return;
+    }
+    string imageFileName = directory + "/keccak.bin";
+
+    json keccakJson;
+    file2json(config.keccakScriptFile, keccakJson);
+    KeccakFExecutor jsonExecutor(fr, config);
+    jsonExecutor.loadScript(keccakJson);
+    jsonExecutor.saveImage(imageFileName);
+
+    KeccakFExecutor imageExecutor(fr, config);
+    if (!imageExecutor.loadImage(imageFileName))
+    {
+        cerr << "Error: RomImageTest() failed loading the Keccak-F script image" << endl;
+        errors++;
+        remove(imageFileName.c_str());
+        return;
+    }
+
+    vector<uint8_t> jsonBits(Keccak_PolLength);
+    for (uint64_t i=0; i<Keccak_PolLength; i++)
+    {
+        jsonBits[i] = random64() >> 63;
+    }
+    vector<uint8_t> imageBits = jsonBits;
+    jsonExecutor.execute(jsonBits.data());
+    imageExecutor.execute(imageBits.data());
+    if (jsonBits != imageBits)
+    {
+        cerr << "Error: RomImageTest() got different Keccak-F results from the script image" << endl;
+        errors++;
+    }
+
+    remove(imageFileName.c_str());
+}
+
+} // namespace
+
+void RomImageTest (Goldilocks &fr, const Config &config)
+{
+    errors = 0;
+
+    char directoryTemplate[] = "/tmp/rom_image_test_XXXXXX";
+    if (mkdtemp(directoryTemplate) == NULL)
+    {
+        cerr << "Error: RomImageTest() failed creating a temporary directory" << endl;
+        exitProcess();
+    }
+    string directory = directoryTemplate;
+
+    RomImageFormatTest(directory);
+    RomImageMainRomTest(fr, config, directory);
+    RomImageKeccakTest(fr, config, directory);
+
+    rmdir(directory.c_str());
+
+    cout << "RomImageTest() done with errors=" << errors << endl;
+}
@@ -0,0 +1,9 @@
+#ifndef ROM_IMAGE_TEST_HPP
+#define ROM_IMAGE_TEST_HPP
+
+#include "config.hpp"
+#include "goldilocks_base_field.hpp"
+
+void RomImageTest (Goldilocks &fr, const Config &config);
+
+#endif
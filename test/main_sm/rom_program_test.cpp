@@ -0,0 +1,479 @@
+#include <iostream>
+#include <vector>
+#include <gmpxx.h>
+#include "rom_program_test.hpp"
+#include "main_sm/fork_4/main/rom_command.hpp"
+#include "main_sm/fork_4/main/rom_program.hpp"
+#include "u256.hpp"
+
+using namespace std;
+using namespace fork_4;
+
+#define ROM_PROGRAM_TEST_VARS 4
+#define ROM_PROGRAM_TEST_MEM 4
+#define ROM_PROGRAM_TEST_REGS 6 // reg_A to reg_SR
+
+namespace
+{
+
+uint64_t seed = 0x0123456789ABCDEFULL;
+
+uint64_t random64 (void)
+{
+    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    return seed;
+}
+
+// Random value of a random size around the 64 and 256-bit limits, negative one time out of six
+mpz_class randomScalar (bool bNegative)
+{
+    static const uint64_t bits[10] = { 0, 1, 3, 8, 63, 64, 65, 200, 255, 256 };
+    uint64_t nBits = bits[random64() % 10];
+    mpz_class s = 0;
+    for (uint64_t i = 0; i < nBits; i += 64)
+    {
+        s = (s << 64) + mpz_class(to_string(random64()));
+    }
+    if (nBits < 256)
+    {
+        s = s & ((mpz_class(1) << nBits) - 1);
+    }
+    if ((random64() % 8) == 0)
+    {
+        s = s & 0xFF; // Small values make shifts, divisions and comparisons likelier to be exact
+    }
+    if (bNegative && ((random64() % 6) == 0))
+    {
+        s = -s;
+    }
+    return s;
+}
+
+class TestState
+{
+public:
+    mpz_class vars[ROM_PROGRAM_TEST_VARS];
+    bool bDeclared[ROM_PROGRAM_TEST_VARS];
+    mpz_class mem[ROM_PROGRAM_TEST_MEM];
+    mpz_class regs[ROM_PROGRAM_TEST_REGS];
+};
+
+// Runs the programs on a TestState, as evalCommand() does on a Context
+class TestHost
+{
+public:
+    TestState &state;
+    TestHost(TestState &state) : state(state) {};
+    bool getVar (uint64_t slot, S256 &r) { return state.bDeclared[slot] && scalar2s256(state.vars[slot], r); }
+    bool getReg (uint64_t reg, S256 &r) { return scalar2s256(state.regs[reg - reg_A], r); }
+    bool getMemValue (uint64_t offset, S256 &r) { return scalar2s256(state.mem[offset], r); }
+    bool setVar (uint64_t slot, bool bDeclare, const S256 &value)
+    {
+        if (!bDeclare && !state.bDeclared[slot])
+        {
+            return false;
+        }
+        state.bDeclared[slot] = true;
+        s2562scalar(value, state.vars[slot]);
+        return true;
+    }
+};
+
+// Evaluates a command tree on mpz_class, as the eval_*() functions do; returns false where they would
+// fail, or for shifts too large to compute
+bool evalTree (const RomCommand &cmd, TestState &state, mpz_class &r)
+{
+    mpz_class a, b;
+    switch (cmd.op)
+    {
+        case op_number: r = cmd.num; return true;
+        case op_getVar:
+            if (!state.bDeclared[cmd.varSlot])
+            {
+                return false;
+            }
+            r = state.vars[cmd.varSlot];
+            return true;
+        case op_getReg: r = state.regs[cmd.reg - reg_A]; return true;
+        case op_getMemValue: r = state.mem[cmd.offset]; return true;
+        case op_declareVar:
+            state.bDeclared[cmd.varSlot] = true;
+            state.vars[cmd.varSlot] = 0;
+            r = 0;
+            return true;
+        case op_setVar:
+        {
+            const RomCommand &left = *cmd.values[0];
+            if (left.op == op_declareVar)
+            {
+                state.bDeclared[left.varSlot] = true;
+                state.vars[left.varSlot] = 0;
+            }
+            else if (!state.bDeclared[left.varSlot])
+            {
+                return false;
+            }
+            if (!evalTree(*cmd.values[1], state, r))
+            {
+                return false;
+            }
+            state.vars[left.varSlot] = r;
+            return true;
+        }
+        case op_if:
+            if (!evalTree(*cmd.values[0], state, a))
+            {
+                return false;
+            }
+            return evalTree(*cmd.values[(a != 0) ? 1 : 2], state, r);
+        case op_functionCall:
+            if (!evalTree(*cmd.params[0], state, a) || ((cmd.params.size() > 1) && !evalTree(*cmd.params[1], state, b)))
+            {
+                return false;
+            }
+            switch (cmd.function)
+            {
+                case f_loadScalar:  r = a; return true;
+                case f_bitwise_not: r = a ^ ((mpz_class(1) << 256) - 1); return true;
+                case f_bitwise_and: r = a & b; return true;
+                case f_bitwise_or:  r = a | b; return true;
+                case f_bitwise_xor: r = a ^ b; return true;
+                case f_comp_lt:     r = (a < b) ? 1 : 0; return true;
+                case f_comp_gt:     r = (a > b) ? 1 : 0; return true;
+                default:            r = (a == b) ? 1 : 0; return true;
+            }
+        default:
+            break;
+    }
+
+    if (!evalTree(*cmd.values[0], state, a) || ((cmd.values.size() > 1) && !evalTree(*cmd.values[1], state, b)))
+    {
+        return false;
+    }
+    switch (cmd.op)
+    {
+        case op_add:    r = a + b; return true;
+        case op_sub:    r = a - b; return true;
+        case op_neg:    r = -a; return true;
+        case op_mul:    r = a * b; return true;
+        case op_div:    if (b == 0) return false; r = a / b; return true;
+        case op_mod:    if (b == 0) return false; r = a % b; return true;
+        case op_or:     r = (a || b) ? 1 : 0; return true;
+        case op_and:    r = (a && b) ? 1 : 0; return true;
+        case op_gt:     r = (a > b) ? 1 : 0; return true;
+        case op_ge:     r = (a >= b) ? 1 : 0; return true;
+        case op_lt:     r = (a < b) ? 1 : 0; return true;
+        case op_le:     r = (a <= b) ? 1 : 0; return true;
+        case op_eq:     r = (a == b) ? 1 : 0; return true;
+        case op_ne:     r = (a != b) ? 1 : 0; return true;
+        case op_not:    r = (a) ? 0 : 1; return true;
+        case op_bitand: r = a & b; return true;
+        case op_bitor:  r = a | b; return true;
+        case op_bitxor: r = a ^ b; return true;
+        case op_bitnot: r = ~a; return true;
+        default:
+            // Shifts by b.get_ui(), where only the values that vanish are computed for large shifts
+            if ((b < 0) || (b >= (mpz_class(1) << 64)))
+            {
+                return false;
+            }
+            if (b > 1024)
+            {
+                if ((cmd.op == op_shl) && (a != 0))
+                {
+                    return false;
+                }
+                r = (cmd.op == op_shl) ? 0 : ((a < 0) ? -1 : 0);
+                return true;
+            }
+            if (cmd.op == op_shl)
+            {
+                r = a << b.get_ui();
+            }
+            else
+            {
+                r = a >> b.get_ui();
+            }
+            return true;
+    }
+}
+
+RomCommand * newCommand (tOp op)
+{
+    RomCommand *pCmd = new RomCommand();
+    pCmd->isPresent = true;
+    pCmd->op = op;
+    return pCmd;
+}
+
+// Random expression of the given depth, over every operation and scalar function
+RomCommand * randomExpression (uint64_t depth)
+{
+    static const tFunction functions[8] = { f_loadScalar, f_bitwise_not, f_bitwise_and, f_bitwise_or, f_bitwise_xor, f_comp_lt, f_comp_gt, f_comp_eq };
+    uint64_t kind = (depth == 0) ? (random64() % 4) : (4 + random64() % 22);
+    RomCommand *pCmd;
+    switch (kind)
+    {
+        case 0:
+            pCmd = newCommand(op_number);
+            pCmd->num = randomScalar(true);
+            if ((random64() % 20) == 0)
+            {
+                pCmd->num = pCmd->num << 64; // Up to 320 bits, which are not compiled
+            }
+            return pCmd;
+        case 1:
+            pCmd = newCommand(op_getVar);
+            pCmd->varName = "v" + to_string(random64() % ROM_PROGRAM_TEST_VARS);
+            return pCmd;
+        case 2:
+            pCmd = newCommand(op_getReg);
+            pCmd->reg = (tReg)(reg_A + random64() % ROM_PROGRAM_TEST_REGS);
+            return pCmd;
+        case 3:
+            pCmd = newCommand(op_getMemValue);
+            pCmd->offset = random64() % ROM_PROGRAM_TEST_MEM;
+            return pCmd;
+        case 4:
+        {
+            pCmd = newCommand(op_functionCall);
+            pCmd->function = functions[random64() % 8];
+            uint64_t nParams = ((pCmd->function == f_loadScalar) || (pCmd->function == f_bitwise_not)) ? 1 : 2;
+            for (uint64_t i = 0; i < nParams; i++)
+            {
+                pCmd->params.push_back(randomExpression(depth - 1));
+            }
+            return pCmd;
+        }
+        case 5:
+            pCmd = newCommand(op_if);
+            for (uint64_t i = 0; i < 3; i++)
+            {
+                pCmd->values.push_back(randomExpression(depth - 1));
+            }
+            return pCmd;
+        default:
+        {
+            // op_add to op_shr
+            pCmd = newCommand((tOp)(op_add + kind - 6));
+            bool bUnary = (pCmd->op == op_neg) || (pCmd->op == op_not) || (pCmd->op == op_bitnot);
+            pCmd->values.push_back(randomExpression(depth - 1));
+            if (!bUnary)
+            {
+                pCmd->values.push_back(randomExpression(depth - 1));
+            }
+            return pCmd;
+        }
+    }
+}
+
+// Random command as found in the ROM: an expression, an assignment or a declaration
+RomCommand * randomCommand (void)
+{
+    uint64_t depth = random64() % 5;
+    switch (random64() % 6)
+    {
+        case 0:
+        {
+            RomCommand *pCmd = newCommand(op_setVar);
+            RomCommand *pLeft = newCommand(((random64() % 3) == 0) ? op_declareVar : op_getVar);
+            pLeft->varName = "v" + to_string(random64() % ROM_PROGRAM_TEST_VARS);
+            pCmd->values.push_back(pLeft);
+            pCmd->values.push_back(randomExpression(depth));
+            return pCmd;
+        }
+        case 1:
+        {
+            RomCommand *pCmd = newCommand(op_declareVar);
+            pCmd->varName = "v" + to_string(random64() % ROM_PROGRAM_TEST_VARS);
+            return pCmd;
+        }
+        default:
+            return randomExpression(1 + depth);
+    }
+}
+
+bool sameState (const TestState &a, const TestState &b)
+{
+    for (uint64_t i = 0; i < ROM_PROGRAM_TEST_VARS; i++)
+    {
+        if ((a.bDeclared[i] != b.bDeclared[i]) || (a.bDeclared[i] && (a.vars[i] != b.vars[i])))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+void RomProgramTest (void)
+{
+    uint64_t errors = 0;
+    const mpz_class limit = mpz_class(1) << 256;
+
+    // Every operation against mpz_class, which it must match whenever the result fits in 256 bits and
+    // mpz_class does not have to compute it
+    static const tRomProgramOpcode opcodes[] = { rpo_add, rpo_sub, rpo_neg, rpo_mul, rpo_div, rpo_mod, rpo_or, rpo_and, rpo_gt, rpo_ge, rpo_lt, rpo_le, rpo_eq, rpo_ne, rpo_not, rpo_bitand, rpo_bitor, rpo_bitxor, rpo_bitnot, rpo_shl, rpo_shr, rpo_bitnot256 };
+    const uint64_t nOpcodes = sizeof(opcodes) / sizeof(opcodes[0]);
+    for (uint64_t i = 0; i < 200000; i++)
+    {
+        tRomProgramOpcode opcode = opcodes[i % nOpcodes];
+        mpz_class a = randomScalar(true);
+        mpz_class b = randomScalar(true);
+        if (((opcode == rpo_div) || (opcode == rpo_mod)) && ((random64() % 3) == 0))
+        {
+            // Exact multiples, the boundary of every quotient bit
+            mpz_class multiple = b * mpz_class((unsigned long)(random64() % 1000));
+            if (abs(multiple) < limit)
+            {
+                a = multiple;
+            }
+        }
+        if ((opcode == rpo_shl) || (opcode == rpo_shr))
+        {
+            b = ((random64() % 8) == 0) ? randomScalar(true) : mpz_class((unsigned long)(random64() % 300));
+        }
+
+        mpz_class expected;
+        bool bExact = true;
+        bool bNonNegative = (a >= 0) && (b >= 0);
+        switch (opcode)
+        {
+            case rpo_add:       expected = a + b; break;
+            case rpo_sub:       expected = a - b; break;
+            case rpo_neg:       expected = -a; break;
+            case rpo_mul:       expected = a * b; break;
+            case rpo_div:       bExact = (b != 0); if (bExact) expected = a / b; break;
+            case rpo_mod:       bExact = (b != 0); if (bExact) expected = a % b; break;
+            case rpo_or:        expected = (a || b) ? 1 : 0; break;
+            case rpo_and:       expected = (a && b) ? 1 : 0; break;
+            case rpo_gt:        expected = (a > b) ? 1 : 0; break;
+            case rpo_ge:        expected = (a >= b) ? 1 : 0; break;
+            case rpo_lt:        expected = (a < b) ? 1 : 0; break;
+            case rpo_le:        expected = (a <= b) ? 1 : 0; break;
+            case rpo_eq:        expected = (a == b) ? 1 : 0; break;
+            case rpo_ne:        expected = (a != b) ? 1 : 0; break;
+            case rpo_not:       expected = (a) ? 0 : 1; break;
+            case rpo_bitand:    bExact = bNonNegative; expected = a & b; break;
+            case rpo_bitor:     bExact = bNonNegative; expected = a | b; break;
+            case rpo_bitxor:    bExact = bNonNegative; expected = a ^ b; break;
+            case rpo_bitnot:    expected = ~a; break;
+            case rpo_bitnot256: bExact = (a >= 0); expected = a ^ (limit - 1); break;
+            case rpo_shl:
+            case rpo_shr:
+                // Large shifts are only computed when the value vanishes
+                bExact = bNonNegative && (b < (mpz_class(1) << 64));
+                if (bExact && (b >= 1024))
+                {
+                    bExact = (opcode == rpo_shr) || (a == 0);
+                    expected = 0;
+                }
+                else if (bExact && (opcode == rpo_shl))
+                {
+                    expected = a << b.get_ui();
+                }
+                else if (bExact)
+                {
+                    expected = a >> b.get_ui();
+                }
+                break;
+            default:
+                cerr << "Error: RomProgramTest() found opcode=" << (uint64_t)opcode << " out of the operations" << endl;
+                errors++;
+                continue;
+        }
+        bExact = bExact && (abs(expected) < limit);
+
+        S256 sa, sb, sr;
+        if (!scalar2s256(a, sa) || !scalar2s256(b, sb))
+        {
+            cerr << "Error: RomProgramTest() scalar2s256() failed a=" << a.get_str(16) << " b=" << b.get_str(16) << endl;
+            errors++;
+            continue;
+        }
+        bool bResult = evalRomOperation(opcode, sa, sb, sr);
+        mpz_class result;
+        s2562scalar(sr, result);
+        if ((bResult != bExact) || (bResult && ((result != expected) || (sr.negative && s256IsZero(sr)))))
+        {
+            cerr << "Error: RomProgramTest() opcode=" << (uint64_t)opcode << " a=" << a.get_str(16) << " b=" << b.get_str(16) << " returned=" << bResult << " expected=" << bExact << " result=" << result.get_str(16) << " expected=" << expected.get_str(16) << endl;
+            errors++;
+        }
+    }
+
+    // Random ROM commands, compiled as by Rom::load(), against their evaluation as trees
+    uint64_t nCompiled = 0;
+    uint64_t nRun = 0;
+    unordered_map<string, uint64_t> varSlots;
+    vector<string> varNames;
+    for (uint64_t i = 0; i < ROM_PROGRAM_TEST_VARS; i++)
+    {
+        varSlots["v" + to_string(i)] = i;
+        varNames.push_back("v" + to_string(i));
+    }
+    for (uint64_t i = 0; i < 50000; i++)
+    {
+        TestState state;
+        for (uint64_t v = 0; v < ROM_PROGRAM_TEST_VARS; v++)
+        {
+            state.bDeclared[v] = (random64() % 8) != 0;
+            state.vars[v] = randomScalar(true);
+        }
+        for (uint64_t m = 0; m < ROM_PROGRAM_TEST_MEM; m++)
+        {
+            state.mem[m] = randomScalar(false);
+        }
+        for (uint64_t r = 0; r < ROM_PROGRAM_TEST_REGS; r++)
+        {
+            state.regs[r] = randomScalar(false);
+        }
+
+        RomCommand *pCmd = randomCommand();
+        compileRomCommand(*pCmd, varSlots, varNames);
+        if (pCmd->pProgram == NULL)
+        {
+            freeRomCommand(*pCmd);
+            delete pCmd;
+            continue;
+        }
+        nCompiled++;
+
+        TestState treeState = state;
+        mpz_class expected;
+        bool bExpected = evalTree(*pCmd, treeState, expected);
+
+        TestState programState = state;
+        TestHost host(programState);
+        S256 sr;
+        if (runRomProgram(*pCmd->pProgram, host, sr))
+        {
+            nRun++;
+            mpz_class result;
+            s2562scalar(sr, result);
+            if (!bExpected || (result != expected) || !sameState(programState, treeState))
+            {
+                cerr << "Error: RomProgramTest() mismatch command=" << pCmd->toString() << " result=" << result.get_str(16) << " expected=" << (bExpected ? expected.get_str(16) : "failure") << endl;
+                errors++;
+            }
+        }
+        else if (!sameState(programState, state))
+        {
+            // A program that fails must leave no side effects, since the command is then evaluated as a tree
+            cerr << "Error: RomProgramTest() failed program changed the variables, command=" << pCmd->toString() << endl;
+            errors++;
+        }
+
+        freeRomCommand(*pCmd);
+        delete pCmd;
+    }
+
+    // Most commands must be compiled and run, or else the fast path has been lost
+    if ((nCompiled < 25000) || (nRun < nCompiled / 2))
+    {
+        cerr << "Error: RomProgramTest() too few commands compiled=" << nCompiled << " run=" << nRun << endl;
+        errors++;
+    }
+
+    cout << "RomProgramTest() done with compiled=" << nCompiled << " run=" << nRun << " errors=" << errors << endl;
+}
@@ -0,0 +1,6 @@
+#ifndef ROM_PROGRAM_TEST_HPP
+#define ROM_PROGRAM_TEST_HPP
+
+void RomProgramTest (void);
+
+#endif
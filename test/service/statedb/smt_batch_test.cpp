@@ -0,0 +1,144 @@
+#include <iostream>
+#include <vector>
+#include "smt_batch_test.hpp"
+#include "smt.hpp"
+#include "database.hpp"
+#include "scalar.hpp"
+
+using namespace std;
+
+bool SmtBatchTest_sameSiblings (Goldilocks &fr, const map<uint64_t, vector<Goldilocks::Element>> &a, const map<uint64_t, vector<Goldilocks::Element>> &b)
+{
+    if (a.size() != b.size()) return false;
+    map<uint64_t, vector<Goldilocks::Element>>::const_iterator ita, itb;
+    for (ita=a.begin(), itb=b.begin(); ita!=a.end(); ita++, itb++)
+    {
+        if ((ita->first != itb->first) || (ita->second.size() != itb->second.size())) return false;
+        for (uint64_t i=0; i<ita->second.size(); i++)
+        {
+            if (!fr.equal(ita->second[i], itb->second[i])) return false;
+        }
+    }
+    return true;
+}
+
+bool SmtBatchTest_sameFea (Goldilocks &fr, const Goldilocks::Element (&a)[4], const Goldilocks::Element (&b)[4])
+{
+    return fr.equal(a[0], b[0]) && fr.equal(a[1], b[1]) && fr.equal(a[2], b[2]) && fr.equal(a[3], b[3]);
+}
+
+void SmtBatchTest (Goldilocks &fr, const Config &config)
+{
+    uint64_t errors = 0;
+    cout << "SmtBatchTest() starting..." << endl;
+
+    Smt smt(fr);
+    Database db(fr, config);
+    db.init();
+
+    // Keys sharing their first bits, so that their paths share nodes, plus a repeated key and a
+    // deletion, so that the batch goes through the insert, update and delete modes
+    vector<SmtKeyValue> keyValues;
+    uint64_t seed = 0x0123456789ABCDEFULL;
+    for (uint64_t i=0; i<24; i++)
+    {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        SmtKeyValue keyValue;
+        keyValue.key[0] = fr.fromU64((i % 4) | ((seed >> 32) << 2));
+        keyValue.key[1] = fr.fromU64(seed >> 40);
+        keyValue.key[2] = fr.fromU64(i);
+        keyValue.key[3] = fr.fromU64(seed & 0xFFFFFFFF);
+        keyValue.value = (i % 11 == 10) ? mpz_class(0) : mpz_class(seed);
+        keyValues.push_back(keyValue);
+    }
+    keyValues.push_back(keyValues[3]);
+    keyValues.back().value = 0x1234;
+    keyValues.push_back(keyValues[5]);
+    keyValues.back().value = 0;
+
+    // Sequential sets
+    Goldilocks::Element root[4] = { fr.zero(), fr.zero(), fr.zero(), fr.zero() };
+    vector<SmtSetResult> setResults(keyValues.size());
+    for (uint64_t i=0; i<keyValues.size(); i++)
+    {
+        if (smt.set(db, root, keyValues[i].key, keyValues[i].value, false, setResults[i]) != ZKR_SUCCESS)
+        {
+            cerr << "Error: SmtBatchTest() failed calling set() i=" << i << endl;
+            errors++;
+        }
+        for (uint64_t j=0; j<4; j++) root[j] = setResults[i].newRoot[j];
+    }
+
+    // Batch set from the same initial root
+    Goldilocks::Element oldRoot[4] = { fr.zero(), fr.zero(), fr.zero(), fr.zero() };
+    Goldilocks::Element newRoot[4];
+    vector<SmtSetResult> setBatchResults;
+    if (smt.setBatch(db, oldRoot, keyValues, false, newRoot, setBatchResults) != ZKR_SUCCESS)
+    {
+        cerr << "Error: SmtBatchTest() failed calling setBatch()" << endl;
+        errors++;
+    }
+    if (!SmtBatchTest_sameFea(fr, root, newRoot))
+    {
+        cerr << "Error: SmtBatchTest() setBatch() newRoot=" << fea2string(fr, newRoot) << " != set() root=" << fea2string(fr, root) << endl;
+        errors++;
+    }
+    for (uint64_t i=0; (i<setBatchResults.size()) && (i<setResults.size()); i++)
+    {
+        SmtSetResult &a = setBatchResults[i];
+        SmtSetResult &b = setResults[i];
+        if ( !SmtBatchTest_sameFea(fr, a.oldRoot, b.oldRoot) || !SmtBatchTest_sameFea(fr, a.newRoot, b.newRoot) ||
+             !SmtBatchTest_sameFea(fr, a.insKey, b.insKey) || (a.insValue != b.insValue) || (a.isOld0 != b.isOld0) ||
+             (a.oldValue != b.oldValue) || (a.newValue != b.newValue) || (a.mode != b.mode) ||
+             (a.proofHashCounter != b.proofHashCounter) || !SmtBatchTest_sameSiblings(fr, a.siblings, b.siblings) )
+        {
+            cerr << "Error: SmtBatchTest() setBatch() result i=" << i << " mode=" << a.mode << " does not match set() result mode=" << b.mode << endl;
+            errors++;
+        }
+    }
+    if (setBatchResults.size() != setResults.size())
+    {
+        cerr << "Error: SmtBatchTest() setBatch() returned " << setBatchResults.size() << " results instead of " << setResults.size() << endl;
+        errors++;
+    }
+
+    // Batch get against the final root, including a key that is not in the tree
+    SmtKeyValue absent;
+    absent.key[0] = fr.fromU64(3);
+    absent.key[1] = fr.fromU64(7);
+    absent.key[2] = fr.fromU64(1000);
+    absent.key[3] = fr.fromU64(5);
+    keyValues.push_back(absent);
+    vector<SmtGetResult> getBatchResults;
+    if (smt.getBatch(db, root, keyValues, getBatchResults) != ZKR_SUCCESS)
+    {
+        cerr << "Error: SmtBatchTest() failed calling getBatch()" << endl;
+        errors++;
+    }
+    for (uint64_t i=0; (i<getBatchResults.size()) && (i<keyValues.size()); i++)
+    {
+        SmtGetResult getResult;
+        if (smt.get(db, root, keyValues[i].key, getResult) != ZKR_SUCCESS)
+        {
+            cerr << "Error: SmtBatchTest() failed calling get() i=" << i << endl;
+            errors++;
+            continue;
+        }
+        SmtGetResult &a = getBatchResults[i];
+        if ( !SmtBatchTest_sameFea(fr, a.root, getResult.root) || !SmtBatchTest_sameFea(fr, a.key, getResult.key) ||
+             !SmtBatchTest_sameFea(fr, a.insKey, getResult.insKey) || (a.insValue != getResult.insValue) ||
+             (a.isOld0 != getResult.isOld0) || (a.value != getResult.value) ||
+             (a.proofHashCounter != getResult.proofHashCounter) || !SmtBatchTest_sameSiblings(fr, a.siblings, getResult.siblings) )
+        {
+            cerr << "Error: SmtBatchTest() getBatch() result i=" << i << " value=" << a.value.get_str(16) << " does not match get() result value=" << getResult.value.get_str(16) << endl;
+            errors++;
+        }
+    }
+    if (getBatchResults.size() != keyValues.size())
+    {
+        cerr << "Error: SmtBatchTest() getBatch() returned " << getBatchResults.size() << " results instead of " << keyValues.size() << endl;
+        errors++;
+    }
+
+    cout << "SmtBatchTest() done with errors=" << errors << endl;
+}
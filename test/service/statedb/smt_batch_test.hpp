@@ -0,0 +1,9 @@
+#ifndef SMT_BATCH_TEST_HPP
+#define SMT_BATCH_TEST_HPP
+
+#include "goldilocks_base_field.hpp"
+#include "config.hpp"
+
+void SmtBatchTest (Goldilocks &fr, const Config &config);
+
+#endif
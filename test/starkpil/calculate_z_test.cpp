@@ -0,0 +1,72 @@
+#include <iostream>
+#include <vector>
+#include <omp.h>
+#include "calculate_z_test.hpp"
+#include "polinomial.hpp"
+
+using namespace std;
+
+void CalculateZTest (Goldilocks &fr)
+{
+    uint64_t errors = 0;
+    uint64_t seed = 0x0123456789ABCDEFULL;
+    const uint64_t maxThreads = omp_get_max_threads();
+    const uint64_t threads[3] = { 1, 3, maxThreads };
+    const uint64_t sizes[6] = { 1, 2, 5, 64, 1000, 4096 };
+
+    for (uint64_t th = 0; th < 3; th++)
+    {
+        omp_set_num_threads(threads[th]);
+        for (uint64_t s = 0; s < 6; s++)
+        {
+            // den is a permutation of num, since 7 is coprime with every size, so that the grand product
+            // closes to one, as in the provers
+            const uint64_t N = sizes[s];
+            Polinomial num(N, FIELD_EXTENSION);
+            Polinomial den(N, FIELD_EXTENSION);
+            for (uint64_t i = 0; i < N; i++)
+            {
+                for (uint64_t d = 0; d < FIELD_EXTENSION; d++)
+                {
+                    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+                    num[i][d] = Goldilocks::fromU64(seed % GOLDILOCKS_PRIME);
+                }
+            }
+            for (uint64_t i = 0; i < N; i++)
+            {
+                Polinomial::copyElement(den, i, num, (i * 7 + 3) % N);
+            }
+
+            // Sequential reference, one inversion per row
+            Polinomial expected(N, FIELD_EXTENSION);
+            Polinomial denInv(1, FIELD_EXTENSION);
+            Goldilocks3::copy((Goldilocks3::Element *)expected[0], &Goldilocks3::one());
+            for (uint64_t i = 1; i < N; i++)
+            {
+                Goldilocks3::inv((Goldilocks3::Element *)denInv[0], (Goldilocks3::Element *)den[i - 1]);
+                Polinomial::mulElement(expected, i, expected, i - 1, num, i - 1);
+                Polinomial::mulElement(expected, i, expected, i, denInv, 0);
+            }
+
+            Polinomial z(N, FIELD_EXTENSION);
+            Polinomial::calculateZ(z, num, den);
+
+            for (uint64_t i = 0; i < N; i++)
+            {
+                for (uint64_t d = 0; d < FIELD_EXTENSION; d++)
+                {
+                    if (!Goldilocks::equal(z[i][d], expected[i][d]))
+                    {
+                        cerr << "Error: CalculateZTest() mismatch threads=" << threads[th] << " N=" << N << " i=" << i << " d=" << d << " got=" << fr.toString(z[i][d], 16) << " expected=" << fr.toString(expected[i][d], 16) << endl;
+                        errors++;
+                        i = N;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+    omp_set_num_threads(maxThreads);
+
+    cout << "CalculateZTest() done with errors=" << errors << endl;
+}
@@ -0,0 +1,8 @@
+#ifndef CALCULATE_Z_TEST_HPP
+#define CALCULATE_Z_TEST_HPP
+
+#include "goldilocks_base_field.hpp"
+
+void CalculateZTest (Goldilocks &fr);
+
+#endif
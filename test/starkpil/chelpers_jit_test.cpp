@@ -0,0 +1,171 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include "chelpers_jit_test.hpp"
+#include "chelpersJit.hpp"
+#include "rowTiles.hpp"
+#include "zkevmSteps.hpp"
+
+using namespace std;
+
+#define CHELPERS_JIT_TEST_NROWS 64 // Rows of the synthetic step, a multiple of the batch
+#define CHELPERS_JIT_TEST_NROWS_BATCH 4
+
+// Synthetic kernel, adding the first row of the batch plus one to every row of the batch, so that a row
+// computed twice, or not at all, shows up
+static void ChelpersJitTest_kernel (StepsParams &params, uint64_t i)
+{
+    for (uint64_t j = 0; j < CHELPERS_JIT_TEST_NROWS_BATCH; j++)
+    {
+        params.pols[i + j] = params.pols[i + j] + Goldilocks::fromU64(i + 1);
+    }
+}
+
+// Synthetic parser of the RowTiles test, adding up for row i, read at row r, the elements its ops read
+static Goldilocks::Element ChelpersJitTest_parser (const StepsParserArgs &parserArgs, const uint64_t *args, uint64_t r, const Goldilocks::Element *pols, const Goldilocks::Element *pConst, uint64_t numpols)
+{
+    Goldilocks::Element sum = Goldilocks::zero();
+    uint64_t i_args = 0;
+    for (uint64_t kk = 0; kk < parserArgs.nOps; kk++)
+    {
+        switch (parserArgs.pOps[kk])
+        {
+            case 0:
+                sum = sum + pols[args[i_args] + r * args[i_args + 1]];
+                i_args += 2;
+                break;
+            case 1:
+                sum = sum + pols[args[i_args] + ((r + args[i_args + 1]) % args[i_args + 2]) * args[i_args + 3]];
+                i_args += 4;
+                break;
+            case 2:
+                sum = sum + pConst[args[i_args] + r * numpols];
+                i_args += 1;
+                break;
+            default:
+                sum = sum + pConst[args[i_args] + ((r + args[i_args + 1]) % args[i_args + 2]) * numpols];
+                i_args += 3;
+                break;
+        }
+    }
+    return sum;
+}
+
+void ChelpersJitTest (Goldilocks &fr, const Config &config)
+{
+    uint64_t errors = 0;
+
+    // Every zkevm step computed by the parsers must have its kernel, generated at build time
+    map<string, ChelpersJitFunction> kernels;
+    ZkevmSteps zkevmSteps;
+    zkevmSteps.getJitKernels(kernels);
+    for (const char *step : {"step2prev", "step3prev", "step3", "step42ns", "step52ns"})
+    {
+        if ((kernels.find(step) == kernels.end()) || (kernels[step] == NULL))
+        {
+            cerr << "Error: ChelpersJitTest() found no kernel for " << step << endl;
+            errors++;
+        }
+    }
+
+    // ChelpersJit must run every batch of rows once, and leave the steps without a kernel, or with rows
+    // that are not a multiple of the batch, to the parsers
+    vector<Goldilocks::Element> pols(CHELPERS_JIT_TEST_NROWS, Goldilocks::zero());
+    vector<Goldilocks::Element> constants(CHELPERS_JIT_TEST_NROWS, Goldilocks::zero());
+    ConstantPolsStarks constPols(constants.data(), CHELPERS_JIT_TEST_NROWS, 1);
+    Polinomial dummy(1, FIELD_EXTENSION);
+    ZhInv zi;
+    StepsParams params = {pols.data(), &constPols, &constPols, dummy, dummy, dummy, zi, dummy, dummy, dummy, NULL, NULL, NULL};
+
+    ChelpersJit jit({{"test", ChelpersJitTest_kernel}}, CHELPERS_JIT_TEST_NROWS_BATCH);
+    if (jit.run("missing", params, CHELPERS_JIT_TEST_NROWS))
+    {
+        cerr << "Error: ChelpersJitTest() ran a step without a kernel" << endl;
+        errors++;
+    }
+    if (jit.run("test", params, CHELPERS_JIT_TEST_NROWS + 1))
+    {
+        cerr << "Error: ChelpersJitTest() ran a step with a partial batch" << endl;
+        errors++;
+    }
+    if (!jit.run("test", params, CHELPERS_JIT_TEST_NROWS))
+    {
+        cerr << "Error: ChelpersJitTest() failed running the synthetic step" << endl;
+        errors++;
+    }
+    for (uint64_t i = 0; i < CHELPERS_JIT_TEST_NROWS; i++)
+    {
+        Goldilocks::Element expected = Goldilocks::fromU64(i - (i % CHELPERS_JIT_TEST_NROWS_BATCH) + 1);
+        if (!Goldilocks::equal(pols[i], expected))
+        {
+            cerr << "Error: ChelpersJitTest() mismatch row=" << i << " got=" << fr.toString(pols[i], 16) << " expected=" << fr.toString(expected, 16) << endl;
+            errors++;
+            break;
+        }
+    }
+
+    // The arguments rewritten by RowTiles must read the same rows from the tiles as the original ones from the
+    // sections: two sections of pols, with their rows and their next rows, and the constant pols
+    const uint64_t nrows = CHELPERS_JIT_TEST_NROWS;
+    const uint64_t nextRows = 2;
+    const uint64_t rowSizeA = 3, rowSizeB = 2, numpols = 4;
+    const uint64_t offsetA = 5, offsetB = offsetA + nrows * rowSizeA;
+    vector<Goldilocks::Element> tilePols(offsetB + nrows * rowSizeB);
+    vector<Goldilocks::Element> tileConst(nrows * numpols);
+    for (uint64_t j = 0; j < tilePols.size(); j++)
+    {
+        tilePols[j] = Goldilocks::fromU64(j * 7 + 1);
+    }
+    for (uint64_t j = 0; j < tileConst.size(); j++)
+    {
+        tileConst[j] = Goldilocks::fromU64(j * 13 + 5);
+    }
+    RowTiles tiles(nrows, nextRows, 4096, CHELPERS_JIT_TEST_NROWS_BATCH, {{&tilePols[offsetA], rowSizeA}, {tileConst.data(), numpols}, {&tilePols[offsetB], rowSizeB}});
+    const char *const opcodeArgs[] = {"PS", "PHNS", "C", "CHN"};
+    const uint64_t ops[] = {0, 1, 2, 3, 0, 1};
+    const uint64_t args[] = {offsetA + 1, rowSizeA, offsetB, nextRows, nrows, rowSizeB, 3, 1, nextRows, nrows, offsetB + 1, rowSizeB, offsetA + 2, 0, nrows, rowSizeA};
+    StepsParserArgs parserArgs = {ops, 6, args, 16, opcodeArgs, 4};
+    RowTilesArgs tileArgs;
+    string reason;
+    if (!tiles.remapArgs(parserArgs, tilePols.data(), tileConst.data(), tileArgs, reason))
+    {
+        cerr << "Error: ChelpersJitTest() failed rewriting the arguments for the tiles: " << reason << endl;
+        errors++;
+    }
+    else
+    {
+        vector<Goldilocks::Element> sums(nrows, Goldilocks::zero());
+        tiles.run(CHELPERS_JIT_TEST_NROWS_BATCH, [&](uint64_t i, Goldilocks::Element *pScratch) {
+            for (uint64_t j = 0; j < CHELPERS_JIT_TEST_NROWS_BATCH; j++)
+            {
+                sums[i + j] = ChelpersJitTest_parser(parserArgs, tileArgs.args.data(), (i % tiles.tileRows) + j, pScratch, &pScratch[tileArgs.constOffset], numpols);
+            }
+        });
+        for (uint64_t i = 0; i < nrows; i++)
+        {
+            Goldilocks::Element expected = ChelpersJitTest_parser(parserArgs, args, i, tilePols.data(), tileConst.data(), numpols);
+            if (!Goldilocks::equal(sums[i], expected))
+            {
+                cerr << "Error: ChelpersJitTest() mismatch in the tiles row=" << i << " got=" << fr.toString(sums[i], 16) << " expected=" << fr.toString(expected, 16) << endl;
+                errors++;
+                break;
+            }
+        }
+    }
+
+    // The reads that are not in the tiles must be rejected
+    const char *const badOpcodeArgs[] = {"WS", "PS", "PHNS"};
+    const uint64_t badArgs[][4] = {{offsetA, rowSizeA, 0, 0}, {offsetA, rowSizeB, 0, 0}, {offsetB, nextRows + 1, nrows, rowSizeB}, {0, rowSizeA, 0, 0}};
+    const uint64_t badOps[] = {0, 1, 2, 1};
+    for (uint64_t b = 0; b < 4; b++)
+    {
+        StepsParserArgs badParserArgs = {&badOps[b], 1, badArgs[b], (b == 2) ? 4u : 2u, badOpcodeArgs, 3};
+        if (tiles.remapArgs(badParserArgs, tilePols.data(), tileConst.data(), tileArgs, reason))
+        {
+            cerr << "Error: ChelpersJitTest() rewrote the arguments of the bad case=" << b << " for the tiles" << endl;
+            errors++;
+        }
+    }
+
+    cout << "ChelpersJitTest() done with errors=" << errors << endl;
+}
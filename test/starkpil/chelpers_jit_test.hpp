@@ -0,0 +1,9 @@
+#ifndef CHELPERS_JIT_TEST_HPP
+#define CHELPERS_JIT_TEST_HPP
+
+#include "goldilocks_base_field.hpp"
+#include "config.hpp"
+
+void ChelpersJitTest (Goldilocks &fr, const Config &config);
+
+#endif
@@ -0,0 +1,130 @@
+#include <iostream>
+#include <vector>
+#include <omp.h>
+#include "fri_fold_test.hpp"
+#include "friFold.hpp"
+
+using namespace std;
+
+// Cubic extension multiplication, modulo x^3 - x - 1
+static void FRIFoldTest_mul3 (Goldilocks::Element *c, const Goldilocks::Element *a, const Goldilocks::Element *b)
+{
+    Goldilocks::Element r[3] = { Goldilocks::zero(), Goldilocks::zero(), Goldilocks::zero() };
+    for (uint64_t i = 0; i < 3; i++)
+    {
+        for (uint64_t j = 0; j < 3; j++)
+        {
+            Goldilocks::Element p = a[i] * b[j];
+            uint64_t k = i + j;
+            if (k < 3)
+            {
+                r[k] = r[k] + p;
+            }
+            else
+            {
+                r[k - 3] = r[k - 3] + p;
+                r[k - 2] = r[k - 2] + p;
+            }
+        }
+    }
+    c[0] = r[0];
+    c[1] = r[1];
+    c[2] = r[2];
+}
+
+// Reference fold, as FRIProve did it before FRIFold: for every group, a plain inverse DFT of its nX
+// elements, coefficients multiplied by 1, sinv, sinv^2..., and evaluated at specialX
+static void FRIFoldTest_reference (const vector<Goldilocks::Element> &pol, uint64_t polBits, uint64_t reductionBits, const Goldilocks::Element &shiftInv, const Goldilocks::Element *specialX, vector<Goldilocks::Element> &result)
+{
+    const uint64_t nX = 1ULL << reductionBits;
+    const uint64_t pol2N = 1ULL << (polBits - reductionBits);
+    const Goldilocks::Element wi = Goldilocks::inv(Goldilocks::w(polBits));
+    const Goldilocks::Element wnInv = Goldilocks::inv(Goldilocks::w(reductionBits));
+    const Goldilocks::Element nXInv = Goldilocks::inv(Goldilocks::fromU64(nX));
+
+    vector<Goldilocks::Element> wnInvPowers(nX);
+    wnInvPowers[0] = Goldilocks::one();
+    for (uint64_t i = 1; i < nX; i++) wnInvPowers[i] = wnInvPowers[i - 1] * wnInv;
+
+    result.resize(pol2N * 3);
+    Goldilocks::Element sinv = shiftInv;
+    vector<Goldilocks::Element> coefs(nX * 3);
+    for (uint64_t g = 0; g < pol2N; g++)
+    {
+        Goldilocks::Element sinvPower = Goldilocks::one();
+        for (uint64_t k = 0; k < nX; k++)
+        {
+            for (uint64_t d = 0; d < 3; d++)
+            {
+                Goldilocks::Element sum = Goldilocks::zero();
+                for (uint64_t i = 0; i < nX; i++)
+                {
+                    sum = sum + pol[(i * pol2N + g) * 3 + d] * wnInvPowers[(i * k) % nX];
+                }
+                coefs[k * 3 + d] = sum * nXInv * sinvPower;
+            }
+            sinvPower = sinvPower * sinv;
+        }
+
+        Goldilocks::Element acc[3] = { Goldilocks::zero(), Goldilocks::zero(), Goldilocks::zero() };
+        Goldilocks::Element xPower[3] = { Goldilocks::one(), Goldilocks::zero(), Goldilocks::zero() };
+        for (uint64_t k = 0; k < nX; k++)
+        {
+            Goldilocks::Element term[3];
+            FRIFoldTest_mul3(term, &coefs[k * 3], xPower);
+            for (uint64_t d = 0; d < 3; d++) acc[d] = acc[d] + term[d];
+            FRIFoldTest_mul3(xPower, xPower, specialX);
+        }
+        for (uint64_t d = 0; d < 3; d++) result[g * 3 + d] = acc[d];
+        sinv = sinv * wi;
+    }
+}
+
+void FRIFoldTest (Goldilocks &fr)
+{
+    uint64_t errors = 0;
+    uint64_t seed = 0x0123456789ABCDEFULL;
+    const Goldilocks::Element shiftInv = Goldilocks::inv(Goldilocks::shift());
+    const uint64_t maxThreads = omp_get_max_threads();
+    const uint64_t threads[3] = { 1, 3, maxThreads };
+
+    // Fewer groups than lanes, groups that are not a multiple of the lanes, and several threads
+    for (uint64_t t = 0; t < 3; t++)
+    {
+        omp_set_num_threads(threads[t]);
+        for (uint64_t polBits = 1; polBits <= 9; polBits++)
+        {
+            for (uint64_t reductionBits = 1; (reductionBits <= polBits) && (reductionBits <= 5); reductionBits++)
+            {
+                vector<Goldilocks::Element> pol((1ULL << polBits) * 3);
+                for (uint64_t i = 0; i < pol.size(); i++)
+                {
+                    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+                    pol[i] = Goldilocks::fromU64(seed % GOLDILOCKS_PRIME);
+                }
+                Goldilocks::Element specialX[3];
+                for (uint64_t d = 0; d < 3; d++)
+                {
+                    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+                    specialX[d] = Goldilocks::fromU64(seed % GOLDILOCKS_PRIME);
+                }
+
+                vector<Goldilocks::Element> expected;
+                FRIFoldTest_reference(pol, polBits, reductionBits, shiftInv, specialX, expected);
+                FRIFold::fold(pol.data(), polBits, reductionBits, shiftInv, specialX);
+                for (uint64_t i = 0; i < expected.size(); i++)
+                {
+                    if (!Goldilocks::equal(pol[i], expected[i]))
+                    {
+                        cerr << "Error: FRIFoldTest() mismatch threads=" << threads[t] << " polBits=" << polBits << " reductionBits=" << reductionBits << " i=" << i << " got=" << fr.toString(pol[i], 16) << " expected=" << fr.toString(expected[i], 16) << endl;
+                        errors++;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+    omp_set_num_threads(maxThreads);
+
+    cout << "FRIFoldTest() done with errors=" << errors << endl;
+}
@@ -0,0 +1,8 @@
+#ifndef FRI_FOLD_TEST_HPP
+#define FRI_FOLD_TEST_HPP
+
+#include "goldilocks_base_field.hpp"
+
+void FRIFoldTest (Goldilocks &fr);
+
+#endif
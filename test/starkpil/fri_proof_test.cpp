@@ -0,0 +1,189 @@
+#include <iostream>
+#include <fstream>
+#include <cstdio>
+#include "fri_proof_test.hpp"
+#include "friProof.hpp"
+#include "proof2zkinStark.hpp"
+
+using namespace std;
+
+// Overwrites the 64-bit word at the given byte offset of a file
+static void FRIProofTest_patchU64 (const string &fileName, uint64_t offset, uint64_t value)
+{
+    fstream file(fileName, ios::in | ios::out | ios::binary);
+    file.seekp(offset);
+    file.write((const char *)&value, sizeof(value));
+}
+
+void FRIProofTest (Goldilocks &fr, const Config &config)
+{
+    uint64_t errors = 0;
+    const string fileName = config.outputPath + "/fri_proof_test.proof.bin";
+    const string patchedFileName = config.outputPath + "/fri_proof_test_patched.proof.bin";
+
+    // Proof with 2 steps: 2 trees of widths 5 and 2 with 3 siblings, and 1 tree of width 6 with 2 siblings
+    const uint64_t nQueries = 3;
+    FRIProof proof(8, 3, 2, 5, 4);
+    uint64_t c = 1;
+    for (uint64_t i = 0; i < HASH_SIZE; i++)
+    {
+        proof.proofs.root1[i] = Goldilocks::fromU64(c++);
+        proof.proofs.root2[i] = Goldilocks::fromU64(c++);
+        proof.proofs.root3[i] = Goldilocks::fromU64(c++);
+        proof.proofs.root4[i] = Goldilocks::fromU64(c++);
+        proof.proofs.fri.trees[0].root[i] = Goldilocks::fromU64(c++);
+        proof.proofs.fri.trees[1].root[i] = Goldilocks::fromU64(c++);
+    }
+    for (uint64_t i = 0; i < proof.proofs.evals.size(); i++)
+        for (uint64_t j = 0; j < proof.proofs.evals[i].size(); j++)
+            proof.proofs.evals[i][j] = Goldilocks::fromU64(c++);
+    for (uint64_t i = 0; i < proof.proofs.fri.pol.size(); i++)
+        for (uint64_t j = 0; j < proof.proofs.fri.pol[i].size(); j++)
+            proof.proofs.fri.pol[i][j] = Goldilocks::fromU64(c++);
+    for (uint64_t i = 0; i < proof.publics.size(); i++)
+        proof.publics[i] = Goldilocks::fromU64(c++);
+
+    const uint64_t widths0[2] = { 5, 2 };
+    proof.proofs.fri.trees[0].polQueries.resize(nQueries, 2);
+    proof.proofs.fri.trees[1].polQueries.resize(nQueries, 1);
+    const uint64_t arenaSize = nQueries * (5 + 2 + 2 * 3 * HASH_SIZE) + nQueries * (6 + 2 * HASH_SIZE);
+    Goldilocks::Element *pArena = proof.proofs.fri.allocQueriesArena(arenaSize);
+    for (uint64_t i = 0; i < arenaSize; i++) pArena[i] = Goldilocks::fromU64(1000 + i);
+    uint64_t offset = 0;
+    for (uint64_t q = 0; q < nQueries; q++)
+    {
+        for (uint64_t t = 0; t < 2; t++)
+        {
+            proof.proofs.fri.trees[0].polQueries[q][t] = MerkleProof(widths0[t], 3, pArena + offset);
+            offset += widths0[t] + 3 * HASH_SIZE;
+        }
+    }
+    for (uint64_t q = 0; q < nQueries; q++)
+    {
+        proof.proofs.fri.trees[1].polQueries[q][0] = MerkleProof(6, 2, pArena + offset);
+        offset += 6 + 2 * HASH_SIZE;
+    }
+
+    // Round trip through the binary file, compared through the JSON proof
+    proof2file(proof, fileName);
+    if (!FRIProof::isBinaryFile(fileName))
+    {
+        cerr << "Error: FRIProofTest() isBinaryFile() returned false for " << fileName << endl;
+        errors++;
+    }
+    FRIProof *pLoaded = file2proof(fileName);
+    if (pLoaded == NULL)
+    {
+        cerr << "Error: FRIProofTest() file2proof() failed loading " << fileName << endl;
+        errors++;
+    }
+    else
+    {
+        if (pLoaded->proofs.proof2json().dump() != proof.proofs.proof2json().dump())
+        {
+            cerr << "Error: FRIProofTest() loaded proof does not match the saved one" << endl;
+            errors++;
+        }
+        for (uint64_t i = 0; i < proof.publics.size(); i++)
+        {
+            if (!Goldilocks::equal(pLoaded->publics[i], proof.publics[i]))
+            {
+                cerr << "Error: FRIProofTest() loaded publics[" << i << "]=" << fr.toString(pLoaded->publics[i]) << " expected=" << fr.toString(proof.publics[i]) << endl;
+                errors++;
+            }
+        }
+        delete pLoaded;
+    }
+
+    // Headers whose sizes only fit the file when their products overflow must be rejected.  The header
+    // is the magic, then version, polN, dim, numSteps, evalSize, nPublics, arenaSize, and then nQueries
+    // and nTrees of every step, all of them 64-bit words
+    struct Patch
+    {
+        uint64_t word;
+        uint64_t value;
+    };
+    const Patch patches[4][2] = {
+        { { 2, 1ULL << 62 }, { 3, 4 } },  // polN * dim
+        { { 5, 1ULL << 62 }, { 3, 4 } },  // evalSize * dim
+        { { 8, 1ULL << 61 }, { 9, 4 } },  // nQueries * nTrees * 3 * 8
+        { { 8, 1 }, { 9, 1ULL << 63 } }   // nTrees alone
+    };
+    for (uint64_t p = 0; p < 4; p++)
+    {
+        {
+            ifstream src(fileName, ios::binary);
+            ofstream dst(patchedFileName, ios::binary);
+            dst << src.rdbuf();
+        }
+        for (uint64_t k = 0; k < 2; k++)
+        {
+            FRIProofTest_patchU64(patchedFileName, patches[p][k].word * sizeof(uint64_t), patches[p][k].value);
+        }
+        FRIProof *pPatched = file2proof(patchedFileName);
+        if (pPatched != NULL)
+        {
+            cerr << "Error: FRIProofTest() file2proof() accepted patched header p=" << p << endl;
+            errors++;
+            delete pPatched;
+        }
+    }
+
+    // Truncated file
+    {
+        ifstream src(fileName, ios::binary);
+        string data((istreambuf_iterator<char>(src)), istreambuf_iterator<char>());
+        ofstream dst(patchedFileName, ios::binary | ios::trunc);
+        dst.write(data.data(), data.size() - sizeof(uint64_t));
+    }
+    FRIProof *pTruncated = file2proof(patchedFileName);
+    if (pTruncated != NULL)
+    {
+        cerr << "Error: FRIProofTest() file2proof() accepted a truncated file" << endl;
+        errors++;
+        delete pTruncated;
+    }
+
+    remove(fileName.c_str());
+    remove(patchedFileName.c_str());
+
+    // proof2zkinStark() needs the 5 trees of step 0, 1 tree in the next steps and the same shape of
+    // every tree in all the queries
+    if (checkProofShape(proof, 2))
+    {
+        cerr << "Error: FRIProofTest() checkProofShape() accepted 2 trees in step 0" << endl;
+        errors++;
+    }
+    FRIProof shaped(8, 3, 2, 5, 4);
+    shaped.proofs.fri.trees[0].polQueries.resize(nQueries, 5);
+    shaped.proofs.fri.trees[1].polQueries.resize(nQueries, 1);
+    Goldilocks::Element *pShapedArena = shaped.proofs.fri.allocQueriesArena(6 + 2 * HASH_SIZE);
+    for (uint64_t q = 0; q < nQueries; q++)
+    {
+        for (uint64_t t = 0; t < 5; t++)
+        {
+            shaped.proofs.fri.trees[0].polQueries[q][t] = MerkleProof(t, 2, pShapedArena);
+        }
+        shaped.proofs.fri.trees[1].polQueries[q][0] = MerkleProof(6, 2, pShapedArena);
+    }
+    if (!checkProofShape(shaped, 2) || checkProofShape(shaped, 3))
+    {
+        cerr << "Error: FRIProofTest() checkProofShape() failed checking the number of steps" << endl;
+        errors++;
+    }
+    shaped.proofs.fri.trees[1].polQueries[nQueries - 1][0] = MerkleProof(6, 3, pShapedArena);
+    if (checkProofShape(shaped, 2))
+    {
+        cerr << "Error: FRIProofTest() checkProofShape() accepted queries of different shapes" << endl;
+        errors++;
+    }
+    shaped.proofs.fri.trees[1].polQueries[nQueries - 1][0] = MerkleProof(6, 2, pShapedArena);
+    shaped.proofs.fri.trees[0].polQueries.resize(0, 5);
+    if (checkProofShape(shaped, 2))
+    {
+        cerr << "Error: FRIProofTest() checkProofShape() accepted a proof without queries" << endl;
+        errors++;
+    }
+
+    cout << "FRIProofTest() done with errors=" << errors << endl;
+}
@@ -0,0 +1,9 @@
+#ifndef FRI_PROOF_TEST_HPP
+#define FRI_PROOF_TEST_HPP
+
+#include "goldilocks_base_field.hpp"
+#include "config.hpp"
+
+void FRIProofTest (Goldilocks &fr, const Config &config);
+
+#endif
@@ -0,0 +1,103 @@
+#include <iostream>
+#include <vector>
+#include <map>
+#include <algorithm>
+#include <omp.h>
+#include "h1h2_test.hpp"
+#include "h1h2.hpp"
+#include "polinomial.hpp"
+
+using namespace std;
+
+// Reference h1/h2, as the std::map based Polinomial::calculateH1H2() computed them: t and f sorted by
+// the row of t of every value, the last one for f values, and distributed alternately
+static void H1H2Test_reference (vector<Goldilocks::Element> &h1, vector<Goldilocks::Element> &h2, Polinomial &fPol, Polinomial &tPol)
+{
+    const uint64_t N = tPol.degree();
+    const uint64_t dim = tPol.dim();
+    map<vector<uint64_t>, uint64_t> lastRow;
+    for (uint64_t i = 0; i < N; i++)
+    {
+        vector<uint64_t> key(dim);
+        for (uint64_t d = 0; d < dim; d++) key[d] = Goldilocks::toU64(tPol[i][d]);
+        lastRow[key] = i;
+    }
+    vector<uint64_t> rows(N);
+    for (uint64_t i = 0; i < N; i++) rows[i] = i;
+    for (uint64_t i = 0; i < N; i++)
+    {
+        vector<uint64_t> key(dim);
+        for (uint64_t d = 0; d < dim; d++) key[d] = Goldilocks::toU64(fPol[i][d]);
+        rows.push_back(lastRow[key]);
+    }
+    sort(rows.begin(), rows.end());
+    h1.resize(N * dim);
+    h2.resize(N * dim);
+    for (uint64_t p = 0; p < 2 * N; p++)
+    {
+        for (uint64_t d = 0; d < dim; d++)
+        {
+            ((p & 1) ? h2 : h1)[(p >> 1) * dim + d] = tPol[rows[p]][d];
+        }
+    }
+}
+
+void H1H2Test (Goldilocks &fr)
+{
+    uint64_t errors = 0;
+    uint64_t seed = 0x0123456789ABCDEFULL;
+    const uint64_t maxThreads = omp_get_max_threads();
+    const uint64_t threads[2] = { 1, maxThreads };
+    const uint64_t sizes[5] = { 1, 7, 64, 1000, 4096 };
+
+    for (uint64_t th = 0; th < 2; th++)
+    {
+        omp_set_num_threads(threads[th]);
+        for (uint64_t dim = 1; dim <= 3; dim += 2)
+        {
+            for (uint64_t s = 0; s < 5; s++)
+            {
+                // Columns with a stride larger than their dimension, as in the committed sections; t has
+                // repeated values, and f has runs of the same value
+                const uint64_t N = sizes[s];
+                const uint64_t stride = dim + 2;
+                vector<Goldilocks::Element> columns(4 * N * stride, Goldilocks::zero());
+                Polinomial fPol(&columns[0], N, dim, stride);
+                Polinomial tPol(&columns[N * stride], N, dim, stride);
+                Polinomial h1(&columns[2 * N * stride], N, dim, stride);
+                Polinomial h2(&columns[3 * N * stride], N, dim, stride);
+                const uint64_t nValues = N / 3 + 1;
+                for (uint64_t i = 0; i < N; i++)
+                {
+                    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+                    for (uint64_t d = 0; d < dim; d++) tPol[i][d] = Goldilocks::fromU64(((seed >> 16) % nValues) * (d + 1));
+                }
+                for (uint64_t i = 0; i < N; i++)
+                {
+                    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+                    uint64_t row = ((i > 0) && (seed % 4 == 0)) ? i - 1 : (seed >> 16) % N;
+                    for (uint64_t d = 0; d < dim; d++) fPol[i][d] = tPol[row][d];
+                }
+
+                vector<Goldilocks::Element> expectedH1, expectedH2;
+                H1H2Test_reference(expectedH1, expectedH2, fPol, tPol);
+
+                vector<uint64_t> buffer(H1H2::getBufferSize(N));
+                H1H2::calculate(h1, h2, fPol, tPol, 0, buffer.data(), buffer.size());
+
+                for (uint64_t i = 0; i < N * dim; i++)
+                {
+                    if (!Goldilocks::equal(h1[i / dim][i % dim], expectedH1[i]) || !Goldilocks::equal(h2[i / dim][i % dim], expectedH2[i]))
+                    {
+                        cerr << "Error: H1H2Test() mismatch threads=" << threads[th] << " dim=" << dim << " N=" << N << " row=" << i / dim << " h1=" << fr.toString(h1[i / dim][i % dim]) << " expected=" << fr.toString(expectedH1[i]) << " h2=" << fr.toString(h2[i / dim][i % dim]) << " expected=" << fr.toString(expectedH2[i]) << endl;
+                        errors++;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+    omp_set_num_threads(maxThreads);
+
+    cout << "H1H2Test() done with errors=" << errors << endl;
+}
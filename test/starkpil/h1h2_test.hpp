@@ -0,0 +1,8 @@
+#ifndef H1H2_TEST_HPP
+#define H1H2_TEST_HPP
+
+#include "goldilocks_base_field.hpp"
+
+void H1H2Test (Goldilocks &fr);
+
+#endif
@@ -0,0 +1,74 @@
+#include <iostream>
+#include <vector>
+#include "lde_merkle_test.hpp"
+#include "ldeMerkle.hpp"
+
+using namespace std;
+
+void LDEMerkleTest (Goldilocks &fr)
+{
+    uint64_t errors = 0;
+    uint64_t seed = 0x0123456789ABCDEFULL;
+    const uint64_t blowups[2] = { 2, 4 };
+    const uint64_t sizes[5] = { 2, 4, 64, 256, 1024 };
+    const uint64_t widths[3] = { 1, 3, 13 };
+
+    for (uint64_t b = 0; b < 2; b++)
+    {
+        for (uint64_t s = 0; s < 5; s++)
+        {
+            for (uint64_t w = 0; w < 3; w++)
+            {
+                const uint64_t R = blowups[b];
+                const uint64_t N = sizes[s];
+                const uint64_t NExtended = N * R;
+                const uint64_t ncols = widths[w];
+                if (N < R) continue;
+
+                vector<Goldilocks::Element> src(N * ncols);
+                for (uint64_t i = 0; i < src.size(); i++)
+                {
+                    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+                    src[i] = Goldilocks::fromU64(seed % GOLDILOCKS_PRIME);
+                }
+
+                // Reference: extension of the whole stage followed by the merkelization of the result
+                NTT_Goldilocks ntt(N);
+                vector<Goldilocks::Element> expected(NExtended * ncols);
+                MerkleTreeGL expectedTree(NExtended, ncols, expected.data());
+                ntt.extendPol(expected.data(), src.data(), NExtended, N, ncols, NULL);
+                expectedTree.merkelize();
+
+                vector<Goldilocks::Element> dst(NExtended * ncols);
+                MerkleTreeGL tree(NExtended, ncols, dst.data());
+                LDEMerkle::extendAndMerkelize(ntt, tree, dst.data(), src.data(), NExtended, N, ncols, NULL);
+
+                for (uint64_t i = 0; i < dst.size(); i++)
+                {
+                    if (!Goldilocks::equal(dst[i], expected[i]))
+                    {
+                        cerr << "Error: LDEMerkleTest() extended mismatch R=" << R << " N=" << N << " ncols=" << ncols << " i=" << i << " got=" << fr.toString(dst[i], 16) << " expected=" << fr.toString(expected[i], 16) << endl;
+                        errors++;
+                        break;
+                    }
+                }
+
+                Goldilocks::Element root[4];
+                Goldilocks::Element expectedRoot[4];
+                tree.getRoot(root);
+                expectedTree.getRoot(expectedRoot);
+                for (uint64_t i = 0; i < 4; i++)
+                {
+                    if (!Goldilocks::equal(root[i], expectedRoot[i]))
+                    {
+                        cerr << "Error: LDEMerkleTest() root mismatch R=" << R << " N=" << N << " ncols=" << ncols << " i=" << i << " got=" << fr.toString(root[i], 16) << " expected=" << fr.toString(expectedRoot[i], 16) << endl;
+                        errors++;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    cout << "LDEMerkleTest() done with errors=" << errors << endl;
+}
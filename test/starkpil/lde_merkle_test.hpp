@@ -0,0 +1,8 @@
+#ifndef LDE_MERKLE_TEST_HPP
+#define LDE_MERKLE_TEST_HPP
+
+#include "goldilocks_base_field.hpp"
+
+void LDEMerkleTest (Goldilocks &fr);
+
+#endif
@@ -0,0 +1,70 @@
+#include <iostream>
+#include <vector>
+#include "poseidon_lanes_test.hpp"
+#include "poseidon_goldilocks.hpp"
+#include "poseidon_goldilocks_lanes.hpp"
+
+using namespace std;
+
+void PoseidonLanesTest (Goldilocks &fr)
+{
+    uint64_t errors = 0;
+    const uint64_t lanes = PoseidonGoldilocksLanes::lanes();
+    cout << "PoseidonLanesTest() lanes=" << lanes << endl;
+
+    // Some inputs are built from values above the prime, which may be kept non-canonical by fromU64()
+    const uint64_t maxSize = 4 * RATE + 3;
+    const uint64_t inputStride = maxSize + 5;
+    const uint64_t outputStride = CAPACITY + 3;
+    vector<Goldilocks::Element> input(lanes * inputStride);
+    uint64_t seed = 0x0123456789ABCDEFULL;
+    for (uint64_t i = 0; i < input.size(); i++)
+    {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        input[i] = (i % 7 == 0) ? Goldilocks::fromU64(0xFFFFFFFF00000001ULL + (seed % 0xFFFFFFFFULL)) : Goldilocks::fromU64(seed);
+    }
+
+    // Every size, including the ones that are copied instead of hashed and the ones with a partial last rate
+    for (uint64_t size = 0; size <= maxSize; size++)
+    {
+        vector<Goldilocks::Element> output(lanes * outputStride);
+        PoseidonGoldilocksLanes::linear_hash(output.data(), outputStride, input.data(), inputStride, size);
+        for (uint64_t l = 0; l < lanes; l++)
+        {
+            Goldilocks::Element expected[CAPACITY];
+            PoseidonGoldilocks::linear_hash(expected, &input[l * inputStride], size);
+            for (uint64_t k = 0; k < CAPACITY; k++)
+            {
+                if (!Goldilocks::equal(output[l * outputStride + k], expected[k]))
+                {
+                    cerr << "Error: PoseidonLanesTest() mismatch for size=" << size << " lane=" << l << " k=" << k << " got=" << fr.toString(output[l * outputStride + k], 16) << " expected=" << fr.toString(expected[k], 16) << endl;
+                    errors++;
+                }
+            }
+        }
+    }
+
+    // Hashing RATE elements is a permutation of a zero capacity, as the Merkle tree nodes use it
+    vector<Goldilocks::Element> output(lanes * CAPACITY);
+    PoseidonGoldilocksLanes::linear_hash(output.data(), CAPACITY, input.data(), RATE, RATE);
+    for (uint64_t l = 0; l < lanes; l++)
+    {
+        Goldilocks::Element state[SPONGE_WIDTH];
+        for (uint64_t k = 0; k < SPONGE_WIDTH; k++)
+        {
+            state[k] = (k < RATE) ? input[l * RATE + k] : Goldilocks::zero();
+        }
+        Goldilocks::Element expected[CAPACITY];
+        PoseidonGoldilocks::hash(expected, state);
+        for (uint64_t k = 0; k < CAPACITY; k++)
+        {
+            if (!Goldilocks::equal(output[l * CAPACITY + k], expected[k]))
+            {
+                cerr << "Error: PoseidonLanesTest() hash mismatch for lane=" << l << " k=" << k << endl;
+                errors++;
+            }
+        }
+    }
+
+    cout << "PoseidonLanesTest done with errors=" << errors << endl;
+}
@@ -0,0 +1,8 @@
+#ifndef POSEIDON_LANES_TEST_HPP
+#define POSEIDON_LANES_TEST_HPP
+
+#include "goldilocks_base_field.hpp"
+
+void PoseidonLanesTest (Goldilocks &fr);
+
+#endif
@@ -0,0 +1,273 @@
+#include <iostream>
+#include <vector>
+#include "poseidon_opt_test.hpp"
+#include "poseidon_opt.hpp"
+#include "merkleTreeBN128.hpp"
+#include "transcriptBN128.hpp"
+
+using namespace std;
+
+// Partial rounds per width, as used by Poseidon_opt
+static const unsigned int PoseidonOptTest_nRoundsP[16] = {56, 57, 56, 60, 60, 63, 64, 63, 60, 66, 60, 65, 70, 60, 64, 68};
+
+static void PoseidonOptTest_exp5 (RawFr &field, RawFr::Element &r)
+{
+    RawFr::Element aux = r;
+    field.square(r, r);
+    field.square(r, r);
+    field.mul(r, r, aux);
+}
+
+static void PoseidonOptTest_mix (RawFr &field, vector<RawFr::Element> &state, const vector<vector<RawFr::Element>> &m)
+{
+    const uint64_t t = state.size();
+    vector<RawFr::Element> newState(t);
+    for (uint64_t i = 0; i < t; i++)
+    {
+        newState[i] = field.zero();
+        for (uint64_t j = 0; j < t; j++)
+        {
+            RawFr::Element mji = m[j][i];
+            field.mul(mji, mji, state[j]);
+            field.add(newState[i], newState[i], mji);
+        }
+    }
+    state = newState;
+}
+
+// Reference implementation, the vector based Poseidon_opt::hash() that the fixed-width hash replaced
+static void PoseidonOptTest_reference (RawFr &field, vector<RawFr::Element> &state)
+{
+    const uint64_t t = state.size();
+    const uint64_t nRoundsF = 8;
+    const uint64_t nRoundsP = PoseidonOptTest_nRoundsP[t - 2];
+    const vector<RawFr::Element> &c = Constants_opt::C[t - 2];
+    const vector<RawFr::Element> &s = Constants_opt::S[t - 2];
+    const vector<vector<RawFr::Element>> &m = Constants_opt::M[t - 2];
+    const vector<vector<RawFr::Element>> &p = Constants_opt::P[t - 2];
+
+    for (uint64_t i = 0; i < t; i++) field.add(state[i], state[i], c[i]);
+    for (uint64_t r = 0; r < nRoundsF / 2; r++)
+    {
+        for (uint64_t i = 0; i < t; i++)
+        {
+            PoseidonOptTest_exp5(field, state[i]);
+            field.add(state[i], state[i], c[(r + 1) * t + i]);
+        }
+        PoseidonOptTest_mix(field, state, (r < nRoundsF / 2 - 1) ? m : p);
+    }
+    for (uint64_t r = 0; r < nRoundsP; r++)
+    {
+        PoseidonOptTest_exp5(field, state[0]);
+        field.add(state[0], state[0], c[(nRoundsF / 2 + 1) * t + r]);
+        RawFr::Element s0 = field.zero();
+        RawFr::Element aux;
+        for (uint64_t j = 0; j < t; j++)
+        {
+            field.mul(aux, s[(t * 2 - 1) * r + j], state[j]);
+            field.add(s0, s0, aux);
+            if (j > 0)
+            {
+                field.mul(aux, state[0], s[(t * 2 - 1) * r + t + j - 1]);
+                field.add(state[j], state[j], aux);
+            }
+        }
+        state[0] = s0;
+    }
+    for (uint64_t r = 0; r < nRoundsF / 2 - 1; r++)
+    {
+        for (uint64_t i = 0; i < t; i++)
+        {
+            PoseidonOptTest_exp5(field, state[i]);
+            field.add(state[i], state[i], c[(nRoundsF / 2 + 1) * t + nRoundsP + r * t + i]);
+        }
+        PoseidonOptTest_mix(field, state, m);
+    }
+    for (uint64_t i = 0; i < t; i++) PoseidonOptTest_exp5(field, state[i]);
+    PoseidonOptTest_mix(field, state, m);
+}
+
+// Reference MerkleTreeBN128 root, built as linearHash() and merkelize() did with the reference hash
+static RawFr::Element PoseidonOptTest_referenceRoot (RawFr &field, const vector<Goldilocks::Element> &source, uint64_t height, uint64_t sourceWidth)
+{
+    vector<RawFr::Element> level(height, field.zero());
+    for (uint64_t i = 0; i < height; i++)
+    {
+        if (sourceWidth <= 4)
+        {
+            for (uint64_t k = 0; k < sourceWidth; k++) level[i].v[k] = Goldilocks::toU64(source[i * sourceWidth + k]);
+            field.toMontgomery(level[i], level[i]);
+            continue;
+        }
+        vector<RawFr::Element> row;
+        for (uint64_t j = 0; j < sourceWidth; j += GOLDILOCKS_ELEMENTS)
+        {
+            RawFr::Element e = field.zero();
+            for (uint64_t k = 0; (k < GOLDILOCKS_ELEMENTS) && (j + k < sourceWidth); k++) e.v[k] = Goldilocks::toU64(source[i * sourceWidth + j + k]);
+            field.toMontgomery(e, e);
+            row.push_back(e);
+        }
+        for (uint64_t j = 0; j < row.size(); j += 16)
+        {
+            uint64_t n = min<uint64_t>(16, row.size() - j);
+            vector<RawFr::Element> state(n + 1);
+            state[0] = level[i];
+            for (uint64_t k = 0; k < n; k++) state[k + 1] = row[j + k];
+            PoseidonOptTest_reference(field, state);
+            level[i] = state[0];
+        }
+    }
+    while (level.size() > 1)
+    {
+        vector<RawFr::Element> next;
+        for (uint64_t i = 0; i < level.size(); i += 16)
+        {
+            vector<RawFr::Element> state(17, field.zero());
+            for (uint64_t k = 0; (k < 16) && (i + k < level.size()); k++) state[k + 1] = level[i + k];
+            PoseidonOptTest_reference(field, state);
+            next.push_back(state[0]);
+        }
+        level = next;
+    }
+    return level[0];
+}
+
+void PoseidonOptTest (Goldilocks &fr)
+{
+    uint64_t errors = 0;
+    RawFr field;
+    Poseidon_opt poseidon;
+
+    // Known vectors: circomlib poseidon([1,2]) and poseidon([1,2,3,4]), i.e. widths 3 and 5 with a zero capacity
+    const char *inputs[2] = { "1,2", "1,2,3,4" };
+    const char *expected[2] = { "7853200120776062878684798364095072458815029376092732009249414926327459813530",
+                                "18821383157269793795438455681495246036402687001665670618754263018637548127333" };
+    for (uint64_t v = 0; v < 2; v++)
+    {
+        vector<RawFr::Element> state(1, field.zero());
+        string s = inputs[v];
+        for (uint64_t i = 0; i < s.size(); i += 2)
+        {
+            RawFr::Element e;
+            field.fromUI(e, s[i] - '0');
+            state.push_back(e);
+        }
+        RawFr::Element result;
+        poseidon.hash(state, &result);
+        if (field.toString(result, 10) != expected[v])
+        {
+            cerr << "Error: PoseidonOptTest() poseidon([" << inputs[v] << "])=" << field.toString(result, 10) << " expected=" << expected[v] << endl;
+            errors++;
+        }
+    }
+
+    // Every width, with pseudo-random states, hashed by the vector API, by the runtime width API and by
+    // the multi-lane hash, against the reference implementation
+    const unsigned int lanes = POSEIDON_OPT_LANES;
+    uint64_t seed = 0x0123456789ABCDEFULL;
+    for (unsigned int t = 2; t <= 17; t++)
+    {
+        vector<vector<RawFr::Element>> states(lanes, vector<RawFr::Element>(t));
+        vector<RawFr::Element> laneStates(lanes * t);
+        for (unsigned int l = 0; l < lanes; l++)
+        {
+            for (unsigned int i = 0; i < t; i++)
+            {
+                seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+                RawFr::Element e;
+                field.fromString(e, to_string(seed) + to_string(seed >> 7) + to_string(seed >> 13) + to_string(seed >> 29), 10);
+                states[l][i] = e;
+                laneStates[l * t + i] = e;
+            }
+        }
+        poseidon.hash<lanes>(laneStates.data(), t);
+        for (unsigned int l = 0; l < lanes; l++)
+        {
+            vector<RawFr::Element> reference = states[l];
+            PoseidonOptTest_reference(field, reference);
+
+            vector<RawFr::Element> state = states[l];
+            poseidon.hash(state);
+
+            for (unsigned int i = 0; i < t; i++)
+            {
+                if (!field.eq(state[i], reference[i]) || !field.eq(laneStates[l * t + i], reference[i]))
+                {
+                    cerr << "Error: PoseidonOptTest() mismatch t=" << t << " lane=" << l << " i=" << i << " got=" << field.toString(state[i], 16) << " lanes got=" << field.toString(laneStates[l * t + i], 16) << " expected=" << field.toString(reference[i], 16) << endl;
+                    errors++;
+                }
+            }
+        }
+    }
+
+    // MerkleTreeBN128 roots, for widths that are hashed directly, in one call and in several calls, and for
+    // heights with one or several levels
+    const uint64_t widths[6] = { 3, 4, 5, 48, 50, 100 };
+    const uint64_t heights[4] = { 16, 32, 256, 512 };
+    for (uint64_t w = 0; w < 6; w++)
+    {
+        for (uint64_t h = 0; h < 4; h++)
+        {
+            vector<Goldilocks::Element> source(heights[h] * widths[w]);
+            for (uint64_t i = 0; i < source.size(); i++)
+            {
+                seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+                source[i] = Goldilocks::fromU64(seed % GOLDILOCKS_PRIME);
+            }
+            MerkleTreeBN128 tree(heights[h], widths[w]);
+            tree.initialize(source.data());
+            RawFr::Element root;
+            tree.getRoot(&root);
+            RawFr::Element expectedRoot = PoseidonOptTest_referenceRoot(field, source, heights[h], widths[w]);
+            if (!field.eq(root, expectedRoot))
+            {
+                cerr << "Error: PoseidonOptTest() MerkleTreeBN128 width=" << widths[w] << " height=" << heights[h] << " root=" << field.toString(root, 16) << " expected=" << field.toString(expectedRoot, 16) << endl;
+                errors++;
+            }
+        }
+    }
+
+    // TranscriptBN128: 20 inputs update the state once when 16 are pending, and once more, zero padded, when
+    // the first field is read
+    Goldilocks::Element transcriptInput[20];
+    vector<RawFr::Element> first(17, field.zero());
+    vector<RawFr::Element> second(17, field.zero());
+    for (uint64_t i = 0; i < 20; i++)
+    {
+        transcriptInput[i] = Goldilocks::fromU64(i * 0x9E3779B97F4A7C15ULL % GOLDILOCKS_PRIME);
+        RawFr::Element e = field.zero();
+        e.v[0] = Goldilocks::toU64(transcriptInput[i]);
+        field.toMontgomery(e, e);
+        if (i < 16) first[i + 1] = e;
+        else second[i - 16 + 1] = e;
+    }
+    PoseidonOptTest_reference(field, first);
+    second[0] = first[0];
+    PoseidonOptTest_reference(field, second);
+
+    TranscriptBN128 transcript;
+    transcript.put(transcriptInput, 20);
+    for (uint64_t f = 0; f < 2; f++)
+    {
+        uint64_t fields[3];
+        transcript.getField(fields);
+        RawFr::Element expectedField;
+        field.fromMontgomery(expectedField, second[f]);
+        for (uint64_t k = 0; k < 3; k++)
+        {
+            if (fields[k] != expectedField.v[k])
+            {
+                cerr << "Error: PoseidonOptTest() TranscriptBN128 field=" << f << " k=" << k << " got=" << fields[k] << " expected=" << expectedField.v[k] << endl;
+                errors++;
+            }
+        }
+    }
+    RawFr::Element field253 = transcript.getFields253();
+    if (!field.eq(field253, second[2]))
+    {
+        cerr << "Error: PoseidonOptTest() TranscriptBN128 getFields253()=" << field.toString(field253, 16) << " expected=" << field.toString(second[2], 16) << endl;
+        errors++;
+    }
+
+    cout << "PoseidonOptTest() done with errors=" << errors << endl;
+}
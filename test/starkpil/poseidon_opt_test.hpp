@@ -0,0 +1,8 @@
+#ifndef POSEIDON_OPT_TEST_HPP
+#define POSEIDON_OPT_TEST_HPP
+
+#include "goldilocks_base_field.hpp"
+
+void PoseidonOptTest (Goldilocks &fr);
+
+#endif
@@ -0,0 +1,138 @@
+#include <iostream>
+#include <cstring>
+#include "zkin_test.hpp"
+#include "zkin.hpp"
+
+using namespace std;
+
+static uint64_t zkinCompare (const Zkin &a, const Zkin &b)
+{
+    if ((a.signals.size() != b.signals.size()) || (a.values.size() != b.values.size()))
+    {
+        return 1;
+    }
+    for (uint64_t i = 0; i < a.signals.size(); i++)
+    {
+        if ((a.signals[i].name != b.signals[i].name) ||
+            (a.signals[i].shape != b.signals[i].shape) ||
+            (a.signals[i].offset != b.signals[i].offset) ||
+            (a.signals[i].size != b.signals[i].size))
+        {
+            return 1;
+        }
+    }
+    for (uint64_t i = 0; i < a.values.size(); i++)
+    {
+        if (Goldilocks::toU64(a.values[i]) != Goldilocks::toU64(b.values[i]))
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static void replaceU64 (string &data, uint64_t pos, uint64_t value)
+{
+    memcpy(&data[pos], &value, sizeof(uint64_t));
+}
+
+void ZkinTest (Goldilocks &fr)
+{
+    uint64_t errors = 0;
+
+    // Zkin with a scalar, a vector, a matrix and an empty signal
+    Zkin zkin;
+    Goldilocks::Element *pScalar = zkin.add("scalar", {});
+    pScalar[0] = Goldilocks::fromU64(7);
+    Goldilocks::Element *pVector = zkin.add("vector", {5});
+    for (uint64_t i = 0; i < 5; i++) pVector[i] = Goldilocks::fromU64(1000 + i);
+    Goldilocks::Element *pMatrix = zkin.add("matrix", {3, 4});
+    for (uint64_t i = 0; i < 12; i++) pMatrix[i] = Goldilocks::fromU64(0xFFFFFFFF00000000ULL - i);
+    zkin.add("empty", {0});
+
+    // Binary round trip
+    string data;
+    zkin.serialize(data);
+    Zkin zkinBinary;
+    if (!zkinBinary.deserialize(data) || (zkinCompare(zkin, zkinBinary) != 0))
+    {
+        cerr << "Error: ZkinTest() binary round trip failed" << endl;
+        errors++;
+    }
+
+    // JSON round trip
+    ordered_json j;
+    zkin.toJson(j);
+    Zkin zkinJson;
+    zkinJson.fromJson(j);
+    if (zkinCompare(zkin, zkinJson) != 0)
+    {
+        cerr << "Error: ZkinTest() JSON round trip failed" << endl;
+        errors++;
+    }
+
+    // Ragged JSON arrays must be rejected
+    ordered_json jRagged = ordered_json::parse("{\"ragged\": [[\"1\",\"2\"],[\"3\"]]}");
+    bool bThrown = false;
+    try
+    {
+        Zkin zkinRagged;
+        zkinRagged.fromJson(jRagged);
+    }
+    catch (std::exception &e)
+    {
+        bThrown = true;
+    }
+    if (!bThrown)
+    {
+        cerr << "Error: ZkinTest() accepted a ragged JSON array" << endl;
+        errors++;
+    }
+
+    // Offsets of the first signal, "scalar": magic(4) version(8) nSignals(8) nameSize(8) name(6) nDims(8)
+    uint64_t scalarSizePos = 4 + 8 + 8 + 8 + 6 + 8;
+    // Offsets of the second signal, "vector": nameSize(8) name(6) nDims(8) shape[0](8) size(8)
+    uint64_t vectorPos = scalarSizePos + 8 + 8;
+    uint64_t vectorShapePos = vectorPos + 8 + 6 + 8;
+    uint64_t vectorSizePos = vectorShapePos + 8;
+
+    // Size not matching the shape must be rejected
+    string corrupt = data;
+    replaceU64(corrupt, vectorSizePos, 4);
+    Zkin zkinCorrupt;
+    if (zkinCorrupt.deserialize(corrupt))
+    {
+        cerr << "Error: ZkinTest() accepted a signal whose size does not match its shape" << endl;
+        errors++;
+    }
+
+    // Shapes and sizes whose byte length overflows must be rejected
+    corrupt = data;
+    replaceU64(corrupt, vectorShapePos, 0x2000000000000001ULL);
+    replaceU64(corrupt, vectorSizePos, 0x2000000000000001ULL);
+    if (zkinCorrupt.deserialize(corrupt))
+    {
+        cerr << "Error: ZkinTest() accepted a signal size that overflows" << endl;
+        errors++;
+    }
+    corrupt = data;
+    replaceU64(corrupt, vectorPos, 0xFFFFFFFFFFFFFFF0ULL);
+    if (zkinCorrupt.deserialize(corrupt))
+    {
+        cerr << "Error: ZkinTest() accepted a name size that overflows" << endl;
+        errors++;
+    }
+
+    // Every truncation must be rejected
+    for (uint64_t size = 0; size < data.size(); size++)
+    {
+        if (zkinCorrupt.deserialize(data.substr(0, size)))
+        {
+            cerr << "Error: ZkinTest() accepted a zkin truncated to " << size << " bytes" << endl;
+            errors++;
+            break;
+        }
+    }
+
+    cout << "ZkinTest done with errors=" << errors << endl;
+}
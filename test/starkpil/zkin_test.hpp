@@ -0,0 +1,8 @@
+#ifndef ZKIN_TEST_HPP
+#define ZKIN_TEST_HPP
+
+#include "goldilocks_base_field.hpp"
+
+void ZkinTest (Goldilocks &fr);
+
+#endif
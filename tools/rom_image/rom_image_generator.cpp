@@ -0,0 +1,28 @@
+#include "rom_image_generator.hpp"
+#include "rom_image.hpp"
+#include "main_sm/fork_4/main/rom.hpp"
+#include "sm/keccak_f/keccak_f_executor.hpp"
+#include "utils.hpp"
+#include "timer.hpp"
+
+void RomImageGenerate (Goldilocks &fr, const Config &config)
+{
+    TimerStart(ROM_IMAGE_GENERATE);
+
+    // Main SM ROM, loaded from this path by MainExecutor
+    string romFileName = "src/main_sm/fork_4/scripts/rom.json";
+    json romJson;
+    file2json(romFileName, romJson);
+    fork_4::Rom rom(config);
+    rom.load(fr, romJson);
+    rom.saveImage(fr, romImageFileName(romFileName), romFileName);
+
+    // Keccak-F script
+    KeccakFExecutor keccakFExecutor(fr, config);
+    json keccakJson;
+    file2json(config.keccakScriptFile, keccakJson);
+    keccakFExecutor.loadScript(keccakJson);
+    keccakFExecutor.saveImage(romImageFileName(config.keccakScriptFile));
+
+    TimerStopAndLog(ROM_IMAGE_GENERATE);
+}
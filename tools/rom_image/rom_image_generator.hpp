@@ -0,0 +1,10 @@
+#ifndef ROM_IMAGE_GENERATOR_HPP
+#define ROM_IMAGE_GENERATOR_HPP
+
+#include "goldilocks_base_field.hpp"
+#include "config.hpp"
+
+/* Generates the binary images of the main SM ROM and of the Keccak-F script, next to their JSON files */
+void RomImageGenerate (Goldilocks &fr, const Config &config);
+
+#endif
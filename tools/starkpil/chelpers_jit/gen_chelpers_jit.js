@@ -0,0 +1,358 @@
+// Generates at build time the kernels of ChelpersJit (src/starkpil/chelpersJit.hpp) from the chelpers parsers:
+// for every step, a function computing a batch of rows with the code of the opcode of every op of the step, one
+// after the other, and the arguments of every op turned into literal constants, so that nothing is left to
+// dispatch or load at run time.  The code of every opcode is taken from the parser, with its arguments replaced
+// by $0, $1..., and the ops and arguments from the op and args arrays of the parser header.
+//
+// For the steps read in tiles, it also generates the kind of every argument of every opcode, so that RowTiles can
+// rewrite the addresses of the args arrays into its scratch buffer.
+//
+// Last, it widens the AVX2 parsers and kernels, which compute 4 rows per batch, to 8 rows per batch with AVX-512, in
+// the <steps class>Avx512 subclass.  They read the same op and args arrays as the AVX2 parsers, and are compiled with
+// -mavx512f into a library of their own, which the prover only loads on the CPUs that support it.
+//
+// Usage: node gen_chelpers_jit.js <chelpers dir> <prefix> <steps class> <output dir>
+// e.g.   node tools/starkpil/chelpers_jit/gen_chelpers_jit.js src/starkpil/zkevm/chelpers zkevm ZkevmSteps build/chelpers/gen
+// writes <output dir>/<prefix>.chelpers.jit.cpp, <output dir>/<prefix>.chelpers.args.cpp and
+// <output dir>/<prefix>.chelpers.avx512.cpp
+const fs = require("fs");
+const path = require("path");
+
+const steps = ["step2prev", "step3prev", "step3", "step42ns", "step52ns"];
+const tiledSteps = ["step42ns", "step52ns"]; // Steps whose parsers can read the rows in tiles, see RowTiles
+
+function fail(message) {
+    console.error("Error: gen_chelpers_jit.js " + message);
+    process.exit(1);
+}
+
+function readDefine(header, name, fileName) {
+    const match = header.match(new RegExp("#define " + name + " (\\d+)"));
+    if (!match) fail("could not find " + name + " in " + fileName);
+    return Number(match[1]);
+}
+
+// Removes the indentation common to all the lines
+function dedent(lines) {
+    const indent = Math.min(...lines.map(line => line.match(/^ */)[0].length));
+    return lines.map(line => line.slice(indent));
+}
+
+// Returns the index of the line closing the brace opened at line first
+function closingLine(lines, first) {
+    let depth = 0;
+    for (let l = first; l < lines.length; l++) {
+        for (const c of lines[l]) {
+            if (c == "{") depth++;
+            if (c == "}") {
+                depth--;
+                if (depth == 0) return l;
+            }
+        }
+    }
+    fail("unbalanced braces from line " + (first + 1));
+}
+
+// Returns the lines of the function whose definition starts with signature, up to the brace closing its body
+function functionText(lines, signature, fileName) {
+    const first = lines.findIndex(line => line.startsWith(signature));
+    if (first < 0) fail("could not find " + signature + " in " + fileName);
+    return lines.slice(first, closingLine(lines, first) + 1).join("\n") + "\n";
+}
+
+// Turns the 4-row AVX2 code of the parsers into the same code computing 8 rows with AVX-512: the _avx
+// functions and types become the _avx512 ones, Goldilocks::load/store become load_avx512/store_avx512,
+// __m256i becomes __m512i, and the per-row arrays are sized NR_
+function widen(code, where) {
+    const result = code
+        .replace(/\[4\]/g, "[NR_]")
+        .replace(/\b(\w+)_avx\b/g, "$1_avx512")
+        .replace(/\b__m256i\b/g, "__m512i")
+        .replace(/\b_mm256_setzero_si256\b/g, "_mm512_setzero_si512")
+        .replace(/\bGoldilocks::(load|store)\b/g, "Goldilocks::$1_avx512");
+    const left = result.match(/\b(\w*_avx|_mm256\w*|__m256\w*)\b/);
+    if (left) fail("could not widen " + left[0] + " in " + where);
+    return result;
+}
+
+// Returns the values of the array name defined in header
+function readArray(header, name, fileName) {
+    const match = header.match(new RegExp("uint64_t " + name + "\\[\\w+\\] = \\{([^}]*)\\}"));
+    if (!match) fail("could not find " + name + " in " + fileName);
+    return match[1].split(",").map(value => value.trim().replace(/ULL$/, "")).filter(value => value != "").map(value => {
+        if (!/^\d+$/.test(value)) fail("unexpected value " + value + " of " + name + " in " + fileName);
+        return value;
+    });
+}
+
+function parseStep(dir, prefix, stepsClass, step) {
+    const cppFile = path.join(dir, prefix + ".chelpers." + step + ".parser.cpp");
+    const hppFile = path.join(dir, prefix + ".chelpers." + step + ".parser.hpp");
+    const header = fs.readFileSync(hppFile, "utf8");
+    const lines = fs.readFileSync(cppFile, "utf8").split("\n");
+
+    const nOps = readDefine(header, "NOPS_", hppFile);
+    const nArgs = readDefine(header, "NARGS_", hppFile);
+    const nTemp1 = header.includes("#define NTEMP1_") ? readDefine(header, "NTEMP1_", hppFile) : 0;
+    const nTemp3 = header.includes("#define NTEMP3_") ? readDefine(header, "NTEMP3_", hppFile) : 0;
+
+    // The steps read in tiles compute every batch of rows in a function of their own, which reads the pols and the
+    // constant pols at row r from pols and pConstPols2ns, and the arguments from args; the rest do it in the loop of
+    // their parser
+    let l = lines.findIndex(line => line.startsWith("static void " + step + "_parser_batch_avx("));
+    const bBatch = (l >= 0);
+    let batchArgsName = null;
+    if (bBatch) {
+        const callMatch = lines.join("\n").match(new RegExp(step + "_parser_batch_avx\\(params, i, i, params\\.pols, params\\.pConstPols2ns, (\\w+)\\);"));
+        if (!callMatch) fail("could not find the call to " + step + "_parser_batch_avx in " + cppFile);
+        batchArgsName = callMatch[1];
+    } else {
+        l = lines.findIndex(line => line.includes("void " + stepsClass + "::" + step + "_parser_first_avx("));
+        if (l < 0) fail("could not find " + step + "_parser_first_avx in " + cppFile);
+        while (!lines[l].includes("i += nrowsBatch")) l++;
+    }
+    while (lines[l].trim() != "{") l++;
+    const loopBegin = l + 1;
+    while (!lines[l].includes("for (int kk = 0; kk < NOPS_; ++kk)")) l++;
+    const loopKk = l;
+
+    // Variables of every batch of rows, except the index of the arguments
+    const prologue = lines.slice(loopBegin, loopKk).filter(line => {
+        const t = line.trim();
+        return (t != "") && !t.startsWith("//") && !t.startsWith("int i_args");
+    });
+
+    while (!lines[l].includes("switch (")) l++;
+    const switchMatch = lines[l].match(/switch \((\w+)\[kk\]\)/);
+    if (!switchMatch) fail("unexpected switch in line " + (l + 1) + " of " + cppFile);
+    const opsName = switchMatch[1];
+    const switchEnd = closingLine(lines, l);
+
+    let argsName = null;
+    const opcodes = [];
+    for (; l < switchEnd; l++) {
+        const caseMatch = lines[l].match(/^\s*case (\d+):\s*$/);
+        if (!caseMatch) continue;
+        const opcode = Number(caseMatch[1]);
+        if (opcode != opcodes.length) fail("unexpected case " + opcode + " in line " + (l + 1) + " of " + cppFile);
+        const bodyBegin = l + 1;
+        if (lines[bodyBegin].trim() != "{") fail("case without braces in line " + (l + 1) + " of " + cppFile);
+        const bodyEnd = closingLine(lines, bodyBegin);
+
+        let offset = 0;
+        const code = [];
+        for (const line of lines.slice(bodyBegin + 1, bodyEnd)) {
+            const t = line.trim();
+            if ((t == "") || t.startsWith("//") || (t == "break;")) continue;
+            const incMatch = t.match(/^i_args \+= (\d+);$/);
+            if (incMatch) {
+                offset += Number(incMatch[1]);
+                continue;
+            }
+            const replaced = line.replace(/(\w+)\[i_args( \+ (\d+))?\]/g, (all, name, plus, k) => {
+                if (argsName === null) argsName = name;
+                if (name != argsName) fail("unexpected arguments " + name + " in " + cppFile);
+                return "$" + (offset + (k === undefined ? 0 : Number(k)));
+            });
+            if (replaced.includes("i_args")) fail("unexpected use of i_args in: " + t);
+            code.push(replaced.trimEnd());
+        }
+        opcodes.push({ nArgs: offset, code: "{\n" + dedent(code).map(line => "    " + line).join("\n") + "\n}\n" });
+        l = bodyEnd;
+    }
+    if (opcodes.length == 0) fail("no opcodes found in " + cppFile);
+
+    if (argsName === null) fail("no arguments found in " + cppFile);
+    if (bBatch && (argsName != "args")) fail("unexpected arguments " + argsName + " in " + step + "_parser_batch_avx of " + cppFile);
+    const ops = readArray(header, opsName, hppFile);
+    const args = readArray(header, bBatch ? batchArgsName : argsName, hppFile);
+    if (ops.length != nOps) fail("found " + ops.length + " ops instead of " + nOps + " in " + hppFile);
+    if (args.length != nArgs) fail("found " + args.length + " arguments instead of " + nArgs + " in " + hppFile);
+
+    // The AVX2 parser of the step, with the batch function and the parser in tiles of the steps read in tiles
+    const avxSignatures = bBatch ? ["static void " + step + "_parser_batch_avx(", "void " + stepsClass + "::" + step + "_parser_first_avx(", "void " + stepsClass + "::" + step + "_parser_first_avx_tiles("]
+                                 : ["void " + stepsClass + "::" + step + "_parser_first_avx("];
+    const avxParser = avxSignatures.map(signature => functionText(lines, signature, cppFile)).join("\n");
+
+    return { step, bBatch, opsName, argsName: bBatch ? batchArgsName : argsName, ops, args, nTemp1, nTemp3, prologue: dedent(prologue).join("\n") + "\n", opcodes, avxParser };
+}
+
+// Returns the kinds of the arguments of every opcode of a step read in tiles, for RowTiles::remapArgs(), as a string
+// with a character per argument: 'P' offset in the pols of a row read, 'S' its row size, 'C' column of the constant
+// pols, 'H' row shift and 'N' rows of the domain of the previous 'P' or 'C', 'W' offset in the pols of a row written,
+// and '-' anything else.  It fails if an opcode reads the pols or the constant pols in any other way, which would
+// bypass the tiles
+function argKinds(s) {
+    if (!s.bBatch) fail(s.step + " is read in tiles, but has no " + s.step + "_parser_batch_avx");
+    const patterns = [
+        [/pols\[\$(\d+) \+ r \* \$(\d+)\]/g, "PS"],
+        [/pConstPols2ns->getElement\(\$(\d+), r\)/g, "C"],
+        [/pConstPols2ns->getElement\(\d+, r\)/g, ""],
+        [/offsets\d\[j\] = \$(\d+) \+ \(\(\(r \+ j\) \+ \$(\d+)\) % \$(\d+)\) \* \$(\d+);/g, "PHNS"],
+        [/offsets\d\[j\] = \$(\d+) \+ \(\(\(r \+ j\) \+ \$(\d+)\) % \$(\d+)\) \* numpols;/g, "CHN"],
+        [/offsets\d\[j\] = \$(\d+) \+ \(r \+ j\) \* \$(\d+);/g, "PS"],
+        [/offsets\d\[j\] = \$(\d+) \+ \(r \+ j\) \* numpols;/g, "C"],
+        [/pols\[0\]/g, ""],
+        [/pConstPols2ns->getElement\(0, 0\)/g, ""],
+        [/pConstPols2ns->numPols\(\)/g, ""],
+    ];
+    return s.opcodes.map((opcode, n) => {
+        const where = "opcode " + n + " of " + s.step;
+        const kinds = new Array(opcode.nArgs).fill("-");
+        let code = opcode.code;
+        if (/\bparams\.(pols|pConstPols|pConstPols2ns)\b/.test(code)) fail("found pols read outside of the tiles in " + where);
+        // The first argument of the Goldilocks functions is the result
+        const bWrite = /^\s*[\w:]+\(&?\(?(pols\b|pConstPols2ns\b)/m.test(code);
+        for (const [pattern, patternKinds] of patterns) {
+            code = code.replace(pattern, (all, ...groups) => {
+                for (let g = 0; g < patternKinds.length; g++) {
+                    const k = Number(groups[g]);
+                    if ((kinds[k] != "-") && (kinds[k] != patternKinds[g])) fail("argument $" + k + " is both " + kinds[k] + " and " + patternKinds[g] + " in " + where);
+                    kinds[k] = patternKinds[g];
+                }
+                return "ADDRESS";
+            });
+        }
+        const left = code.match(/\b(r|pols|pConstPols2ns)\b.*/);
+        if (left) fail("unexpected read of the pols in " + where + ": " + left[0].trim());
+        return bWrite ? kinds.join("").replace(/P/g, "W") : kinds.join("");
+    });
+}
+
+// Returns the kernel of the step: its prologue, and then the code of the opcode of every op with the values
+// of its arguments
+function generateKernel(s) {
+    let out = "";
+    out += "static void " + s.step + "_jit(StepsParams &params, uint64_t i)\n";
+    out += "{\n";
+    out += "#define NTEMP1_ " + s.nTemp1 + "\n";
+    out += "#define NTEMP3_ " + s.nTemp3 + "\n";
+    if (s.bBatch) {
+        out += "    uint64_t r = i;\n";
+        out += "    Goldilocks::Element *pols = params.pols;\n";
+        out += "    ConstantPolsStarks *pConstPols2ns = params.pConstPols2ns;\n";
+    }
+    out += s.prologue.split("\n").map(line => (line == "") ? line : "    " + line).join("\n");
+    let iArgs = 0;
+    for (let kk = 0; kk < s.ops.length; kk++) {
+        const opcode = s.opcodes[Number(s.ops[kk])];
+        if (opcode === undefined) fail("invalid opcode " + s.ops[kk] + " at op " + kk + " of " + s.step);
+        if (iArgs + opcode.nArgs > s.args.length) fail("ran out of arguments at op " + kk + " of " + s.step);
+        const code = opcode.code.replace(/\$(\d+)/g, (all, k) => {
+            if (Number(k) >= opcode.nArgs) fail("invalid argument $" + k + " in opcode " + s.ops[kk] + " of " + s.step);
+            return "((uint64_t)" + s.args[iArgs + Number(k)] + "ULL)";
+        });
+        out += code.split("\n").map(line => (line == "") ? line : "    " + line).join("\n");
+        iArgs += opcode.nArgs;
+    }
+    if (iArgs != s.args.length) fail("used " + iArgs + " arguments instead of " + s.args.length + " in " + s.step);
+    out += "#undef NTEMP1_\n";
+    out += "#undef NTEMP3_\n";
+    out += "}\n\n";
+    return out;
+}
+
+// Returns the AVX2 parser of the step widened to AVX-512 as the parser of the Avx512 subclass of the steps class, which
+// overrides the AVX2 one and reads the same op and args arrays, defined by the parser header
+function generateAvx512Parser(s, stepsClass) {
+    let out = "";
+    out += "extern uint64_t " + s.opsName + "[" + s.ops.length + "];\n";
+    out += "extern uint64_t " + s.argsName + "[" + s.args.length + "];\n\n";
+    out += "#define NOPS_ " + s.ops.length + "\n";
+    out += "#define NARGS_ " + s.args.length + "\n";
+    out += "#define NTEMP1_ " + s.nTemp1 + "\n";
+    out += "#define NTEMP3_ " + s.nTemp3 + "\n\n";
+    out += widen(s.avxParser, s.step)
+        .split(stepsClass + "::").join(stepsClass + "Avx512::")
+        .replace(/_parser_first_avx512\(/g, "_parser_first_avx(");
+    out += "\n";
+    out += "#undef NOPS_\n";
+    out += "#undef NARGS_\n";
+    out += "#undef NTEMP1_\n";
+    out += "#undef NTEMP3_\n\n";
+    return out;
+}
+
+function main() {
+    if (process.argv.length != 6) fail("usage: node gen_chelpers_jit.js <chelpers dir> <prefix> <steps class> <output dir>");
+    const [dir, prefix, stepsClass, outputDir] = process.argv.slice(2);
+
+    let out = "";
+    out += "// Generated by tools/starkpil/chelpers_jit/gen_chelpers_jit.js from the " + prefix + ".chelpers.*.parser files, do not edit\n";
+    out += "#include \"goldilocks_cubic_extension.hpp\"\n";
+    out += "#include \"zhInv.hpp\"\n";
+    out += "#include \"starks.hpp\"\n";
+    out += "#include \"constant_pols_starks.hpp\"\n";
+    out += "#include \"chelpersJit.hpp\"\n";
+    out += "#include \"" + prefix + "Steps.hpp\"\n";
+    out += "#include <immintrin.h>\n\n";
+    out += "#define NR_ 4\n\n";
+
+    let argsOut = "";
+    argsOut += "// Generated by tools/starkpil/chelpers_jit/gen_chelpers_jit.js from the " + prefix + ".chelpers.*.parser files, do not edit\n";
+    argsOut += "#include \"goldilocks_cubic_extension.hpp\"\n";
+    argsOut += "#include \"zhInv.hpp\"\n";
+    argsOut += "#include \"starks.hpp\"\n";
+    argsOut += "#include \"constant_pols_starks.hpp\"\n";
+    argsOut += "#include \"" + prefix + "Steps.hpp\"\n\n";
+
+    let avx512Out = "";
+    avx512Out += "// Generated by tools/starkpil/chelpers_jit/gen_chelpers_jit.js from the " + prefix + ".chelpers.*.parser files, do not edit\n";
+    avx512Out += "// Compiled with -mavx512f into a library of its own, only loaded by the prover on the CPUs that support it\n";
+    avx512Out += "#include \"goldilocks_cubic_extension.hpp\"\n";
+    avx512Out += "#include \"zhInv.hpp\"\n";
+    avx512Out += "#include \"starks.hpp\"\n";
+    avx512Out += "#include \"constant_pols_starks.hpp\"\n";
+    avx512Out += "#include \"chelpersJit.hpp\"\n";
+    avx512Out += "#include \"" + prefix + "Steps.hpp\"\n";
+    avx512Out += "#include <immintrin.h>\n\n";
+    avx512Out += "#define NR_ 8\n\n";
+
+    let kernels = "";
+    for (const step of steps) {
+        const s = parseStep(dir, prefix, stepsClass, step);
+        const kernel = generateKernel(s);
+        out += kernel;
+        kernels += "    kernels[\"" + step + "\"] = " + step + "_jit;\n";
+        avx512Out += generateAvx512Parser(s, stepsClass);
+        avx512Out += widen(kernel, step + "_jit");
+
+        if (tiledSteps.includes(step)) {
+            // The op and args arrays are defined by the parser headers, which can only be included once
+            argsOut += "extern uint64_t " + s.opsName + "[" + s.ops.length + "];\n";
+            argsOut += "extern uint64_t " + s.argsName + "[" + s.args.length + "];\n\n";
+            argsOut += "static const char *const " + step + "OpcodeArgs[] = {\n";
+            for (const kinds of argKinds(s)) {
+                argsOut += "    \"" + kinds + "\",\n";
+            }
+            argsOut += "};\n\n";
+            argsOut += "bool " + stepsClass + "::" + step + "_parser_args(StepsParserArgs &parserArgs)\n";
+            argsOut += "{\n";
+            argsOut += "    parserArgs = {" + s.opsName + ", " + s.ops.length + ", " + s.argsName + ", " + s.args.length + ", " + step + "OpcodeArgs, " + s.opcodes.length + "};\n";
+            argsOut += "    return true;\n";
+            argsOut += "}\n\n";
+        }
+    }
+    out += "void " + stepsClass + "::getJitKernels(std::map<std::string, ChelpersJitFunction> &kernels)\n";
+    out += "{\n";
+    out += "    kernels.clear();\n";
+    out += kernels;
+    out += "}\n";
+
+    avx512Out += "void " + stepsClass + "Avx512::getJitKernels(std::map<std::string, ChelpersJitFunction> &kernels)\n";
+    avx512Out += "{\n";
+    avx512Out += "    kernels.clear();\n";
+    avx512Out += kernels;
+    avx512Out += "}\n\n";
+    avx512Out += "extern \"C\" " + stepsClass + " *" + prefix + "StepsAvx512New(void)\n";
+    avx512Out += "{\n";
+    avx512Out += "    return new " + stepsClass + "Avx512();\n";
+    avx512Out += "}\n";
+
+    fs.mkdirSync(outputDir, { recursive: true });
+    fs.writeFileSync(path.join(outputDir, prefix + ".chelpers.jit.cpp"), out);
+    fs.writeFileSync(path.join(outputDir, prefix + ".chelpers.args.cpp"), argsOut);
+    fs.writeFileSync(path.join(outputDir, prefix + ".chelpers.avx512.cpp"), avx512Out);
+}
+
+main();